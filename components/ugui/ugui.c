@@ -48,6 +48,7 @@
 //  Oct 11, 2014  V0.1  First release.
 /* -------------------------------------------------------------------------------- */
 #include "ugui.h"
+#include <string.h>
 
 /* Static functions */
  UG_RESULT _UG_WindowDrawTitle( UG_WINDOW* wnd );
@@ -58,9 +59,27 @@
  void _UG_CheckboxUpdate(UG_WINDOW* wnd, UG_OBJECT* obj);
  void _UG_ImageUpdate(UG_WINDOW* wnd, UG_OBJECT* obj);
  void _UG_PutChar( char chr, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc, const UG_FONT* font);
+#ifdef USE_CONSOLE_SCROLL
+ void _UG_ConsoleScroll( UG_S16 dy );
+ void _UG_ConsoleMarkDirty( UG_S16 ys, UG_S16 ye );
+#endif
+ void _UG_PSetClipped( UG_S16 x, UG_S16 y, UG_COLOR c );
+ void _UG_DrawSpan( UG_S16 x1, UG_S16 x2, UG_S16 y, UG_COLOR c );
+ void _UG_PutCharSpan( UG_U16 g, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc, const UG_FONT* font, UG_S16 w );
+#ifdef USE_COLOR_RGB565
+ void _UG_BlendRow( UG_COLOR* dst, UG_S16 n, UG_U32 cc, UG_U32 ia );
+ UG_U32 _UG_Scale2( UG_U32 p, UG_U32 a );
+#endif
+#ifdef USE_CMDLIST
+ UG_CMD* _UG_CmdAlloc( UG_U8 type, UG_U16 text_len );
+#endif
 
  /* Pointer to the gui */
+#ifdef USE_GUI_PER_TASK
+static UG_TASK_LOCAL UG_GUI* gui;
+#else
 static UG_GUI* gui;
+#endif
 
 #ifdef USE_FONT_4X6
 __UG_FONT_DATA unsigned char font_4x6[256][6]={
@@ -3717,7 +3736,7 @@ __UG_FONT_DATA unsigned char font_16x26[256][52]={
 };
 #endif
 
-#ifdef USE_FONT_22X36
+#if defined(USE_FONT_22X36) && !defined(USE_FONT_SPAN_22X36)
 __UG_FONT_DATA unsigned char font_22x36[256][108]={
 {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x00
 {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0xC0,0xFF,0x00,0xF0,0xC0,0x03,0x38,0x00,0x07,0x1C,0x00,0x0E,0xCC,0xE1,0x0C,0xCE,0xE1,0x1C,0xC6,0xE1,0x18,0x06,0x00,0x18,0x06,0x00,0x18,0x26,0x00,0x19,0x66,0x80,0x19,0xCE,0xC0,0x1C,0x8C,0x7F,0x0C,0x1C,0x3F,0x0E,0x38,0x00,0x07,0xF0,0xC0,0x03,0xC0,0xFF,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x01
@@ -3978,7 +3997,7 @@ __UG_FONT_DATA unsigned char font_22x36[256][108]={
 };
 #endif
 
-#ifdef USE_FONT_24X40
+#if defined(USE_FONT_24X40) && !defined(USE_FONT_SPAN_24X40)
 __UG_FONT_DATA unsigned char font_24x40[256][120]={
 {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x00
 {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0xC0,0xFF,0x03,0xE0,0x81,0x07,0x70,0x00,0x0E,0x38,0x00,0x1C,0x1C,0x00,0x38,0x8C,0xC3,0x31,0x8E,0xC3,0x71,0x86,0xC3,0x61,0x06,0x00,0x60,0x06,0x00,0x60,0x66,0x00,0x66,0x46,0x00,0x62,0xCE,0x00,0x73,0x8C,0x81,0x31,0x1C,0xFF,0x38,0x38,0x7E,0x1C,0x70,0x00,0x0E,0xE0,0x81,0x07,0xC0,0xFF,0x03,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x01
@@ -4239,7 +4258,7 @@ __UG_FONT_DATA unsigned char font_24x40[256][120]={
 };
 #endif
 
-#ifdef USE_FONT_32X53
+#if defined(USE_FONT_32X53) && !defined(USE_FONT_SPAN_32X53)
 __UG_FONT_DATA unsigned char font_32x53[256][212]={
 {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},   // 0x00
 {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0xFC,0x3F,0x00,0x00,0xFF,0xFF,0x00,0x80,0x1F,0xF8,0x01,0xC0,0x03,0xC0,0x03,0xE0,0x01,0x80,0x07,0xF0,0x00,0x00,0x0F,0x70,0x00,0x00,0x0E,0x38,0x1C,0x38,0x1C,0x38,0x3E,0x7C,0x1C,0x3C,0x3E,0x7C,0x3C,0x1C,0x3E,0x7C,0x38,0x1C,0x1C,0x38,0x38,0x1C,0x00,0x00,0x38,0x1C,0x00,0x00,0x38,0x1C,0x00,0x00,0x38,0x1C,0x03,0xC0,0x38,0x3C,0x03,0xC0,0x3C,0x38,0x07,0xE0,0x1C,0x38,0x1E,0x78,0x1C,0x70,0xFC,0x3F,0x0E,0xF0,0xF8,0x1F,0x0F,0xE0,0xE1,0x87,0x07,0xC0,0x03,0xC0,0x03,0x80,0x1F,0xF8,0x01,0x00,0xFF,0xFF,0x00,0x00,0xFC,0x3F,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},   // 0x01
@@ -4543,14 +4562,29 @@ __UG_FONT_DATA unsigned char font_32x53[256][212]={
    const UG_FONT FONT_16X26 = {(unsigned char*)font_16x26,FONT_TYPE_1BPP,16,26,0,255,NULL};
 #endif
 #ifdef USE_FONT_22X36
+#ifdef USE_FONT_SPAN_22X36
+   extern __UG_FONT_DATA unsigned char font_22x36_span[];
+   const UG_FONT FONT_22X36 = {(unsigned char*)font_22x36_span,FONT_TYPE_SPAN,22,36,0,255,NULL};
+#else
    const UG_FONT FONT_22X36 = {(unsigned char*)font_22x36,FONT_TYPE_1BPP,22,36,0,255,NULL};
 #endif
+#endif
 #ifdef USE_FONT_24X40
+#ifdef USE_FONT_SPAN_24X40
+   extern __UG_FONT_DATA unsigned char font_24x40_span[];
+   const UG_FONT FONT_24X40 = {(unsigned char*)font_24x40_span,FONT_TYPE_SPAN,24,40,0,255,NULL};
+#else
    const UG_FONT FONT_24X40 = {(unsigned char*)font_24x40,FONT_TYPE_1BPP,24,40,0,255,NULL};
 #endif
+#endif
 #ifdef USE_FONT_32X53
+#ifdef USE_FONT_SPAN_32X53
+   extern __UG_FONT_DATA unsigned char font_32x53_span[];
+   const UG_FONT FONT_32X53 = {(unsigned char*)font_32x53_span,FONT_TYPE_SPAN,32,53,0,255,NULL};
+#else
    const UG_FONT FONT_32X53 = {(unsigned char*)font_32x53,FONT_TYPE_1BPP,32,53,0,255,NULL};
 #endif
+#endif
 
 
 
@@ -4559,14 +4593,31 @@ UG_S16 UG_Init( UG_GUI* g, void (*p)(UG_S16,UG_S16,UG_COLOR), UG_S16 x, UG_S16 y
    UG_U8 i;
 
    g->pset = (void(*)(UG_S16,UG_S16,UG_COLOR))p;
+   g->pset_unclipped = g->pset;
    g->x_dim = x;
    g->y_dim = y;
+   g->clip.xs = 0;
+   g->clip.ys = 0;
+   g->clip.xe = x - 1;
+   g->clip.ye = y - 1;
    g->console.x_start = 4;
    g->console.y_start = 4;
    g->console.x_end = g->x_dim - g->console.x_start-1;
    g->console.y_end = g->y_dim - g->console.x_start-1;
    g->console.x_pos = g->console.x_end;
    g->console.y_pos = g->console.y_end;
+   #ifdef USE_CONSOLE_SCROLL
+   g->console.scroll = 0;
+   g->console.head = 0;
+   g->console.lines = 0;
+   g->console.col = 0;
+   g->console.dirty_ys = -1;
+   g->console.dirty_ye = -1;
+   #endif
+   g->fb = NULL;
+   #ifdef USE_CMDLIST
+   g->cmdlist = NULL;
+   #endif
    g->char_h_space = 1;
    g->char_v_space = 1;
    g->font.p = NULL;
@@ -4635,6 +4686,26 @@ void UG_FillFrame( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c )
       y1 = n;
    }
 
+   #ifdef USE_CMDLIST
+   if ( gui->cmdlist != NULL )
+   {
+      UG_CMD* cmd = _UG_CmdAlloc(CMD_TYPE_FILL_FRAME, 0);
+      cmd->x1 = x1;
+      cmd->y1 = y1;
+      cmd->x2 = x2;
+      cmd->y2 = y2;
+      cmd->fc = c;
+      return;
+   }
+   #endif
+
+   /* Clip */
+   if ( x1 < gui->clip.xs ) x1 = gui->clip.xs;
+   if ( y1 < gui->clip.ys ) y1 = gui->clip.ys;
+   if ( x2 > gui->clip.xe ) x2 = gui->clip.xe;
+   if ( y2 > gui->clip.ye ) y2 = gui->clip.ye;
+   if ( x1 > x2 || y1 > y2 ) return;
+
    /* Is hardware acceleration available? */
    if ( gui->driver[DRIVER_FILL_FRAME].state & DRIVER_ENABLED )
    {
@@ -4645,7 +4716,7 @@ void UG_FillFrame( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c )
    {
       for( n=x1; n<=x2; n++ )
       {
-         gui->pset(n,m,c);
+         gui->pset_unclipped(n,m,c);
       }
    }
 }
@@ -4836,6 +4907,17 @@ void UG_DrawRoundFrame( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_S16 r, UG
 
 void UG_DrawPixel( UG_S16 x0, UG_S16 y0, UG_COLOR c )
 {
+   #ifdef USE_CMDLIST
+   if ( gui->cmdlist != NULL )
+   {
+      UG_CMD* cmd = _UG_CmdAlloc(CMD_TYPE_PIXEL, 0);
+      cmd->x1 = x0;
+      cmd->y1 = y0;
+      cmd->fc = c;
+      return;
+   }
+   #endif
+
    gui->pset(x0,y0,c);
 }
 
@@ -4962,8 +5044,21 @@ void UG_DrawLine( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c )
 {
    UG_S16 n, dx, dy, sgndx, sgndy, dxabs, dyabs, x, y, drawx, drawy;
 
-   /* Is hardware acceleration available? */
-   if ( gui->driver[DRIVER_DRAW_LINE].state & DRIVER_ENABLED )
+   #ifdef USE_CMDLIST
+   if ( gui->cmdlist != NULL )
+   {
+      UG_CMD* cmd = _UG_CmdAlloc(CMD_TYPE_LINE, 0);
+      cmd->x1 = x1;
+      cmd->y1 = y1;
+      cmd->x2 = x2;
+      cmd->y2 = y2;
+      cmd->fc = c;
+      return;
+   }
+   #endif
+
+   /* Is hardware acceleration available? (the driver does not know about clipping) */
+   if ( (gui->driver[DRIVER_DRAW_LINE].state & DRIVER_ENABLED) && gui->pset == gui->pset_unclipped )
    {
       if( ((UG_RESULT(*)(UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c))gui->driver[DRIVER_DRAW_LINE].driver)(x1,y1,x2,y2,c) == UG_RESULT_OK ) return;
    }
@@ -5011,12 +5106,38 @@ void UG_DrawLine( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c )
    }  
 }
 
-void UG_PutString( UG_S16 x, UG_S16 y, char* str )
+void UG_PutString( UG_S16 x, UG_S16 y, const char* str )
 {
    UG_S16 xp,yp;
    UG_U8 cw;
    char chr;
 
+   #ifdef USE_CMDLIST
+   if ( gui->cmdlist != NULL )
+   {
+      UG_U16 len = strlen(str) + 1;
+      UG_CMD* cmd = _UG_CmdAlloc(CMD_TYPE_STRING, len);
+
+      /* Strings that do not fit into the text buffer are drawn immediately */
+      if ( cmd != NULL )
+      {
+         char* text = gui->cmdlist->text + gui->cmdlist->text_used;
+         memcpy(text, str, len);
+         gui->cmdlist->text_used += len;
+
+         cmd->x1 = x;
+         cmd->y1 = y;
+         cmd->fc = gui->fore_color;
+         cmd->bc = gui->back_color;
+         cmd->p = text;
+         cmd->font = gui->font;
+         cmd->h_space = gui->char_h_space;
+         cmd->v_space = gui->char_v_space;
+         return;
+      }
+   }
+   #endif
+
    xp=x;
    yp=y;
 
@@ -5052,6 +5173,7 @@ void UG_ConsolePutString( char* str )
 {
    char chr;
    UG_U8 cw;
+   UG_S16 lh;
 
    while ( *str != 0 )
    {
@@ -5065,20 +5187,50 @@ void UG_ConsolePutString( char* str )
       
       cw = gui->font.widths ? gui->font.widths[chr - gui->font.start_char] : gui->font.char_width;
       gui->console.x_pos += cw+gui->char_h_space;
+      lh = gui->font.char_height+gui->char_v_space;
 
       if ( gui->console.x_pos+cw > gui->console.x_end )
       {
          gui->console.x_pos = gui->console.x_start;
-         gui->console.y_pos += gui->font.char_height+gui->char_v_space;
+         gui->console.y_pos += lh;
+         #ifdef USE_CONSOLE_SCROLL
+         /* Start a new history line */
+         gui->console.head = (gui->console.head + 1) % UG_CONSOLE_HISTORY;
+         gui->console.history[gui->console.head][0] = 0;
+         gui->console.col = 0;
+         if ( gui->console.lines < UG_CONSOLE_HISTORY ) gui->console.lines++;
+         #endif
       }
       if ( gui->console.y_pos+gui->font.char_height > gui->console.y_end )
       {
-         gui->console.x_pos = gui->console.x_start;
-         gui->console.y_pos = gui->console.y_start;
-         UG_FillFrame(gui->console.x_start,gui->console.y_start,gui->console.x_end,gui->console.y_end,gui->console.back_color);
+         #ifdef USE_CONSOLE_SCROLL
+         /* Scroll if the previous line was still inside the console area */
+         if ( gui->console.scroll && (gui->console.y_pos-lh >= gui->console.y_start) && (gui->console.y_pos-lh+gui->font.char_height <= gui->console.y_end) )
+         {
+            _UG_ConsoleScroll(lh);
+         }
+         else
+         #endif
+         {
+            gui->console.x_pos = gui->console.x_start;
+            gui->console.y_pos = gui->console.y_start;
+            UG_FillFrame(gui->console.x_start,gui->console.y_start,gui->console.x_end,gui->console.y_end,gui->console.back_color);
+            #ifdef USE_CONSOLE_SCROLL
+            _UG_ConsoleMarkDirty(gui->console.y_start,gui->console.y_end);
+            #endif
+         }
       }
 
       UG_PutChar(chr, gui->console.x_pos, gui->console.y_pos, gui->console.fore_color, gui->console.back_color);
+
+      #ifdef USE_CONSOLE_SCROLL
+      if ( gui->console.col < UG_CONSOLE_LINE_LENGTH-1 )
+      {
+         gui->console.history[gui->console.head][gui->console.col++] = chr;
+         gui->console.history[gui->console.head][gui->console.col] = 0;
+      }
+      _UG_ConsoleMarkDirty(gui->console.y_pos,gui->console.y_pos+gui->font.char_height-1);
+      #endif
       str++;
    }
 }
@@ -5101,6 +5253,373 @@ void UG_ConsoleSetBackcolor( UG_COLOR c )
    gui->console.back_color = c;
 }
 
+#ifdef USE_CONSOLE_SCROLL
+void UG_ConsoleSetScroll( UG_U8 enable )
+{
+   UG_U8 i;
+
+   gui->console.scroll = enable;
+   gui->console.x_pos = gui->console.x_end;
+   gui->console.y_pos = gui->console.y_end;
+   gui->console.head = 0;
+   gui->console.lines = 0;
+   gui->console.col = 0;
+   for ( i=0; i<UG_CONSOLE_HISTORY; i++ ) gui->console.history[i][0] = 0;
+}
+
+void UG_ConsoleRedraw( void )
+{
+   UG_S16 lh,rows,n,xp,yp;
+   UG_U8 line,cw;
+   char* c;
+
+   lh = gui->font.char_height+gui->char_v_space;
+   if ( lh <= 0 ) return;
+
+   UG_FillFrame(gui->console.x_start,gui->console.y_start,gui->console.x_end,gui->console.y_end,gui->console.back_color);
+   _UG_ConsoleMarkDirty(gui->console.y_start,gui->console.y_end);
+
+   if ( !gui->console.lines ) return;
+
+   /* Repaint the most recent lines that fit into the console area */
+   rows = (gui->console.y_end - gui->console.y_start + 1 + gui->char_v_space) / lh;
+   n = (gui->console.lines < rows) ? gui->console.lines : rows;
+   line = (gui->console.head + UG_CONSOLE_HISTORY - n + 1) % UG_CONSOLE_HISTORY;
+
+   xp = gui->console.x_start;
+   yp = gui->console.y_start;
+   while ( n-- )
+   {
+      xp = gui->console.x_start;
+      for ( c=gui->console.history[line]; *c; c++ )
+      {
+         UG_PutChar(*c, xp, yp, gui->console.fore_color, gui->console.back_color);
+         cw = gui->font.widths ? gui->font.widths[*c - gui->font.start_char] : gui->font.char_width;
+         xp += cw+gui->char_h_space;
+      }
+      line = (line + 1) % UG_CONSOLE_HISTORY;
+      yp += lh;
+   }
+
+   /* Continue after the last character of the last line */
+   gui->console.x_pos = xp - gui->font.char_width - gui->char_h_space;
+   gui->console.y_pos = yp - lh;
+}
+
+UG_RESULT UG_ConsoleGetDirtyArea( UG_AREA* a )
+{
+   if ( gui->console.dirty_ys < 0 ) return UG_RESULT_FAIL;
+
+   a->xs = gui->console.x_start;
+   a->ys = gui->console.dirty_ys;
+   a->xe = gui->console.x_end;
+   a->ye = gui->console.dirty_ye;
+
+   gui->console.dirty_ys = -1;
+   gui->console.dirty_ye = -1;
+   return UG_RESULT_OK;
+}
+#endif
+
+void UG_SetFramebuffer( UG_COLOR* fb )
+{
+   gui->fb = fb;
+}
+
+void UG_SetClip( UG_S16 xs, UG_S16 ys, UG_S16 xe, UG_S16 ye )
+{
+   if ( xs < 0 ) xs = 0;
+   if ( ys < 0 ) ys = 0;
+   if ( xe > gui->x_dim - 1 ) xe = gui->x_dim - 1;
+   if ( ye > gui->y_dim - 1 ) ye = gui->y_dim - 1;
+
+   gui->clip.xs = xs;
+   gui->clip.ys = ys;
+   gui->clip.xe = xe;
+   gui->clip.ye = ye;
+
+   /* Only pay for the per pixel test if the clip area is smaller than the screen */
+   if ( xs == 0 && ys == 0 && xe == gui->x_dim - 1 && ye == gui->y_dim - 1 )
+   {
+      gui->pset = gui->pset_unclipped;
+   }
+   else
+   {
+      gui->pset = _UG_PSetClipped;
+   }
+}
+
+void UG_ResetClip( void )
+{
+   UG_SetClip(0, 0, gui->x_dim - 1, gui->y_dim - 1);
+}
+
+void UG_DrawImage( UG_S16 xp, UG_S16 yp, UG_S16 w, UG_S16 h, const UG_COLOR* data )
+{
+   UG_S16 xs,ys,xe,ye,x,y;
+   const UG_COLOR* src;
+   UG_COLOR* dst;
+
+   #ifdef USE_CMDLIST
+   if ( gui->cmdlist != NULL )
+   {
+      /* Only the pointer is recorded, the image data must stay valid until the list is executed */
+      UG_CMD* cmd = _UG_CmdAlloc(CMD_TYPE_IMAGE, 0);
+      cmd->x1 = xp;
+      cmd->y1 = yp;
+      cmd->x2 = w;
+      cmd->y2 = h;
+      cmd->p = data;
+      return;
+   }
+   #endif
+
+   xs = ( xp < gui->clip.xs ) ? gui->clip.xs : xp;
+   ys = ( yp < gui->clip.ys ) ? gui->clip.ys : yp;
+   xe = ( xp + w - 1 > gui->clip.xe ) ? gui->clip.xe : xp + w - 1;
+   ye = ( yp + h - 1 > gui->clip.ye ) ? gui->clip.ye : yp + h - 1;
+   if ( xs > xe || ys > ye ) return;
+
+   for( y=ys; y<=ye; y++ )
+   {
+      src = data + (y - yp) * w + (xs - xp);
+
+      /* Copy whole rows if the framebuffer is known */
+      if ( gui->fb != NULL )
+      {
+         dst = gui->fb + y * gui->x_dim + xs;
+         memcpy(dst, src, (xe - xs + 1) * sizeof(UG_COLOR));
+         continue;
+      }
+
+      for( x=xs; x<=xe; x++ )
+      {
+         gui->pset_unclipped(x, y, *src++);
+      }
+   }
+}
+
+#ifdef USE_COLOR_RGB565
+UG_RESULT UG_BlendFrame( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c, UG_U8 alpha )
+{
+   UG_S16 n,y;
+   UG_U32 a,cc;
+
+   if ( x2 < x1 )
+   {
+      n = x2;
+      x2 = x1;
+      x1 = n;
+   }
+   if ( y2 < y1 )
+   {
+      n = y2;
+      y2 = y1;
+      y1 = n;
+   }
+
+   #ifdef USE_CMDLIST
+   if ( gui->cmdlist != NULL )
+   {
+      UG_CMD* cmd = _UG_CmdAlloc(CMD_TYPE_BLEND_FRAME, 0);
+      cmd->x1 = x1;
+      cmd->y1 = y1;
+      cmd->x2 = x2;
+      cmd->y2 = y2;
+      cmd->fc = c;
+      cmd->bc = alpha;
+      return UG_RESULT_OK;
+   }
+   #endif
+
+   /* Blending needs to read the destination */
+   if ( gui->fb == NULL ) return UG_RESULT_FAIL;
+
+   if ( x1 < gui->clip.xs ) x1 = gui->clip.xs;
+   if ( y1 < gui->clip.ys ) y1 = gui->clip.ys;
+   if ( x2 > gui->clip.xe ) x2 = gui->clip.xe;
+   if ( y2 > gui->clip.ye ) y2 = gui->clip.ye;
+   if ( x1 > x2 || y1 > y2 ) return UG_RESULT_OK;
+
+   /* 8 bit alpha to the 0..32 range of the kernels */
+   a = ((UG_U32)alpha + 4) >> 3;
+   if ( a == 0 ) return UG_RESULT_OK;
+
+   /* The color part is the same for every pixel: scale it once */
+   cc = _UG_Scale2((UG_U32)c | ((UG_U32)c << 16), a);
+
+   for( y=y1; y<=y2; y++ )
+   {
+      _UG_BlendRow(gui->fb + y * gui->x_dim + x1, x2 - x1 + 1, cc, 32 - a);
+   }
+   return UG_RESULT_OK;
+}
+
+UG_RESULT UG_DimFrame( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_U8 level )
+{
+   return UG_BlendFrame(x1, y1, x2, y2, C_BLACK, level);
+}
+
+UG_RESULT UG_DrawImageAlpha( UG_S16 xp, UG_S16 yp, UG_S16 w, UG_S16 h, const UG_COLOR* data, const UG_U8* alpha )
+{
+   UG_S16 xs,ys,xe,ye,x,y;
+   const UG_COLOR* src;
+   const UG_U8* msk;
+   UG_COLOR* dst;
+   UG_U32 a,fg,bg;
+
+   #ifdef USE_CMDLIST
+   if ( gui->cmdlist != NULL )
+   {
+      /* Image and mask must stay valid until the list is executed */
+      UG_CMD* cmd = _UG_CmdAlloc(CMD_TYPE_IMAGE_ALPHA, 0);
+      cmd->x1 = xp;
+      cmd->y1 = yp;
+      cmd->x2 = w;
+      cmd->y2 = h;
+      cmd->p = data;
+      cmd->mask = alpha;
+      return UG_RESULT_OK;
+   }
+   #endif
+
+   if ( gui->fb == NULL ) return UG_RESULT_FAIL;
+
+   xs = ( xp < gui->clip.xs ) ? gui->clip.xs : xp;
+   ys = ( yp < gui->clip.ys ) ? gui->clip.ys : yp;
+   xe = ( xp + w - 1 > gui->clip.xe ) ? gui->clip.xe : xp + w - 1;
+   ye = ( yp + h - 1 > gui->clip.ye ) ? gui->clip.ye : yp + h - 1;
+   if ( xs > xe || ys > ye ) return UG_RESULT_OK;
+
+   for( y=ys; y<=ye; y++ )
+   {
+      src = data + (y - yp) * w + (xs - xp);
+      msk = alpha + (y - yp) * w + (xs - xp);
+      dst = gui->fb + y * gui->x_dim + xs;
+
+      for( x=xs; x<=xe; x++, src++, msk++, dst++ )
+      {
+         a = ((UG_U32)*msk + 4) >> 3;
+         if ( a == 0 ) continue;
+         if ( a == 32 )
+         {
+            *dst = *src;
+            continue;
+         }
+
+         /* 0x07E0F81F spreads the fields of one pixel so they can be multiplied at once */
+         fg = ((UG_U32)*src | ((UG_U32)*src << 16)) & 0x07E0F81F;
+         bg = ((UG_U32)*dst | ((UG_U32)*dst << 16)) & 0x07E0F81F;
+         bg = ((((fg - bg) * a) >> 5) + bg) & 0x07E0F81F;
+         *dst = (UG_COLOR)(bg | (bg >> 16));
+      }
+   }
+   return UG_RESULT_OK;
+}
+#endif
+
+#ifdef USE_CMDLIST
+void UG_CmdListInit( UG_CMDLIST* l, UG_CMD* cmds, UG_U16 max, char* text, UG_U16 text_size )
+{
+   l->cmds = cmds;
+   l->max = max;
+   l->count = 0;
+   l->text = text;
+   l->text_size = text_size;
+   l->text_used = 0;
+   l->flushes = 0;
+}
+
+void UG_CmdListBegin( UG_CMDLIST* l )
+{
+   l->count = 0;
+   l->text_used = 0;
+   l->flushes = 0;
+   gui->cmdlist = l;
+}
+
+void UG_CmdListEnd( void )
+{
+   gui->cmdlist = NULL;
+}
+
+void UG_CmdListExecute( UG_CMDLIST* l )
+{
+   UG_U16 i;
+   UG_CMD* cmd;
+   UG_CMDLIST* recording;
+   UG_FONT font;
+   UG_S8 h_space,v_space;
+   UG_COLOR fc,bc;
+
+   /* Execute against the current GUI, do not record into a list while doing so */
+   recording = gui->cmdlist;
+   gui->cmdlist = NULL;
+   font = gui->font;
+   h_space = gui->char_h_space;
+   v_space = gui->char_v_space;
+   fc = gui->fore_color;
+   bc = gui->back_color;
+
+   for( i=0; i<l->count; i++ )
+   {
+      cmd = &l->cmds[i];
+      switch ( cmd->type )
+      {
+         case CMD_TYPE_PIXEL:
+         {
+            UG_DrawPixel(cmd->x1, cmd->y1, cmd->fc);
+            break;
+         }
+         case CMD_TYPE_FILL_FRAME:
+         {
+            UG_FillFrame(cmd->x1, cmd->y1, cmd->x2, cmd->y2, cmd->fc);
+            break;
+         }
+         case CMD_TYPE_LINE:
+         {
+            UG_DrawLine(cmd->x1, cmd->y1, cmd->x2, cmd->y2, cmd->fc);
+            break;
+         }
+         case CMD_TYPE_STRING:
+         {
+            gui->font = cmd->font;
+            gui->char_h_space = cmd->h_space;
+            gui->char_v_space = cmd->v_space;
+            gui->fore_color = cmd->fc;
+            gui->back_color = cmd->bc;
+            UG_PutString(cmd->x1, cmd->y1, (const char*)cmd->p);
+            break;
+         }
+         case CMD_TYPE_IMAGE:
+         {
+            UG_DrawImage(cmd->x1, cmd->y1, cmd->x2, cmd->y2, (const UG_COLOR*)cmd->p);
+            break;
+         }
+         #ifdef USE_COLOR_RGB565
+         case CMD_TYPE_BLEND_FRAME:
+         {
+            UG_BlendFrame(cmd->x1, cmd->y1, cmd->x2, cmd->y2, cmd->fc, (UG_U8)cmd->bc);
+            break;
+         }
+         case CMD_TYPE_IMAGE_ALPHA:
+         {
+            UG_DrawImageAlpha(cmd->x1, cmd->y1, cmd->x2, cmd->y2, (const UG_COLOR*)cmd->p, (const UG_U8*)cmd->mask);
+            break;
+         }
+         #endif
+      }
+   }
+
+   gui->font = font;
+   gui->char_h_space = h_space;
+   gui->char_v_space = v_space;
+   gui->fore_color = fc;
+   gui->back_color = bc;
+   gui->cmdlist = recording;
+}
+#endif
+
 void UG_SetForecolor( UG_COLOR c )
 {
    gui->fore_color = c;
@@ -5336,6 +5855,160 @@ const UG_COLOR pal_checkbox_released[] =
 /* -------------------------------------------------------------------------------- */
 /* -- INTERNAL FUNCTIONS                                                         -- */
 /* -------------------------------------------------------------------------------- */
+void _UG_PSetClipped( UG_S16 x, UG_S16 y, UG_COLOR c )
+{
+   if ( x < gui->clip.xs || x > gui->clip.xe ) return;
+   if ( y < gui->clip.ys || y > gui->clip.ye ) return;
+   gui->pset_unclipped(x, y, c);
+}
+
+#ifdef USE_COLOR_RGB565
+/* Scales all six RGB565 fields of two packed pixels by a/32 (a = 0..32).
+   R0/B0/G1 and G0/B1/R1 are handled in two groups so that every field
+   has 5 free bits above it for the product. */
+UG_U32 _UG_Scale2( UG_U32 p, UG_U32 a )
+{
+   return ((((p & 0x07E0F81F) * a) >> 5) & 0x07E0F81F) |
+          ((((p >> 5) & 0x07C0F83F) * a) & 0xF81F07E0);
+}
+
+#ifdef __GNUC__
+typedef UG_U32 __attribute__((__may_alias__)) UG_U32_ALIAS;
+#else
+typedef UG_U32 UG_U32_ALIAS;
+#endif
+
+/* dst = cc + dst * ia / 32, two pixels per 32 bit word */
+void _UG_BlendRow( UG_COLOR* dst, UG_S16 n, UG_U32 cc, UG_U32 ia )
+{
+   UG_U32_ALIAS* d;
+
+   if ( n <= 0 ) return;
+
+   /* Leading pixel to get to a word boundary */
+   if ( (UG_U32)(size_t)dst & 2 )
+   {
+      *dst = (UG_COLOR)(cc + _UG_Scale2(*dst, ia));
+      dst++;
+      n--;
+   }
+
+   d = (UG_U32_ALIAS*)dst;
+   for( ; n>=2; n-=2, d++ )
+   {
+      *d = cc + _UG_Scale2(*d, ia);
+   }
+
+   if ( n )
+   {
+      dst = (UG_COLOR*)d;
+      *dst = (UG_COLOR)(cc + _UG_Scale2(*dst, ia));
+   }
+}
+#endif
+
+#ifdef USE_CMDLIST
+UG_CMD* _UG_CmdAlloc( UG_U8 type, UG_U16 text_len )
+{
+   UG_CMDLIST* l = gui->cmdlist;
+   UG_CMD* cmd;
+
+   if ( l->count >= l->max || l->text_used + text_len > l->text_size )
+   {
+      /* List is full: draw everything recorded so far and start over */
+      UG_CmdListExecute(l);
+      l->count = 0;
+      l->text_used = 0;
+      l->flushes++;
+
+      if ( text_len > l->text_size ) return NULL;
+   }
+
+   cmd = &l->cmds[l->count++];
+   cmd->type = type;
+   return cmd;
+}
+#endif
+
+/* Horizontal run of one color, clipped */
+void _UG_DrawSpan( UG_S16 x1, UG_S16 x2, UG_S16 y, UG_COLOR c )
+{
+   UG_COLOR* p;
+
+   if ( y < gui->clip.ys || y > gui->clip.ye ) return;
+   if ( x1 < gui->clip.xs ) x1 = gui->clip.xs;
+   if ( x2 > gui->clip.xe ) x2 = gui->clip.xe;
+   if ( x1 > x2 ) return;
+
+   if ( gui->fb != NULL )
+   {
+      p = gui->fb + y * gui->x_dim + x1;
+      for( ; x1<=x2; x1++ ) *p++ = c;
+   }
+   else
+   {
+      for( ; x1<=x2; x1++ ) gui->pset_unclipped(x1, y, c);
+   }
+}
+
+void _UG_PutCharSpan( UG_U16 g, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc, const UG_FONT* font, UG_S16 w )
+{
+   const UG_U8* d;
+   const UG_U8* row;
+   const UG_U8* s;
+   UG_S16 yo,ye,xo;
+   UG_U8 op,n,count;
+
+   d = font->p + (font->p[g * 2] | (font->p[g * 2 + 1] << 8));
+   yo = y;
+   ye = y + font->char_height;
+
+   if ( d[0] != 0xFF )
+   {
+      /* Empty rows above */
+      for( ; yo < y + d[0]; yo++ ) _UG_DrawSpan(x, x + w - 1, yo, bc);
+
+      n = d[1];
+      d += 2;
+      row = d;
+      while ( n )
+      {
+         op = *d++;
+         if ( op & 0x80 )
+         {
+            /* Repeat the previous row */
+            count = op & 0x7F;
+         }
+         else
+         {
+            row = d - 1;
+            d += op * 2;
+            count = 1;
+         }
+         n -= count;
+
+         for( ; count; count--, yo++ )
+         {
+            if ( yo < gui->clip.ys || yo > gui->clip.ye ) continue;
+
+            xo = 0;
+            s = row + 1;
+            for( op=row[0]; op; op--, s+=2 )
+            {
+               if ( s[0] >= w ) break;
+               if ( s[0] > xo ) _UG_DrawSpan(x + xo, x + s[0] - 1, yo, bc);
+               xo = ( s[0] + s[1] > w ) ? w : s[0] + s[1];
+               _UG_DrawSpan(x + s[0], x + xo - 1, yo, fc);
+            }
+            if ( xo < w ) _UG_DrawSpan(x + xo, x + w - 1, yo, bc);
+         }
+      }
+   }
+
+   /* Empty rows below */
+   for( ; yo < ye; yo++ ) _UG_DrawSpan(x, x + w - 1, yo, bc);
+}
+
 void _UG_PutChar( char chr, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc, const UG_FONT* font)
 {
    UG_U16 i,j,k,xo,yo,c,bn,actual_char_width;
@@ -5343,6 +6016,7 @@ void _UG_PutChar( char chr, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc, const
    UG_U32 index;
    UG_COLOR color;
    void(*push_pixel)(UG_COLOR);
+   void(*pset)(UG_S16,UG_S16,UG_COLOR);
 
    bt = (UG_U8)chr;
 
@@ -5367,8 +6041,23 @@ void _UG_PutChar( char chr, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc, const
    if ( font->char_width % 8 ) bn++;
    actual_char_width = (font->widths ? font->widths[bt - font->start_char] : font->char_width);
 
-   /* Is hardware acceleration available? */
-   if ( gui->driver[DRIVER_FILL_AREA].state & DRIVER_ENABLED )
+   /* Skip glyphs outside of the clip area */
+   if ( x > gui->clip.xe || x + actual_char_width - 1 < gui->clip.xs ) return;
+   if ( y > gui->clip.ye || y + font->char_height - 1 < gui->clip.ys ) return;
+
+   if ( font->font_type == FONT_TYPE_SPAN )
+   {
+      _UG_PutCharSpan(bt - font->start_char, x, y, fc, bc, font, actual_char_width);
+      return;
+   }
+
+   /* Glyphs crossing the clip border test every pixel */
+   pset = gui->pset_unclipped;
+   if ( x < gui->clip.xs || x + actual_char_width - 1 > gui->clip.xe ||
+        y < gui->clip.ys || y + font->char_height - 1 > gui->clip.ye ) pset = _UG_PSetClipped;
+
+   /* Is hardware acceleration available? (the driver does not know about clipping) */
+   if ( (gui->driver[DRIVER_FILL_AREA].state & DRIVER_ENABLED) && pset == gui->pset_unclipped )
    {
 	   //(void(*)(UG_COLOR))
       push_pixel = ((void*(*)(UG_S16, UG_S16, UG_S16, UG_S16))gui->driver[DRIVER_FILL_AREA].driver)(x,y,x+actual_char_width-1,y+font->char_height-1);
@@ -5432,11 +6121,11 @@ void _UG_PutChar( char chr, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc, const
              {
                if( b & 0x01 )
                {
-                  gui->pset(xo,yo,fc);
+                  pset(xo,yo,fc);
                }
                else
                {
-                  gui->pset(xo,yo,bc);
+                  pset(xo,yo,bc);
                }
                b >>= 1;
                xo++;
@@ -5458,7 +6147,7 @@ void _UG_PutChar( char chr, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc, const
                color = ((((fc & 0x0000FF) * b + (bc & 0x0000FF) * (256 - b)) >> 8) & 0x0000FF) |//Blue component
                        ((((fc & 0x00FF00) * b + (bc & 0x00FF00) * (256 - b)) >> 8) & 0x00FF00) |//Green component
                        ((((fc & 0xFF0000) * b + (bc & 0xFF0000) * (256 - b)) >> 8) & 0xFF0000); //Red component
-               gui->pset(xo,yo,color);
+               pset(xo,yo,color);
                xo++;
             }
             index += font->char_width - actual_char_width;
@@ -5544,6 +6233,40 @@ void _UG_PutText(UG_TEXT* txt)
    }
 }
 
+#ifdef USE_CONSOLE_SCROLL
+void _UG_ConsoleScroll( UG_S16 dy )
+{
+   UG_S16 y,w;
+   UG_COLOR* p;
+
+   if ( gui->fb != NULL )
+   {
+      /* Move the console rows up inside the framebuffer */
+      w = gui->console.x_end - gui->console.x_start + 1;
+      for ( y=gui->console.y_start; y+dy<=gui->console.y_end; y++ )
+      {
+         p = gui->fb + (UG_S32)y * gui->x_dim + gui->console.x_start;
+         memmove(p, p + (UG_S32)dy * gui->x_dim, w * sizeof(UG_COLOR));
+      }
+      UG_FillFrame(gui->console.x_start,gui->console.y_end-dy+1,gui->console.x_end,gui->console.y_end,gui->console.back_color);
+      gui->console.y_pos -= dy;
+      _UG_ConsoleMarkDirty(gui->console.y_start,gui->console.y_end);
+   }
+   else
+   {
+      /* No framebuffer access: repaint the visible history, the new line is empty */
+      UG_ConsoleRedraw();
+      gui->console.x_pos = gui->console.x_start;
+   }
+}
+
+void _UG_ConsoleMarkDirty( UG_S16 ys, UG_S16 ye )
+{
+   if ( gui->console.dirty_ys < 0 || ys < gui->console.dirty_ys ) gui->console.dirty_ys = ys;
+   if ( ye > gui->console.dirty_ye ) gui->console.dirty_ye = ye;
+}
+#endif
+
 UG_OBJECT* _UG_GetFreeObject( UG_WINDOW* wnd )
 {
    UG_U8 i;
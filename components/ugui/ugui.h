@@ -27,7 +27,8 @@
 typedef enum
 {
 	FONT_TYPE_1BPP,
-	FONT_TYPE_8BPP
+	FONT_TYPE_8BPP,
+	FONT_TYPE_SPAN  /* Row spans, see tools/fontspan/fontspan.py */
 } FONT_TYPE;
 
 typedef struct
@@ -553,18 +554,67 @@ typedef struct
 #define DRIVER_FILL_FRAME                             1
 #define DRIVER_FILL_AREA                              2
 
+#ifdef USE_CMDLIST
+/* -------------------------------------------------------------------------------- */
+/* -- µGUI COMMAND LIST                                                          -- */
+/* -------------------------------------------------------------------------------- */
+/* Recorded draw command */
+typedef struct
+{
+   UG_U8 type;
+   UG_S16 x1;
+   UG_S16 y1;
+   UG_S16 x2;
+   UG_S16 y2;
+   UG_COLOR fc;
+   UG_COLOR bc;
+   const void* p;
+   const void* mask;
+   UG_FONT font;
+   UG_S8 h_space;
+   UG_S8 v_space;
+} UG_CMD;
+
+/* Command list. Command and text storage is provided by the caller */
+typedef struct
+{
+   UG_CMD* cmds;
+   UG_U16 max;
+   UG_U16 count;
+   char* text;
+   UG_U16 text_size;
+   UG_U16 text_used;
+   UG_U16 flushes;
+} UG_CMDLIST;
+
+/* Command types */
+#define CMD_TYPE_PIXEL                                1
+#define CMD_TYPE_FILL_FRAME                           2
+#define CMD_TYPE_LINE                                 3
+#define CMD_TYPE_STRING                               4
+#define CMD_TYPE_IMAGE                                5
+#define CMD_TYPE_BLEND_FRAME                          6
+#define CMD_TYPE_IMAGE_ALPHA                          7
+#endif
+
 /* -------------------------------------------------------------------------------- */
 /* -- µGUI CORE STRUCTURE                                                        -- */
 /* -------------------------------------------------------------------------------- */
 typedef struct
 {
    void (*pset)(UG_S16,UG_S16,UG_COLOR);
+   void (*pset_unclipped)(UG_S16,UG_S16,UG_COLOR);
    UG_S16 x_dim;
    UG_S16 y_dim;
+   UG_AREA clip;
    UG_TOUCH touch;
    UG_WINDOW* next_window;
    UG_WINDOW* active_window;
    UG_WINDOW* last_window;
+   UG_COLOR* fb;
+#ifdef USE_CMDLIST
+   UG_CMDLIST* cmdlist;
+#endif
    struct
    {
       UG_S16 x_pos;
@@ -575,6 +625,15 @@ typedef struct
       UG_S16 y_end;
       UG_COLOR fore_color;
       UG_COLOR back_color;
+#ifdef USE_CONSOLE_SCROLL
+      UG_U8 scroll;
+      UG_U8 head;
+      UG_U8 lines;
+      UG_U8 col;
+      UG_S16 dirty_ys;
+      UG_S16 dirty_ye;
+      char history[UG_CONSOLE_HISTORY][UG_CONSOLE_LINE_LENGTH];
+#endif
    } console;
    UG_FONT font;
    UG_S8 char_h_space;
@@ -897,12 +956,33 @@ void UG_DrawCircle( UG_S16 x0, UG_S16 y0, UG_S16 r, UG_COLOR c );
 void UG_FillCircle( UG_S16 x0, UG_S16 y0, UG_S16 r, UG_COLOR c );
 void UG_DrawArc( UG_S16 x0, UG_S16 y0, UG_S16 r, UG_U8 s, UG_COLOR c );
 void UG_DrawLine( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c );
-void UG_PutString( UG_S16 x, UG_S16 y, char* str );
+void UG_PutString( UG_S16 x, UG_S16 y, const char* str );
 void UG_PutChar( char chr, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc );
 void UG_ConsolePutString( char* str );
 void UG_ConsoleSetArea( UG_S16 xs, UG_S16 ys, UG_S16 xe, UG_S16 ye );
 void UG_ConsoleSetForecolor( UG_COLOR c );
 void UG_ConsoleSetBackcolor( UG_COLOR c );
+#ifdef USE_CONSOLE_SCROLL
+void UG_ConsoleSetScroll( UG_U8 enable );
+void UG_ConsoleRedraw( void );
+UG_RESULT UG_ConsoleGetDirtyArea( UG_AREA* a );
+#endif
+void UG_SetFramebuffer( UG_COLOR* fb );
+void UG_SetClip( UG_S16 xs, UG_S16 ys, UG_S16 xe, UG_S16 ye );
+void UG_ResetClip( void );
+void UG_DrawImage( UG_S16 xp, UG_S16 yp, UG_S16 w, UG_S16 h, const UG_COLOR* data );
+#ifdef USE_COLOR_RGB565
+/* Alpha is 0 (transparent) .. 255 (opaque). These read the framebuffer (UG_SetFramebuffer) */
+UG_RESULT UG_BlendFrame( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c, UG_U8 alpha );
+UG_RESULT UG_DimFrame( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_U8 level );
+UG_RESULT UG_DrawImageAlpha( UG_S16 xp, UG_S16 yp, UG_S16 w, UG_S16 h, const UG_COLOR* data, const UG_U8* alpha );
+#endif
+#ifdef USE_CMDLIST
+void UG_CmdListInit( UG_CMDLIST* l, UG_CMD* cmds, UG_U16 max, char* text, UG_U16 text_size );
+void UG_CmdListBegin( UG_CMDLIST* l );
+void UG_CmdListEnd( void );
+void UG_CmdListExecute( UG_CMDLIST* l );
+#endif
 void UG_SetForecolor( UG_COLOR c );
 void UG_SetBackcolor( UG_COLOR c );
 UG_COLOR UG_GetForecolor( );
@@ -33,6 +33,12 @@
 #define  USE_FONT_24X40
 #define  USE_FONT_32X53
 
+/* Store these fonts as row spans instead of 1bpp bitmaps (smaller, faster to draw).
+   The data in ugui_fontspan.c is generated by tools/fontspan/fontspan.py */
+#define  USE_FONT_SPAN_22X36
+#define  USE_FONT_SPAN_24X40
+#define  USE_FONT_SPAN_32X53
+
 /* Specify platform-dependent integer types here */
 
 #define __UG_FONT_DATA const
@@ -61,5 +67,17 @@ typedef signed long int       UG_S32;
 #define USE_PRERENDER_EVENT
 #define USE_POSTRENDER_EVENT
 
+/* Scrolling console: keeps a history of the last UG_CONSOLE_HISTORY lines */
+#define USE_CONSOLE_SCROLL
+#define UG_CONSOLE_HISTORY                            16
+#define UG_CONSOLE_LINE_LENGTH                        64
+
+/* Per-task GUI context: UG_Init/UG_SelectGUI only affect the calling task */
+#define USE_GUI_PER_TASK
+#define UG_TASK_LOCAL                                 __thread
+
+/* Draw command recording for deferred (e.g. banded) rendering */
+#define USE_CMDLIST
+
 
 #endif
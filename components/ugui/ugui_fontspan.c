@@ -0,0 +1,3090 @@
+/* Generated by tools/fontspan/fontspan.py from the 1bpp fonts in ugui.c. Do not edit. */
+#include "ugui.h"
+
+#ifdef USE_FONT_SPAN_22X36
+/* 14264 bytes, 27648 as 1bpp bitmap */
+__UG_FONT_DATA unsigned char font_22x36_span[14264]={
+0x00,0x02,0x01,0x02,0x72,0x02,0xC5,0x02,0xFF,0x02,0x4F,0x03,0x8C,0x03,0xD4,0x03,
+0xD5,0x03,0xD6,0x03,0xD7,0x03,0xD8,0x03,0x35,0x04,0x79,0x04,0x7A,0x04,0xCF,0x04,
+0x20,0x05,0x61,0x05,0xA2,0x05,0xE2,0x05,0xF2,0x05,0x1F,0x06,0x90,0x06,0x96,0x06,
+0xDA,0x06,0xFD,0x06,0x20,0x07,0x43,0x07,0x66,0x07,0x70,0x07,0xA3,0x07,0xDA,0x07,
+0x11,0x08,0x12,0x08,0x1E,0x08,0x2C,0x08,0x5E,0x08,0xC6,0x08,0x4E,0x09,0xC7,0x09,
+0xD1,0x09,0x11,0x0A,0x51,0x0A,0x8C,0x0A,0x9A,0x0A,0xB0,0x0A,0xB6,0x0A,0xBC,0x0A,
+0x05,0x0B,0x3F,0x0B,0x5A,0x0B,0x9C,0x0B,0xDE,0x0B,0x20,0x0C,0x54,0x0C,0xB3,0x0C,
+0xEF,0x0C,0x4D,0x0D,0xAC,0x0D,0xB8,0x0D,0xD4,0x0D,0x0F,0x0E,0x1B,0x0E,0x56,0x0E,
+0x96,0x0E,0x22,0x0F,0x81,0x0F,0xCD,0x0F,0x0A,0x10,0x4E,0x10,0x64,0x10,0x76,0x10,
+0xC3,0x10,0xD5,0x10,0xE3,0x10,0xFE,0x10,0x71,0x11,0x7B,0x11,0xED,0x11,0x68,0x12,
+0xAC,0x12,0xDE,0x12,0x31,0x13,0x86,0x13,0xC9,0x13,0xD3,0x13,0xF3,0x13,0x4C,0x14,
+0xB6,0x14,0x1D,0x15,0x5C,0x15,0x99,0x15,0xA7,0x15,0xF0,0x15,0xFE,0x15,0x49,0x16,
+0x4F,0x16,0x5D,0x16,0x9E,0x16,0xE4,0x16,0x18,0x17,0x5E,0x17,0x9C,0x17,0xBB,0x17,
+0x12,0x18,0x3C,0x18,0x4C,0x18,0x6D,0x18,0xD0,0x18,0xDA,0x18,0x0E,0x19,0x34,0x19,
+0x6C,0x19,0xB2,0x19,0xF8,0x19,0x1C,0x1A,0x59,0x1A,0x71,0x1A,0x97,0x1A,0xEA,0x1A,
+0x5F,0x1B,0xB4,0x1B,0x0A,0x1C,0x3B,0x1C,0x72,0x1C,0x78,0x1C,0xAF,0x1C,0xD9,0x1C,
+0xE8,0x1C,0x3B,0x1D,0x69,0x1D,0xBB,0x1D,0x16,0x1E,0x5F,0x1E,0xB4,0x1E,0x0D,0x1F,
+0x57,0x1F,0xAF,0x1F,0xF5,0x1F,0x47,0x20,0x59,0x20,0x7D,0x20,0x9B,0x20,0x02,0x21,
+0x63,0x21,0x86,0x21,0xD6,0x21,0x25,0x22,0x77,0x22,0xB7,0x22,0x03,0x23,0x43,0x23,
+0x7D,0x23,0xDB,0x23,0x27,0x24,0x4F,0x24,0xB6,0x24,0xDF,0x24,0x5E,0x25,0xB9,0x25,
+0xE3,0x25,0x38,0x26,0x56,0x26,0xA2,0x26,0xDC,0x26,0x18,0x27,0xA8,0x27,0xD7,0x27,
+0xFF,0x27,0x3D,0x28,0xA7,0x28,0xB1,0x28,0x29,0x29,0xA9,0x29,0xB5,0x29,0x02,0x2A,
+0x4F,0x2A,0x81,0x2A,0xDF,0x2A,0x1D,0x2B,0x23,0x2B,0x31,0x2B,0x9D,0x2B,0x0D,0x2C,
+0x79,0x2C,0x01,0x2D,0x1F,0x2D,0x27,0x2D,0x3D,0x2D,0x53,0x2D,0x9C,0x2D,0xE9,0x2D,
+0xF3,0x2D,0xFD,0x2D,0x07,0x2E,0x11,0x2E,0x1F,0x2E,0x25,0x2E,0x33,0x2E,0x8A,0x2E,
+0xFE,0x2E,0x14,0x2F,0x2A,0x2F,0x3E,0x2F,0x52,0x2F,0x70,0x2F,0x7C,0x2F,0x98,0x2F,
+0xE2,0x2F,0x42,0x30,0x91,0x30,0xB8,0x30,0xD6,0x30,0xF9,0x30,0x03,0x31,0x1E,0x31,
+0x3D,0x31,0x53,0x31,0x5D,0x31,0x67,0x31,0x6D,0x31,0x73,0x31,0x7F,0x31,0x9A,0x31,
+0xA0,0x31,0xF1,0x31,0x5D,0x32,0xB2,0x32,0x03,0x33,0x51,0x33,0xAA,0x33,0xD8,0x33,
+0x22,0x34,0x58,0x34,0x85,0x34,0xB6,0x34,0xE3,0x34,0x4D,0x35,0x99,0x35,0x9F,0x35,
+0xAD,0x35,0xB3,0x35,0xC7,0x35,0xD3,0x35,0x63,0x36,0x90,0x36,0x01,0x37,0x13,0x37,
+0x2B,0x37,0x49,0x37,0x51,0x37,0x57,0x37,0x61,0x37,0x8A,0x37,0xB1,0x37,0xB7,0x37,
+0xFF,0x09,0x13,0x01,0x08,0x06,0x01,0x06,0x0A,0x02,0x04,0x04,0x0E,0x04,0x02,0x03,
+0x03,0x10,0x03,0x02,0x02,0x03,0x11,0x03,0x04,0x02,0x02,0x06,0x03,0x0D,0x03,0x12,
+0x02,0x04,0x01,0x03,0x06,0x03,0x0D,0x03,0x12,0x03,0x04,0x01,0x02,0x06,0x03,0x0D,
+0x03,0x13,0x02,0x02,0x01,0x02,0x13,0x02,0x81,0x04,0x01,0x02,0x05,0x01,0x10,0x01,
+0x13,0x02,0x04,0x01,0x02,0x05,0x02,0x0F,0x02,0x13,0x02,0x04,0x01,0x03,0x06,0x02,
+0x0E,0x02,0x12,0x03,0x03,0x02,0x02,0x07,0x08,0x12,0x02,0x03,0x02,0x03,0x08,0x06,
+0x11,0x03,0x02,0x03,0x03,0x10,0x03,0x02,0x04,0x04,0x0E,0x04,0x01,0x06,0x0A,0x01,
+0x08,0x06,0x09,0x13,0x01,0x08,0x06,0x01,0x06,0x0A,0x01,0x04,0x0E,0x01,0x03,0x10,
+0x01,0x02,0x12,0x03,0x02,0x04,0x09,0x04,0x10,0x04,0x03,0x01,0x05,0x09,0x04,0x10,
+0x05,0x81,0x01,0x01,0x14,0x81,0x03,0x01,0x04,0x06,0x0A,0x11,0x04,0x03,0x01,0x04,
+0x07,0x08,0x11,0x04,0x03,0x01,0x04,0x07,0x08,0x10,0x05,0x03,0x02,0x04,0x09,0x04,
+0x10,0x04,0x02,0x02,0x05,0x0F,0x05,0x02,0x03,0x06,0x0D,0x06,0x01,0x04,0x0E,0x01,
+0x06,0x0A,0x01,0x08,0x06,0x02,0x1A,0x02,0x03,0x05,0x0E,0x05,0x02,0x02,0x07,0x0D,
+0x07,0x02,0x01,0x09,0x0C,0x09,0x01,0x01,0x14,0x01,0x00,0x16,0x86,0x01,0x01,0x14,
+0x82,0x01,0x02,0x12,0x81,0x01,0x03,0x10,0x81,0x01,0x04,0x0E,0x01,0x05,0x0C,0x81,
+0x01,0x06,0x0A,0x01,0x07,0x08,0x01,0x08,0x06,0x01,0x09,0x04,0x01,0x0A,0x02,0x02,
+0x1A,0x01,0x0A,0x01,0x01,0x0A,0x02,0x01,0x09,0x03,0x01,0x08,0x05,0x01,0x07,0x07,
+0x01,0x07,0x08,0x01,0x06,0x0A,0x01,0x05,0x0B,0x01,0x04,0x0D,0x01,0x03,0x10,0x01,
+0x02,0x12,0x01,0x01,0x14,0x01,0x00,0x16,0x01,0x01,0x14,0x01,0x02,0x12,0x01,0x03,
+0x10,0x01,0x04,0x0E,0x01,0x05,0x0C,0x01,0x05,0x0B,0x01,0x06,0x09,0x01,0x07,0x07,
+0x01,0x08,0x06,0x01,0x08,0x05,0x01,0x09,0x03,0x01,0x0A,0x02,0x01,0x0A,0x01,0x02,
+0x1A,0x01,0x09,0x04,0x01,0x07,0x08,0x81,0x01,0x06,0x0A,0x83,0x01,0x07,0x08,0x81,
+0x03,0x03,0x04,0x08,0x06,0x0F,0x04,0x01,0x01,0x14,0x81,0x01,0x00,0x16,0x83,0x03,
+0x01,0x08,0x0A,0x01,0x0C,0x09,0x03,0x01,0x07,0x09,0x03,0x0D,0x07,0x03,0x03,0x04,
+0x09,0x03,0x0E,0x05,0x01,0x09,0x03,0x83,0x01,0x08,0x05,0x82,0x02,0x1A,0x01,0x0A,
+0x01,0x01,0x0A,0x02,0x01,0x09,0x03,0x01,0x08,0x05,0x01,0x07,0x07,0x01,0x07,0x08,
+0x01,0x06,0x0A,0x01,0x05,0x0C,0x01,0x04,0x0E,0x01,0x03,0x10,0x01,0x02,0x12,0x01,
+0x01,0x14,0x81,0x01,0x00,0x16,0x83,0x03,0x01,0x08,0x0A,0x01,0x0C,0x09,0x03,0x01,
+0x07,0x09,0x03,0x0D,0x08,0x03,0x03,0x04,0x09,0x03,0x0F,0x04,0x01,0x09,0x03,0x82,
+0x01,0x08,0x05,0x82,0xFF,0xFF,0xFF,0xFF,0x02,0x1A,0x01,0x12,0x02,0x01,0x0E,0x06,
+0x01,0x0A,0x0A,0x01,0x0B,0x09,0x02,0x0B,0x02,0x0F,0x06,0x01,0x0F,0x06,0x02,0x0E,
+0x03,0x13,0x02,0x02,0x0D,0x04,0x13,0x03,0x02,0x0D,0x03,0x13,0x03,0x02,0x06,0x09,
+0x13,0x01,0x01,0x04,0x0B,0x01,0x03,0x0C,0x02,0x02,0x04,0x0C,0x04,0x02,0x01,0x04,
+0x0D,0x04,0x02,0x01,0x03,0x0E,0x03,0x02,0x00,0x03,0x0F,0x03,0x84,0x02,0x01,0x03,
+0x0E,0x03,0x02,0x01,0x04,0x0D,0x04,0x02,0x02,0x04,0x0C,0x04,0x01,0x03,0x0C,0x01,
+0x04,0x0A,0x01,0x06,0x06,0x02,0x1A,0x01,0x08,0x06,0x01,0x06,0x0A,0x01,0x05,0x0C,
+0x02,0x04,0x04,0x0E,0x04,0x02,0x03,0x04,0x0F,0x04,0x02,0x03,0x03,0x10,0x03,0x02,
+0x02,0x03,0x11,0x03,0x84,0x02,0x03,0x03,0x10,0x04,0x02,0x03,0x04,0x0F,0x04,0x02,
+0x04,0x05,0x0E,0x04,0x01,0x05,0x0D,0x01,0x06,0x0B,0x01,0x08,0x07,0x01,0x0A,0x03,
+0x81,0x01,0x06,0x0B,0x82,0x01,0x0A,0x03,0x83,0xFF,0x02,0x1F,0x01,0x13,0x01,0x01,
+0x11,0x03,0x01,0x0E,0x06,0x01,0x0C,0x08,0x01,0x0A,0x0A,0x02,0x08,0x08,0x12,0x02,
+0x02,0x07,0x07,0x12,0x02,0x02,0x07,0x05,0x12,0x02,0x02,0x07,0x03,0x12,0x02,0x02,
+0x07,0x02,0x12,0x02,0x89,0x02,0x07,0x02,0x0E,0x06,0x02,0x07,0x02,0x0C,0x08,0x02,
+0x07,0x02,0x0B,0x08,0x81,0x02,0x07,0x02,0x0B,0x07,0x02,0x07,0x02,0x0C,0x04,0x01,
+0x03,0x06,0x01,0x01,0x08,0x01,0x00,0x08,0x81,0x01,0x00,0x07,0x01,0x01,0x04,0x06,
+0x14,0x01,0x0A,0x03,0x81,0x03,0x04,0x01,0x0A,0x03,0x11,0x01,0x03,0x03,0x04,0x08,
+0x06,0x10,0x03,0x01,0x04,0x0E,0x01,0x05,0x0C,0x02,0x05,0x04,0x0D,0x04,0x02,0x04,
+0x04,0x0E,0x04,0x02,0x01,0x06,0x0F,0x06,0x82,0x02,0x04,0x03,0x0F,0x03,0x02,0x04,
+0x04,0x0E,0x04,0x02,0x05,0x04,0x0D,0x04,0x01,0x05,0x0D,0x01,0x04,0x0E,0x03,0x03,
+0x03,0x08,0x06,0x10,0x03,0x03,0x04,0x01,0x0A,0x03,0x11,0x01,0x01,0x0A,0x03,0x81,
+0x07,0x15,0x01,0x01,0x01,0x01,0x01,0x03,0x01,0x01,0x05,0x01,0x01,0x07,0x01,0x01,
+0x09,0x01,0x01,0x0A,0x01,0x01,0x0C,0x01,0x01,0x0E,0x01,0x01,0x10,0x01,0x01,0x12,
+0x01,0x01,0x14,0x01,0x01,0x12,0x01,0x01,0x10,0x01,0x01,0x0E,0x01,0x01,0x0C,0x01,
+0x01,0x0A,0x01,0x01,0x09,0x01,0x01,0x07,0x01,0x01,0x05,0x01,0x01,0x03,0x01,0x01,
+0x01,0x07,0x15,0x01,0x14,0x01,0x01,0x12,0x03,0x01,0x10,0x05,0x01,0x0E,0x07,0x01,
+0x0C,0x09,0x01,0x0B,0x0A,0x01,0x09,0x0C,0x01,0x07,0x0E,0x01,0x05,0x10,0x01,0x03,
+0x12,0x01,0x01,0x14,0x01,0x03,0x12,0x01,0x05,0x10,0x01,0x07,0x0E,0x01,0x09,0x0C,
+0x01,0x0B,0x0A,0x01,0x0C,0x09,0x01,0x0E,0x07,0x01,0x10,0x05,0x01,0x12,0x03,0x01,
+0x14,0x01,0x02,0x1F,0x01,0x0B,0x01,0x01,0x0A,0x03,0x01,0x09,0x05,0x01,0x08,0x07,
+0x01,0x07,0x09,0x03,0x06,0x03,0x0A,0x03,0x0E,0x03,0x03,0x06,0x01,0x0A,0x03,0x10,
+0x01,0x01,0x0A,0x03,0x90,0x03,0x06,0x01,0x0A,0x03,0x10,0x01,0x03,0x06,0x03,0x0A,
+0x03,0x0E,0x03,0x01,0x07,0x09,0x01,0x08,0x07,0x01,0x09,0x05,0x01,0x0A,0x03,0x01,
+0x0B,0x01,0x02,0x1A,0x02,0x05,0x03,0x0D,0x03,0x92,0x00,0x82,0x02,0x05,0x03,0x0D,
+0x03,0x83,0x02,0x1F,0x01,0x05,0x0D,0x01,0x03,0x0F,0x02,0x03,0x08,0x10,0x02,0x02,
+0x02,0x09,0x10,0x02,0x85,0x02,0x03,0x08,0x10,0x02,0x02,0x04,0x07,0x10,0x02,0x02,
+0x05,0x06,0x10,0x02,0x02,0x07,0x04,0x10,0x02,0x02,0x09,0x02,0x10,0x02,0x91,0x02,
+0x20,0x01,0x08,0x08,0x01,0x06,0x0B,0x01,0x05,0x0C,0x02,0x05,0x04,0x0F,0x02,0x01,
+0x04,0x03,0x82,0x01,0x04,0x04,0x01,0x05,0x05,0x01,0x05,0x07,0x01,0x06,0x08,0x01,
+0x06,0x09,0x02,0x05,0x03,0x0B,0x06,0x02,0x04,0x03,0x0D,0x04,0x02,0x04,0x03,0x0E,
+0x04,0x02,0x04,0x03,0x0F,0x03,0x02,0x04,0x04,0x0F,0x03,0x02,0x04,0x05,0x0F,0x03,
+0x02,0x05,0x05,0x0F,0x02,0x02,0x06,0x07,0x0E,0x03,0x01,0x07,0x09,0x01,0x09,0x07,
+0x01,0x0B,0x06,0x01,0x0D,0x04,0x01,0x0E,0x04,0x01,0x0F,0x03,0x81,0x02,0x04,0x01,
+0x0F,0x03,0x02,0x04,0x04,0x0D,0x04,0x01,0x04,0x0D,0x01,0x04,0x0C,0x01,0x07,0x07,
+0x0B,0x06,0x01,0x01,0x14,0x85,0x00,0x23,0x01,0x0B,0x01,0x01,0x0A,0x03,0x81,0x01,
+0x08,0x07,0x01,0x07,0x09,0x03,0x06,0x03,0x0A,0x03,0x0E,0x03,0x03,0x06,0x01,0x0A,
+0x03,0x10,0x01,0x01,0x0A,0x03,0x8F,0x03,0x06,0x01,0x0A,0x03,0x10,0x01,0x03,0x06,
+0x03,0x0A,0x03,0x0E,0x03,0x01,0x07,0x09,0x01,0x08,0x07,0x01,0x09,0x05,0x01,0x0A,
+0x03,0x01,0x0B,0x01,0x00,0x81,0x01,0x06,0x0B,0x82,0x02,0x1F,0x01,0x0B,0x01,0x01,
+0x0A,0x03,0x01,0x09,0x05,0x01,0x08,0x07,0x01,0x07,0x09,0x03,0x06,0x03,0x0A,0x03,
+0x0E,0x03,0x03,0x06,0x01,0x0A,0x03,0x10,0x01,0x01,0x0A,0x03,0x97,0x02,0x1F,0x01,
+0x0A,0x03,0x97,0x03,0x06,0x01,0x0A,0x03,0x10,0x01,0x03,0x06,0x03,0x0A,0x03,0x0E,
+0x03,0x01,0x07,0x09,0x01,0x08,0x07,0x01,0x09,0x05,0x01,0x0A,0x03,0x01,0x0B,0x01,
+0x0C,0x0B,0x01,0x0D,0x02,0x01,0x0E,0x02,0x01,0x0E,0x03,0x01,0x0F,0x03,0x01,0x02,
+0x11,0x01,0x02,0x12,0x01,0x02,0x11,0x01,0x0F,0x03,0x01,0x0E,0x03,0x01,0x0E,0x02,
+0x01,0x0D,0x02,0x0C,0x0B,0x01,0x07,0x02,0x01,0x06,0x02,0x01,0x05,0x03,0x01,0x04,
+0x03,0x01,0x03,0x11,0x01,0x02,0x12,0x01,0x03,0x11,0x01,0x04,0x03,0x01,0x05,0x03,
+0x01,0x06,0x02,0x01,0x07,0x02,0x09,0x13,0x01,0x02,0x03,0x8F,0x01,0x02,0x12,0x82,
+0x0C,0x0B,0x02,0x07,0x02,0x0D,0x02,0x02,0x06,0x02,0x0E,0x02,0x02,0x05,0x03,0x0E,
+0x03,0x02,0x04,0x03,0x0F,0x03,0x01,0x03,0x10,0x01,0x02,0x12,0x01,0x03,0x10,0x02,
+0x04,0x03,0x0F,0x03,0x02,0x05,0x03,0x0E,0x03,0x02,0x06,0x02,0x0E,0x02,0x02,0x07,
+0x02,0x0D,0x02,0x07,0x15,0x01,0x0A,0x01,0x81,0x01,0x09,0x03,0x81,0x01,0x08,0x05,
+0x81,0x01,0x08,0x06,0x01,0x07,0x07,0x01,0x07,0x08,0x01,0x06,0x09,0x01,0x06,0x0A,
+0x01,0x05,0x0B,0x01,0x05,0x0C,0x01,0x04,0x0D,0x01,0x04,0x0E,0x01,0x03,0x0F,0x01,
+0x03,0x10,0x81,0x01,0x02,0x12,0x81,0x01,0x01,0x14,0x07,0x15,0x01,0x01,0x14,0x01,
+0x02,0x12,0x81,0x01,0x03,0x10,0x81,0x01,0x03,0x0F,0x01,0x04,0x0E,0x01,0x04,0x0D,
+0x01,0x05,0x0C,0x01,0x05,0x0B,0x01,0x06,0x0A,0x01,0x06,0x09,0x01,0x07,0x08,0x01,
+0x07,0x07,0x01,0x08,0x06,0x01,0x08,0x05,0x81,0x01,0x09,0x03,0x81,0x01,0x0A,0x01,
+0x81,0xFF,0x02,0x1A,0x01,0x09,0x03,0x92,0x00,0x82,0x01,0x09,0x03,0x83,0x00,0x0A,
+0x02,0x04,0x04,0x0D,0x04,0x85,0x02,0x05,0x02,0x0E,0x02,0x83,0x02,0x1A,0x02,0x09,
+0x03,0x10,0x03,0x81,0x02,0x08,0x03,0x0F,0x03,0x83,0x02,0x07,0x03,0x0E,0x03,0x01,
+0x02,0x13,0x82,0x02,0x06,0x03,0x0D,0x03,0x84,0x01,0x01,0x12,0x82,0x02,0x05,0x03,
+0x0C,0x03,0x02,0x04,0x03,0x0B,0x03,0x84,0x02,0x03,0x03,0x0A,0x03,0x81,0x00,0x1E,
+0x01,0x0A,0x02,0x81,0x01,0x08,0x07,0x01,0x06,0x0B,0x01,0x05,0x0C,0x03,0x05,0x04,
+0x0A,0x02,0x0F,0x02,0x02,0x04,0x04,0x0A,0x02,0x02,0x04,0x03,0x0A,0x02,0x82,0x02,
+0x04,0x04,0x0A,0x02,0x02,0x05,0x04,0x0A,0x02,0x01,0x06,0x06,0x01,0x07,0x05,0x01,
+0x08,0x05,0x01,0x09,0x06,0x01,0x0A,0x06,0x01,0x0A,0x07,0x02,0x0A,0x02,0x0E,0x03,
+0x02,0x0A,0x02,0x0E,0x04,0x02,0x0A,0x02,0x0F,0x03,0x82,0x03,0x03,0x01,0x0A,0x02,
+0x0E,0x04,0x03,0x03,0x03,0x0A,0x02,0x0D,0x04,0x01,0x03,0x0E,0x01,0x03,0x0D,0x01,
+0x06,0x08,0x01,0x0A,0x02,0x81,0x02,0x1A,0x02,0x03,0x05,0x13,0x03,0x02,0x02,0x07,
+0x12,0x03,0x03,0x01,0x03,0x07,0x03,0x11,0x03,0x03,0x00,0x03,0x08,0x03,0x10,0x03,
+0x81,0x03,0x00,0x03,0x08,0x03,0x0F,0x03,0x03,0x00,0x03,0x08,0x03,0x0E,0x03,0x81,
+0x03,0x00,0x03,0x08,0x03,0x0D,0x03,0x03,0x01,0x03,0x07,0x03,0x0C,0x03,0x02,0x02,
+0x07,0x0B,0x03,0x02,0x03,0x05,0x0B,0x03,0x01,0x0A,0x03,0x01,0x09,0x03,0x02,0x08,
+0x03,0x0E,0x05,0x02,0x08,0x03,0x0D,0x07,0x03,0x07,0x03,0x0C,0x03,0x12,0x03,0x03,
+0x06,0x03,0x0B,0x03,0x13,0x03,0x03,0x05,0x03,0x0B,0x03,0x13,0x03,0x81,0x03,0x04,
+0x03,0x0B,0x03,0x13,0x03,0x03,0x03,0x03,0x0B,0x03,0x13,0x03,0x81,0x03,0x02,0x03,
+0x0C,0x03,0x12,0x03,0x02,0x01,0x03,0x0D,0x07,0x02,0x00,0x03,0x0E,0x05,0x02,0x1A,
+0x01,0x08,0x05,0x01,0x07,0x08,0x01,0x06,0x09,0x02,0x05,0x04,0x0C,0x04,0x02,0x05,
+0x03,0x0D,0x03,0x82,0x02,0x05,0x03,0x0C,0x03,0x02,0x06,0x03,0x0B,0x04,0x01,0x06,
+0x08,0x01,0x06,0x06,0x01,0x05,0x06,0x02,0x03,0x08,0x13,0x03,0x03,0x02,0x04,0x08,
+0x03,0x13,0x03,0x03,0x01,0x04,0x09,0x03,0x13,0x03,0x03,0x01,0x03,0x09,0x04,0x13,
+0x03,0x03,0x00,0x03,0x0A,0x04,0x13,0x02,0x03,0x00,0x03,0x0A,0x04,0x12,0x03,0x03,
+0x00,0x03,0x0B,0x04,0x12,0x03,0x03,0x00,0x03,0x0C,0x04,0x11,0x03,0x02,0x00,0x04,
+0x0D,0x07,0x02,0x01,0x04,0x0D,0x06,0x02,0x01,0x06,0x0E,0x05,0x01,0x02,0x12,0x01,
+0x03,0x11,0x02,0x06,0x07,0x11,0x04,0x00,0x0A,0x01,0x08,0x04,0x85,0x01,0x09,0x02,
+0x83,0x00,0x21,0x01,0x11,0x02,0x01,0x0E,0x05,0x01,0x0C,0x05,0x01,0x0B,0x04,0x01,
+0x0A,0x04,0x01,0x09,0x04,0x01,0x09,0x03,0x01,0x08,0x03,0x81,0x01,0x07,0x03,0x82,
+0x01,0x06,0x03,0x88,0x01,0x07,0x03,0x82,0x01,0x08,0x03,0x81,0x01,0x09,0x03,0x01,
+0x09,0x04,0x01,0x0A,0x04,0x01,0x0B,0x04,0x01,0x0C,0x05,0x01,0x0E,0x05,0x01,0x11,
+0x02,0x00,0x21,0x01,0x03,0x03,0x01,0x03,0x05,0x01,0x05,0x05,0x01,0x07,0x04,0x01,
+0x08,0x04,0x01,0x09,0x04,0x01,0x0A,0x03,0x01,0x0B,0x03,0x81,0x01,0x0C,0x03,0x82,
+0x01,0x0D,0x03,0x88,0x01,0x0C,0x03,0x82,0x01,0x0B,0x03,0x81,0x01,0x0A,0x03,0x01,
+0x09,0x04,0x01,0x08,0x04,0x01,0x07,0x04,0x01,0x05,0x05,0x01,0x03,0x05,0x01,0x03,
+0x02,0x02,0x0F,0x01,0x09,0x03,0x83,0x03,0x04,0x02,0x09,0x03,0x10,0x02,0x03,0x03,
+0x05,0x0A,0x01,0x0E,0x05,0x02,0x03,0x06,0x0D,0x06,0x02,0x05,0x04,0x0D,0x04,0x00,
+0x02,0x08,0x02,0x0C,0x02,0x01,0x07,0x08,0x02,0x06,0x04,0x0C,0x04,0x02,0x05,0x04,
+0x0D,0x04,0x02,0x05,0x03,0x0E,0x03,0x02,0x07,0x01,0x0E,0x01,0x09,0x13,0x01,0x0A,
+0x03,0x87,0x01,0x02,0x13,0x82,0x01,0x0A,0x03,0x87,0x17,0x0B,0x01,0x08,0x05,0x84,
+0x01,0x0A,0x03,0x81,0x01,0x0A,0x02,0x01,0x09,0x03,0x01,0x08,0x03,0x01,0x08,0x02,
+0x0F,0x03,0x01,0x04,0x0E,0x82,0x17,0x05,0x01,0x08,0x05,0x84,0x00,0x21,0x01,0x12,
+0x03,0x01,0x11,0x03,0x81,0x01,0x10,0x03,0x81,0x01,0x0F,0x03,0x81,0x01,0x0E,0x03,
+0x81,0x01,0x0D,0x03,0x81,0x01,0x0C,0x03,0x81,0x01,0x0B,0x03,0x81,0x01,0x0A,0x03,
+0x01,0x09,0x04,0x01,0x09,0x03,0x01,0x08,0x03,0x81,0x01,0x07,0x03,0x81,0x01,0x06,
+0x03,0x81,0x01,0x05,0x03,0x81,0x01,0x04,0x03,0x81,0x01,0x03,0x03,0x81,0x01,0x02,
+0x03,0x81,0x01,0x01,0x03,0x02,0x1A,0x01,0x08,0x05,0x01,0x06,0x09,0x01,0x05,0x0B,
+0x02,0x04,0x04,0x0D,0x04,0x02,0x04,0x03,0x0E,0x03,0x02,0x03,0x03,0x0F,0x03,0x82,
+0x02,0x02,0x03,0x10,0x03,0x89,0x02,0x03,0x03,0x0F,0x03,0x82,0x02,0x04,0x03,0x0E,
+0x03,0x02,0x04,0x04,0x0D,0x04,0x01,0x05,0x0B,0x01,0x06,0x09,0x01,0x08,0x05,0x02,
+0x1A,0x01,0x0B,0x02,0x01,0x08,0x05,0x01,0x05,0x08,0x01,0x03,0x0A,0x02,0x03,0x04,
+0x0A,0x03,0x01,0x0A,0x03,0x91,0x01,0x03,0x11,0x82,0x02,0x1A,0x01,0x07,0x06,0x01,
+0x04,0x0B,0x01,0x04,0x0C,0x02,0x04,0x03,0x0C,0x04,0x02,0x04,0x01,0x0D,0x04,0x01,
+0x0E,0x03,0x84,0x01,0x0D,0x03,0x01,0x0C,0x04,0x01,0x0C,0x03,0x01,0x0B,0x03,0x01,
+0x0A,0x03,0x01,0x09,0x03,0x01,0x08,0x03,0x01,0x07,0x03,0x01,0x06,0x03,0x01,0x05,
+0x03,0x81,0x01,0x04,0x03,0x01,0x03,0x04,0x01,0x03,0x0E,0x82,0x02,0x1A,0x01,0x06,
+0x07,0x01,0x04,0x0B,0x01,0x04,0x0C,0x02,0x04,0x02,0x0C,0x05,0x01,0x0E,0x03,0x83,
+0x01,0x0D,0x03,0x01,0x0B,0x04,0x01,0x06,0x08,0x81,0x01,0x06,0x09,0x01,0x0B,0x05,
+0x01,0x0D,0x04,0x01,0x0E,0x04,0x01,0x0F,0x03,0x83,0x01,0x0E,0x04,0x01,0x0E,0x03,
+0x02,0x04,0x02,0x0C,0x05,0x01,0x04,0x0C,0x01,0x04,0x0B,0x01,0x05,0x08,0x02,0x1A,
+0x01,0x0D,0x03,0x01,0x0C,0x04,0x01,0x0B,0x05,0x81,0x01,0x0A,0x06,0x02,0x09,0x03,
+0x0D,0x03,0x81,0x02,0x08,0x03,0x0D,0x03,0x02,0x07,0x03,0x0D,0x03,0x81,0x02,0x06,
+0x03,0x0D,0x03,0x02,0x05,0x03,0x0D,0x03,0x02,0x04,0x03,0x0D,0x03,0x81,0x02,0x03,
+0x03,0x0D,0x03,0x02,0x02,0x03,0x0D,0x03,0x01,0x02,0x11,0x82,0x01,0x0D,0x03,0x86,
+0x02,0x1A,0x01,0x05,0x0B,0x82,0x01,0x05,0x03,0x86,0x01,0x05,0x07,0x01,0x05,0x09,
+0x01,0x05,0x0A,0x01,0x0B,0x05,0x01,0x0C,0x04,0x01,0x0D,0x04,0x01,0x0E,0x03,0x83,
+0x01,0x0D,0x04,0x01,0x0D,0x03,0x02,0x05,0x02,0x0C,0x04,0x01,0x05,0x0A,0x01,0x05,
+0x09,0x01,0x06,0x06,0x02,0x1A,0x01,0x0A,0x06,0x01,0x08,0x0A,0x01,0x07,0x0B,0x02,
+0x06,0x04,0x10,0x02,0x01,0x05,0x04,0x01,0x05,0x03,0x01,0x04,0x03,0x82,0x01,0x03,
+0x03,0x02,0x03,0x03,0x09,0x05,0x02,0x03,0x03,0x08,0x08,0x02,0x03,0x03,0x07,0x0A,
+0x02,0x03,0x06,0x0D,0x05,0x02,0x03,0x04,0x0F,0x03,0x02,0x03,0x04,0x0F,0x04,0x02,
+0x03,0x04,0x10,0x03,0x02,0x03,0x03,0x10,0x03,0x81,0x02,0x04,0x03,0x10,0x03,0x81,
+0x02,0x04,0x04,0x0F,0x03,0x02,0x05,0x04,0x0E,0x04,0x01,0x06,0x0B,0x01,0x07,0x09,
+0x01,0x08,0x06,0x02,0x1A,0x01,0x04,0x10,0x82,0x01,0x10,0x03,0x81,0x01,0x0F,0x03,
+0x81,0x01,0x0E,0x03,0x01,0x0D,0x03,0x81,0x01,0x0C,0x03,0x81,0x01,0x0B,0x03,0x01,
+0x0A,0x04,0x01,0x0A,0x03,0x01,0x09,0x04,0x01,0x09,0x03,0x01,0x08,0x04,0x01,0x08,
+0x03,0x01,0x07,0x04,0x01,0x07,0x03,0x01,0x06,0x04,0x81,0x01,0x05,0x04,0x82,0x02,
+0x1A,0x01,0x08,0x07,0x01,0x06,0x0A,0x01,0x05,0x0C,0x02,0x05,0x03,0x0D,0x05,0x02,
+0x04,0x03,0x0F,0x03,0x82,0x02,0x04,0x04,0x0F,0x03,0x02,0x05,0x03,0x0E,0x03,0x02,
+0x05,0x05,0x0D,0x03,0x02,0x06,0x05,0x0C,0x03,0x01,0x07,0x07,0x01,0x07,0x08,0x02,
+0x05,0x04,0x0A,0x06,0x02,0x05,0x03,0x0C,0x05,0x02,0x04,0x03,0x0D,0x05,0x02,0x03,
+0x03,0x0F,0x04,0x81,0x02,0x03,0x03,0x10,0x03,0x82,0x02,0x03,0x04,0x0F,0x04,0x02,
+0x04,0x05,0x0E,0x04,0x01,0x05,0x0C,0x01,0x06,0x0A,0x01,0x08,0x06,0x02,0x1A,0x01,
+0x08,0x06,0x01,0x06,0x09,0x01,0x05,0x0B,0x02,0x04,0x04,0x0D,0x04,0x02,0x04,0x03,
+0x0E,0x04,0x02,0x03,0x03,0x0F,0x03,0x81,0x02,0x03,0x03,0x10,0x03,0x81,0x02,0x03,
+0x03,0x0F,0x04,0x02,0x03,0x04,0x0F,0x04,0x02,0x04,0x03,0x0E,0x05,0x02,0x04,0x05,
+0x0D,0x06,0x02,0x05,0x0A,0x10,0x03,0x02,0x06,0x08,0x10,0x03,0x02,0x07,0x06,0x10,
+0x03,0x01,0x10,0x03,0x01,0x0F,0x03,0x82,0x01,0x0E,0x03,0x01,0x0D,0x04,0x02,0x04,
+0x02,0x0C,0x04,0x01,0x04,0x0B,0x01,0x04,0x0A,0x01,0x06,0x06,0x09,0x13,0x01,0x08,
+0x05,0x84,0x00,0x88,0x01,0x08,0x05,0x84,0x09,0x19,0x01,0x08,0x05,0x84,0x00,0x88,
+0x01,0x08,0x05,0x84,0x01,0x0A,0x03,0x81,0x01,0x0A,0x02,0x01,0x09,0x03,0x01,0x08,
+0x03,0x01,0x08,0x02,0x09,0x13,0x01,0x13,0x01,0x01,0x11,0x03,0x01,0x0F,0x05,0x01,
+0x0D,0x06,0x01,0x0B,0x06,0x01,0x0A,0x05,0x01,0x08,0x05,0x01,0x06,0x05,0x01,0x04,
+0x06,0x01,0x02,0x06,0x01,0x04,0x05,0x01,0x06,0x05,0x01,0x08,0x05,0x01,0x0A,0x05,
+0x01,0x0B,0x06,0x01,0x0D,0x06,0x01,0x0F,0x05,0x01,0x11,0x03,0x01,0x13,0x01,0x0D,
+0x0A,0x01,0x02,0x12,0x82,0x00,0x83,0x01,0x02,0x12,0x82,0x09,0x13,0x01,0x02,0x01,
+0x01,0x02,0x03,0x01,0x02,0x05,0x01,0x03,0x06,0x01,0x05,0x06,0x01,0x07,0x05,0x01,
+0x09,0x05,0x01,0x0B,0x05,0x01,0x0C,0x06,0x01,0x0E,0x06,0x01,0x0D,0x05,0x01,0x0B,
+0x05,0x01,0x09,0x05,0x01,0x07,0x05,0x01,0x05,0x06,0x01,0x03,0x06,0x01,0x02,0x05,
+0x01,0x02,0x03,0x01,0x02,0x01,0x02,0x1A,0x01,0x05,0x09,0x01,0x03,0x0E,0x01,0x03,
+0x0F,0x02,0x03,0x03,0x0E,0x05,0x02,0x03,0x03,0x0F,0x04,0x02,0x03,0x03,0x10,0x03,
+0x01,0x10,0x03,0x81,0x01,0x0F,0x03,0x01,0x0E,0x03,0x01,0x0D,0x03,0x01,0x0C,0x03,
+0x01,0x0B,0x03,0x01,0x0A,0x03,0x01,0x09,0x03,0x01,0x09,0x02,0x01,0x08,0x03,0x82,
+0x00,0x82,0x01,0x08,0x03,0x83,0x02,0x1A,0x01,0x09,0x07,0x01,0x07,0x0B,0x02,0x06,
+0x04,0x0F,0x04,0x02,0x05,0x03,0x10,0x03,0x02,0x04,0x03,0x11,0x03,0x02,0x03,0x03,
+0x0C,0x08,0x02,0x03,0x03,0x0B,0x09,0x03,0x02,0x03,0x0A,0x03,0x11,0x03,0x03,0x02,
+0x03,0x09,0x03,0x11,0x03,0x03,0x01,0x04,0x09,0x03,0x11,0x03,0x03,0x01,0x03,0x09,
+0x02,0x11,0x03,0x03,0x01,0x03,0x08,0x03,0x11,0x03,0x03,0x01,0x03,0x08,0x03,0x10,
+0x04,0x81,0x03,0x01,0x03,0x08,0x03,0x0F,0x05,0x81,0x04,0x01,0x03,0x08,0x03,0x0E,
+0x02,0x11,0x03,0x04,0x01,0x03,0x08,0x04,0x0D,0x03,0x11,0x03,0x03,0x02,0x03,0x09,
+0x06,0x11,0x03,0x03,0x02,0x03,0x09,0x06,0x11,0x05,0x03,0x03,0x03,0x0A,0x04,0x11,
+0x05,0x01,0x03,0x03,0x01,0x04,0x03,0x02,0x05,0x04,0x0F,0x02,0x01,0x06,0x0B,0x01,
+0x08,0x07,0x05,0x17,0x01,0x09,0x04,0x01,0x08,0x05,0x01,0x08,0x06,0x81,0x02,0x07,
+0x03,0x0B,0x03,0x02,0x07,0x03,0x0B,0x04,0x02,0x06,0x03,0x0C,0x03,0x02,0x06,0x03,
+0x0C,0x04,0x02,0x06,0x03,0x0D,0x03,0x02,0x05,0x03,0x0D,0x03,0x02,0x05,0x03,0x0D,
+0x04,0x02,0x04,0x03,0x0E,0x03,0x02,0x04,0x03,0x0E,0x04,0x02,0x04,0x03,0x0F,0x03,
+0x01,0x03,0x0F,0x01,0x03,0x10,0x81,0x02,0x02,0x03,0x10,0x04,0x02,0x02,0x03,0x11,
+0x03,0x02,0x01,0x04,0x11,0x04,0x02,0x01,0x03,0x12,0x03,0x81,0x02,0x00,0x03,0x13,
+0x03,0x05,0x17,0x01,0x03,0x0B,0x01,0x03,0x0D,0x01,0x03,0x0E,0x02,0x03,0x03,0x0D,
+0x05,0x02,0x03,0x03,0x0F,0x03,0x82,0x02,0x03,0x03,0x0E,0x03,0x02,0x03,0x03,0x0C,
+0x05,0x01,0x03,0x0C,0x01,0x03,0x0A,0x01,0x03,0x0D,0x02,0x03,0x03,0x0C,0x05,0x02,
+0x03,0x03,0x0E,0x04,0x02,0x03,0x03,0x0F,0x04,0x02,0x03,0x03,0x10,0x03,0x83,0x02,
+0x03,0x03,0x0E,0x04,0x01,0x03,0x0F,0x01,0x03,0x0E,0x01,0x03,0x0C,0x05,0x17,0x01,
+0x0A,0x09,0x01,0x08,0x0D,0x01,0x06,0x0F,0x02,0x05,0x06,0x12,0x03,0x01,0x04,0x05,
+0x01,0x04,0x03,0x01,0x03,0x04,0x01,0x03,0x03,0x01,0x02,0x03,0x85,0x01,0x02,0x04,
+0x01,0x03,0x03,0x01,0x03,0x04,0x01,0x03,0x05,0x01,0x04,0x05,0x02,0x05,0x06,0x12,
+0x03,0x01,0x06,0x0F,0x01,0x08,0x0D,0x01,0x0A,0x08,0x05,0x17,0x01,0x02,0x0A,0x01,
+0x02,0x0D,0x01,0x02,0x0E,0x02,0x02,0x03,0x0C,0x05,0x02,0x02,0x03,0x0E,0x04,0x02,
+0x02,0x03,0x0F,0x03,0x81,0x02,0x02,0x03,0x0F,0x04,0x02,0x02,0x03,0x10,0x03,0x86,
+0x02,0x02,0x03,0x0F,0x03,0x81,0x02,0x02,0x03,0x0E,0x04,0x02,0x02,0x03,0x0D,0x04,
+0x02,0x02,0x03,0x0B,0x06,0x01,0x02,0x0E,0x01,0x02,0x0C,0x01,0x02,0x0A,0x05,0x17,
+0x01,0x04,0x0F,0x82,0x01,0x04,0x03,0x86,0x01,0x04,0x0D,0x82,0x01,0x04,0x03,0x86,
+0x01,0x04,0x10,0x82,0x05,0x17,0x01,0x04,0x10,0x82,0x01,0x04,0x03,0x86,0x01,0x04,
+0x0E,0x82,0x01,0x04,0x03,0x89,0x05,0x17,0x01,0x09,0x09,0x01,0x07,0x0D,0x01,0x05,
+0x0F,0x02,0x04,0x06,0x11,0x03,0x01,0x03,0x05,0x01,0x03,0x03,0x01,0x02,0x04,0x01,
+0x02,0x03,0x01,0x01,0x03,0x82,0x02,0x01,0x03,0x0C,0x08,0x82,0x02,0x01,0x04,0x11,
+0x03,0x02,0x02,0x03,0x11,0x03,0x02,0x02,0x04,0x11,0x03,0x02,0x02,0x05,0x11,0x03,
+0x02,0x03,0x05,0x11,0x03,0x02,0x04,0x07,0x11,0x03,0x01,0x05,0x0F,0x01,0x07,0x0D,
+0x01,0x09,0x09,0x05,0x17,0x02,0x03,0x03,0x10,0x03,0x89,0x01,0x03,0x10,0x82,0x02,
+0x03,0x03,0x10,0x03,0x89,0x05,0x17,0x01,0x03,0x0F,0x82,0x01,0x09,0x03,0x90,0x01,
+0x03,0x0F,0x82,0x05,0x17,0x01,0x05,0x0B,0x82,0x01,0x0D,0x03,0x8E,0x01,0x0C,0x03,
+0x02,0x03,0x01,0x0B,0x04,0x01,0x03,0x0B,0x01,0x03,0x0A,0x01,0x04,0x07,0x05,0x17,
+0x02,0x03,0x03,0x0F,0x04,0x02,0x03,0x03,0x0E,0x04,0x02,0x03,0x03,0x0D,0x04,0x02,
+0x03,0x03,0x0C,0x04,0x02,0x03,0x03,0x0B,0x04,0x02,0x03,0x03,0x0B,0x03,0x02,0x03,
+0x03,0x0A,0x04,0x02,0x03,0x03,0x09,0x04,0x02,0x03,0x03,0x08,0x04,0x02,0x03,0x03,
+0x07,0x04,0x02,0x03,0x03,0x07,0x03,0x01,0x03,0x08,0x02,0x03,0x03,0x07,0x04,0x02,
+0x03,0x03,0x08,0x04,0x02,0x03,0x03,0x09,0x04,0x02,0x03,0x03,0x0A,0x04,0x02,0x03,
+0x03,0x0B,0x04,0x02,0x03,0x03,0x0C,0x04,0x02,0x03,0x03,0x0D,0x04,0x02,0x03,0x03,
+0x0E,0x04,0x02,0x03,0x03,0x0F,0x04,0x02,0x03,0x03,0x10,0x04,0x02,0x03,0x03,0x10,
+0x05,0x05,0x17,0x01,0x04,0x03,0x93,0x01,0x04,0x10,0x82,0x05,0x17,0x02,0x02,0x05,
+0x10,0x05,0x81,0x02,0x02,0x06,0x10,0x05,0x02,0x02,0x06,0x0F,0x06,0x81,0x04,0x02,
+0x03,0x06,0x03,0x0F,0x02,0x12,0x03,0x04,0x02,0x03,0x06,0x03,0x0E,0x03,0x12,0x03,
+0x81,0x04,0x02,0x03,0x07,0x03,0x0E,0x02,0x12,0x03,0x04,0x02,0x03,0x07,0x03,0x0D,
+0x03,0x12,0x03,0x04,0x02,0x03,0x07,0x03,0x0D,0x02,0x12,0x03,0x04,0x02,0x03,0x08,
+0x03,0x0D,0x02,0x12,0x03,0x04,0x02,0x03,0x08,0x03,0x0C,0x03,0x12,0x03,0x04,0x02,
+0x03,0x08,0x03,0x0C,0x02,0x12,0x03,0x03,0x02,0x03,0x09,0x05,0x12,0x03,0x81,0x03,
+0x02,0x03,0x0A,0x03,0x12,0x03,0x81,0x02,0x02,0x03,0x12,0x03,0x84,0x05,0x17,0x02,
+0x03,0x04,0x11,0x03,0x81,0x02,0x03,0x05,0x11,0x03,0x02,0x03,0x06,0x11,0x03,0x81,
+0x02,0x03,0x07,0x11,0x03,0x03,0x03,0x03,0x07,0x03,0x11,0x03,0x03,0x03,0x03,0x08,
+0x03,0x11,0x03,0x03,0x03,0x03,0x08,0x04,0x11,0x03,0x03,0x03,0x03,0x09,0x03,0x11,
+0x03,0x03,0x03,0x03,0x09,0x04,0x11,0x03,0x03,0x03,0x03,0x0A,0x03,0x11,0x03,0x03,
+0x03,0x03,0x0A,0x04,0x11,0x03,0x03,0x03,0x03,0x0B,0x03,0x11,0x03,0x03,0x03,0x03,
+0x0C,0x03,0x11,0x03,0x03,0x03,0x03,0x0C,0x04,0x11,0x03,0x03,0x03,0x03,0x0D,0x03,
+0x11,0x03,0x02,0x03,0x03,0x0D,0x07,0x02,0x03,0x03,0x0E,0x06,0x02,0x03,0x03,0x0F,
+0x05,0x81,0x02,0x03,0x03,0x10,0x04,0x81,0x05,0x17,0x01,0x07,0x07,0x01,0x05,0x0B,
+0x01,0x04,0x0D,0x02,0x03,0x05,0x0D,0x05,0x02,0x03,0x03,0x0F,0x03,0x02,0x02,0x03,
+0x10,0x03,0x81,0x02,0x01,0x04,0x10,0x04,0x02,0x01,0x03,0x11,0x03,0x86,0x02,0x01,
+0x04,0x10,0x04,0x02,0x02,0x03,0x10,0x03,0x81,0x02,0x03,0x03,0x0F,0x03,0x02,0x03,
+0x05,0x0D,0x05,0x01,0x04,0x0D,0x01,0x05,0x0B,0x01,0x07,0x07,0x05,0x17,0x01,0x04,
+0x0C,0x01,0x04,0x0E,0x01,0x04,0x0F,0x02,0x04,0x03,0x0F,0x04,0x02,0x04,0x03,0x10,
+0x04,0x02,0x04,0x03,0x11,0x03,0x83,0x02,0x04,0x03,0x10,0x03,0x02,0x04,0x03,0x0E,
+0x05,0x01,0x04,0x0E,0x01,0x04,0x0C,0x01,0x04,0x0A,0x01,0x04,0x03,0x88,0x05,0x1C,
+0x01,0x07,0x07,0x01,0x05,0x0B,0x01,0x04,0x0D,0x02,0x03,0x05,0x0D,0x05,0x02,0x03,
+0x03,0x0F,0x03,0x02,0x02,0x03,0x10,0x03,0x81,0x02,0x01,0x04,0x10,0x04,0x02,0x01,
+0x03,0x11,0x03,0x86,0x02,0x01,0x04,0x10,0x03,0x02,0x02,0x03,0x10,0x03,0x81,0x02,
+0x03,0x03,0x0F,0x03,0x02,0x03,0x05,0x0D,0x05,0x01,0x04,0x0D,0x01,0x06,0x09,0x01,
+0x07,0x08,0x01,0x0D,0x04,0x01,0x0E,0x06,0x01,0x0F,0x07,0x01,0x11,0x04,0x01,0x13,
+0x01,0x05,0x17,0x01,0x03,0x0A,0x01,0x03,0x0C,0x01,0x03,0x0D,0x02,0x03,0x03,0x0C,
+0x05,0x02,0x03,0x03,0x0E,0x03,0x83,0x02,0x03,0x03,0x0D,0x04,0x02,0x03,0x03,0x0D,
+0x03,0x02,0x03,0x03,0x0B,0x05,0x01,0x03,0x0C,0x01,0x03,0x0A,0x81,0x02,0x03,0x03,
+0x0A,0x04,0x81,0x02,0x03,0x03,0x0B,0x04,0x02,0x03,0x03,0x0C,0x04,0x02,0x03,0x03,
+0x0D,0x04,0x02,0x03,0x03,0x0E,0x04,0x02,0x03,0x03,0x0F,0x03,0x02,0x03,0x03,0x0F,
+0x04,0x02,0x03,0x03,0x10,0x04,0x05,0x17,0x01,0x07,0x08,0x01,0x05,0x0D,0x01,0x04,
+0x0E,0x02,0x04,0x04,0x0F,0x03,0x01,0x03,0x03,0x82,0x01,0x03,0x04,0x01,0x03,0x05,
+0x01,0x04,0x07,0x01,0x05,0x09,0x01,0x07,0x09,0x01,0x0A,0x07,0x01,0x0C,0x06,0x01,
+0x0F,0x04,0x01,0x10,0x03,0x82,0x02,0x03,0x01,0x0F,0x04,0x02,0x03,0x04,0x0E,0x04,
+0x01,0x03,0x0E,0x01,0x03,0x0D,0x01,0x06,0x08,0x05,0x17,0x01,0x00,0x15,0x82,0x01,
+0x09,0x03,0x93,0x05,0x17,0x02,0x03,0x03,0x10,0x03,0x90,0x02,0x03,0x04,0x0F,0x04,
+0x02,0x04,0x03,0x0F,0x03,0x02,0x04,0x04,0x0D,0x05,0x01,0x05,0x0C,0x01,0x06,0x0A,
+0x01,0x08,0x06,0x05,0x17,0x02,0x00,0x04,0x13,0x03,0x02,0x01,0x03,0x12,0x03,0x81,
+0x02,0x01,0x04,0x11,0x03,0x02,0x02,0x03,0x11,0x03,0x02,0x02,0x04,0x10,0x04,0x02,
+0x03,0x03,0x10,0x03,0x81,0x02,0x03,0x04,0x0F,0x03,0x02,0x04,0x03,0x0F,0x03,0x02,
+0x04,0x04,0x0E,0x03,0x81,0x02,0x05,0x03,0x0D,0x04,0x02,0x05,0x04,0x0D,0x03,0x02,
+0x06,0x03,0x0C,0x04,0x02,0x06,0x04,0x0C,0x03,0x81,0x02,0x07,0x03,0x0B,0x03,0x01,
+0x07,0x07,0x01,0x08,0x06,0x01,0x08,0x05,0x81,0x01,0x09,0x03,0x05,0x17,0x02,0x00,
+0x03,0x13,0x03,0x82,0x02,0x01,0x03,0x13,0x02,0x81,0x03,0x01,0x03,0x09,0x04,0x12,
+0x03,0x82,0x03,0x01,0x03,0x09,0x05,0x12,0x03,0x03,0x01,0x03,0x08,0x06,0x12,0x02,
+0x03,0x02,0x03,0x08,0x06,0x12,0x02,0x04,0x02,0x03,0x08,0x02,0x0B,0x03,0x12,0x02,
+0x04,0x02,0x03,0x08,0x02,0x0C,0x03,0x11,0x03,0x81,0x04,0x02,0x03,0x07,0x03,0x0C,
+0x03,0x11,0x03,0x04,0x02,0x03,0x07,0x03,0x0C,0x03,0x11,0x02,0x04,0x03,0x03,0x07,
+0x02,0x0D,0x03,0x11,0x02,0x82,0x02,0x03,0x06,0x0D,0x06,0x02,0x03,0x05,0x0E,0x05,
+0x02,0x03,0x05,0x0E,0x04,0x81,0x05,0x17,0x02,0x01,0x04,0x12,0x04,0x02,0x02,0x04,
+0x11,0x04,0x02,0x03,0x04,0x10,0x04,0x02,0x04,0x03,0x0F,0x04,0x02,0x04,0x04,0x0E,
+0x04,0x02,0x05,0x04,0x0E,0x03,0x02,0x06,0x04,0x0D,0x04,0x02,0x07,0x03,0x0C,0x04,
+0x01,0x07,0x08,0x01,0x08,0x06,0x01,0x09,0x04,0x81,0x01,0x08,0x06,0x01,0x07,0x08,
+0x02,0x07,0x03,0x0C,0x04,0x02,0x06,0x03,0x0D,0x03,0x02,0x05,0x04,0x0D,0x04,0x02,
+0x04,0x04,0x0E,0x04,0x02,0x04,0x03,0x0F,0x04,0x02,0x03,0x03,0x10,0x03,0x02,0x02,
+0x03,0x10,0x04,0x02,0x01,0x04,0x11,0x04,0x02,0x00,0x04,0x12,0x04,0x05,0x17,0x02,
+0x01,0x04,0x12,0x04,0x02,0x02,0x04,0x12,0x03,0x02,0x03,0x04,0x11,0x03,0x02,0x03,
+0x04,0x10,0x04,0x02,0x04,0x04,0x10,0x03,0x02,0x05,0x03,0x0F,0x03,0x02,0x05,0x04,
+0x0E,0x04,0x02,0x06,0x04,0x0E,0x03,0x02,0x07,0x03,0x0D,0x03,0x02,0x07,0x04,0x0C,
+0x04,0x01,0x08,0x07,0x01,0x09,0x05,0x81,0x01,0x0A,0x03,0x89,0x05,0x17,0x01,0x03,
+0x11,0x82,0x01,0x10,0x04,0x01,0x0F,0x04,0x01,0x0E,0x04,0x01,0x0D,0x04,0x01,0x0C,
+0x04,0x01,0x0C,0x03,0x01,0x0B,0x04,0x01,0x0A,0x04,0x01,0x09,0x04,0x01,0x08,0x04,
+0x01,0x07,0x04,0x01,0x07,0x03,0x01,0x06,0x04,0x01,0x05,0x04,0x01,0x04,0x04,0x01,
+0x03,0x04,0x01,0x02,0x04,0x01,0x02,0x12,0x82,0x00,0x21,0x01,0x08,0x0B,0x82,0x01,
+0x08,0x03,0x9A,0x01,0x08,0x0B,0x82,0x00,0x21,0x01,0x01,0x03,0x01,0x02,0x03,0x81,
+0x01,0x03,0x03,0x81,0x01,0x04,0x03,0x81,0x01,0x05,0x03,0x81,0x01,0x06,0x03,0x81,
+0x01,0x07,0x03,0x81,0x01,0x08,0x03,0x81,0x01,0x09,0x03,0x01,0x09,0x04,0x01,0x0A,
+0x03,0x01,0x0B,0x03,0x81,0x01,0x0C,0x03,0x81,0x01,0x0D,0x03,0x81,0x01,0x0E,0x03,
+0x81,0x01,0x0F,0x03,0x81,0x01,0x10,0x03,0x81,0x01,0x11,0x03,0x81,0x01,0x12,0x03,
+0x00,0x21,0x01,0x03,0x0B,0x82,0x01,0x0B,0x03,0x9A,0x01,0x03,0x0B,0x82,0x02,0x15,
+0x01,0x0A,0x01,0x81,0x01,0x09,0x03,0x81,0x01,0x09,0x04,0x01,0x08,0x05,0x81,0x02,
+0x07,0x03,0x0B,0x03,0x81,0x02,0x07,0x02,0x0C,0x03,0x02,0x06,0x03,0x0C,0x03,0x02,
+0x06,0x03,0x0D,0x03,0x02,0x05,0x03,0x0D,0x03,0x02,0x05,0x03,0x0E,0x03,0x02,0x05,
+0x02,0x0E,0x03,0x02,0x04,0x03,0x0F,0x03,0x81,0x02,0x03,0x03,0x0F,0x03,0x02,0x03,
+0x03,0x10,0x03,0x81,0x02,0x02,0x03,0x11,0x03,0x1C,0x03,0x01,0x00,0x16,0x82,0x00,
+0x04,0x01,0x08,0x04,0x01,0x09,0x04,0x01,0x0A,0x04,0x01,0x0C,0x03,0x09,0x13,0x01,
+0x07,0x07,0x01,0x04,0x0C,0x81,0x02,0x04,0x03,0x0D,0x04,0x01,0x0E,0x03,0x83,0x01,
+0x07,0x0A,0x01,0x05,0x0C,0x02,0x04,0x04,0x0E,0x03,0x02,0x03,0x03,0x0E,0x03,0x02,
+0x02,0x03,0x0E,0x03,0x81,0x02,0x02,0x03,0x0D,0x04,0x02,0x02,0x04,0x0B,0x06,0x02,
+0x03,0x0B,0x0F,0x05,0x02,0x04,0x09,0x0F,0x05,0x02,0x05,0x06,0x10,0x04,0x00,0x1C,
+0x01,0x03,0x03,0x88,0x02,0x03,0x03,0x0A,0x05,0x02,0x03,0x03,0x08,0x08,0x02,0x03,
+0x03,0x07,0x0A,0x02,0x03,0x06,0x0E,0x04,0x02,0x03,0x05,0x0F,0x03,0x02,0x03,0x04,
+0x0F,0x04,0x02,0x03,0x03,0x10,0x03,0x86,0x02,0x03,0x03,0x0F,0x03,0x02,0x03,0x04,
+0x0E,0x04,0x02,0x03,0x06,0x0D,0x04,0x01,0x03,0x0E,0x02,0x03,0x03,0x07,0x09,0x02,
+0x03,0x02,0x09,0x05,0x09,0x13,0x01,0x0A,0x08,0x01,0x07,0x0D,0x01,0x06,0x0E,0x02,
+0x05,0x05,0x11,0x03,0x01,0x04,0x04,0x01,0x04,0x03,0x01,0x03,0x04,0x01,0x03,0x03,
+0x84,0x01,0x03,0x04,0x01,0x04,0x03,0x01,0x04,0x04,0x02,0x05,0x05,0x12,0x02,0x01,
+0x06,0x0E,0x01,0x07,0x0D,0x01,0x0A,0x08,0x00,0x1C,0x01,0x0F,0x03,0x88,0x02,0x07,
+0x05,0x0F,0x03,0x02,0x05,0x09,0x0F,0x03,0x01,0x04,0x0E,0x02,0x04,0x04,0x0C,0x06,
+0x02,0x03,0x04,0x0E,0x04,0x02,0x03,0x03,0x0F,0x03,0x02,0x02,0x03,0x0F,0x03,0x86,
+0x02,0x02,0x04,0x0E,0x04,0x02,0x03,0x03,0x0D,0x05,0x02,0x03,0x04,0x0C,0x06,0x02,
+0x04,0x0A,0x0F,0x03,0x02,0x05,0x08,0x0F,0x03,0x02,0x06,0x05,0x0F,0x03,0x09,0x13,
+0x01,0x08,0x06,0x01,0x06,0x0A,0x01,0x05,0x0B,0x02,0x04,0x04,0x0D,0x04,0x02,0x03,
+0x03,0x0E,0x03,0x02,0x03,0x03,0x0F,0x03,0x02,0x02,0x03,0x0F,0x03,0x01,0x02,0x10,
+0x82,0x01,0x02,0x03,0x81,0x01,0x02,0x04,0x01,0x03,0x03,0x01,0x03,0x04,0x02,0x04,
+0x05,0x0F,0x03,0x01,0x04,0x0E,0x01,0x06,0x0C,0x01,0x08,0x07,0x00,0x1C,0x01,0x0C,
+0x09,0x01,0x0A,0x0C,0x01,0x09,0x0D,0x02,0x09,0x04,0x15,0x01,0x01,0x08,0x04,0x01,
+0x08,0x03,0x83,0x01,0x03,0x12,0x82,0x01,0x08,0x03,0x8F,0x09,0x1A,0x02,0x07,0x05,
+0x0F,0x03,0x02,0x05,0x09,0x0F,0x03,0x01,0x04,0x0E,0x02,0x04,0x04,0x0C,0x06,0x02,
+0x03,0x04,0x0E,0x04,0x02,0x03,0x03,0x0F,0x03,0x02,0x02,0x03,0x0F,0x03,0x86,0x02,
+0x02,0x04,0x0E,0x04,0x02,0x03,0x03,0x0D,0x05,0x02,0x03,0x04,0x0C,0x06,0x02,0x04,
+0x0A,0x0F,0x03,0x02,0x05,0x08,0x0F,0x03,0x02,0x06,0x05,0x0F,0x03,0x01,0x0F,0x03,
+0x81,0x01,0x0E,0x03,0x02,0x04,0x03,0x0D,0x04,0x01,0x04,0x0C,0x01,0x04,0x0B,0x01,
+0x06,0x07,0x00,0x1C,0x01,0x03,0x03,0x88,0x02,0x03,0x03,0x0A,0x05,0x02,0x03,0x03,
+0x08,0x09,0x02,0x03,0x03,0x07,0x0A,0x02,0x03,0x07,0x0E,0x04,0x02,0x03,0x05,0x0F,
+0x03,0x02,0x03,0x04,0x0F,0x03,0x02,0x03,0x03,0x0F,0x03,0x8C,0x01,0x1B,0x01,0x09,
+0x04,0x83,0x00,0x83,0x01,0x03,0x0A,0x82,0x01,0x0A,0x03,0x8F,0x01,0x22,0x01,0x0B,
+0x04,0x83,0x00,0x83,0x01,0x04,0x0B,0x82,0x01,0x0C,0x03,0x91,0x01,0x0B,0x04,0x02,
+0x03,0x02,0x0B,0x03,0x01,0x03,0x0B,0x01,0x03,0x0A,0x01,0x05,0x06,0x00,0x1C,0x01,
+0x04,0x03,0x88,0x02,0x04,0x03,0x0F,0x05,0x02,0x04,0x03,0x0E,0x05,0x02,0x04,0x03,
+0x0D,0x05,0x02,0x04,0x03,0x0C,0x05,0x02,0x04,0x03,0x0B,0x05,0x02,0x04,0x03,0x0A,
+0x05,0x02,0x04,0x03,0x09,0x05,0x02,0x04,0x03,0x09,0x04,0x02,0x04,0x03,0x08,0x04,
+0x01,0x04,0x07,0x02,0x04,0x03,0x08,0x04,0x02,0x04,0x03,0x09,0x04,0x02,0x04,0x03,
+0x0A,0x04,0x02,0x04,0x03,0x0B,0x04,0x02,0x04,0x03,0x0C,0x04,0x02,0x04,0x03,0x0D,
+0x04,0x02,0x04,0x03,0x0E,0x04,0x02,0x04,0x03,0x0F,0x04,0x02,0x04,0x03,0x10,0x04,
+0x00,0x1C,0x01,0x03,0x0A,0x82,0x01,0x0A,0x03,0x98,0x09,0x13,0x03,0x02,0x03,0x08,
+0x03,0x0F,0x04,0x03,0x02,0x03,0x07,0x05,0x0E,0x05,0x03,0x02,0x03,0x06,0x06,0x0E,
+0x06,0x03,0x02,0x06,0x0A,0x05,0x11,0x03,0x03,0x02,0x05,0x0A,0x04,0x11,0x03,0x03,
+0x02,0x04,0x0A,0x04,0x11,0x03,0x03,0x02,0x03,0x0A,0x03,0x11,0x03,0x8C,0x09,0x13,
+0x02,0x03,0x03,0x0A,0x05,0x02,0x03,0x03,0x08,0x09,0x02,0x03,0x03,0x07,0x0A,0x02,
+0x03,0x07,0x0E,0x04,0x02,0x03,0x05,0x0F,0x03,0x02,0x03,0x04,0x0F,0x03,0x02,0x03,
+0x03,0x0F,0x03,0x8C,0x09,0x13,0x01,0x07,0x07,0x01,0x05,0x0B,0x01,0x04,0x0D,0x02,
+0x04,0x04,0x0D,0x04,0x02,0x03,0x04,0x0E,0x04,0x02,0x03,0x03,0x0F,0x03,0x02,0x02,
+0x03,0x10,0x03,0x86,0x02,0x03,0x03,0x0F,0x03,0x02,0x03,0x04,0x0E,0x04,0x02,0x04,
+0x04,0x0D,0x04,0x01,0x04,0x0D,0x01,0x05,0x0B,0x01,0x07,0x07,0x09,0x1A,0x02,0x03,
+0x03,0x0A,0x05,0x02,0x03,0x03,0x08,0x08,0x02,0x03,0x03,0x07,0x0A,0x02,0x03,0x06,
+0x0E,0x04,0x02,0x03,0x05,0x0F,0x03,0x02,0x03,0x04,0x0F,0x04,0x02,0x03,0x03,0x10,
+0x03,0x86,0x02,0x03,0x03,0x0F,0x03,0x02,0x03,0x04,0x0E,0x04,0x02,0x03,0x06,0x0D,
+0x04,0x01,0x03,0x0E,0x02,0x03,0x03,0x07,0x09,0x02,0x03,0x03,0x09,0x05,0x01,0x03,
+0x03,0x86,0x09,0x1A,0x02,0x07,0x06,0x0F,0x03,0x02,0x05,0x09,0x0F,0x03,0x01,0x04,
+0x0E,0x02,0x04,0x04,0x0C,0x06,0x02,0x03,0x04,0x0E,0x04,0x02,0x03,0x03,0x0F,0x03,
+0x02,0x02,0x03,0x0F,0x03,0x86,0x02,0x02,0x04,0x0E,0x04,0x02,0x03,0x03,0x0D,0x05,
+0x02,0x03,0x04,0x0C,0x06,0x02,0x04,0x0A,0x0F,0x03,0x02,0x05,0x08,0x0F,0x03,0x02,
+0x06,0x05,0x0F,0x03,0x01,0x0F,0x03,0x86,0x09,0x13,0x02,0x05,0x03,0x0C,0x07,0x02,
+0x05,0x03,0x0A,0x09,0x02,0x05,0x03,0x09,0x0A,0x02,0x05,0x07,0x10,0x03,0x02,0x05,
+0x05,0x10,0x03,0x02,0x05,0x04,0x10,0x03,0x01,0x05,0x03,0x8C,0x09,0x13,0x01,0x08,
+0x07,0x01,0x06,0x0B,0x01,0x05,0x0C,0x02,0x04,0x04,0x0F,0x02,0x01,0x04,0x03,0x81,
+0x01,0x04,0x04,0x01,0x05,0x06,0x01,0x06,0x08,0x01,0x07,0x09,0x01,0x0A,0x07,0x01,
+0x0D,0x05,0x01,0x0F,0x03,0x81,0x02,0x04,0x01,0x0F,0x03,0x02,0x04,0x03,0x0D,0x05,
+0x01,0x04,0x0D,0x01,0x04,0x0C,0x01,0x07,0x07,0x05,0x17,0x01,0x07,0x03,0x83,0x01,
+0x02,0x11,0x82,0x01,0x07,0x03,0x8B,0x01,0x07,0x05,0x01,0x08,0x0B,0x81,0x01,0x0A,
+0x09,0x09,0x13,0x02,0x03,0x03,0x0F,0x03,0x8C,0x02,0x03,0x03,0x0E,0x04,0x02,0x03,
+0x03,0x0D,0x05,0x02,0x03,0x04,0x0B,0x07,0x02,0x04,0x0A,0x0F,0x03,0x02,0x04,0x09,
+0x0F,0x03,0x02,0x06,0x05,0x0F,0x03,0x09,0x13,0x02,0x01,0x03,0x11,0x04,0x02,0x02,
+0x03,0x11,0x03,0x81,0x02,0x02,0x04,0x10,0x03,0x02,0x03,0x03,0x10,0x03,0x02,0x03,
+0x04,0x0F,0x03,0x02,0x04,0x03,0x0F,0x03,0x02,0x04,0x03,0x0E,0x03,0x02,0x05,0x03,
+0x0E,0x03,0x02,0x05,0x03,0x0D,0x04,0x02,0x05,0x04,0x0D,0x03,0x02,0x06,0x03,0x0C,
+0x04,0x02,0x06,0x04,0x0C,0x03,0x02,0x07,0x03,0x0C,0x03,0x02,0x07,0x03,0x0B,0x03,
+0x01,0x08,0x06,0x01,0x08,0x05,0x81,0x01,0x09,0x03,0x09,0x13,0x02,0x00,0x03,0x13,
+0x03,0x02,0x00,0x04,0x13,0x03,0x03,0x00,0x04,0x09,0x04,0x13,0x02,0x03,0x01,0x03,
+0x09,0x04,0x13,0x02,0x03,0x01,0x03,0x09,0x05,0x12,0x03,0x81,0x03,0x01,0x03,0x08,
+0x06,0x12,0x03,0x04,0x01,0x04,0x08,0x02,0x0C,0x02,0x12,0x02,0x04,0x02,0x03,0x08,
+0x02,0x0C,0x03,0x12,0x02,0x04,0x02,0x03,0x07,0x03,0x0C,0x03,0x11,0x03,0x81,0x04,
+0x02,0x03,0x07,0x02,0x0D,0x02,0x11,0x03,0x04,0x02,0x04,0x07,0x02,0x0D,0x03,0x11,
+0x02,0x03,0x03,0x06,0x0D,0x03,0x11,0x02,0x03,0x03,0x05,0x0D,0x03,0x11,0x02,0x02,
+0x03,0x05,0x0E,0x05,0x81,0x02,0x03,0x05,0x0E,0x04,0x02,0x04,0x03,0x0E,0x04,0x09,
+0x13,0x02,0x02,0x04,0x10,0x04,0x02,0x03,0x04,0x10,0x03,0x02,0x04,0x04,0x0F,0x03,
+0x02,0x05,0x04,0x0E,0x04,0x02,0x06,0x03,0x0E,0x03,0x02,0x06,0x04,0x0D,0x03,0x02,
+0x07,0x04,0x0C,0x04,0x01,0x08,0x07,0x01,0x09,0x05,0x81,0x01,0x08,0x06,0x01,0x08,
+0x07,0x02,0x07,0x03,0x0C,0x04,0x02,0x06,0x04,0x0D,0x04,0x02,0x05,0x04,0x0E,0x03,
+0x02,0x05,0x03,0x0E,0x04,0x02,0x04,0x03,0x0F,0x04,0x02,0x03,0x04,0x10,0x04,0x02,
+0x02,0x04,0x11,0x04,0x09,0x1A,0x02,0x01,0x04,0x12,0x03,0x02,0x02,0x03,0x11,0x03,
+0x81,0x02,0x03,0x03,0x10,0x03,0x81,0x02,0x04,0x03,0x0F,0x03,0x81,0x02,0x04,0x04,
+0x0F,0x03,0x02,0x05,0x03,0x0E,0x03,0x02,0x05,0x04,0x0E,0x03,0x02,0x06,0x03,0x0D,
+0x03,0x02,0x06,0x04,0x0D,0x03,0x02,0x07,0x03,0x0C,0x03,0x81,0x01,0x08,0x06,0x81,
+0x01,0x09,0x04,0x81,0x01,0x09,0x03,0x81,0x01,0x08,0x03,0x01,0x07,0x04,0x01,0x06,
+0x04,0x01,0x02,0x08,0x01,0x02,0x07,0x01,0x02,0x05,0x09,0x13,0x01,0x02,0x11,0x82,
+0x01,0x0E,0x05,0x01,0x0D,0x05,0x01,0x0C,0x05,0x01,0x0B,0x05,0x01,0x0A,0x05,0x01,
+0x09,0x05,0x01,0x08,0x05,0x01,0x07,0x05,0x01,0x06,0x05,0x01,0x05,0x05,0x01,0x04,
+0x05,0x01,0x03,0x05,0x01,0x02,0x05,0x01,0x02,0x11,0x82,0x00,0x21,0x01,0x0C,0x06,
+0x01,0x0A,0x08,0x81,0x01,0x09,0x04,0x01,0x09,0x03,0x84,0x01,0x0A,0x03,0x84,0x01,
+0x08,0x04,0x01,0x04,0x07,0x01,0x04,0x05,0x01,0x04,0x07,0x01,0x08,0x04,0x01,0x0A,
+0x03,0x84,0x01,0x09,0x03,0x84,0x01,0x09,0x04,0x01,0x0A,0x08,0x01,0x0B,0x07,0x01,
+0x0C,0x06,0x00,0x21,0x01,0x0A,0x03,0xA0,0x00,0x21,0x01,0x04,0x06,0x01,0x04,0x07,
+0x01,0x04,0x08,0x01,0x09,0x04,0x01,0x0A,0x03,0x84,0x01,0x09,0x03,0x84,0x01,0x0A,
+0x04,0x01,0x0B,0x07,0x01,0x0D,0x05,0x01,0x0B,0x07,0x01,0x0A,0x04,0x01,0x09,0x03,
+0x84,0x01,0x0A,0x03,0x84,0x01,0x09,0x04,0x01,0x04,0x08,0x81,0x01,0x04,0x06,0x0E,
+0x08,0x01,0x04,0x04,0x02,0x03,0x07,0x13,0x02,0x02,0x02,0x09,0x13,0x02,0x03,0x02,
+0x02,0x08,0x05,0x12,0x03,0x03,0x01,0x03,0x09,0x05,0x12,0x02,0x02,0x01,0x02,0x0B,
+0x09,0x02,0x01,0x02,0x0C,0x07,0x01,0x0E,0x04,0x05,0x17,0x01,0x04,0x0D,0x81,0x02,
+0x04,0x02,0x10,0x01,0x93,0x01,0x04,0x0D,0x05,0x1F,0x01,0x0A,0x09,0x01,0x08,0x0D,
+0x01,0x06,0x0F,0x02,0x05,0x06,0x12,0x03,0x01,0x04,0x05,0x01,0x04,0x03,0x01,0x03,
+0x04,0x01,0x03,0x03,0x01,0x02,0x03,0x85,0x01,0x02,0x04,0x01,0x03,0x03,0x01,0x03,
+0x04,0x01,0x03,0x05,0x01,0x04,0x05,0x02,0x05,0x06,0x12,0x03,0x01,0x06,0x0F,0x01,
+0x08,0x0D,0x01,0x0A,0x08,0x01,0x0C,0x02,0x01,0x0C,0x01,0x01,0x0B,0x04,0x01,0x0D,
+0x03,0x01,0x0E,0x03,0x81,0x01,0x0A,0x06,0x01,0x0A,0x05,0x02,0x1A,0x02,0x06,0x03,
+0x0D,0x03,0x82,0x00,0x83,0x02,0x03,0x03,0x0F,0x03,0x8C,0x02,0x03,0x03,0x0E,0x04,
+0x02,0x03,0x03,0x0D,0x05,0x02,0x03,0x04,0x0B,0x07,0x02,0x04,0x0A,0x0F,0x03,0x02,
+0x04,0x09,0x0F,0x03,0x02,0x06,0x05,0x0F,0x03,0x00,0x1C,0x01,0x0D,0x04,0x01,0x0C,
+0x04,0x01,0x0B,0x04,0x01,0x0B,0x03,0x01,0x0A,0x03,0x01,0x09,0x03,0x00,0x82,0x01,
+0x08,0x06,0x01,0x06,0x0A,0x01,0x05,0x0B,0x02,0x04,0x04,0x0D,0x04,0x02,0x03,0x03,
+0x0E,0x03,0x02,0x03,0x03,0x0F,0x03,0x02,0x02,0x03,0x0F,0x03,0x01,0x02,0x10,0x82,
+0x01,0x02,0x03,0x81,0x01,0x02,0x04,0x01,0x03,0x03,0x01,0x03,0x04,0x02,0x04,0x05,
+0x0F,0x03,0x01,0x04,0x0E,0x01,0x06,0x0C,0x01,0x08,0x07,0x00,0x1C,0x01,0x09,0x04,
+0x01,0x08,0x06,0x01,0x07,0x08,0x02,0x07,0x03,0x0C,0x03,0x02,0x06,0x03,0x0D,0x03,
+0x02,0x05,0x03,0x0E,0x03,0x00,0x82,0x01,0x07,0x07,0x01,0x04,0x0C,0x81,0x02,0x04,
+0x03,0x0D,0x04,0x01,0x0E,0x03,0x83,0x01,0x07,0x0A,0x01,0x05,0x0C,0x02,0x04,0x04,
+0x0E,0x03,0x02,0x03,0x03,0x0E,0x03,0x02,0x02,0x03,0x0E,0x03,0x81,0x02,0x02,0x03,
+0x0D,0x04,0x02,0x02,0x04,0x0B,0x06,0x02,0x03,0x0B,0x0F,0x05,0x02,0x04,0x09,0x0F,
+0x05,0x02,0x05,0x06,0x10,0x04,0x02,0x1A,0x02,0x07,0x03,0x0E,0x03,0x82,0x00,0x83,
+0x01,0x07,0x07,0x01,0x04,0x0C,0x81,0x02,0x04,0x03,0x0D,0x04,0x01,0x0E,0x03,0x83,
+0x01,0x07,0x0A,0x01,0x05,0x0C,0x02,0x04,0x04,0x0E,0x03,0x02,0x03,0x03,0x0E,0x03,
+0x02,0x02,0x03,0x0E,0x03,0x81,0x02,0x02,0x03,0x0D,0x04,0x02,0x02,0x04,0x0B,0x06,
+0x02,0x03,0x0B,0x0F,0x05,0x02,0x04,0x09,0x0F,0x05,0x02,0x05,0x06,0x10,0x04,0x00,
+0x1C,0x01,0x05,0x04,0x01,0x06,0x04,0x01,0x07,0x04,0x01,0x08,0x03,0x01,0x09,0x03,
+0x01,0x0A,0x03,0x00,0x82,0x01,0x07,0x07,0x01,0x04,0x0C,0x81,0x02,0x04,0x03,0x0D,
+0x04,0x01,0x0E,0x03,0x83,0x01,0x07,0x0A,0x01,0x05,0x0C,0x02,0x04,0x04,0x0E,0x03,
+0x02,0x03,0x03,0x0E,0x03,0x02,0x02,0x03,0x0E,0x03,0x81,0x02,0x02,0x03,0x0D,0x04,
+0x02,0x02,0x04,0x0B,0x06,0x02,0x03,0x0B,0x0F,0x05,0x02,0x04,0x09,0x0F,0x05,0x02,
+0x05,0x06,0x10,0x04,0x00,0x1C,0x01,0x09,0x04,0x02,0x08,0x02,0x0C,0x02,0x02,0x08,
+0x01,0x0D,0x01,0x81,0x02,0x08,0x02,0x0C,0x02,0x01,0x09,0x04,0x00,0x82,0x01,0x07,
+0x07,0x01,0x04,0x0C,0x81,0x02,0x04,0x03,0x0D,0x04,0x01,0x0E,0x03,0x83,0x01,0x07,
+0x0A,0x01,0x05,0x0C,0x02,0x04,0x04,0x0E,0x03,0x02,0x03,0x03,0x0E,0x03,0x02,0x02,
+0x03,0x0E,0x03,0x81,0x02,0x02,0x03,0x0D,0x04,0x02,0x02,0x04,0x0B,0x06,0x02,0x03,
+0x0B,0x0F,0x05,0x02,0x04,0x09,0x0F,0x05,0x02,0x05,0x06,0x10,0x04,0x09,0x1B,0x01,
+0x0A,0x08,0x01,0x07,0x0D,0x01,0x06,0x0E,0x02,0x05,0x05,0x11,0x03,0x01,0x04,0x04,
+0x01,0x04,0x03,0x01,0x03,0x04,0x01,0x03,0x03,0x84,0x01,0x03,0x04,0x01,0x04,0x03,
+0x01,0x04,0x04,0x02,0x05,0x05,0x12,0x02,0x01,0x06,0x0E,0x01,0x07,0x0D,0x01,0x0A,
+0x08,0x01,0x0A,0x02,0x01,0x0A,0x01,0x01,0x09,0x04,0x01,0x0B,0x03,0x01,0x0C,0x03,
+0x81,0x01,0x08,0x06,0x01,0x08,0x05,0x00,0x1C,0x01,0x0A,0x04,0x01,0x09,0x06,0x01,
+0x08,0x08,0x02,0x08,0x03,0x0D,0x03,0x02,0x07,0x03,0x0E,0x03,0x02,0x06,0x03,0x0F,
+0x03,0x00,0x82,0x01,0x08,0x06,0x01,0x06,0x0A,0x01,0x05,0x0B,0x02,0x04,0x04,0x0D,
+0x04,0x02,0x03,0x03,0x0E,0x03,0x02,0x03,0x03,0x0F,0x03,0x02,0x02,0x03,0x0F,0x03,
+0x01,0x02,0x10,0x82,0x01,0x02,0x03,0x81,0x01,0x02,0x04,0x01,0x03,0x03,0x01,0x03,
+0x04,0x02,0x04,0x05,0x0F,0x03,0x01,0x04,0x0E,0x01,0x06,0x0C,0x01,0x08,0x07,0x02,
+0x1A,0x02,0x07,0x03,0x0E,0x03,0x82,0x00,0x83,0x01,0x08,0x06,0x01,0x06,0x0A,0x01,
+0x05,0x0B,0x02,0x04,0x04,0x0D,0x04,0x02,0x03,0x03,0x0E,0x03,0x02,0x03,0x03,0x0F,
+0x03,0x02,0x02,0x03,0x0F,0x03,0x01,0x02,0x10,0x82,0x01,0x02,0x03,0x81,0x01,0x02,
+0x04,0x01,0x03,0x03,0x01,0x03,0x04,0x02,0x04,0x05,0x0F,0x03,0x01,0x04,0x0E,0x01,
+0x06,0x0C,0x01,0x08,0x07,0x00,0x1C,0x01,0x05,0x04,0x01,0x06,0x04,0x01,0x07,0x04,
+0x01,0x08,0x03,0x01,0x09,0x03,0x01,0x0A,0x03,0x00,0x82,0x01,0x08,0x06,0x01,0x06,
+0x0A,0x01,0x05,0x0B,0x02,0x04,0x04,0x0D,0x04,0x02,0x03,0x03,0x0E,0x03,0x02,0x03,
+0x03,0x0F,0x03,0x02,0x02,0x03,0x0F,0x03,0x01,0x02,0x10,0x82,0x01,0x02,0x03,0x81,
+0x01,0x02,0x04,0x01,0x03,0x03,0x01,0x03,0x04,0x02,0x04,0x05,0x0F,0x03,0x01,0x04,
+0x0E,0x01,0x06,0x0C,0x01,0x08,0x07,0x02,0x1A,0x02,0x07,0x03,0x0E,0x03,0x82,0x00,
+0x83,0x01,0x03,0x0A,0x82,0x01,0x0A,0x03,0x8F,0x00,0x1C,0x01,0x0A,0x04,0x01,0x09,
+0x06,0x01,0x08,0x08,0x02,0x08,0x03,0x0D,0x03,0x02,0x07,0x03,0x0E,0x03,0x02,0x06,
+0x03,0x0F,0x03,0x00,0x82,0x01,0x03,0x0A,0x82,0x01,0x0A,0x03,0x8F,0x00,0x1C,0x01,
+0x05,0x04,0x01,0x06,0x04,0x01,0x07,0x04,0x01,0x08,0x03,0x01,0x09,0x03,0x01,0x0A,
+0x03,0x00,0x82,0x01,0x03,0x0A,0x82,0x01,0x0A,0x03,0x8F,0x00,0x1C,0x02,0x05,0x03,
+0x0E,0x03,0x82,0x00,0x81,0x01,0x09,0x04,0x01,0x08,0x05,0x01,0x08,0x06,0x81,0x02,
+0x07,0x03,0x0B,0x03,0x02,0x07,0x03,0x0B,0x04,0x02,0x06,0x03,0x0C,0x03,0x02,0x06,
+0x03,0x0C,0x04,0x02,0x06,0x03,0x0D,0x03,0x02,0x05,0x03,0x0D,0x03,0x02,0x05,0x03,
+0x0D,0x04,0x02,0x04,0x03,0x0E,0x03,0x02,0x04,0x03,0x0E,0x04,0x02,0x04,0x03,0x0F,
+0x03,0x01,0x03,0x0F,0x01,0x03,0x10,0x81,0x02,0x02,0x03,0x10,0x04,0x02,0x02,0x03,
+0x11,0x03,0x02,0x01,0x04,0x11,0x04,0x02,0x01,0x03,0x12,0x03,0x81,0x02,0x00,0x03,
+0x13,0x03,0x00,0x1C,0x01,0x09,0x03,0x02,0x08,0x01,0x0C,0x01,0x82,0x01,0x09,0x03,
+0x81,0x01,0x08,0x05,0x81,0x01,0x08,0x06,0x02,0x07,0x03,0x0B,0x03,0x81,0x02,0x06,
+0x03,0x0B,0x04,0x02,0x06,0x03,0x0C,0x03,0x02,0x06,0x02,0x0C,0x04,0x02,0x05,0x03,
+0x0D,0x03,0x02,0x05,0x03,0x0D,0x04,0x02,0x04,0x03,0x0E,0x03,0x81,0x02,0x04,0x03,
+0x0F,0x03,0x01,0x03,0x0F,0x01,0x03,0x10,0x81,0x02,0x02,0x03,0x10,0x04,0x02,0x02,
+0x03,0x11,0x03,0x02,0x01,0x03,0x11,0x03,0x02,0x01,0x03,0x12,0x03,0x81,0x02,0x00,
+0x03,0x13,0x03,0x00,0x1C,0x01,0x0D,0x04,0x01,0x0C,0x04,0x01,0x0B,0x04,0x01,0x0A,
+0x03,0x00,0x01,0x04,0x0F,0x82,0x01,0x04,0x03,0x86,0x01,0x04,0x0D,0x82,0x01,0x04,
+0x03,0x86,0x01,0x04,0x10,0x82,0x09,0x13,0x02,0x03,0x06,0x0D,0x04,0x02,0x02,0x09,
+0x0C,0x07,0x01,0x02,0x12,0x03,0x02,0x01,0x08,0x06,0x11,0x03,0x02,0x09,0x04,0x12,
+0x02,0x02,0x09,0x03,0x12,0x03,0x82,0x01,0x05,0x10,0x01,0x03,0x12,0x02,0x02,0x04,
+0x09,0x0C,0x02,0x02,0x03,0x09,0x03,0x02,0x01,0x03,0x09,0x03,0x81,0x02,0x01,0x03,
+0x09,0x04,0x03,0x01,0x04,0x08,0x06,0x13,0x02,0x01,0x02,0x13,0x02,0x02,0x07,0x0B,
+0x0A,0x02,0x04,0x04,0x0D,0x06,0x05,0x17,0x01,0x0A,0x0A,0x01,0x09,0x0B,0x81,0x01,
+0x08,0x06,0x81,0x02,0x08,0x02,0x0B,0x03,0x02,0x07,0x03,0x0B,0x03,0x81,0x02,0x06,
+0x03,0x0B,0x03,0x81,0x02,0x05,0x03,0x0B,0x08,0x81,0x02,0x05,0x02,0x0B,0x08,0x02,
+0x04,0x03,0x0B,0x03,0x02,0x04,0x02,0x0B,0x03,0x01,0x03,0x0B,0x81,0x01,0x02,0x0C,
+0x02,0x02,0x03,0x0B,0x03,0x02,0x02,0x02,0x0B,0x03,0x02,0x01,0x03,0x0B,0x0A,0x81,
+0x02,0x00,0x03,0x0B,0x0A,0x00,0x1C,0x01,0x09,0x04,0x01,0x08,0x06,0x01,0x07,0x08,
+0x02,0x07,0x03,0x0C,0x03,0x02,0x06,0x03,0x0D,0x03,0x02,0x05,0x03,0x0E,0x03,0x00,
+0x82,0x01,0x07,0x07,0x01,0x05,0x0B,0x01,0x04,0x0D,0x02,0x04,0x04,0x0D,0x04,0x02,
+0x03,0x04,0x0E,0x04,0x02,0x03,0x03,0x0F,0x03,0x02,0x02,0x03,0x10,0x03,0x86,0x02,
+0x03,0x03,0x0F,0x03,0x02,0x03,0x04,0x0E,0x04,0x02,0x04,0x04,0x0D,0x04,0x01,0x04,
+0x0D,0x01,0x05,0x0B,0x01,0x07,0x07,0x02,0x1A,0x02,0x06,0x03,0x0D,0x03,0x82,0x00,
+0x83,0x01,0x07,0x07,0x01,0x05,0x0B,0x01,0x04,0x0D,0x02,0x04,0x04,0x0D,0x04,0x02,
+0x03,0x04,0x0E,0x04,0x02,0x03,0x03,0x0F,0x03,0x02,0x02,0x03,0x10,0x03,0x86,0x02,
+0x03,0x03,0x0F,0x03,0x02,0x03,0x04,0x0E,0x04,0x02,0x04,0x04,0x0D,0x04,0x01,0x04,
+0x0D,0x01,0x05,0x0B,0x01,0x07,0x07,0x00,0x1C,0x01,0x04,0x04,0x01,0x05,0x04,0x01,
+0x06,0x04,0x01,0x07,0x03,0x01,0x08,0x03,0x01,0x09,0x03,0x00,0x82,0x01,0x07,0x07,
+0x01,0x05,0x0B,0x01,0x04,0x0D,0x02,0x04,0x04,0x0D,0x04,0x02,0x03,0x04,0x0E,0x04,
+0x02,0x03,0x03,0x0F,0x03,0x02,0x02,0x03,0x10,0x03,0x86,0x02,0x03,0x03,0x0F,0x03,
+0x02,0x03,0x04,0x0E,0x04,0x02,0x04,0x04,0x0D,0x04,0x01,0x04,0x0D,0x01,0x05,0x0B,
+0x01,0x07,0x07,0x00,0x1C,0x01,0x09,0x04,0x01,0x08,0x06,0x01,0x07,0x08,0x02,0x07,
+0x03,0x0C,0x03,0x02,0x06,0x03,0x0D,0x03,0x02,0x05,0x03,0x0E,0x03,0x00,0x82,0x02,
+0x03,0x03,0x0F,0x03,0x8C,0x02,0x03,0x03,0x0E,0x04,0x02,0x03,0x03,0x0D,0x05,0x02,
+0x03,0x04,0x0B,0x07,0x02,0x04,0x0A,0x0F,0x03,0x02,0x04,0x09,0x0F,0x03,0x02,0x06,
+0x05,0x0F,0x03,0x00,0x1C,0x01,0x04,0x04,0x01,0x05,0x04,0x01,0x06,0x04,0x01,0x07,
+0x03,0x01,0x08,0x03,0x01,0x09,0x03,0x00,0x82,0x02,0x03,0x03,0x0F,0x03,0x8C,0x02,
+0x03,0x03,0x0E,0x04,0x02,0x03,0x03,0x0D,0x05,0x02,0x03,0x04,0x0B,0x07,0x02,0x04,
+0x0A,0x0F,0x03,0x02,0x04,0x09,0x0F,0x03,0x02,0x06,0x05,0x0F,0x03,0x02,0x21,0x02,
+0x07,0x03,0x0E,0x03,0x82,0x00,0x83,0x02,0x01,0x04,0x12,0x03,0x02,0x02,0x03,0x11,
+0x03,0x81,0x02,0x03,0x03,0x10,0x03,0x81,0x02,0x04,0x03,0x0F,0x03,0x81,0x02,0x04,
+0x04,0x0F,0x03,0x02,0x05,0x03,0x0E,0x03,0x02,0x05,0x04,0x0E,0x03,0x02,0x06,0x03,
+0x0D,0x03,0x02,0x06,0x04,0x0D,0x03,0x02,0x07,0x03,0x0C,0x03,0x81,0x01,0x08,0x06,
+0x81,0x01,0x09,0x04,0x81,0x01,0x09,0x03,0x81,0x01,0x08,0x03,0x01,0x07,0x04,0x01,
+0x06,0x04,0x01,0x02,0x08,0x01,0x02,0x07,0x01,0x02,0x05,0x00,0x1C,0x02,0x05,0x03,
+0x0E,0x03,0x82,0x00,0x81,0x01,0x07,0x07,0x01,0x05,0x0B,0x01,0x04,0x0D,0x02,0x03,
+0x05,0x0D,0x05,0x02,0x03,0x03,0x0F,0x03,0x02,0x02,0x03,0x10,0x03,0x81,0x02,0x01,
+0x04,0x10,0x04,0x02,0x01,0x03,0x11,0x03,0x86,0x02,0x01,0x04,0x10,0x04,0x02,0x02,
+0x03,0x10,0x03,0x81,0x02,0x03,0x03,0x0F,0x03,0x02,0x03,0x05,0x0D,0x05,0x01,0x04,
+0x0D,0x01,0x05,0x0B,0x01,0x07,0x07,0x00,0x1C,0x02,0x06,0x03,0x0F,0x03,0x82,0x00,
+0x81,0x02,0x03,0x03,0x10,0x03,0x90,0x02,0x03,0x04,0x0F,0x04,0x02,0x04,0x03,0x0F,
+0x03,0x02,0x04,0x04,0x0D,0x05,0x01,0x05,0x0C,0x01,0x06,0x0A,0x01,0x08,0x06,0x09,
+0x13,0x02,0x07,0x07,0x10,0x03,0x01,0x05,0x0D,0x01,0x04,0x0D,0x02,0x04,0x04,0x0D,
+0x04,0x02,0x03,0x04,0x0E,0x04,0x02,0x03,0x03,0x0D,0x05,0x03,0x02,0x03,0x0C,0x03,
+0x10,0x03,0x03,0x02,0x03,0x0B,0x03,0x10,0x03,0x03,0x02,0x03,0x0A,0x03,0x10,0x03,
+0x03,0x02,0x03,0x09,0x03,0x10,0x03,0x03,0x02,0x03,0x08,0x03,0x10,0x03,0x03,0x02,
+0x03,0x07,0x03,0x10,0x03,0x03,0x02,0x03,0x06,0x03,0x10,0x03,0x02,0x03,0x05,0x0F,
+0x03,0x02,0x03,0x04,0x0E,0x04,0x02,0x04,0x04,0x0D,0x04,0x01,0x04,0x0D,0x01,0x03,
+0x0D,0x02,0x02,0x03,0x07,0x07,0x02,0x1A,0x01,0x0C,0x06,0x01,0x0A,0x08,0x01,0x09,
+0x09,0x02,0x09,0x03,0x11,0x01,0x01,0x08,0x03,0x86,0x01,0x05,0x09,0x82,0x01,0x08,
+0x03,0x85,0x01,0x07,0x03,0x01,0x07,0x02,0x01,0x05,0x04,0x01,0x04,0x0E,0x82,0x05,
+0x17,0x02,0x07,0x07,0x11,0x03,0x01,0x05,0x0E,0x01,0x04,0x0E,0x02,0x03,0x05,0x0D,
+0x05,0x02,0x03,0x03,0x0F,0x03,0x02,0x02,0x03,0x0E,0x05,0x02,0x02,0x03,0x0D,0x06,
+0x03,0x01,0x04,0x0C,0x03,0x10,0x03,0x03,0x01,0x03,0x0C,0x02,0x11,0x03,0x03,0x01,
+0x03,0x0B,0x03,0x11,0x03,0x03,0x01,0x03,0x0A,0x03,0x11,0x03,0x03,0x01,0x03,0x09,
+0x03,0x11,0x03,0x03,0x01,0x03,0x08,0x03,0x11,0x03,0x03,0x01,0x03,0x07,0x03,0x11,
+0x03,0x03,0x01,0x03,0x07,0x02,0x11,0x03,0x03,0x02,0x03,0x06,0x03,0x10,0x04,0x02,
+0x02,0x06,0x10,0x03,0x02,0x02,0x05,0x10,0x03,0x02,0x03,0x03,0x0F,0x03,0x02,0x03,
+0x05,0x0D,0x05,0x01,0x03,0x0E,0x01,0x02,0x0E,0x02,0x01,0x03,0x07,0x07,0x09,0x13,
+0x02,0x02,0x01,0x12,0x01,0x02,0x01,0x03,0x11,0x03,0x02,0x02,0x03,0x10,0x03,0x02,
+0x03,0x03,0x0F,0x03,0x02,0x04,0x03,0x0E,0x03,0x02,0x05,0x03,0x0D,0x03,0x02,0x06,
+0x03,0x0C,0x03,0x02,0x07,0x03,0x0B,0x03,0x01,0x08,0x05,0x01,0x09,0x03,0x01,0x08,
+0x05,0x02,0x07,0x03,0x0B,0x03,0x02,0x06,0x03,0x0C,0x03,0x02,0x05,0x03,0x0D,0x03,
+0x02,0x04,0x03,0x0E,0x03,0x02,0x03,0x03,0x0F,0x03,0x02,0x02,0x03,0x10,0x03,0x02,
+0x01,0x03,0x11,0x03,0x02,0x02,0x01,0x12,0x01,0x00,0x23,0x01,0x0C,0x06,0x01,0x0A,
+0x09,0x01,0x09,0x0A,0x02,0x08,0x04,0x12,0x01,0x01,0x08,0x03,0x84,0x01,0x05,0x0B,
+0x82,0x01,0x08,0x03,0x92,0x02,0x00,0x01,0x07,0x04,0x01,0x00,0x0A,0x01,0x00,0x09,
+0x01,0x01,0x07,0x00,0x1C,0x01,0x0D,0x04,0x01,0x0C,0x04,0x01,0x0B,0x04,0x01,0x0B,
+0x03,0x01,0x0A,0x03,0x01,0x09,0x03,0x00,0x82,0x01,0x07,0x07,0x01,0x04,0x0C,0x81,
+0x02,0x04,0x03,0x0D,0x04,0x01,0x0E,0x03,0x83,0x01,0x07,0x0A,0x01,0x05,0x0C,0x02,
+0x04,0x04,0x0E,0x03,0x02,0x03,0x03,0x0E,0x03,0x02,0x02,0x03,0x0E,0x03,0x81,0x02,
+0x02,0x03,0x0D,0x04,0x02,0x02,0x04,0x0B,0x06,0x02,0x03,0x0B,0x0F,0x05,0x02,0x04,
+0x09,0x0F,0x05,0x02,0x05,0x06,0x10,0x04,0x00,0x1C,0x01,0x0D,0x04,0x01,0x0C,0x04,
+0x01,0x0B,0x04,0x01,0x0B,0x03,0x01,0x0A,0x03,0x01,0x09,0x03,0x00,0x82,0x01,0x03,
+0x0A,0x82,0x01,0x0A,0x03,0x8F,0x00,0x1C,0x01,0x0D,0x04,0x01,0x0C,0x04,0x01,0x0B,
+0x04,0x01,0x0B,0x03,0x01,0x0A,0x03,0x01,0x09,0x03,0x00,0x82,0x01,0x07,0x07,0x01,
+0x05,0x0B,0x01,0x04,0x0D,0x02,0x04,0x04,0x0D,0x04,0x02,0x03,0x04,0x0E,0x04,0x02,
+0x03,0x03,0x0F,0x03,0x02,0x02,0x03,0x10,0x03,0x86,0x02,0x03,0x03,0x0F,0x03,0x02,
+0x03,0x04,0x0E,0x04,0x02,0x04,0x04,0x0D,0x04,0x01,0x04,0x0D,0x01,0x05,0x0B,0x01,
+0x07,0x07,0x00,0x1C,0x01,0x0C,0x04,0x01,0x0B,0x04,0x01,0x0A,0x04,0x01,0x0A,0x03,
+0x01,0x09,0x03,0x01,0x08,0x03,0x00,0x82,0x02,0x03,0x03,0x0F,0x03,0x8C,0x02,0x03,
+0x03,0x0E,0x04,0x02,0x03,0x03,0x0D,0x05,0x02,0x03,0x04,0x0B,0x07,0x02,0x04,0x0A,
+0x0F,0x03,0x02,0x04,0x09,0x0F,0x03,0x02,0x06,0x05,0x0F,0x03,0x01,0x1B,0x02,0x07,
+0x04,0x0F,0x02,0x02,0x06,0x06,0x0E,0x03,0x02,0x05,0x03,0x0A,0x06,0x02,0x05,0x02,
+0x0B,0x04,0x00,0x83,0x02,0x03,0x03,0x0A,0x05,0x02,0x03,0x03,0x08,0x09,0x02,0x03,
+0x03,0x07,0x0A,0x02,0x03,0x07,0x0E,0x04,0x02,0x03,0x05,0x0F,0x03,0x02,0x03,0x04,
+0x0F,0x03,0x02,0x03,0x03,0x0F,0x03,0x8C,0x00,0x1C,0x02,0x07,0x04,0x0F,0x02,0x02,
+0x06,0x07,0x0E,0x03,0x02,0x05,0x02,0x09,0x07,0x02,0x05,0x02,0x0B,0x04,0x00,0x02,
+0x03,0x04,0x11,0x03,0x81,0x02,0x03,0x05,0x11,0x03,0x02,0x03,0x06,0x11,0x03,0x81,
+0x02,0x03,0x07,0x11,0x03,0x03,0x03,0x03,0x07,0x03,0x11,0x03,0x03,0x03,0x03,0x08,
+0x03,0x11,0x03,0x03,0x03,0x03,0x08,0x04,0x11,0x03,0x03,0x03,0x03,0x09,0x03,0x11,
+0x03,0x03,0x03,0x03,0x09,0x04,0x11,0x03,0x03,0x03,0x03,0x0A,0x03,0x11,0x03,0x03,
+0x03,0x03,0x0A,0x04,0x11,0x03,0x03,0x03,0x03,0x0B,0x03,0x11,0x03,0x03,0x03,0x03,
+0x0C,0x03,0x11,0x03,0x03,0x03,0x03,0x0C,0x04,0x11,0x03,0x03,0x03,0x03,0x0D,0x03,
+0x11,0x03,0x02,0x03,0x03,0x0D,0x07,0x02,0x03,0x03,0x0E,0x06,0x02,0x03,0x03,0x0F,
+0x05,0x81,0x02,0x03,0x03,0x10,0x04,0x81,0x02,0x0D,0x01,0x07,0x07,0x01,0x05,0x0A,
+0x02,0x05,0x02,0x0C,0x04,0x01,0x0D,0x03,0x81,0x01,0x08,0x08,0x01,0x05,0x0B,0x02,
+0x05,0x03,0x0D,0x03,0x02,0x04,0x03,0x0D,0x03,0x81,0x02,0x04,0x04,0x0B,0x05,0x01,
+0x05,0x0D,0x02,0x06,0x05,0x0E,0x04,0x02,0x0D,0x01,0x08,0x06,0x01,0x06,0x0A,0x02,
+0x05,0x04,0x0D,0x04,0x02,0x05,0x03,0x0E,0x03,0x02,0x04,0x03,0x0F,0x03,0x84,0x02,
+0x05,0x03,0x0E,0x03,0x02,0x05,0x04,0x0D,0x04,0x01,0x06,0x0A,0x01,0x08,0x06,0x09,
+0x1A,0x01,0x0B,0x03,0x83,0x00,0x82,0x01,0x0B,0x03,0x82,0x01,0x0B,0x02,0x01,0x0A,
+0x03,0x01,0x09,0x03,0x01,0x08,0x03,0x01,0x07,0x03,0x01,0x05,0x04,0x01,0x04,0x03,
+0x81,0x01,0x03,0x03,0x81,0x02,0x03,0x03,0x10,0x03,0x02,0x03,0x04,0x10,0x03,0x02,
+0x03,0x05,0x10,0x03,0x01,0x04,0x0F,0x01,0x05,0x0E,0x01,0x08,0x09,0x02,0x10,0x01,
+0x08,0x06,0x01,0x06,0x0A,0x02,0x05,0x04,0x0D,0x04,0x03,0x04,0x03,0x08,0x05,0x0F,
+0x03,0x04,0x04,0x02,0x08,0x02,0x0C,0x02,0x10,0x02,0x04,0x03,0x03,0x08,0x02,0x0C,
+0x02,0x10,0x03,0x04,0x03,0x02,0x08,0x02,0x0C,0x02,0x11,0x02,0x03,0x03,0x02,0x08,
+0x04,0x11,0x02,0x04,0x03,0x02,0x08,0x02,0x0B,0x01,0x11,0x02,0x04,0x03,0x02,0x08,
+0x02,0x0B,0x02,0x11,0x02,0x04,0x03,0x03,0x08,0x02,0x0B,0x02,0x10,0x03,0x04,0x04,
+0x02,0x08,0x02,0x0C,0x02,0x10,0x02,0x02,0x04,0x03,0x0F,0x03,0x02,0x05,0x04,0x0D,
+0x04,0x01,0x06,0x0A,0x01,0x08,0x06,0x0E,0x09,0x01,0x02,0x13,0x82,0x01,0x12,0x03,
+0x85,0x02,0x1A,0x02,0x00,0x05,0x0E,0x03,0x02,0x00,0x05,0x0D,0x03,0x02,0x02,0x03,
+0x0D,0x03,0x02,0x02,0x03,0x0C,0x03,0x81,0x02,0x02,0x03,0x0B,0x03,0x02,0x02,0x03,
+0x0A,0x04,0x02,0x02,0x03,0x0A,0x03,0x02,0x02,0x03,0x09,0x03,0x81,0x02,0x02,0x03,
+0x08,0x03,0x81,0x03,0x02,0x03,0x07,0x03,0x0E,0x06,0x02,0x07,0x03,0x0D,0x08,0x03,
+0x06,0x03,0x0D,0x01,0x12,0x04,0x02,0x06,0x03,0x13,0x03,0x02,0x05,0x03,0x13,0x03,
+0x81,0x02,0x04,0x03,0x12,0x03,0x02,0x03,0x04,0x10,0x04,0x02,0x03,0x03,0x0F,0x04,
+0x02,0x02,0x03,0x0F,0x03,0x02,0x02,0x03,0x0E,0x03,0x02,0x01,0x03,0x0D,0x03,0x02,
+0x01,0x03,0x0D,0x09,0x02,0x00,0x03,0x0D,0x09,0x02,0x1A,0x02,0x00,0x05,0x0F,0x03,
+0x02,0x00,0x05,0x0E,0x03,0x02,0x02,0x03,0x0E,0x03,0x02,0x02,0x03,0x0D,0x03,0x81,
+0x02,0x02,0x03,0x0C,0x03,0x02,0x02,0x03,0x0B,0x04,0x02,0x02,0x03,0x0B,0x03,0x02,
+0x02,0x03,0x0A,0x03,0x81,0x02,0x02,0x03,0x09,0x03,0x81,0x03,0x02,0x03,0x08,0x03,
+0x10,0x04,0x02,0x08,0x03,0x0F,0x05,0x02,0x07,0x03,0x0E,0x06,0x03,0x07,0x03,0x0D,
+0x03,0x11,0x03,0x03,0x06,0x03,0x0D,0x02,0x11,0x03,0x03,0x06,0x03,0x0C,0x02,0x11,
+0x03,0x03,0x05,0x03,0x0B,0x02,0x11,0x03,0x03,0x04,0x04,0x0A,0x02,0x11,0x03,0x02,
+0x04,0x03,0x0A,0x0C,0x02,0x03,0x03,0x0A,0x0C,0x02,0x03,0x03,0x11,0x03,0x02,0x02,
+0x03,0x11,0x03,0x81,0x02,0x01,0x03,0x11,0x03,0x09,0x1A,0x01,0x0A,0x03,0x83,0x00,
+0x82,0x01,0x0A,0x03,0x92,0x0B,0x0F,0x02,0x09,0x01,0x10,0x01,0x02,0x08,0x03,0x0F,
+0x03,0x02,0x07,0x03,0x0E,0x03,0x02,0x06,0x03,0x0D,0x03,0x02,0x05,0x03,0x0C,0x03,
+0x02,0x04,0x03,0x0B,0x03,0x02,0x03,0x03,0x0A,0x03,0x02,0x02,0x03,0x09,0x03,0x02,
+0x03,0x03,0x0A,0x03,0x02,0x04,0x03,0x0B,0x03,0x02,0x05,0x03,0x0C,0x03,0x02,0x06,
+0x03,0x0D,0x03,0x02,0x07,0x03,0x0E,0x03,0x02,0x08,0x03,0x0F,0x03,0x02,0x09,0x01,
+0x10,0x01,0x0B,0x0F,0x02,0x04,0x01,0x0C,0x01,0x02,0x03,0x03,0x0B,0x03,0x02,0x04,
+0x03,0x0C,0x03,0x02,0x05,0x03,0x0D,0x03,0x02,0x06,0x03,0x0E,0x03,0x02,0x07,0x03,
+0x0F,0x03,0x02,0x08,0x03,0x10,0x03,0x02,0x09,0x03,0x11,0x03,0x02,0x08,0x03,0x10,
+0x03,0x02,0x07,0x03,0x0F,0x03,0x02,0x06,0x03,0x0E,0x03,0x02,0x05,0x03,0x0D,0x03,
+0x02,0x04,0x03,0x0C,0x03,0x02,0x03,0x03,0x0B,0x03,0x02,0x04,0x01,0x0C,0x01,0x00,
+0x21,0x03,0x00,0x04,0x07,0x04,0x0E,0x04,0x83,0x00,0x82,0x03,0x00,0x04,0x07,0x04,
+0x0E,0x04,0x83,0x00,0x82,0x03,0x00,0x04,0x07,0x04,0x0E,0x04,0x83,0x00,0x83,0x03,
+0x00,0x04,0x07,0x04,0x0E,0x04,0x83,0x00,0x82,0x03,0x00,0x04,0x07,0x04,0x0E,0x04,
+0x83,0x00,0x24,0x03,0x04,0x04,0x0B,0x04,0x12,0x04,0x83,0x03,0x00,0x04,0x07,0x04,
+0x0E,0x04,0x82,0x01,0x00,0x16,0x03,0x04,0x04,0x0B,0x04,0x12,0x04,0x82,0x03,0x00,
+0x04,0x07,0x04,0x0E,0x04,0x82,0x01,0x00,0x16,0x03,0x04,0x04,0x0B,0x04,0x12,0x04,
+0x82,0x03,0x00,0x04,0x07,0x04,0x0E,0x04,0x83,0x03,0x04,0x04,0x0B,0x04,0x12,0x04,
+0x82,0x01,0x00,0x16,0x03,0x00,0x04,0x07,0x04,0x0E,0x04,0x82,0x03,0x04,0x04,0x0B,
+0x04,0x12,0x04,0x82,0x01,0x00,0x16,0x03,0x00,0x04,0x07,0x04,0x0E,0x04,0x82,0x00,
+0x24,0x01,0x00,0x16,0x83,0x03,0x00,0x04,0x07,0x04,0x0E,0x04,0x82,0x01,0x00,0x16,
+0x83,0x03,0x00,0x04,0x07,0x04,0x0E,0x04,0x82,0x01,0x00,0x16,0x83,0x03,0x00,0x04,
+0x07,0x04,0x0E,0x04,0x83,0x01,0x00,0x16,0x83,0x03,0x00,0x04,0x07,0x04,0x0E,0x04,
+0x82,0x01,0x00,0x16,0x83,0x03,0x00,0x04,0x07,0x04,0x0E,0x04,0x82,0x00,0x24,0x01,
+0x0A,0x03,0xA3,0x00,0x24,0x01,0x0A,0x03,0x8F,0x01,0x00,0x0D,0x82,0x01,0x0A,0x03,
+0x90,0x00,0x1C,0x01,0x0B,0x04,0x01,0x0A,0x04,0x01,0x09,0x04,0x01,0x08,0x03,0x00,
+0x01,0x09,0x04,0x01,0x08,0x05,0x01,0x08,0x06,0x81,0x02,0x07,0x03,0x0B,0x03,0x02,
+0x07,0x03,0x0B,0x04,0x02,0x06,0x03,0x0C,0x03,0x02,0x06,0x03,0x0C,0x04,0x02,0x06,
+0x03,0x0D,0x03,0x02,0x05,0x03,0x0D,0x03,0x02,0x05,0x03,0x0D,0x04,0x02,0x04,0x03,
+0x0E,0x03,0x02,0x04,0x03,0x0E,0x04,0x02,0x04,0x03,0x0F,0x03,0x01,0x03,0x0F,0x01,
+0x03,0x10,0x81,0x02,0x02,0x03,0x10,0x04,0x02,0x02,0x03,0x11,0x03,0x02,0x01,0x04,
+0x11,0x04,0x02,0x01,0x03,0x12,0x03,0x81,0x02,0x00,0x03,0x13,0x03,0x00,0x1C,0x01,
+0x08,0x05,0x01,0x07,0x07,0x02,0x06,0x03,0x0C,0x03,0x02,0x05,0x03,0x0D,0x03,0x00,
+0x01,0x09,0x04,0x01,0x08,0x05,0x01,0x08,0x06,0x81,0x02,0x07,0x03,0x0B,0x03,0x02,
+0x07,0x03,0x0B,0x04,0x02,0x06,0x03,0x0C,0x03,0x02,0x06,0x03,0x0C,0x04,0x02,0x06,
+0x03,0x0D,0x03,0x02,0x05,0x03,0x0D,0x03,0x02,0x05,0x03,0x0D,0x04,0x02,0x04,0x03,
+0x0E,0x03,0x02,0x04,0x03,0x0E,0x04,0x02,0x04,0x03,0x0F,0x03,0x01,0x03,0x0F,0x01,
+0x03,0x10,0x81,0x02,0x02,0x03,0x10,0x04,0x02,0x02,0x03,0x11,0x03,0x02,0x01,0x04,
+0x11,0x04,0x02,0x01,0x03,0x12,0x03,0x81,0x02,0x00,0x03,0x13,0x03,0x00,0x1C,0x01,
+0x06,0x04,0x01,0x07,0x04,0x01,0x08,0x04,0x01,0x0A,0x03,0x00,0x01,0x09,0x04,0x01,
+0x08,0x05,0x01,0x08,0x06,0x81,0x02,0x07,0x03,0x0B,0x03,0x02,0x07,0x03,0x0B,0x04,
+0x02,0x06,0x03,0x0C,0x03,0x02,0x06,0x03,0x0C,0x04,0x02,0x06,0x03,0x0D,0x03,0x02,
+0x05,0x03,0x0D,0x03,0x02,0x05,0x03,0x0D,0x04,0x02,0x04,0x03,0x0E,0x03,0x02,0x04,
+0x03,0x0E,0x04,0x02,0x04,0x03,0x0F,0x03,0x01,0x03,0x0F,0x01,0x03,0x10,0x81,0x02,
+0x02,0x03,0x10,0x04,0x02,0x02,0x03,0x11,0x03,0x02,0x01,0x04,0x11,0x04,0x02,0x01,
+0x03,0x12,0x03,0x81,0x02,0x00,0x03,0x13,0x03,0x02,0x1A,0x01,0x07,0x07,0x01,0x05,
+0x0B,0x02,0x04,0x04,0x0D,0x04,0x02,0x03,0x03,0x0F,0x03,0x02,0x03,0x02,0x10,0x02,
+0x02,0x02,0x02,0x11,0x02,0x03,0x02,0x02,0x09,0x05,0x11,0x02,0x03,0x02,0x02,0x07,
+0x08,0x11,0x02,0x03,0x01,0x02,0x06,0x09,0x12,0x02,0x04,0x01,0x02,0x06,0x04,0x0E,
+0x01,0x12,0x02,0x03,0x01,0x02,0x05,0x04,0x12,0x02,0x03,0x01,0x02,0x05,0x03,0x12,
+0x02,0x83,0x03,0x01,0x02,0x05,0x04,0x12,0x02,0x04,0x01,0x02,0x06,0x04,0x0E,0x01,
+0x12,0x02,0x03,0x01,0x02,0x06,0x09,0x12,0x02,0x03,0x02,0x02,0x07,0x08,0x11,0x02,
+0x03,0x02,0x02,0x09,0x04,0x11,0x02,0x02,0x02,0x02,0x11,0x02,0x02,0x03,0x02,0x10,
+0x02,0x02,0x03,0x03,0x0F,0x03,0x02,0x04,0x04,0x0D,0x04,0x01,0x05,0x0B,0x01,0x07,
+0x07,0x00,0x24,0x02,0x07,0x03,0x0D,0x03,0x8C,0x02,0x00,0x0A,0x0D,0x03,0x82,0x01,
+0x0D,0x03,0x82,0x02,0x00,0x0A,0x0D,0x03,0x82,0x02,0x07,0x03,0x0D,0x03,0x8D,0x00,
+0x24,0x02,0x07,0x03,0x0D,0x03,0xA3,0x0D,0x17,0x01,0x00,0x10,0x82,0x01,0x0D,0x03,
+0x82,0x02,0x00,0x0A,0x0D,0x03,0x82,0x02,0x07,0x03,0x0D,0x03,0x8D,0x00,0x16,0x02,
+0x07,0x03,0x0D,0x03,0x8C,0x02,0x00,0x0A,0x0D,0x03,0x82,0x01,0x0D,0x03,0x82,0x01,
+0x00,0x10,0x82,0x02,0x1A,0x01,0x0A,0x02,0x82,0x01,0x08,0x07,0x01,0x07,0x0A,0x01,
+0x05,0x0C,0x03,0x05,0x04,0x0A,0x02,0x0F,0x02,0x02,0x04,0x04,0x0A,0x02,0x02,0x04,
+0x03,0x0A,0x02,0x02,0x03,0x03,0x0A,0x02,0x86,0x02,0x03,0x04,0x0A,0x02,0x02,0x04,
+0x03,0x0A,0x02,0x02,0x04,0x04,0x0A,0x02,0x03,0x05,0x04,0x0A,0x02,0x0F,0x02,0x01,
+0x05,0x0C,0x01,0x06,0x0B,0x01,0x08,0x07,0x01,0x0A,0x02,0x82,0x02,0x1A,0x02,0x01,
+0x05,0x13,0x03,0x02,0x02,0x04,0x12,0x03,0x02,0x03,0x04,0x11,0x03,0x02,0x03,0x04,
+0x10,0x03,0x02,0x04,0x04,0x0F,0x04,0x02,0x04,0x04,0x0F,0x03,0x02,0x05,0x04,0x0E,
+0x03,0x02,0x06,0x04,0x0D,0x03,0x02,0x06,0x04,0x0C,0x04,0x02,0x07,0x04,0x0C,0x03,
+0x01,0x07,0x07,0x01,0x08,0x05,0x01,0x09,0x04,0x01,0x04,0x0D,0x81,0x01,0x09,0x03,
+0x83,0x01,0x04,0x0D,0x81,0x01,0x09,0x03,0x84,0x10,0x14,0x01,0x00,0x0D,0x82,0x01,
+0x0A,0x03,0x90,0x00,0x13,0x01,0x0A,0x03,0x8F,0x01,0x0A,0x0C,0x82,0x00,0x13,0x01,
+0x0A,0x03,0x8F,0x01,0x00,0x16,0x82,0x10,0x14,0x01,0x00,0x16,0x82,0x01,0x0A,0x03,
+0x90,0x00,0x24,0x01,0x0A,0x03,0x8F,0x01,0x0A,0x0C,0x82,0x01,0x0A,0x03,0x90,0x10,
+0x03,0x01,0x00,0x16,0x82,0x00,0x24,0x01,0x0A,0x03,0x8F,0x01,0x00,0x16,0x82,0x01,
+0x0A,0x03,0x90,0x01,0x1B,0x02,0x07,0x04,0x0F,0x02,0x02,0x06,0x06,0x0E,0x03,0x02,
+0x05,0x03,0x0A,0x06,0x02,0x05,0x02,0x0B,0x04,0x00,0x83,0x01,0x07,0x07,0x01,0x04,
+0x0C,0x81,0x02,0x04,0x03,0x0D,0x04,0x01,0x0E,0x03,0x83,0x01,0x07,0x0A,0x01,0x05,
+0x0C,0x02,0x04,0x04,0x0E,0x03,0x02,0x03,0x03,0x0E,0x03,0x02,0x02,0x03,0x0E,0x03,
+0x81,0x02,0x02,0x03,0x0D,0x04,0x02,0x02,0x04,0x0B,0x06,0x02,0x03,0x0B,0x0F,0x05,
+0x02,0x04,0x09,0x0F,0x05,0x02,0x05,0x06,0x10,0x04,0x00,0x1C,0x02,0x07,0x04,0x0F,
+0x02,0x02,0x06,0x07,0x0E,0x03,0x02,0x05,0x02,0x09,0x07,0x02,0x05,0x02,0x0B,0x04,
+0x00,0x01,0x09,0x04,0x01,0x08,0x05,0x01,0x08,0x06,0x81,0x02,0x07,0x03,0x0B,0x03,
+0x02,0x07,0x03,0x0B,0x04,0x02,0x06,0x03,0x0C,0x03,0x02,0x06,0x03,0x0C,0x04,0x02,
+0x06,0x03,0x0D,0x03,0x02,0x05,0x03,0x0D,0x03,0x02,0x05,0x03,0x0D,0x04,0x02,0x04,
+0x03,0x0E,0x03,0x02,0x04,0x03,0x0E,0x04,0x02,0x04,0x03,0x0F,0x03,0x01,0x03,0x0F,
+0x01,0x03,0x10,0x81,0x02,0x02,0x03,0x10,0x04,0x02,0x02,0x03,0x11,0x03,0x02,0x01,
+0x04,0x11,0x04,0x02,0x01,0x03,0x12,0x03,0x81,0x02,0x00,0x03,0x13,0x03,0x00,0x16,
+0x02,0x07,0x03,0x0D,0x03,0x8C,0x02,0x07,0x03,0x0D,0x09,0x82,0x01,0x07,0x03,0x82,
+0x01,0x07,0x0F,0x82,0x0D,0x17,0x01,0x07,0x0F,0x82,0x01,0x07,0x03,0x82,0x02,0x07,
+0x03,0x0D,0x09,0x82,0x02,0x07,0x03,0x0D,0x03,0x8D,0x00,0x16,0x02,0x07,0x03,0x0D,
+0x03,0x8C,0x02,0x00,0x0A,0x0D,0x09,0x82,0x00,0x82,0x01,0x00,0x16,0x82,0x0D,0x17,
+0x01,0x00,0x16,0x82,0x00,0x82,0x02,0x00,0x0A,0x0D,0x09,0x82,0x02,0x07,0x03,0x0D,
+0x03,0x8D,0x00,0x24,0x02,0x07,0x03,0x0D,0x03,0x8C,0x02,0x07,0x03,0x0D,0x09,0x82,
+0x01,0x07,0x03,0x82,0x02,0x07,0x03,0x0D,0x09,0x82,0x02,0x07,0x03,0x0D,0x03,0x8D,
+0x0D,0x09,0x01,0x00,0x16,0x82,0x00,0x82,0x01,0x00,0x16,0x82,0x00,0x24,0x02,0x07,
+0x03,0x0D,0x03,0x8C,0x02,0x00,0x0A,0x0D,0x09,0x82,0x00,0x82,0x02,0x00,0x0A,0x0D,
+0x09,0x82,0x02,0x07,0x03,0x0D,0x03,0x8D,0x06,0x12,0x02,0x03,0x01,0x12,0x01,0x02,
+0x02,0x03,0x11,0x03,0x03,0x03,0x03,0x09,0x04,0x10,0x03,0x01,0x04,0x0E,0x01,0x05,
+0x0C,0x02,0x05,0x04,0x0D,0x04,0x02,0x04,0x04,0x0E,0x04,0x02,0x04,0x03,0x0F,0x03,
+0x83,0x02,0x04,0x04,0x0E,0x04,0x02,0x05,0x04,0x0D,0x04,0x01,0x05,0x0C,0x01,0x04,
+0x0E,0x03,0x03,0x03,0x09,0x04,0x10,0x03,0x02,0x02,0x03,0x11,0x03,0x02,0x03,0x01,
+0x12,0x01,0x00,0x1C,0x02,0x02,0x04,0x0C,0x01,0x02,0x02,0x07,0x0B,0x03,0x01,0x02,
+0x0B,0x01,0x05,0x07,0x01,0x07,0x06,0x01,0x05,0x09,0x02,0x04,0x04,0x0A,0x05,0x02,
+0x05,0x01,0x0B,0x05,0x01,0x0C,0x04,0x01,0x07,0x0A,0x01,0x06,0x0B,0x01,0x04,0x0E,
+0x02,0x04,0x04,0x0D,0x05,0x02,0x03,0x04,0x0F,0x04,0x02,0x03,0x03,0x0F,0x04,0x02,
+0x02,0x03,0x10,0x03,0x85,0x02,0x02,0x03,0x0F,0x04,0x02,0x03,0x03,0x0F,0x03,0x02,
+0x03,0x04,0x0E,0x04,0x02,0x04,0x04,0x0D,0x04,0x01,0x04,0x0C,0x01,0x06,0x09,0x01,
+0x07,0x06,0x05,0x17,0x01,0x02,0x0A,0x01,0x02,0x0D,0x01,0x02,0x0E,0x02,0x02,0x03,
+0x0C,0x05,0x02,0x02,0x03,0x0E,0x04,0x02,0x02,0x03,0x0F,0x03,0x81,0x02,0x02,0x03,
+0x0F,0x04,0x02,0x02,0x03,0x10,0x03,0x02,0x00,0x09,0x10,0x03,0x82,0x02,0x02,0x03,
+0x10,0x03,0x82,0x02,0x02,0x03,0x0F,0x03,0x81,0x02,0x02,0x03,0x0E,0x04,0x02,0x02,
+0x03,0x0D,0x04,0x02,0x02,0x03,0x0B,0x06,0x01,0x02,0x0E,0x01,0x02,0x0C,0x01,0x02,
+0x0A,0x00,0x1C,0x01,0x09,0x05,0x01,0x08,0x07,0x02,0x07,0x03,0x0D,0x03,0x02,0x06,
+0x03,0x0E,0x03,0x00,0x01,0x04,0x0F,0x82,0x01,0x04,0x03,0x86,0x01,0x04,0x0D,0x82,
+0x01,0x04,0x03,0x86,0x01,0x04,0x10,0x82,0x00,0x1C,0x02,0x06,0x03,0x0F,0x03,0x82,
+0x00,0x81,0x01,0x04,0x0F,0x82,0x01,0x04,0x03,0x86,0x01,0x04,0x0D,0x82,0x01,0x04,
+0x03,0x86,0x01,0x04,0x10,0x82,0x00,0x1C,0x01,0x07,0x04,0x01,0x08,0x04,0x01,0x09,
+0x04,0x01,0x0B,0x03,0x00,0x01,0x04,0x0F,0x82,0x01,0x04,0x03,0x86,0x01,0x04,0x0D,
+0x82,0x01,0x04,0x03,0x86,0x01,0x04,0x10,0x82,0x09,0x13,0x01,0x03,0x0A,0x82,0x01,
+0x0A,0x03,0x8F,0x00,0x1C,0x01,0x0C,0x04,0x01,0x0B,0x04,0x01,0x0A,0x04,0x01,0x09,
+0x03,0x00,0x01,0x03,0x0F,0x82,0x01,0x09,0x03,0x90,0x01,0x03,0x0F,0x82,0x00,0x1C,
+0x01,0x08,0x05,0x01,0x07,0x07,0x02,0x06,0x03,0x0C,0x03,0x02,0x05,0x03,0x0D,0x03,
+0x00,0x01,0x03,0x0F,0x82,0x01,0x09,0x03,0x90,0x01,0x03,0x0F,0x82,0x00,0x1C,0x02,
+0x05,0x03,0x0E,0x03,0x82,0x00,0x81,0x01,0x03,0x0F,0x82,0x01,0x09,0x03,0x90,0x01,
+0x03,0x0F,0x82,0x00,0x13,0x01,0x0A,0x03,0x8F,0x01,0x00,0x0D,0x82,0x10,0x14,0x01,
+0x0A,0x0C,0x82,0x01,0x0A,0x03,0x90,0x00,0x24,0x01,0x00,0x16,0xA3,0x12,0x12,0x01,
+0x00,0x16,0x91,0x00,0x21,0x01,0x0A,0x03,0x8C,0x00,0x86,0x01,0x0A,0x03,0x8C,0x00,
+0x1C,0x01,0x06,0x04,0x01,0x07,0x04,0x01,0x08,0x04,0x01,0x0A,0x03,0x00,0x01,0x03,
+0x0F,0x82,0x01,0x09,0x03,0x90,0x01,0x03,0x0F,0x82,0x00,0x12,0x01,0x00,0x16,0x91,
+0x00,0x1C,0x01,0x0C,0x04,0x01,0x0B,0x04,0x01,0x0A,0x04,0x01,0x09,0x03,0x00,0x01,
+0x07,0x07,0x01,0x05,0x0B,0x01,0x04,0x0D,0x02,0x03,0x05,0x0D,0x05,0x02,0x03,0x03,
+0x0F,0x03,0x02,0x02,0x03,0x10,0x03,0x81,0x02,0x01,0x04,0x10,0x04,0x02,0x01,0x03,
+0x11,0x03,0x86,0x02,0x01,0x04,0x10,0x04,0x02,0x02,0x03,0x10,0x03,0x81,0x02,0x03,
+0x03,0x0F,0x03,0x02,0x03,0x05,0x0D,0x05,0x01,0x04,0x0D,0x01,0x05,0x0B,0x01,0x07,
+0x07,0x00,0x1C,0x01,0x06,0x06,0x01,0x05,0x09,0x01,0x04,0x0B,0x02,0x03,0x04,0x0B,
+0x04,0x02,0x03,0x03,0x0C,0x03,0x82,0x02,0x03,0x03,0x0B,0x03,0x81,0x02,0x03,0x03,
+0x0A,0x03,0x81,0x02,0x03,0x03,0x09,0x03,0x81,0x02,0x03,0x03,0x09,0x04,0x02,0x03,
+0x03,0x09,0x05,0x02,0x03,0x03,0x0A,0x05,0x02,0x03,0x03,0x0B,0x05,0x02,0x03,0x03,
+0x0C,0x05,0x02,0x03,0x03,0x0E,0x04,0x02,0x03,0x03,0x0F,0x04,0x02,0x03,0x03,0x10,
+0x04,0x02,0x03,0x03,0x11,0x03,0x82,0x03,0x03,0x03,0x09,0x02,0x10,0x04,0x02,0x03,
+0x03,0x09,0x0A,0x02,0x03,0x03,0x09,0x09,0x02,0x03,0x03,0x0B,0x06,0x00,0x1C,0x01,
+0x08,0x05,0x01,0x07,0x07,0x02,0x06,0x03,0x0C,0x03,0x02,0x05,0x03,0x0D,0x03,0x00,
+0x01,0x07,0x07,0x01,0x05,0x0B,0x01,0x04,0x0D,0x02,0x03,0x05,0x0D,0x05,0x02,0x03,
+0x03,0x0F,0x03,0x02,0x02,0x03,0x10,0x03,0x81,0x02,0x01,0x04,0x10,0x04,0x02,0x01,
+0x03,0x11,0x03,0x86,0x02,0x01,0x04,0x10,0x04,0x02,0x02,0x03,0x10,0x03,0x81,0x02,
+0x03,0x03,0x0F,0x03,0x02,0x03,0x05,0x0D,0x05,0x01,0x04,0x0D,0x01,0x05,0x0B,0x01,
+0x07,0x07,0x00,0x1C,0x01,0x06,0x04,0x01,0x07,0x04,0x01,0x08,0x04,0x01,0x0A,0x03,
+0x00,0x01,0x07,0x07,0x01,0x05,0x0B,0x01,0x04,0x0D,0x02,0x03,0x05,0x0D,0x05,0x02,
+0x03,0x03,0x0F,0x03,0x02,0x02,0x03,0x10,0x03,0x81,0x02,0x01,0x04,0x10,0x04,0x02,
+0x01,0x03,0x11,0x03,0x86,0x02,0x01,0x04,0x10,0x04,0x02,0x02,0x03,0x10,0x03,0x81,
+0x02,0x03,0x03,0x0F,0x03,0x02,0x03,0x05,0x0D,0x05,0x01,0x04,0x0D,0x01,0x05,0x0B,
+0x01,0x07,0x07,0x01,0x1B,0x02,0x07,0x04,0x0F,0x02,0x02,0x06,0x06,0x0E,0x03,0x02,
+0x05,0x03,0x0A,0x06,0x02,0x05,0x02,0x0B,0x04,0x00,0x83,0x01,0x07,0x07,0x01,0x05,
+0x0B,0x01,0x04,0x0D,0x02,0x04,0x04,0x0D,0x04,0x02,0x03,0x04,0x0E,0x04,0x02,0x03,
+0x03,0x0F,0x03,0x02,0x02,0x03,0x10,0x03,0x86,0x02,0x03,0x03,0x0F,0x03,0x02,0x03,
+0x04,0x0E,0x04,0x02,0x04,0x04,0x0D,0x04,0x01,0x04,0x0D,0x01,0x05,0x0B,0x01,0x07,
+0x07,0x00,0x1C,0x02,0x07,0x04,0x0F,0x02,0x02,0x06,0x07,0x0E,0x03,0x02,0x05,0x02,
+0x09,0x07,0x02,0x05,0x02,0x0B,0x04,0x00,0x01,0x07,0x07,0x01,0x05,0x0B,0x01,0x04,
+0x0D,0x02,0x03,0x05,0x0D,0x05,0x02,0x03,0x03,0x0F,0x03,0x02,0x02,0x03,0x10,0x03,
+0x81,0x02,0x01,0x04,0x10,0x04,0x02,0x01,0x03,0x11,0x03,0x86,0x02,0x01,0x04,0x10,
+0x04,0x02,0x02,0x03,0x10,0x03,0x81,0x02,0x03,0x03,0x0F,0x03,0x02,0x03,0x05,0x0D,
+0x05,0x01,0x04,0x0D,0x01,0x05,0x0B,0x01,0x07,0x07,0x09,0x1A,0x02,0x03,0x03,0x0F,
+0x03,0x8C,0x02,0x03,0x04,0x0E,0x04,0x02,0x03,0x04,0x0D,0x05,0x02,0x03,0x06,0x0C,
+0x06,0x02,0x03,0x0B,0x0F,0x03,0x03,0x03,0x03,0x07,0x07,0x0F,0x03,0x03,0x03,0x03,
+0x08,0x04,0x10,0x03,0x01,0x03,0x03,0x86,0x00,0x23,0x01,0x03,0x03,0x88,0x02,0x03,
+0x03,0x0A,0x05,0x02,0x03,0x03,0x08,0x08,0x02,0x03,0x03,0x07,0x0A,0x02,0x03,0x06,
+0x0E,0x04,0x02,0x03,0x05,0x0F,0x03,0x02,0x03,0x04,0x0F,0x04,0x02,0x03,0x03,0x10,
+0x03,0x86,0x02,0x03,0x03,0x0F,0x03,0x02,0x03,0x04,0x0E,0x04,0x02,0x03,0x06,0x0D,
+0x04,0x01,0x03,0x0E,0x02,0x03,0x03,0x07,0x09,0x02,0x03,0x03,0x09,0x05,0x01,0x03,
+0x03,0x86,0x05,0x17,0x01,0x04,0x03,0x84,0x01,0x04,0x0C,0x01,0x04,0x0E,0x01,0x04,
+0x0F,0x02,0x04,0x03,0x0F,0x04,0x02,0x04,0x03,0x10,0x04,0x02,0x04,0x03,0x11,0x03,
+0x83,0x02,0x04,0x03,0x10,0x03,0x02,0x04,0x03,0x0E,0x05,0x01,0x04,0x0E,0x01,0x04,
+0x0C,0x01,0x04,0x0A,0x01,0x04,0x03,0x83,0x00,0x1C,0x01,0x0C,0x04,0x01,0x0B,0x04,
+0x01,0x0A,0x04,0x01,0x09,0x03,0x00,0x02,0x03,0x03,0x10,0x03,0x90,0x02,0x03,0x04,
+0x0F,0x04,0x02,0x04,0x03,0x0F,0x03,0x02,0x04,0x04,0x0D,0x05,0x01,0x05,0x0C,0x01,
+0x06,0x0A,0x01,0x08,0x06,0x00,0x1C,0x01,0x08,0x05,0x01,0x07,0x07,0x02,0x06,0x03,
+0x0C,0x03,0x02,0x05,0x03,0x0D,0x03,0x00,0x02,0x03,0x03,0x10,0x03,0x90,0x02,0x03,
+0x04,0x0F,0x04,0x02,0x04,0x03,0x0F,0x03,0x02,0x04,0x04,0x0D,0x05,0x01,0x05,0x0C,
+0x01,0x06,0x0A,0x01,0x08,0x06,0x00,0x1C,0x01,0x07,0x04,0x01,0x08,0x04,0x01,0x09,
+0x04,0x01,0x0B,0x03,0x00,0x02,0x03,0x03,0x10,0x03,0x90,0x02,0x03,0x04,0x0F,0x04,
+0x02,0x04,0x03,0x0F,0x03,0x02,0x04,0x04,0x0D,0x05,0x01,0x05,0x0C,0x01,0x06,0x0A,
+0x01,0x08,0x06,0x00,0x23,0x01,0x0D,0x04,0x01,0x0C,0x04,0x01,0x0B,0x04,0x01,0x0B,
+0x03,0x01,0x0A,0x03,0x01,0x09,0x03,0x00,0x82,0x02,0x01,0x04,0x12,0x03,0x02,0x02,
+0x03,0x11,0x03,0x81,0x02,0x03,0x03,0x10,0x03,0x81,0x02,0x04,0x03,0x0F,0x03,0x81,
+0x02,0x04,0x04,0x0F,0x03,0x02,0x05,0x03,0x0E,0x03,0x02,0x05,0x04,0x0E,0x03,0x02,
+0x06,0x03,0x0D,0x03,0x02,0x06,0x04,0x0D,0x03,0x02,0x07,0x03,0x0C,0x03,0x81,0x01,
+0x08,0x06,0x81,0x01,0x09,0x04,0x81,0x01,0x09,0x03,0x81,0x01,0x08,0x03,0x01,0x07,
+0x04,0x01,0x06,0x04,0x01,0x02,0x08,0x01,0x02,0x07,0x01,0x02,0x05,0x00,0x1C,0x01,
+0x0C,0x04,0x01,0x0B,0x04,0x01,0x0A,0x04,0x01,0x09,0x03,0x00,0x02,0x01,0x04,0x12,
+0x04,0x02,0x02,0x04,0x12,0x03,0x02,0x03,0x04,0x11,0x03,0x02,0x03,0x04,0x10,0x04,
+0x02,0x04,0x04,0x10,0x03,0x02,0x05,0x03,0x0F,0x03,0x02,0x05,0x04,0x0E,0x04,0x02,
+0x06,0x04,0x0E,0x03,0x02,0x07,0x03,0x0D,0x03,0x02,0x07,0x04,0x0C,0x04,0x01,0x08,
+0x07,0x01,0x09,0x05,0x81,0x01,0x0A,0x03,0x89,0x00,0x03,0x01,0x00,0x16,0x82,0x00,
+0x04,0x01,0x0A,0x04,0x01,0x09,0x04,0x01,0x08,0x04,0x01,0x07,0x03,0x0F,0x03,0x01,
+0x04,0x0E,0x82,0x09,0x13,0x01,0x0A,0x03,0x84,0x01,0x02,0x13,0x82,0x01,0x0A,0x03,
+0x84,0x00,0x82,0x01,0x02,0x13,0x82,0x1C,0x07,0x01,0x00,0x16,0x81,0x00,0x82,0x01,
+0x00,0x16,0x81,0x02,0x1A,0x02,0x01,0x07,0x13,0x03,0x02,0x01,0x08,0x12,0x03,0x03,
+0x01,0x01,0x07,0x03,0x11,0x03,0x02,0x07,0x03,0x11,0x03,0x02,0x06,0x03,0x10,0x03,
+0x02,0x02,0x06,0x0F,0x03,0x02,0x02,0x05,0x0E,0x04,0x02,0x05,0x04,0x0E,0x03,0x02,
+0x07,0x03,0x0D,0x03,0x02,0x07,0x03,0x0C,0x03,0x03,0x01,0x01,0x06,0x04,0x0C,0x03,
+0x02,0x01,0x08,0x0B,0x03,0x03,0x01,0x07,0x0A,0x03,0x10,0x04,0x02,0x0A,0x03,0x0F,
+0x05,0x02,0x09,0x03,0x0E,0x06,0x03,0x08,0x03,0x0D,0x03,0x11,0x03,0x03,0x08,0x03,
+0x0D,0x02,0x11,0x03,0x03,0x07,0x03,0x0C,0x02,0x11,0x03,0x03,0x06,0x03,0x0B,0x02,
+0x11,0x03,0x03,0x05,0x04,0x0A,0x02,0x11,0x03,0x02,0x05,0x03,0x0A,0x0C,0x02,0x04,
+0x03,0x0A,0x0C,0x02,0x03,0x03,0x11,0x03,0x81,0x02,0x02,0x03,0x11,0x03,0x02,0x01,
+0x03,0x11,0x03,0x02,0x1F,0x01,0x05,0x0D,0x01,0x03,0x0F,0x02,0x03,0x08,0x10,0x02,
+0x02,0x02,0x09,0x10,0x02,0x85,0x02,0x03,0x08,0x10,0x02,0x02,0x04,0x07,0x10,0x02,
+0x02,0x05,0x06,0x10,0x02,0x02,0x07,0x04,0x10,0x02,0x02,0x09,0x02,0x10,0x02,0x91,
+0x02,0x20,0x01,0x08,0x08,0x01,0x06,0x0B,0x01,0x05,0x0C,0x02,0x05,0x04,0x0F,0x02,
+0x01,0x04,0x03,0x82,0x01,0x04,0x04,0x01,0x05,0x05,0x01,0x05,0x07,0x01,0x06,0x08,
+0x01,0x06,0x09,0x02,0x05,0x03,0x0B,0x06,0x02,0x04,0x03,0x0D,0x04,0x02,0x04,0x03,
+0x0E,0x04,0x02,0x04,0x03,0x0F,0x03,0x02,0x04,0x04,0x0F,0x03,0x02,0x04,0x05,0x0F,
+0x03,0x02,0x05,0x05,0x0F,0x02,0x02,0x06,0x07,0x0E,0x03,0x01,0x07,0x09,0x01,0x09,
+0x07,0x01,0x0B,0x06,0x01,0x0D,0x04,0x01,0x0E,0x04,0x01,0x0F,0x03,0x81,0x02,0x04,
+0x01,0x0F,0x03,0x02,0x04,0x04,0x0D,0x04,0x01,0x04,0x0D,0x01,0x04,0x0C,0x01,0x07,
+0x07,0x09,0x13,0x01,0x09,0x04,0x83,0x00,0x83,0x01,0x02,0x13,0x82,0x00,0x83,0x01,
+0x09,0x04,0x83,0x1C,0x08,0x01,0x0A,0x02,0x01,0x0A,0x01,0x01,0x09,0x04,0x01,0x0B,
+0x03,0x01,0x0C,0x03,0x81,0x01,0x08,0x06,0x01,0x08,0x05,0x02,0x08,0x01,0x08,0x04,
+0x01,0x07,0x06,0x02,0x06,0x03,0x0B,0x03,0x02,0x06,0x02,0x0C,0x02,0x81,0x02,0x06,
+0x03,0x0B,0x03,0x01,0x07,0x06,0x01,0x08,0x04,0x00,0x03,0x02,0x05,0x03,0x0E,0x03,
+0x82,0x10,0x04,0x01,0x09,0x04,0x83,0x02,0x0D,0x01,0x06,0x06,0x81,0x01,0x09,0x03,
+0x8A,0x02,0x0D,0x01,0x07,0x08,0x01,0x06,0x0B,0x02,0x06,0x02,0x0E,0x03,0x01,0x0E,
+0x03,0x01,0x0D,0x03,0x01,0x08,0x07,0x81,0x01,0x0D,0x03,0x01,0x0E,0x03,0x81,0x02,
+0x06,0x02,0x0D,0x04,0x01,0x06,0x0A,0x01,0x07,0x07,0x02,0x0D,0x01,0x06,0x08,0x01,
+0x05,0x0A,0x02,0x05,0x02,0x0C,0x04,0x01,0x0D,0x03,0x81,0x01,0x0C,0x04,0x01,0x0B,
+0x04,0x01,0x09,0x04,0x01,0x07,0x04,0x01,0x06,0x04,0x01,0x05,0x03,0x01,0x05,0x0B,
+0x81,0x09,0x13,0x01,0x01,0x14,0x92,0xFF,
+};
+#endif
+
+#ifdef USE_FONT_SPAN_24X40
+/* 15139 bytes, 30720 as 1bpp bitmap */
+__UG_FONT_DATA unsigned char font_24x40_span[15139]={
+0x00,0x02,0x01,0x02,0x80,0x02,0xD9,0x02,0x1C,0x03,0x73,0x03,0xB0,0x03,0xFB,0x03,
+0xFC,0x03,0xFD,0x03,0xFE,0x03,0xFF,0x03,0x6D,0x04,0xBB,0x04,0xBC,0x04,0x1A,0x05,
+0x70,0x05,0xB7,0x05,0xFE,0x05,0x40,0x06,0x50,0x06,0x7E,0x06,0xF7,0x06,0xFD,0x06,
+0x45,0x07,0x69,0x07,0x8D,0x07,0xB0,0x07,0xD3,0x07,0xDD,0x07,0x10,0x08,0x4B,0x08,
+0x86,0x08,0x87,0x08,0x93,0x08,0xA1,0x08,0xE0,0x08,0x4D,0x09,0xF5,0x09,0x7D,0x0A,
+0x87,0x0A,0xCD,0x0A,0x13,0x0B,0x54,0x0B,0x62,0x0B,0x78,0x0B,0x7E,0x0B,0x84,0x0B,
+0xD5,0x0B,0x23,0x0C,0x43,0x0C,0x89,0x0C,0xCF,0x0C,0x25,0x0D,0x5D,0x0D,0xCC,0x0D,
+0x0F,0x0E,0x7F,0x0E,0xEE,0x0E,0xFA,0x0E,0x16,0x0F,0x57,0x0F,0x63,0x0F,0xA4,0x0F,
+0xE3,0x0F,0x85,0x10,0xD4,0x10,0x25,0x11,0x63,0x11,0xAC,0x11,0xC2,0x11,0xD4,0x11,
+0x25,0x12,0x37,0x12,0x45,0x12,0x63,0x12,0xE0,0x12,0xEA,0x12,0x55,0x13,0xCE,0x13,
+0x12,0x14,0x49,0x14,0x9F,0x14,0xF6,0x14,0x3C,0x15,0x46,0x15,0x66,0x15,0xCA,0x15,
+0x4E,0x16,0xC1,0x16,0x07,0x17,0x4A,0x17,0x58,0x17,0xA9,0x17,0xB7,0x17,0x10,0x18,
+0x16,0x18,0x24,0x18,0x6F,0x18,0xB8,0x18,0xEC,0x18,0x33,0x19,0x75,0x19,0x94,0x19,
+0xEF,0x19,0x20,0x1A,0x30,0x1A,0x51,0x1A,0xBA,0x1A,0xC4,0x1A,0xF9,0x1A,0x26,0x1B,
+0x60,0x1B,0xA7,0x1B,0xF0,0x1B,0x1B,0x1C,0x5B,0x1C,0x78,0x1C,0xA5,0x1C,0xF2,0x1C,
+0x6B,0x1D,0xCC,0x1D,0x3B,0x1E,0x72,0x1E,0xB7,0x1E,0xBD,0x1E,0x02,0x1F,0x2C,0x1F,
+0x3A,0x1F,0x8E,0x1F,0xC3,0x1F,0x19,0x20,0x7C,0x20,0xCF,0x20,0x2E,0x21,0x91,0x21,
+0xDB,0x21,0x35,0x22,0x7F,0x22,0xD5,0x22,0xE7,0x22,0x09,0x23,0x27,0x23,0x7E,0x23,
+0xE3,0x23,0x07,0x24,0x5D,0x24,0xB0,0x24,0x02,0x25,0x44,0x25,0x92,0x25,0xD7,0x25,
+0x18,0x26,0x8F,0x26,0xDB,0x26,0x03,0x27,0x74,0x27,0xA3,0x27,0x30,0x28,0x91,0x28,
+0xBB,0x28,0x1A,0x29,0x38,0x29,0x86,0x29,0xC7,0x29,0x0D,0x2A,0x9C,0x2A,0xCD,0x2A,
+0xF5,0x2A,0x39,0x2B,0xA4,0x2B,0xAE,0x2B,0x28,0x2C,0xA8,0x2C,0xB4,0x2C,0x0B,0x2D,
+0x62,0x2D,0x94,0x2D,0xE6,0x2D,0x24,0x2E,0x2A,0x2E,0x38,0x2E,0x95,0x2E,0xF6,0x2E,
+0x53,0x2F,0xEC,0x2F,0x0A,0x30,0x12,0x30,0x28,0x30,0x3E,0x30,0x90,0x30,0xE2,0x30,
+0xEC,0x30,0xF6,0x30,0x00,0x31,0x0A,0x31,0x18,0x31,0x1E,0x31,0x2C,0x31,0x90,0x31,
+0xF5,0x31,0x0B,0x32,0x21,0x32,0x35,0x32,0x49,0x32,0x67,0x32,0x73,0x32,0x8F,0x32,
+0xD9,0x32,0x3B,0x33,0x90,0x33,0xB8,0x33,0xD6,0x33,0xFA,0x33,0x04,0x34,0x20,0x34,
+0x40,0x34,0x56,0x34,0x60,0x34,0x6A,0x34,0x70,0x34,0x76,0x34,0x82,0x34,0x9E,0x34,
+0xA4,0x34,0xF6,0x34,0x70,0x35,0xC6,0x35,0x18,0x36,0x6B,0x36,0xC5,0x36,0xF8,0x36,
+0x45,0x37,0x80,0x37,0xAE,0x37,0xE0,0x37,0x0E,0x38,0x91,0x38,0xE5,0x38,0xEB,0x38,
+0xF9,0x38,0xFF,0x38,0x13,0x39,0x1F,0x39,0xBF,0x39,0xED,0x39,0x66,0x3A,0x78,0x3A,
+0x90,0x3A,0xAE,0x3A,0xB6,0x3A,0xBC,0x3A,0xC9,0x3A,0xF5,0x3A,0x1C,0x3B,0x22,0x3B,
+0xFF,0x0B,0x15,0x01,0x09,0x06,0x01,0x06,0x0C,0x02,0x05,0x04,0x0F,0x04,0x02,0x04,
+0x03,0x11,0x03,0x02,0x03,0x03,0x12,0x03,0x02,0x02,0x03,0x13,0x03,0x04,0x02,0x02,
+0x07,0x03,0x0E,0x03,0x14,0x02,0x04,0x01,0x03,0x07,0x03,0x0E,0x03,0x14,0x03,0x04,
+0x01,0x02,0x07,0x03,0x0E,0x03,0x15,0x02,0x02,0x01,0x02,0x15,0x02,0x81,0x04,0x01,
+0x02,0x05,0x02,0x11,0x02,0x15,0x02,0x04,0x01,0x02,0x06,0x01,0x11,0x01,0x15,0x02,
+0x04,0x01,0x03,0x06,0x02,0x10,0x02,0x14,0x03,0x04,0x02,0x02,0x07,0x02,0x0F,0x02,
+0x14,0x02,0x03,0x02,0x03,0x08,0x08,0x13,0x03,0x03,0x03,0x03,0x09,0x06,0x12,0x03,
+0x02,0x04,0x03,0x11,0x03,0x02,0x05,0x04,0x0F,0x04,0x01,0x06,0x0C,0x01,0x09,0x06,
+0x0B,0x15,0x01,0x09,0x06,0x01,0x06,0x0C,0x01,0x05,0x0E,0x01,0x04,0x10,0x01,0x03,
+0x12,0x01,0x02,0x14,0x03,0x02,0x05,0x0A,0x04,0x11,0x05,0x03,0x01,0x06,0x0A,0x04,
+0x11,0x06,0x81,0x01,0x01,0x16,0x81,0x03,0x01,0x04,0x07,0x0A,0x13,0x04,0x03,0x01,
+0x05,0x07,0x0A,0x12,0x05,0x03,0x01,0x05,0x08,0x08,0x12,0x05,0x03,0x02,0x05,0x09,
+0x06,0x11,0x05,0x02,0x02,0x06,0x10,0x06,0x02,0x03,0x06,0x0F,0x06,0x01,0x04,0x10,
+0x01,0x05,0x0E,0x01,0x06,0x0C,0x01,0x09,0x06,0x03,0x1D,0x02,0x04,0x04,0x10,0x04,
+0x02,0x02,0x08,0x0E,0x08,0x02,0x02,0x09,0x0D,0x09,0x02,0x01,0x0A,0x0D,0x0A,0x01,
+0x01,0x16,0x01,0x00,0x18,0x86,0x01,0x01,0x16,0x82,0x01,0x02,0x14,0x81,0x01,0x03,
+0x12,0x81,0x01,0x04,0x10,0x81,0x01,0x05,0x0E,0x01,0x06,0x0C,0x81,0x01,0x07,0x0A,
+0x01,0x08,0x08,0x01,0x09,0x06,0x01,0x0A,0x04,0x01,0x0B,0x02,0x03,0x1D,0x01,0x0C,
+0x01,0x81,0x01,0x0B,0x03,0x01,0x0A,0x05,0x01,0x09,0x06,0x01,0x09,0x07,0x01,0x08,
+0x09,0x01,0x07,0x0A,0x01,0x06,0x0C,0x01,0x05,0x0E,0x01,0x04,0x10,0x01,0x03,0x12,
+0x01,0x02,0x14,0x01,0x01,0x16,0x01,0x00,0x18,0x01,0x01,0x16,0x01,0x02,0x14,0x01,
+0x03,0x12,0x01,0x04,0x10,0x01,0x05,0x0E,0x01,0x06,0x0C,0x01,0x07,0x0B,0x01,0x08,
+0x09,0x01,0x09,0x07,0x01,0x09,0x06,0x01,0x0A,0x05,0x01,0x0B,0x03,0x01,0x0B,0x02,
+0x01,0x0C,0x01,0x03,0x1D,0x01,0x09,0x06,0x01,0x08,0x08,0x01,0x07,0x0A,0x01,0x06,
+0x0C,0x84,0x01,0x07,0x0A,0x81,0x01,0x03,0x12,0x01,0x02,0x14,0x01,0x01,0x16,0x01,
+0x00,0x18,0x84,0x03,0x01,0x09,0x0B,0x02,0x0E,0x09,0x03,0x02,0x07,0x0B,0x02,0x0F,
+0x07,0x03,0x03,0x05,0x0A,0x04,0x10,0x05,0x01,0x0A,0x04,0x84,0x01,0x09,0x06,0x82,
+0x03,0x1D,0x01,0x0B,0x01,0x01,0x0B,0x02,0x01,0x0A,0x03,0x01,0x09,0x05,0x01,0x08,
+0x07,0x01,0x08,0x08,0x01,0x07,0x0A,0x01,0x06,0x0B,0x01,0x05,0x0D,0x01,0x04,0x0F,
+0x01,0x03,0x12,0x01,0x02,0x14,0x81,0x01,0x01,0x16,0x01,0x00,0x18,0x84,0x03,0x01,
+0x09,0x0B,0x02,0x0E,0x09,0x03,0x02,0x07,0x0B,0x02,0x0F,0x07,0x03,0x03,0x04,0x0A,
+0x04,0x11,0x04,0x01,0x0A,0x04,0x83,0x01,0x09,0x06,0x82,0xFF,0xFF,0xFF,0xFF,0x03,
+0x1D,0x01,0x13,0x02,0x01,0x0F,0x07,0x01,0x0C,0x0A,0x01,0x0B,0x0B,0x02,0x0B,0x04,
+0x11,0x05,0x02,0x10,0x03,0x14,0x03,0x02,0x0F,0x04,0x14,0x03,0x02,0x0F,0x03,0x14,
+0x03,0x02,0x0E,0x04,0x14,0x04,0x02,0x0E,0x03,0x15,0x03,0x02,0x06,0x0A,0x15,0x01,
+0x01,0x04,0x0C,0x01,0x03,0x0D,0x02,0x02,0x05,0x0C,0x05,0x02,0x01,0x04,0x0E,0x04,
+0x02,0x01,0x03,0x0F,0x03,0x02,0x00,0x04,0x0F,0x04,0x02,0x00,0x03,0x10,0x03,0x84,
+0x02,0x00,0x04,0x0F,0x04,0x02,0x01,0x03,0x0F,0x03,0x02,0x01,0x04,0x0E,0x04,0x02,
+0x02,0x05,0x0C,0x05,0x01,0x03,0x0D,0x01,0x04,0x0B,0x01,0x06,0x07,0x03,0x1D,0x01,
+0x08,0x07,0x01,0x06,0x0B,0x01,0x05,0x0D,0x02,0x04,0x05,0x0E,0x05,0x02,0x03,0x04,
+0x10,0x04,0x02,0x03,0x03,0x11,0x03,0x02,0x02,0x04,0x11,0x04,0x02,0x02,0x03,0x12,
+0x03,0x84,0x02,0x02,0x04,0x11,0x04,0x02,0x03,0x03,0x11,0x03,0x02,0x03,0x04,0x10,
+0x04,0x02,0x04,0x05,0x0E,0x05,0x01,0x05,0x0D,0x01,0x06,0x0B,0x01,0x08,0x07,0x01,
+0x0A,0x03,0x82,0x01,0x05,0x0D,0x82,0x01,0x0A,0x03,0x83,0xFF,0x03,0x23,0x01,0x15,
+0x01,0x01,0x13,0x03,0x01,0x11,0x05,0x01,0x0F,0x07,0x01,0x0D,0x09,0x02,0x0A,0x09,
+0x14,0x02,0x02,0x08,0x09,0x14,0x02,0x02,0x08,0x07,0x14,0x02,0x02,0x08,0x05,0x14,
+0x02,0x02,0x08,0x03,0x14,0x02,0x02,0x08,0x02,0x14,0x02,0x8A,0x02,0x08,0x02,0x0F,
+0x07,0x02,0x08,0x02,0x0D,0x09,0x81,0x02,0x08,0x02,0x0C,0x09,0x81,0x02,0x08,0x02,
+0x0C,0x08,0x02,0x08,0x02,0x0D,0x05,0x01,0x03,0x07,0x01,0x01,0x09,0x01,0x01,0x08,
+0x01,0x00,0x09,0x01,0x00,0x08,0x81,0x01,0x01,0x05,0x08,0x15,0x01,0x0B,0x03,0x81,
+0x03,0x04,0x02,0x0B,0x03,0x12,0x02,0x03,0x03,0x04,0x09,0x07,0x12,0x03,0x01,0x04,
+0x11,0x01,0x05,0x0F,0x02,0x05,0x05,0x0E,0x05,0x02,0x05,0x03,0x10,0x04,0x02,0x04,
+0x04,0x10,0x04,0x02,0x01,0x06,0x11,0x06,0x82,0x02,0x04,0x04,0x10,0x04,0x02,0x05,
+0x03,0x10,0x04,0x02,0x05,0x05,0x0E,0x05,0x01,0x05,0x0E,0x01,0x04,0x11,0x03,0x03,
+0x04,0x09,0x07,0x11,0x04,0x03,0x04,0x02,0x0B,0x03,0x12,0x02,0x01,0x0B,0x03,0x81,
+0x09,0x17,0x01,0x01,0x01,0x01,0x01,0x03,0x01,0x01,0x05,0x01,0x01,0x07,0x01,0x01,
+0x09,0x01,0x01,0x0B,0x01,0x01,0x0C,0x01,0x01,0x0E,0x01,0x01,0x10,0x01,0x01,0x12,
+0x01,0x01,0x14,0x01,0x01,0x16,0x01,0x01,0x14,0x01,0x01,0x12,0x01,0x01,0x10,0x01,
+0x01,0x0E,0x01,0x01,0x0C,0x01,0x01,0x0B,0x01,0x01,0x09,0x01,0x01,0x07,0x01,0x01,
+0x05,0x01,0x01,0x03,0x01,0x01,0x01,0x09,0x17,0x01,0x16,0x01,0x01,0x14,0x03,0x01,
+0x12,0x05,0x01,0x10,0x07,0x01,0x0E,0x09,0x01,0x0C,0x0B,0x01,0x0B,0x0C,0x01,0x09,
+0x0E,0x01,0x07,0x10,0x01,0x05,0x12,0x01,0x03,0x14,0x01,0x01,0x16,0x01,0x03,0x14,
+0x01,0x05,0x12,0x01,0x07,0x10,0x01,0x09,0x0E,0x01,0x0B,0x0C,0x01,0x0C,0x0B,0x01,
+0x0E,0x09,0x01,0x10,0x07,0x01,0x12,0x05,0x01,0x14,0x03,0x01,0x16,0x01,0x03,0x23,
+0x01,0x0C,0x01,0x01,0x0B,0x03,0x81,0x01,0x0A,0x05,0x01,0x09,0x07,0x01,0x08,0x09,
+0x03,0x07,0x03,0x0B,0x03,0x0F,0x03,0x03,0x07,0x01,0x0B,0x03,0x11,0x01,0x01,0x0B,
+0x03,0x92,0x03,0x07,0x01,0x0B,0x03,0x11,0x01,0x03,0x07,0x03,0x0B,0x03,0x0F,0x03,
+0x01,0x08,0x09,0x01,0x09,0x07,0x01,0x0A,0x05,0x01,0x0B,0x03,0x81,0x01,0x0C,0x01,
+0x03,0x1D,0x02,0x06,0x04,0x0F,0x04,0x94,0x00,0x83,0x02,0x06,0x04,0x0F,0x04,0x83,
+0x03,0x23,0x01,0x07,0x0C,0x01,0x05,0x0E,0x02,0x04,0x08,0x11,0x02,0x02,0x03,0x09,
+0x11,0x02,0x86,0x02,0x04,0x08,0x11,0x02,0x81,0x02,0x05,0x07,0x11,0x02,0x02,0x06,
+0x06,0x11,0x02,0x02,0x08,0x04,0x11,0x02,0x02,0x0A,0x02,0x11,0x02,0x93,0x03,0x23,
+0x01,0x0A,0x08,0x01,0x08,0x0B,0x01,0x07,0x0C,0x02,0x06,0x04,0x11,0x02,0x01,0x05,
+0x04,0x01,0x05,0x03,0x82,0x01,0x05,0x05,0x01,0x06,0x05,0x01,0x07,0x07,0x01,0x07,
+0x09,0x01,0x07,0x0A,0x02,0x06,0x03,0x0C,0x06,0x02,0x06,0x02,0x0E,0x05,0x02,0x05,
+0x03,0x0F,0x05,0x02,0x05,0x03,0x10,0x04,0x02,0x05,0x03,0x11,0x03,0x02,0x05,0x04,
+0x11,0x03,0x02,0x06,0x05,0x11,0x03,0x02,0x06,0x06,0x10,0x03,0x02,0x07,0x08,0x10,
+0x03,0x01,0x09,0x09,0x01,0x0B,0x07,0x01,0x0D,0x06,0x01,0x0F,0x04,0x01,0x10,0x04,
+0x01,0x11,0x03,0x82,0x02,0x05,0x01,0x10,0x04,0x02,0x05,0x04,0x0F,0x04,0x01,0x05,
+0x0D,0x01,0x05,0x0C,0x01,0x08,0x07,0x0D,0x07,0x01,0x01,0x16,0x86,0x01,0x27,0x01,
+0x0C,0x01,0x01,0x0B,0x03,0x81,0x01,0x0A,0x05,0x01,0x09,0x07,0x01,0x08,0x09,0x03,
+0x07,0x03,0x0B,0x03,0x0F,0x03,0x03,0x07,0x01,0x0B,0x03,0x11,0x01,0x01,0x0B,0x03,
+0x91,0x03,0x07,0x01,0x0B,0x03,0x11,0x01,0x03,0x07,0x03,0x0B,0x03,0x0F,0x03,0x01,
+0x08,0x09,0x01,0x09,0x07,0x01,0x0A,0x05,0x01,0x0B,0x03,0x81,0x01,0x0C,0x01,0x00,
+0x81,0x01,0x07,0x0B,0x82,0x03,0x23,0x01,0x0C,0x01,0x01,0x0B,0x03,0x81,0x01,0x0A,
+0x05,0x01,0x09,0x07,0x01,0x08,0x09,0x03,0x07,0x03,0x0B,0x03,0x0F,0x03,0x03,0x07,
+0x01,0x0B,0x03,0x11,0x01,0x01,0x0B,0x03,0x9A,0x03,0x23,0x01,0x0B,0x03,0x9A,0x03,
+0x07,0x01,0x0B,0x03,0x11,0x01,0x03,0x07,0x03,0x0B,0x03,0x0F,0x03,0x01,0x08,0x09,
+0x01,0x09,0x07,0x01,0x0A,0x05,0x01,0x0B,0x03,0x81,0x01,0x0C,0x01,0x0F,0x0B,0x01,
+0x0E,0x02,0x01,0x0F,0x02,0x01,0x0F,0x03,0x01,0x10,0x03,0x01,0x02,0x13,0x01,0x02,
+0x14,0x01,0x02,0x13,0x01,0x10,0x03,0x01,0x0F,0x03,0x01,0x0F,0x02,0x01,0x0E,0x02,
+0x0F,0x0B,0x01,0x08,0x02,0x01,0x07,0x02,0x01,0x06,0x03,0x01,0x05,0x03,0x01,0x03,
+0x13,0x01,0x02,0x14,0x01,0x03,0x13,0x01,0x05,0x03,0x01,0x06,0x03,0x01,0x07,0x02,
+0x01,0x08,0x02,0x0B,0x15,0x01,0x02,0x03,0x91,0x01,0x02,0x14,0x82,0x0F,0x0B,0x02,
+0x08,0x02,0x0E,0x02,0x02,0x07,0x02,0x0F,0x02,0x02,0x06,0x03,0x0F,0x03,0x02,0x05,
+0x03,0x10,0x03,0x01,0x03,0x12,0x01,0x02,0x14,0x01,0x03,0x12,0x02,0x05,0x03,0x10,
+0x03,0x02,0x06,0x03,0x0F,0x03,0x02,0x07,0x02,0x0F,0x02,0x02,0x08,0x02,0x0E,0x02,
+0x09,0x17,0x01,0x0B,0x01,0x81,0x01,0x0A,0x03,0x81,0x01,0x09,0x05,0x81,0x01,0x09,
+0x06,0x01,0x08,0x07,0x01,0x08,0x08,0x01,0x07,0x09,0x01,0x07,0x0A,0x01,0x06,0x0B,
+0x01,0x06,0x0C,0x01,0x05,0x0D,0x01,0x05,0x0E,0x01,0x04,0x0F,0x01,0x04,0x10,0x81,
+0x01,0x03,0x12,0x81,0x01,0x02,0x14,0x81,0x01,0x01,0x16,0x09,0x17,0x01,0x01,0x16,
+0x01,0x02,0x14,0x81,0x01,0x03,0x12,0x81,0x01,0x04,0x10,0x81,0x01,0x04,0x0F,0x01,
+0x05,0x0E,0x01,0x05,0x0D,0x01,0x06,0x0C,0x01,0x06,0x0B,0x01,0x07,0x0A,0x01,0x07,
+0x09,0x01,0x08,0x08,0x01,0x08,0x07,0x01,0x09,0x06,0x01,0x09,0x05,0x81,0x01,0x0A,
+0x03,0x81,0x01,0x0B,0x01,0x81,0xFF,0x03,0x1D,0x01,0x0A,0x04,0x94,0x00,0x83,0x01,
+0x0A,0x04,0x83,0x01,0x0B,0x02,0x05,0x05,0x0F,0x05,0x85,0x02,0x06,0x03,0x10,0x03,
+0x84,0x03,0x1D,0x02,0x0A,0x03,0x12,0x03,0x81,0x02,0x09,0x03,0x11,0x03,0x83,0x02,
+0x08,0x03,0x10,0x03,0x82,0x01,0x03,0x14,0x82,0x02,0x07,0x03,0x0F,0x03,0x81,0x02,
+0x07,0x03,0x0E,0x03,0x02,0x06,0x03,0x0E,0x03,0x81,0x01,0x01,0x15,0x82,0x02,0x05,
+0x03,0x0D,0x03,0x82,0x02,0x04,0x03,0x0C,0x03,0x83,0x02,0x03,0x03,0x0B,0x03,0x81,
+0x01,0x21,0x01,0x0C,0x02,0x81,0x01,0x0A,0x07,0x01,0x08,0x0C,0x01,0x07,0x0D,0x03,
+0x06,0x05,0x0C,0x02,0x11,0x03,0x02,0x05,0x05,0x0C,0x02,0x02,0x05,0x04,0x0C,0x02,
+0x83,0x02,0x05,0x05,0x0C,0x02,0x02,0x06,0x05,0x0C,0x02,0x01,0x07,0x07,0x01,0x08,
+0x06,0x01,0x09,0x06,0x01,0x0A,0x06,0x01,0x0C,0x06,0x01,0x0C,0x07,0x02,0x0C,0x02,
+0x0F,0x05,0x02,0x0C,0x02,0x10,0x04,0x02,0x0C,0x02,0x10,0x05,0x02,0x0C,0x02,0x11,
+0x04,0x83,0x03,0x04,0x01,0x0C,0x02,0x10,0x04,0x03,0x04,0x04,0x0C,0x02,0x0F,0x05,
+0x01,0x04,0x0F,0x01,0x04,0x0E,0x01,0x08,0x08,0x01,0x0C,0x02,0x81,0x03,0x1E,0x02,
+0x03,0x05,0x15,0x03,0x02,0x02,0x08,0x14,0x03,0x03,0x01,0x03,0x07,0x04,0x13,0x03,
+0x03,0x01,0x03,0x08,0x03,0x13,0x03,0x03,0x00,0x03,0x09,0x03,0x12,0x03,0x03,0x00,
+0x03,0x09,0x03,0x11,0x03,0x03,0x00,0x03,0x09,0x03,0x10,0x03,0x81,0x03,0x00,0x03,
+0x09,0x03,0x0F,0x03,0x03,0x01,0x03,0x08,0x03,0x0E,0x03,0x03,0x01,0x04,0x07,0x04,
+0x0E,0x03,0x02,0x02,0x08,0x0D,0x03,0x02,0x04,0x04,0x0C,0x03,0x01,0x0C,0x03,0x01,
+0x0B,0x03,0x01,0x0A,0x03,0x02,0x09,0x03,0x10,0x04,0x02,0x09,0x03,0x0E,0x08,0x03,
+0x08,0x03,0x0D,0x03,0x13,0x04,0x03,0x07,0x03,0x0D,0x03,0x14,0x03,0x03,0x07,0x03,
+0x0C,0x03,0x15,0x03,0x03,0x06,0x03,0x0C,0x03,0x15,0x03,0x03,0x05,0x03,0x0C,0x03,
+0x15,0x03,0x81,0x03,0x04,0x03,0x0C,0x03,0x15,0x03,0x03,0x03,0x03,0x0D,0x03,0x14,
+0x03,0x03,0x02,0x03,0x0D,0x04,0x13,0x04,0x02,0x02,0x03,0x0E,0x08,0x02,0x01,0x03,
+0x10,0x04,0x01,0x00,0x03,0x03,0x1E,0x01,0x09,0x06,0x01,0x07,0x09,0x01,0x06,0x0B,
+0x02,0x06,0x04,0x0D,0x05,0x02,0x05,0x04,0x0E,0x04,0x83,0x02,0x05,0x05,0x0D,0x04,
+0x02,0x06,0x04,0x0C,0x04,0x02,0x06,0x04,0x0B,0x04,0x01,0x06,0x08,0x01,0x06,0x07,
+0x01,0x04,0x08,0x02,0x03,0x09,0x14,0x04,0x03,0x02,0x04,0x08,0x05,0x14,0x04,0x03,
+0x01,0x04,0x09,0x05,0x14,0x04,0x03,0x01,0x04,0x0A,0x04,0x14,0x04,0x03,0x00,0x04,
+0x0A,0x05,0x14,0x03,0x03,0x00,0x04,0x0B,0x05,0x14,0x03,0x03,0x00,0x04,0x0C,0x05,
+0x13,0x04,0x03,0x00,0x04,0x0C,0x05,0x13,0x03,0x02,0x00,0x04,0x0D,0x09,0x02,0x00,
+0x05,0x0E,0x07,0x02,0x01,0x04,0x0F,0x05,0x02,0x01,0x05,0x0F,0x06,0x02,0x02,0x06,
+0x0D,0x09,0x01,0x03,0x14,0x02,0x04,0x0B,0x12,0x06,0x01,0x06,0x07,0x01,0x0B,0x01,
+0x09,0x05,0x85,0x01,0x0A,0x03,0x84,0x01,0x25,0x01,0x12,0x03,0x01,0x10,0x05,0x01,
+0x0E,0x07,0x01,0x0D,0x06,0x01,0x0C,0x05,0x01,0x0B,0x05,0x01,0x0A,0x05,0x01,0x0A,
+0x04,0x01,0x09,0x04,0x81,0x01,0x08,0x04,0x82,0x01,0x07,0x04,0x8A,0x01,0x08,0x04,
+0x82,0x01,0x09,0x04,0x81,0x01,0x0A,0x04,0x01,0x0A,0x05,0x01,0x0B,0x05,0x01,0x0C,
+0x05,0x01,0x0D,0x06,0x01,0x0E,0x07,0x01,0x10,0x05,0x01,0x12,0x03,0x01,0x25,0x01,
+0x03,0x03,0x01,0x03,0x05,0x01,0x03,0x07,0x01,0x05,0x06,0x01,0x07,0x05,0x01,0x08,
+0x05,0x01,0x09,0x05,0x01,0x0A,0x04,0x01,0x0B,0x04,0x81,0x01,0x0C,0x04,0x82,0x01,
+0x0D,0x04,0x8A,0x01,0x0C,0x04,0x82,0x01,0x0B,0x04,0x81,0x01,0x0A,0x04,0x01,0x09,
+0x05,0x01,0x08,0x05,0x01,0x07,0x05,0x01,0x05,0x06,0x01,0x03,0x07,0x01,0x03,0x05,
+0x01,0x03,0x03,0x03,0x11,0x01,0x0A,0x04,0x83,0x03,0x04,0x01,0x0B,0x02,0x13,0x01,
+0x03,0x04,0x03,0x0B,0x02,0x11,0x03,0x02,0x03,0x06,0x0F,0x06,0x02,0x03,0x07,0x0E,
+0x07,0x02,0x06,0x04,0x0E,0x04,0x00,0x02,0x09,0x01,0x0E,0x01,0x01,0x08,0x08,0x02,
+0x07,0x04,0x0D,0x04,0x02,0x06,0x04,0x0E,0x04,0x81,0x02,0x06,0x03,0x0F,0x03,0x02,
+0x08,0x01,0x0F,0x01,0x0B,0x15,0x01,0x0B,0x03,0x88,0x01,0x02,0x15,0x82,0x01,0x0B,
+0x03,0x88,0x1A,0x0C,0x01,0x09,0x06,0x85,0x01,0x0B,0x04,0x81,0x01,0x0B,0x03,0x01,
+0x0A,0x04,0x01,0x09,0x04,0x01,0x09,0x02,0x12,0x03,0x01,0x04,0x10,0x82,0x1A,0x06,
+0x01,0x09,0x06,0x85,0x01,0x25,0x01,0x14,0x03,0x01,0x13,0x03,0x81,0x01,0x12,0x03,
+0x81,0x01,0x11,0x03,0x81,0x01,0x10,0x03,0x81,0x01,0x0F,0x03,0x81,0x01,0x0E,0x03,
+0x81,0x01,0x0D,0x03,0x81,0x01,0x0C,0x03,0x81,0x01,0x0B,0x03,0x01,0x0A,0x04,0x01,
+0x0A,0x03,0x01,0x09,0x03,0x81,0x01,0x08,0x03,0x81,0x01,0x07,0x03,0x81,0x01,0x06,
+0x03,0x81,0x01,0x05,0x03,0x81,0x01,0x04,0x03,0x81,0x01,0x03,0x03,0x81,0x01,0x02,
+0x03,0x81,0x01,0x01,0x03,0x03,0x1E,0x01,0x09,0x06,0x01,0x07,0x0A,0x01,0x06,0x0C,
+0x02,0x05,0x05,0x0E,0x05,0x02,0x04,0x05,0x0F,0x05,0x02,0x04,0x04,0x10,0x04,0x02,
+0x03,0x04,0x11,0x04,0x82,0x02,0x03,0x03,0x12,0x03,0x02,0x02,0x04,0x12,0x04,0x89,
+0x02,0x03,0x03,0x12,0x03,0x02,0x03,0x04,0x11,0x04,0x82,0x02,0x04,0x04,0x10,0x04,
+0x02,0x04,0x05,0x0F,0x05,0x02,0x05,0x05,0x0E,0x05,0x01,0x06,0x0C,0x01,0x07,0x0A,
+0x01,0x09,0x06,0x03,0x1D,0x01,0x0D,0x02,0x01,0x0A,0x05,0x01,0x07,0x08,0x01,0x03,
+0x0C,0x02,0x03,0x07,0x0B,0x04,0x02,0x03,0x02,0x0B,0x04,0x01,0x0B,0x04,0x93,0x01,
+0x03,0x14,0x82,0x03,0x1D,0x01,0x07,0x07,0x01,0x04,0x0C,0x01,0x04,0x0D,0x02,0x04,
+0x03,0x0D,0x05,0x02,0x04,0x01,0x0E,0x04,0x01,0x0F,0x04,0x85,0x01,0x0E,0x04,0x81,
+0x01,0x0D,0x04,0x01,0x0C,0x04,0x01,0x0B,0x04,0x01,0x0A,0x04,0x01,0x09,0x04,0x01,
+0x08,0x04,0x01,0x07,0x04,0x01,0x07,0x03,0x01,0x06,0x04,0x01,0x05,0x04,0x01,0x04,
+0x04,0x81,0x01,0x03,0x05,0x01,0x03,0x10,0x82,0x03,0x1E,0x01,0x07,0x08,0x01,0x05,
+0x0D,0x01,0x05,0x0E,0x02,0x05,0x03,0x0E,0x05,0x01,0x0F,0x05,0x01,0x10,0x04,0x83,
+0x01,0x0F,0x04,0x81,0x01,0x0D,0x05,0x01,0x08,0x08,0x81,0x01,0x08,0x0A,0x01,0x0D,
+0x06,0x01,0x0F,0x05,0x01,0x10,0x04,0x01,0x11,0x04,0x85,0x01,0x10,0x04,0x01,0x0F,
+0x05,0x02,0x05,0x03,0x0E,0x05,0x01,0x05,0x0D,0x01,0x05,0x0C,0x01,0x07,0x08,0x03,
+0x1D,0x01,0x0E,0x04,0x01,0x0D,0x05,0x01,0x0C,0x06,0x81,0x01,0x0B,0x07,0x01,0x0A,
+0x08,0x02,0x0A,0x03,0x0E,0x04,0x02,0x09,0x03,0x0E,0x04,0x02,0x08,0x04,0x0E,0x04,
+0x02,0x08,0x03,0x0E,0x04,0x02,0x07,0x03,0x0E,0x04,0x02,0x06,0x04,0x0E,0x04,0x02,
+0x06,0x03,0x0E,0x04,0x02,0x05,0x03,0x0E,0x04,0x02,0x04,0x04,0x0E,0x04,0x02,0x04,
+0x03,0x0E,0x04,0x02,0x03,0x03,0x0E,0x04,0x02,0x02,0x04,0x0E,0x04,0x01,0x02,0x14,
+0x82,0x01,0x0E,0x04,0x87,0x03,0x1E,0x01,0x06,0x0D,0x82,0x01,0x06,0x03,0x86,0x01,
+0x06,0x07,0x01,0x06,0x09,0x01,0x06,0x0B,0x01,0x0C,0x06,0x01,0x0E,0x05,0x01,0x0F,
+0x04,0x81,0x01,0x10,0x04,0x85,0x01,0x0F,0x05,0x01,0x0F,0x04,0x01,0x0E,0x05,0x02,
+0x05,0x02,0x0D,0x05,0x01,0x05,0x0C,0x01,0x05,0x0B,0x01,0x07,0x07,0x03,0x1E,0x01,
+0x0B,0x07,0x01,0x09,0x0B,0x01,0x08,0x0C,0x02,0x07,0x05,0x11,0x03,0x01,0x06,0x04,
+0x01,0x05,0x04,0x81,0x01,0x04,0x04,0x82,0x01,0x03,0x04,0x02,0x03,0x04,0x0B,0x06,
+0x02,0x03,0x04,0x09,0x09,0x02,0x03,0x04,0x08,0x0C,0x02,0x03,0x07,0x0F,0x05,0x02,
+0x03,0x06,0x10,0x05,0x02,0x03,0x05,0x11,0x04,0x02,0x03,0x05,0x11,0x05,0x02,0x03,
+0x05,0x12,0x04,0x02,0x03,0x04,0x12,0x04,0x81,0x02,0x04,0x04,0x12,0x04,0x81,0x02,
+0x04,0x04,0x12,0x03,0x02,0x05,0x04,0x11,0x04,0x02,0x05,0x04,0x10,0x05,0x02,0x06,
+0x05,0x0F,0x05,0x01,0x07,0x0C,0x01,0x08,0x0A,0x01,0x0A,0x06,0x03,0x1D,0x01,0x04,
+0x11,0x83,0x01,0x11,0x03,0x81,0x01,0x10,0x03,0x01,0x0F,0x04,0x01,0x0F,0x03,0x01,
+0x0E,0x04,0x01,0x0E,0x03,0x01,0x0D,0x04,0x01,0x0D,0x03,0x01,0x0C,0x04,0x01,0x0C,
+0x03,0x01,0x0B,0x04,0x01,0x0B,0x03,0x01,0x0A,0x04,0x01,0x0A,0x03,0x01,0x09,0x04,
+0x01,0x09,0x03,0x01,0x08,0x04,0x81,0x01,0x07,0x04,0x82,0x01,0x06,0x04,0x82,0x03,
+0x1E,0x01,0x09,0x08,0x01,0x07,0x0C,0x01,0x06,0x0E,0x02,0x05,0x05,0x0F,0x05,0x02,
+0x04,0x05,0x10,0x05,0x02,0x04,0x04,0x11,0x04,0x82,0x02,0x04,0x05,0x11,0x04,0x02,
+0x04,0x05,0x10,0x04,0x02,0x05,0x05,0x0F,0x04,0x02,0x06,0x06,0x0E,0x04,0x01,0x07,
+0x0A,0x01,0x08,0x08,0x01,0x07,0x0A,0x02,0x06,0x04,0x0B,0x08,0x02,0x05,0x04,0x0D,
+0x07,0x02,0x04,0x04,0x0E,0x07,0x02,0x04,0x04,0x10,0x05,0x02,0x03,0x04,0x11,0x05,
+0x81,0x02,0x03,0x04,0x12,0x04,0x82,0x02,0x03,0x05,0x12,0x04,0x02,0x04,0x05,0x11,
+0x04,0x02,0x04,0x06,0x0F,0x05,0x01,0x05,0x0E,0x01,0x07,0x0B,0x01,0x09,0x07,0x03,
+0x1E,0x01,0x09,0x06,0x01,0x07,0x0A,0x01,0x06,0x0D,0x02,0x05,0x05,0x0E,0x05,0x02,
+0x04,0x05,0x10,0x04,0x02,0x04,0x04,0x10,0x04,0x02,0x04,0x03,0x11,0x04,0x02,0x03,
+0x04,0x11,0x04,0x81,0x02,0x03,0x04,0x12,0x04,0x81,0x02,0x03,0x04,0x11,0x05,0x02,
+0x03,0x05,0x11,0x05,0x02,0x04,0x04,0x11,0x05,0x02,0x04,0x05,0x10,0x06,0x02,0x05,
+0x05,0x0F,0x07,0x02,0x06,0x0B,0x12,0x04,0x02,0x07,0x09,0x12,0x04,0x02,0x08,0x06,
+0x12,0x04,0x01,0x12,0x04,0x01,0x11,0x04,0x82,0x01,0x10,0x04,0x81,0x01,0x0F,0x04,
+0x02,0x05,0x03,0x0D,0x05,0x01,0x05,0x0C,0x01,0x05,0x0B,0x01,0x07,0x07,0x0B,0x15,
+0x01,0x09,0x06,0x85,0x00,0x88,0x01,0x09,0x06,0x85,0x0B,0x1B,0x01,0x09,0x06,0x85,
+0x00,0x88,0x01,0x09,0x06,0x85,0x01,0x0B,0x04,0x81,0x01,0x0B,0x03,0x01,0x0A,0x04,
+0x01,0x09,0x04,0x01,0x09,0x02,0x0B,0x15,0x01,0x15,0x01,0x01,0x13,0x03,0x01,0x11,
+0x05,0x01,0x0F,0x06,0x01,0x0D,0x06,0x01,0x0C,0x05,0x01,0x0A,0x06,0x01,0x08,0x06,
+0x01,0x06,0x06,0x01,0x04,0x06,0x01,0x02,0x06,0x01,0x04,0x06,0x01,0x06,0x06,0x01,
+0x08,0x06,0x01,0x0A,0x06,0x01,0x0C,0x05,0x01,0x0D,0x06,0x01,0x0F,0x06,0x01,0x11,
+0x05,0x01,0x13,0x03,0x01,0x15,0x01,0x10,0x0A,0x01,0x02,0x14,0x82,0x00,0x83,0x01,
+0x02,0x14,0x82,0x0B,0x15,0x01,0x02,0x01,0x01,0x02,0x03,0x01,0x02,0x05,0x01,0x03,
+0x06,0x01,0x05,0x06,0x01,0x07,0x05,0x01,0x08,0x06,0x01,0x0A,0x06,0x01,0x0C,0x06,
+0x01,0x0E,0x06,0x01,0x10,0x06,0x01,0x0E,0x06,0x01,0x0C,0x06,0x01,0x0A,0x06,0x01,
+0x08,0x06,0x01,0x07,0x05,0x01,0x05,0x06,0x01,0x03,0x06,0x01,0x02,0x05,0x01,0x02,
+0x03,0x01,0x02,0x01,0x03,0x1D,0x01,0x06,0x0A,0x01,0x03,0x0F,0x01,0x03,0x11,0x02,
+0x03,0x03,0x0E,0x06,0x02,0x03,0x03,0x10,0x05,0x02,0x03,0x03,0x11,0x04,0x81,0x01,
+0x11,0x04,0x81,0x01,0x10,0x04,0x01,0x0F,0x04,0x01,0x0E,0x04,0x01,0x0C,0x05,0x01,
+0x0B,0x05,0x01,0x0A,0x04,0x01,0x09,0x04,0x81,0x01,0x08,0x04,0x83,0x00,0x83,0x01,
+0x08,0x04,0x83,0x03,0x1E,0x01,0x0A,0x07,0x01,0x08,0x0A,0x02,0x06,0x05,0x0F,0x04,
+0x02,0x05,0x04,0x11,0x03,0x02,0x04,0x04,0x11,0x03,0x02,0x04,0x03,0x12,0x03,0x02,
+0x03,0x03,0x0D,0x08,0x02,0x03,0x03,0x0C,0x09,0x03,0x02,0x03,0x0B,0x03,0x11,0x04,
+0x03,0x02,0x03,0x0A,0x03,0x12,0x03,0x03,0x02,0x03,0x09,0x03,0x12,0x03,0x03,0x01,
+0x03,0x09,0x03,0x12,0x03,0x03,0x01,0x03,0x09,0x02,0x12,0x03,0x03,0x01,0x03,0x08,
+0x03,0x12,0x03,0x03,0x01,0x03,0x08,0x03,0x11,0x04,0x81,0x03,0x01,0x03,0x08,0x03,
+0x10,0x05,0x81,0x03,0x01,0x03,0x08,0x03,0x0F,0x06,0x04,0x01,0x03,0x08,0x03,0x0F,
+0x02,0x12,0x03,0x04,0x01,0x04,0x09,0x03,0x0E,0x03,0x12,0x03,0x03,0x02,0x03,0x09,
+0x07,0x12,0x03,0x03,0x02,0x03,0x0A,0x05,0x12,0x06,0x03,0x03,0x03,0x0B,0x03,0x12,
+0x06,0x01,0x03,0x03,0x01,0x04,0x03,0x01,0x05,0x03,0x02,0x06,0x04,0x10,0x02,0x01,
+0x07,0x0B,0x01,0x09,0x07,0x07,0x19,0x01,0x0A,0x04,0x01,0x09,0x06,0x82,0x02,0x08,
+0x03,0x0C,0x04,0x81,0x02,0x07,0x04,0x0D,0x04,0x02,0x07,0x03,0x0D,0x04,0x81,0x02,
+0x06,0x04,0x0E,0x04,0x02,0x06,0x03,0x0E,0x04,0x02,0x05,0x04,0x0F,0x04,0x81,0x02,
+0x05,0x03,0x0F,0x04,0x02,0x04,0x04,0x10,0x04,0x81,0x01,0x03,0x12,0x82,0x02,0x02,
+0x04,0x12,0x04,0x81,0x02,0x01,0x05,0x12,0x05,0x02,0x01,0x04,0x13,0x04,0x81,0x02,
+0x00,0x04,0x13,0x05,0x07,0x19,0x01,0x04,0x0D,0x01,0x04,0x0F,0x01,0x04,0x10,0x02,
+0x04,0x04,0x0F,0x06,0x02,0x04,0x04,0x11,0x04,0x83,0x02,0x04,0x04,0x10,0x04,0x02,
+0x04,0x04,0x0E,0x05,0x01,0x04,0x0E,0x01,0x04,0x0C,0x01,0x04,0x0E,0x02,0x04,0x04,
+0x0E,0x06,0x02,0x04,0x04,0x10,0x05,0x02,0x04,0x04,0x11,0x04,0x02,0x04,0x04,0x12,
+0x04,0x83,0x02,0x04,0x04,0x11,0x05,0x02,0x04,0x04,0x10,0x05,0x01,0x04,0x11,0x01,
+0x04,0x0F,0x01,0x04,0x0D,0x07,0x19,0x01,0x0B,0x09,0x01,0x09,0x0E,0x01,0x07,0x10,
+0x02,0x06,0x06,0x13,0x04,0x02,0x05,0x05,0x16,0x01,0x01,0x04,0x05,0x01,0x03,0x05,
+0x01,0x03,0x04,0x81,0x01,0x02,0x04,0x86,0x01,0x03,0x04,0x81,0x01,0x03,0x05,0x01,
+0x04,0x05,0x01,0x05,0x05,0x02,0x06,0x07,0x14,0x03,0x01,0x07,0x10,0x01,0x09,0x0E,
+0x01,0x0B,0x09,0x07,0x19,0x01,0x03,0x0C,0x01,0x03,0x0F,0x01,0x03,0x10,0x02,0x03,
+0x04,0x0E,0x06,0x02,0x03,0x04,0x10,0x05,0x02,0x03,0x04,0x11,0x05,0x02,0x03,0x04,
+0x12,0x04,0x81,0x02,0x03,0x04,0x13,0x04,0x87,0x02,0x03,0x04,0x13,0x03,0x02,0x03,
+0x04,0x12,0x04,0x81,0x02,0x03,0x04,0x11,0x04,0x02,0x03,0x04,0x10,0x05,0x02,0x03,
+0x04,0x0D,0x07,0x01,0x03,0x10,0x01,0x03,0x0E,0x01,0x03,0x0C,0x07,0x19,0x01,0x04,
+0x11,0x82,0x01,0x04,0x04,0x87,0x01,0x04,0x0F,0x82,0x01,0x04,0x04,0x87,0x01,0x04,
+0x12,0x82,0x07,0x19,0x01,0x05,0x12,0x82,0x01,0x05,0x04,0x87,0x01,0x05,0x10,0x82,
+0x01,0x05,0x04,0x8A,0x07,0x19,0x01,0x0B,0x09,0x01,0x09,0x0E,0x01,0x07,0x10,0x02,
+0x06,0x06,0x13,0x04,0x02,0x05,0x05,0x16,0x01,0x01,0x04,0x05,0x01,0x03,0x05,0x01,
+0x03,0x04,0x81,0x01,0x02,0x04,0x82,0x02,0x02,0x04,0x0E,0x09,0x82,0x02,0x02,0x04,
+0x13,0x04,0x02,0x03,0x04,0x13,0x04,0x81,0x02,0x03,0x05,0x13,0x04,0x02,0x04,0x05,
+0x13,0x04,0x02,0x05,0x05,0x13,0x04,0x02,0x06,0x07,0x13,0x04,0x01,0x07,0x10,0x01,
+0x09,0x0E,0x01,0x0B,0x09,0x07,0x19,0x02,0x03,0x04,0x11,0x04,0x8A,0x01,0x03,0x12,
+0x82,0x02,0x03,0x04,0x11,0x04,0x8A,0x07,0x19,0x01,0x03,0x12,0x82,0x01,0x0A,0x04,
+0x92,0x01,0x03,0x12,0x82,0x07,0x19,0x01,0x05,0x0D,0x82,0x01,0x0E,0x04,0x8F,0x01,
+0x0D,0x05,0x01,0x0D,0x04,0x02,0x03,0x02,0x0C,0x05,0x01,0x03,0x0D,0x01,0x03,0x0C,
+0x01,0x05,0x08,0x07,0x19,0x02,0x03,0x04,0x0F,0x06,0x02,0x03,0x04,0x0F,0x05,0x02,
+0x03,0x04,0x0E,0x05,0x02,0x03,0x04,0x0D,0x05,0x02,0x03,0x04,0x0D,0x04,0x02,0x03,
+0x04,0x0C,0x04,0x02,0x03,0x04,0x0B,0x05,0x02,0x03,0x04,0x0A,0x05,0x02,0x03,0x04,
+0x0A,0x04,0x02,0x03,0x04,0x09,0x04,0x02,0x03,0x04,0x08,0x04,0x02,0x03,0x04,0x08,
+0x03,0x01,0x03,0x09,0x02,0x03,0x04,0x08,0x05,0x02,0x03,0x04,0x09,0x05,0x02,0x03,
+0x04,0x0A,0x04,0x02,0x03,0x04,0x0B,0x04,0x02,0x03,0x04,0x0B,0x05,0x02,0x03,0x04,
+0x0C,0x05,0x02,0x03,0x04,0x0D,0x05,0x02,0x03,0x04,0x0E,0x05,0x02,0x03,0x04,0x0F,
+0x05,0x02,0x03,0x04,0x10,0x05,0x02,0x03,0x04,0x10,0x06,0x02,0x03,0x04,0x11,0x06,
+0x07,0x19,0x01,0x04,0x04,0x95,0x01,0x04,0x11,0x82,0x07,0x19,0x02,0x02,0x05,0x11,
+0x05,0x81,0x02,0x02,0x06,0x11,0x05,0x02,0x02,0x06,0x10,0x06,0x81,0x04,0x02,0x03,
+0x06,0x03,0x10,0x02,0x13,0x03,0x04,0x02,0x03,0x06,0x03,0x0F,0x03,0x13,0x03,0x81,
+0x04,0x02,0x03,0x07,0x03,0x0F,0x02,0x13,0x03,0x04,0x02,0x03,0x07,0x03,0x0E,0x03,
+0x13,0x03,0x81,0x04,0x02,0x03,0x08,0x03,0x0E,0x02,0x13,0x03,0x04,0x02,0x03,0x08,
+0x03,0x0D,0x03,0x13,0x03,0x81,0x04,0x02,0x03,0x09,0x03,0x0D,0x02,0x13,0x03,0x03,
+0x02,0x03,0x09,0x06,0x13,0x03,0x81,0x03,0x02,0x03,0x0A,0x04,0x13,0x03,0x82,0x02,
+0x02,0x03,0x13,0x03,0x84,0x07,0x19,0x02,0x03,0x04,0x12,0x03,0x81,0x02,0x03,0x05,
+0x12,0x03,0x02,0x03,0x06,0x12,0x03,0x81,0x02,0x03,0x07,0x12,0x03,0x02,0x03,0x08,
+0x12,0x03,0x03,0x03,0x03,0x07,0x04,0x12,0x03,0x03,0x03,0x03,0x07,0x05,0x12,0x03,
+0x03,0x03,0x03,0x08,0x05,0x12,0x03,0x81,0x03,0x03,0x03,0x09,0x05,0x12,0x03,0x03,
+0x03,0x03,0x0A,0x04,0x12,0x03,0x03,0x03,0x03,0x0A,0x05,0x12,0x03,0x03,0x03,0x03,
+0x0B,0x05,0x12,0x03,0x03,0x03,0x03,0x0C,0x04,0x12,0x03,0x03,0x03,0x03,0x0C,0x05,
+0x12,0x03,0x02,0x03,0x03,0x0D,0x08,0x81,0x02,0x03,0x03,0x0E,0x07,0x02,0x03,0x03,
+0x0F,0x06,0x81,0x02,0x03,0x03,0x10,0x05,0x02,0x03,0x03,0x11,0x04,0x81,0x07,0x19,
+0x01,0x08,0x08,0x01,0x06,0x0C,0x01,0x05,0x0E,0x02,0x04,0x05,0x0F,0x05,0x02,0x03,
+0x05,0x10,0x05,0x02,0x03,0x04,0x11,0x04,0x02,0x02,0x04,0x12,0x04,0x81,0x02,0x01,
+0x04,0x13,0x04,0x88,0x02,0x02,0x04,0x12,0x04,0x81,0x02,0x03,0x04,0x11,0x04,0x02,
+0x03,0x05,0x10,0x05,0x02,0x04,0x05,0x0F,0x05,0x01,0x05,0x0E,0x01,0x06,0x0C,0x01,
+0x08,0x08,0x07,0x19,0x01,0x04,0x0D,0x01,0x04,0x0F,0x01,0x04,0x11,0x02,0x04,0x04,
+0x10,0x05,0x02,0x04,0x04,0x11,0x05,0x02,0x04,0x04,0x12,0x04,0x84,0x02,0x04,0x04,
+0x11,0x04,0x02,0x04,0x04,0x10,0x05,0x02,0x04,0x04,0x0E,0x06,0x01,0x04,0x0F,0x01,
+0x04,0x0E,0x01,0x04,0x0B,0x01,0x04,0x04,0x88,0x07,0x1F,0x01,0x08,0x08,0x01,0x06,
+0x0C,0x01,0x05,0x0E,0x02,0x04,0x05,0x0F,0x05,0x02,0x03,0x05,0x10,0x05,0x02,0x03,
+0x04,0x11,0x04,0x02,0x02,0x04,0x12,0x04,0x81,0x02,0x01,0x04,0x13,0x04,0x88,0x02,
+0x02,0x04,0x12,0x04,0x81,0x02,0x03,0x04,0x11,0x04,0x02,0x03,0x05,0x10,0x05,0x02,
+0x04,0x05,0x0F,0x05,0x01,0x05,0x0E,0x01,0x06,0x0C,0x01,0x08,0x0A,0x01,0x0E,0x05,
+0x01,0x0F,0x06,0x01,0x10,0x08,0x01,0x11,0x06,0x01,0x13,0x04,0x01,0x15,0x01,0x07,
+0x19,0x01,0x04,0x0D,0x01,0x04,0x0F,0x01,0x04,0x10,0x02,0x04,0x04,0x0F,0x05,0x02,
+0x04,0x04,0x10,0x05,0x02,0x04,0x04,0x11,0x04,0x83,0x02,0x04,0x04,0x10,0x04,0x02,
+0x04,0x04,0x0F,0x05,0x02,0x04,0x04,0x0D,0x06,0x01,0x04,0x0E,0x01,0x04,0x0C,0x81,
+0x02,0x04,0x04,0x0C,0x05,0x81,0x02,0x04,0x04,0x0D,0x05,0x02,0x04,0x04,0x0E,0x05,
+0x02,0x04,0x04,0x0F,0x05,0x81,0x02,0x04,0x04,0x10,0x05,0x02,0x04,0x04,0x11,0x05,
+0x02,0x04,0x04,0x12,0x05,0x81,0x07,0x19,0x01,0x08,0x09,0x01,0x06,0x0E,0x01,0x05,
+0x0F,0x02,0x04,0x05,0x10,0x04,0x01,0x03,0x04,0x83,0x01,0x03,0x05,0x01,0x04,0x06,
+0x01,0x04,0x09,0x01,0x06,0x0A,0x01,0x08,0x0B,0x01,0x0A,0x0A,0x01,0x0D,0x08,0x01,
+0x10,0x06,0x01,0x11,0x05,0x01,0x12,0x04,0x82,0x02,0x03,0x02,0x11,0x04,0x02,0x03,
+0x05,0x0F,0x06,0x01,0x03,0x11,0x01,0x03,0x0F,0x01,0x07,0x09,0x07,0x19,0x01,0x00,
+0x18,0x82,0x01,0x0A,0x04,0x95,0x07,0x19,0x02,0x03,0x04,0x12,0x04,0x92,0x02,0x04,
+0x04,0x11,0x04,0x02,0x04,0x04,0x10,0x05,0x02,0x05,0x05,0x0F,0x05,0x01,0x05,0x0F,
+0x01,0x07,0x0B,0x01,0x09,0x07,0x07,0x19,0x02,0x00,0x05,0x14,0x04,0x02,0x01,0x04,
+0x13,0x04,0x81,0x02,0x01,0x05,0x12,0x05,0x02,0x02,0x04,0x12,0x04,0x02,0x02,0x05,
+0x12,0x04,0x02,0x03,0x04,0x11,0x04,0x81,0x02,0x03,0x05,0x11,0x04,0x02,0x04,0x04,
+0x10,0x04,0x02,0x04,0x05,0x10,0x04,0x02,0x05,0x04,0x0F,0x04,0x81,0x02,0x05,0x05,
+0x0F,0x04,0x02,0x06,0x04,0x0E,0x04,0x02,0x06,0x05,0x0E,0x04,0x02,0x07,0x04,0x0E,
+0x03,0x02,0x07,0x04,0x0D,0x04,0x02,0x07,0x05,0x0D,0x04,0x02,0x08,0x04,0x0D,0x03,
+0x01,0x08,0x08,0x01,0x09,0x06,0x82,0x01,0x0A,0x04,0x07,0x19,0x02,0x00,0x03,0x15,
+0x03,0x02,0x00,0x04,0x15,0x03,0x81,0x02,0x01,0x03,0x14,0x03,0x81,0x03,0x01,0x03,
+0x0A,0x04,0x14,0x03,0x81,0x03,0x01,0x03,0x0A,0x05,0x14,0x03,0x03,0x01,0x04,0x09,
+0x06,0x14,0x03,0x03,0x01,0x04,0x09,0x06,0x13,0x03,0x03,0x02,0x03,0x09,0x06,0x13,
+0x03,0x03,0x02,0x03,0x09,0x07,0x13,0x03,0x04,0x02,0x03,0x08,0x03,0x0D,0x03,0x13,
+0x03,0x81,0x04,0x02,0x04,0x08,0x03,0x0D,0x03,0x13,0x03,0x04,0x02,0x04,0x08,0x03,
+0x0D,0x03,0x12,0x03,0x04,0x03,0x03,0x08,0x02,0x0D,0x04,0x12,0x03,0x04,0x03,0x03,
+0x07,0x03,0x0E,0x03,0x12,0x03,0x82,0x03,0x03,0x03,0x07,0x02,0x0E,0x07,0x02,0x03,
+0x06,0x0F,0x05,0x81,0x02,0x04,0x05,0x0F,0x05,0x02,0x04,0x04,0x0F,0x05,0x07,0x19,
+0x02,0x01,0x05,0x13,0x04,0x02,0x02,0x05,0x12,0x04,0x02,0x03,0x05,0x12,0x03,0x02,
+0x04,0x04,0x11,0x03,0x02,0x04,0x05,0x10,0x04,0x02,0x05,0x05,0x0F,0x04,0x02,0x06,
+0x05,0x0F,0x03,0x02,0x06,0x05,0x0E,0x03,0x02,0x07,0x05,0x0D,0x04,0x01,0x08,0x08,
+0x01,0x09,0x06,0x01,0x09,0x05,0x01,0x0A,0x05,0x01,0x09,0x07,0x01,0x08,0x08,0x02,
+0x07,0x04,0x0C,0x05,0x02,0x07,0x03,0x0D,0x05,0x02,0x06,0x04,0x0E,0x05,0x02,0x05,
+0x04,0x0E,0x05,0x02,0x04,0x04,0x0F,0x05,0x02,0x04,0x03,0x10,0x05,0x02,0x03,0x04,
+0x11,0x04,0x02,0x02,0x04,0x11,0x05,0x02,0x01,0x04,0x12,0x05,0x02,0x00,0x04,0x13,
+0x05,0x07,0x19,0x02,0x01,0x05,0x14,0x04,0x02,0x02,0x04,0x13,0x04,0x02,0x03,0x04,
+0x13,0x03,0x02,0x03,0x05,0x12,0x04,0x02,0x04,0x04,0x12,0x03,0x02,0x05,0x04,0x11,
+0x04,0x02,0x05,0x05,0x10,0x04,0x02,0x06,0x05,0x10,0x03,0x02,0x07,0x04,0x0F,0x04,
+0x02,0x07,0x05,0x0F,0x03,0x02,0x08,0x05,0x0E,0x04,0x01,0x09,0x08,0x01,0x09,0x07,
+0x01,0x0A,0x06,0x01,0x0B,0x04,0x8A,0x07,0x19,0x01,0x03,0x13,0x82,0x01,0x11,0x05,
+0x01,0x10,0x05,0x01,0x10,0x04,0x01,0x0F,0x04,0x01,0x0E,0x04,0x01,0x0D,0x04,0x01,
+0x0C,0x05,0x01,0x0B,0x05,0x01,0x0B,0x04,0x01,0x0A,0x04,0x01,0x09,0x04,0x01,0x08,
+0x05,0x01,0x07,0x05,0x01,0x07,0x04,0x01,0x06,0x04,0x01,0x05,0x04,0x01,0x04,0x04,
+0x01,0x03,0x05,0x01,0x02,0x05,0x01,0x02,0x14,0x82,0x01,0x25,0x01,0x09,0x0C,0x82,
+0x01,0x09,0x03,0x9E,0x01,0x09,0x0C,0x82,0x01,0x25,0x01,0x01,0x03,0x01,0x02,0x03,
+0x81,0x01,0x03,0x03,0x81,0x01,0x04,0x03,0x81,0x01,0x05,0x03,0x81,0x01,0x06,0x03,
+0x81,0x01,0x07,0x03,0x81,0x01,0x08,0x03,0x81,0x01,0x09,0x03,0x81,0x01,0x0A,0x03,
+0x01,0x0A,0x04,0x01,0x0B,0x03,0x01,0x0C,0x03,0x81,0x01,0x0D,0x03,0x81,0x01,0x0E,
+0x03,0x81,0x01,0x0F,0x03,0x81,0x01,0x10,0x03,0x81,0x01,0x11,0x03,0x81,0x01,0x12,
+0x03,0x81,0x01,0x13,0x03,0x81,0x01,0x14,0x03,0x01,0x25,0x01,0x03,0x0C,0x82,0x01,
+0x0C,0x03,0x9E,0x01,0x03,0x0C,0x82,0x03,0x17,0x01,0x0B,0x01,0x81,0x01,0x0A,0x03,
+0x81,0x01,0x0A,0x04,0x01,0x09,0x05,0x81,0x02,0x08,0x03,0x0C,0x03,0x81,0x02,0x08,
+0x03,0x0D,0x03,0x02,0x07,0x03,0x0D,0x03,0x02,0x07,0x03,0x0E,0x03,0x02,0x06,0x03,
+0x0E,0x03,0x02,0x06,0x03,0x0E,0x04,0x02,0x06,0x02,0x0F,0x03,0x02,0x05,0x03,0x0F,
+0x04,0x02,0x05,0x03,0x10,0x03,0x02,0x04,0x03,0x10,0x03,0x02,0x04,0x03,0x11,0x03,
+0x02,0x03,0x03,0x11,0x03,0x02,0x03,0x03,0x12,0x03,0x81,0x02,0x02,0x03,0x13,0x03,
+0x20,0x03,0x01,0x00,0x18,0x82,0x00,0x04,0x01,0x08,0x04,0x01,0x09,0x04,0x01,0x0B,
+0x03,0x01,0x0C,0x03,0x0B,0x15,0x01,0x08,0x09,0x01,0x05,0x0D,0x01,0x05,0x0E,0x02,
+0x05,0x03,0x0F,0x05,0x02,0x05,0x01,0x10,0x04,0x01,0x10,0x04,0x82,0x01,0x09,0x0B,
+0x01,0x07,0x0D,0x01,0x05,0x0F,0x02,0x04,0x06,0x10,0x04,0x02,0x04,0x04,0x10,0x04,
+0x02,0x03,0x04,0x10,0x04,0x82,0x02,0x03,0x04,0x0F,0x05,0x02,0x03,0x06,0x0D,0x08,
+0x02,0x04,0x0C,0x11,0x07,0x02,0x05,0x0A,0x11,0x07,0x02,0x07,0x06,0x13,0x04,0x01,
+0x1F,0x01,0x03,0x04,0x89,0x02,0x03,0x04,0x0B,0x05,0x02,0x03,0x04,0x09,0x09,0x02,
+0x03,0x04,0x08,0x0B,0x03,0x03,0x04,0x08,0x03,0x0F,0x05,0x02,0x03,0x06,0x10,0x04,
+0x02,0x03,0x05,0x10,0x04,0x02,0x03,0x04,0x11,0x04,0x87,0x02,0x03,0x04,0x10,0x04,
+0x81,0x02,0x03,0x05,0x0F,0x05,0x02,0x03,0x07,0x0E,0x05,0x01,0x03,0x0F,0x02,0x03,
+0x04,0x08,0x09,0x02,0x03,0x03,0x0A,0x05,0x0B,0x15,0x01,0x0A,0x09,0x01,0x08,0x0D,
+0x01,0x06,0x0F,0x02,0x05,0x06,0x12,0x03,0x01,0x05,0x05,0x01,0x04,0x05,0x01,0x04,
+0x04,0x01,0x03,0x04,0x86,0x01,0x04,0x04,0x01,0x04,0x05,0x01,0x04,0x06,0x02,0x05,
+0x07,0x12,0x03,0x01,0x06,0x0F,0x01,0x08,0x0D,0x01,0x0A,0x09,0x01,0x1F,0x01,0x11,
+0x04,0x89,0x02,0x08,0x06,0x11,0x04,0x02,0x06,0x0A,0x11,0x04,0x01,0x05,0x10,0x02,
+0x04,0x05,0x0E,0x07,0x02,0x04,0x04,0x10,0x05,0x02,0x03,0x04,0x11,0x04,0x81,0x02,
+0x02,0x04,0x11,0x04,0x87,0x02,0x03,0x04,0x10,0x05,0x02,0x03,0x04,0x0F,0x06,0x02,
+0x04,0x04,0x0D,0x08,0x02,0x04,0x0C,0x11,0x04,0x02,0x05,0x0A,0x11,0x04,0x02,0x07,
+0x06,0x11,0x04,0x0B,0x15,0x01,0x0A,0x06,0x01,0x07,0x0B,0x01,0x06,0x0D,0x02,0x05,
+0x05,0x0F,0x05,0x02,0x05,0x04,0x10,0x04,0x02,0x04,0x04,0x11,0x03,0x02,0x04,0x04,
+0x11,0x04,0x02,0x03,0x04,0x11,0x04,0x81,0x01,0x03,0x12,0x82,0x01,0x03,0x04,0x81,
+0x01,0x04,0x04,0x81,0x01,0x04,0x05,0x02,0x05,0x06,0x12,0x03,0x01,0x06,0x0F,0x01,
+0x07,0x0E,0x01,0x0A,0x08,0x01,0x1F,0x01,0x0E,0x09,0x01,0x0C,0x0C,0x01,0x0A,0x0E,
+0x02,0x0A,0x05,0x16,0x02,0x01,0x09,0x05,0x01,0x09,0x04,0x84,0x01,0x03,0x14,0x82,
+0x01,0x09,0x04,0x91,0x0B,0x1D,0x02,0x08,0x06,0x11,0x04,0x02,0x06,0x0A,0x11,0x04,
+0x01,0x05,0x10,0x02,0x04,0x05,0x0E,0x07,0x02,0x04,0x04,0x10,0x05,0x02,0x03,0x04,
+0x11,0x04,0x81,0x02,0x02,0x04,0x11,0x04,0x87,0x02,0x03,0x04,0x10,0x05,0x02,0x03,
+0x05,0x0F,0x06,0x03,0x04,0x05,0x0D,0x03,0x11,0x04,0x02,0x04,0x0C,0x11,0x04,0x02,
+0x05,0x0A,0x11,0x04,0x02,0x07,0x06,0x11,0x04,0x01,0x11,0x04,0x81,0x01,0x10,0x04,
+0x81,0x02,0x04,0x03,0x0E,0x05,0x01,0x04,0x0E,0x01,0x04,0x0D,0x01,0x07,0x08,0x01,
+0x1F,0x01,0x04,0x04,0x89,0x02,0x04,0x04,0x0D,0x06,0x02,0x04,0x04,0x0B,0x09,0x02,
+0x04,0x04,0x0A,0x0B,0x03,0x04,0x04,0x09,0x03,0x11,0x04,0x02,0x04,0x07,0x11,0x05,
+0x02,0x04,0x06,0x12,0x04,0x02,0x04,0x05,0x12,0x04,0x02,0x04,0x04,0x12,0x04,0x8D,
+0x01,0x1F,0x01,0x0A,0x05,0x84,0x00,0x84,0x01,0x03,0x0C,0x82,0x01,0x0B,0x04,0x91,
+0x01,0x27,0x01,0x0C,0x05,0x84,0x00,0x84,0x01,0x04,0x0D,0x82,0x01,0x0D,0x04,0x94,
+0x01,0x0C,0x04,0x02,0x03,0x02,0x0B,0x05,0x01,0x03,0x0C,0x01,0x03,0x0B,0x01,0x05,
+0x07,0x01,0x1F,0x01,0x04,0x04,0x89,0x02,0x04,0x04,0x0F,0x06,0x02,0x04,0x04,0x0F,
+0x05,0x02,0x04,0x04,0x0E,0x05,0x02,0x04,0x04,0x0D,0x05,0x02,0x04,0x04,0x0C,0x05,
+0x02,0x04,0x04,0x0B,0x06,0x02,0x04,0x04,0x0B,0x05,0x02,0x04,0x04,0x0A,0x05,0x02,
+0x04,0x04,0x09,0x05,0x01,0x04,0x09,0x81,0x02,0x04,0x04,0x09,0x05,0x02,0x04,0x04,
+0x0A,0x05,0x02,0x04,0x04,0x0B,0x05,0x02,0x04,0x04,0x0C,0x05,0x02,0x04,0x04,0x0D,
+0x05,0x02,0x04,0x04,0x0E,0x05,0x02,0x04,0x04,0x0F,0x05,0x02,0x04,0x04,0x0F,0x06,
+0x02,0x04,0x04,0x10,0x06,0x02,0x04,0x04,0x11,0x06,0x01,0x1F,0x01,0x04,0x0C,0x82,
+0x01,0x0C,0x04,0x9B,0x0B,0x15,0x03,0x02,0x03,0x08,0x04,0x11,0x03,0x03,0x02,0x03,
+0x07,0x06,0x10,0x05,0x03,0x02,0x03,0x06,0x07,0x0F,0x07,0x03,0x02,0x06,0x0B,0x06,
+0x13,0x03,0x03,0x02,0x05,0x0B,0x05,0x13,0x03,0x03,0x02,0x04,0x0B,0x04,0x13,0x03,
+0x81,0x03,0x02,0x03,0x0B,0x03,0x13,0x03,0x8D,0x0B,0x15,0x02,0x04,0x04,0x0D,0x06,
+0x02,0x04,0x04,0x0B,0x09,0x02,0x04,0x04,0x0A,0x0B,0x03,0x04,0x04,0x09,0x03,0x11,
+0x04,0x02,0x04,0x07,0x11,0x05,0x02,0x04,0x06,0x12,0x04,0x02,0x04,0x05,0x12,0x04,
+0x02,0x04,0x04,0x12,0x04,0x8D,0x0B,0x15,0x01,0x08,0x08,0x01,0x06,0x0C,0x01,0x05,
+0x0E,0x02,0x04,0x05,0x0F,0x05,0x02,0x03,0x05,0x10,0x05,0x02,0x03,0x04,0x11,0x04,
+0x81,0x02,0x02,0x04,0x12,0x04,0x86,0x02,0x03,0x04,0x11,0x04,0x81,0x02,0x03,0x05,
+0x10,0x05,0x02,0x04,0x05,0x0F,0x05,0x01,0x05,0x0E,0x01,0x06,0x0C,0x01,0x08,0x08,
+0x0B,0x1D,0x02,0x04,0x04,0x0C,0x05,0x02,0x04,0x04,0x0A,0x09,0x02,0x04,0x04,0x09,
+0x0B,0x02,0x04,0x08,0x10,0x05,0x02,0x04,0x06,0x11,0x04,0x02,0x04,0x05,0x11,0x04,
+0x02,0x04,0x04,0x12,0x04,0x87,0x02,0x04,0x04,0x11,0x04,0x81,0x02,0x04,0x05,0x10,
+0x05,0x02,0x04,0x07,0x0F,0x05,0x01,0x04,0x0F,0x02,0x04,0x04,0x09,0x09,0x02,0x04,
+0x04,0x0B,0x05,0x01,0x04,0x04,0x87,0x0B,0x1D,0x02,0x08,0x06,0x12,0x03,0x02,0x06,
+0x0A,0x11,0x04,0x01,0x05,0x10,0x02,0x04,0x05,0x0E,0x07,0x02,0x04,0x04,0x10,0x05,
+0x02,0x03,0x04,0x11,0x04,0x81,0x02,0x02,0x04,0x11,0x04,0x87,0x02,0x03,0x04,0x10,
+0x05,0x02,0x03,0x04,0x0F,0x06,0x03,0x04,0x04,0x0D,0x03,0x11,0x04,0x02,0x04,0x0B,
+0x11,0x04,0x02,0x05,0x09,0x11,0x04,0x02,0x07,0x06,0x11,0x04,0x01,0x11,0x04,0x87,
+0x0B,0x15,0x02,0x06,0x04,0x0F,0x07,0x02,0x06,0x04,0x0D,0x09,0x02,0x06,0x04,0x0C,
+0x0A,0x03,0x06,0x04,0x0B,0x04,0x13,0x03,0x02,0x06,0x07,0x13,0x03,0x02,0x06,0x06,
+0x13,0x03,0x02,0x06,0x05,0x13,0x03,0x01,0x06,0x04,0x8D,0x0B,0x15,0x01,0x09,0x09,
+0x01,0x06,0x0E,0x01,0x05,0x0F,0x02,0x04,0x06,0x11,0x03,0x01,0x04,0x04,0x82,0x01,
+0x04,0x06,0x01,0x05,0x08,0x01,0x06,0x0A,0x01,0x08,0x0A,0x01,0x0B,0x09,0x01,0x0E,
+0x06,0x01,0x10,0x05,0x01,0x11,0x04,0x81,0x02,0x03,0x01,0x10,0x05,0x02,0x03,0x04,
+0x0F,0x05,0x01,0x03,0x10,0x01,0x03,0x0F,0x01,0x06,0x0A,0x07,0x19,0x01,0x08,0x04,
+0x83,0x01,0x03,0x13,0x82,0x01,0x08,0x04,0x8C,0x01,0x08,0x05,0x01,0x09,0x05,0x01,
+0x09,0x0D,0x01,0x0A,0x0C,0x01,0x0C,0x0A,0x0B,0x15,0x02,0x03,0x04,0x10,0x04,0x8D,
+0x02,0x03,0x04,0x0F,0x05,0x02,0x03,0x04,0x0E,0x06,0x02,0x03,0x04,0x0D,0x07,0x03,
+0x03,0x05,0x0C,0x03,0x10,0x04,0x02,0x04,0x0B,0x10,0x04,0x02,0x05,0x08,0x10,0x04,
+0x02,0x06,0x06,0x10,0x04,0x0B,0x15,0x02,0x01,0x04,0x12,0x05,0x02,0x02,0x04,0x12,
+0x04,0x81,0x02,0x02,0x05,0x11,0x05,0x02,0x03,0x04,0x11,0x04,0x02,0x03,0x05,0x11,
+0x04,0x02,0x04,0x04,0x10,0x04,0x81,0x02,0x05,0x04,0x0F,0x04,0x81,0x02,0x05,0x05,
+0x0F,0x04,0x02,0x06,0x04,0x0E,0x04,0x81,0x02,0x07,0x04,0x0E,0x03,0x02,0x07,0x04,
+0x0D,0x04,0x02,0x08,0x04,0x0D,0x03,0x01,0x08,0x08,0x81,0x01,0x09,0x06,0x81,0x01,
+0x0A,0x04,0x0B,0x15,0x02,0x00,0x04,0x15,0x03,0x81,0x03,0x00,0x04,0x0A,0x04,0x15,
+0x02,0x03,0x01,0x03,0x0A,0x05,0x14,0x03,0x81,0x03,0x01,0x04,0x09,0x06,0x14,0x03,
+0x81,0x04,0x01,0x04,0x09,0x02,0x0D,0x02,0x14,0x02,0x04,0x02,0x03,0x09,0x02,0x0D,
+0x03,0x13,0x03,0x04,0x02,0x03,0x08,0x03,0x0D,0x03,0x13,0x03,0x81,0x04,0x02,0x04,
+0x08,0x02,0x0E,0x02,0x13,0x03,0x04,0x02,0x04,0x08,0x02,0x0E,0x03,0x13,0x02,0x04,
+0x03,0x03,0x07,0x03,0x0E,0x03,0x12,0x03,0x81,0x04,0x03,0x03,0x07,0x02,0x0F,0x02,
+0x12,0x03,0x02,0x03,0x06,0x0F,0x06,0x02,0x03,0x06,0x0F,0x05,0x02,0x03,0x05,0x0F,
+0x05,0x02,0x04,0x04,0x0F,0x05,0x02,0x04,0x04,0x10,0x04,0x0B,0x15,0x02,0x02,0x05,
+0x11,0x04,0x02,0x03,0x05,0x11,0x03,0x02,0x04,0x05,0x10,0x03,0x02,0x05,0x04,0x0F,
+0x04,0x02,0x05,0x05,0x0F,0x03,0x02,0x06,0x05,0x0E,0x03,0x02,0x07,0x05,0x0D,0x04,
+0x02,0x07,0x05,0x0D,0x03,0x01,0x08,0x07,0x01,0x09,0x06,0x01,0x0A,0x04,0x01,0x09,
+0x06,0x01,0x08,0x08,0x02,0x07,0x04,0x0C,0x05,0x02,0x07,0x03,0x0C,0x05,0x02,0x06,
+0x04,0x0D,0x05,0x02,0x05,0x04,0x0E,0x05,0x02,0x05,0x03,0x0F,0x04,0x02,0x04,0x04,
+0x0F,0x05,0x02,0x03,0x04,0x10,0x05,0x02,0x02,0x04,0x11,0x05,0x0B,0x1D,0x02,0x01,
+0x05,0x13,0x04,0x02,0x02,0x04,0x13,0x03,0x02,0x02,0x05,0x12,0x04,0x02,0x03,0x04,
+0x12,0x03,0x02,0x03,0x04,0x11,0x04,0x02,0x03,0x05,0x11,0x03,0x02,0x04,0x04,0x10,
+0x04,0x02,0x04,0x05,0x10,0x04,0x02,0x05,0x04,0x0F,0x04,0x02,0x05,0x05,0x0F,0x04,
+0x02,0x06,0x04,0x0E,0x04,0x02,0x06,0x05,0x0E,0x04,0x02,0x07,0x04,0x0D,0x04,0x81,
+0x02,0x08,0x04,0x0D,0x03,0x01,0x08,0x08,0x01,0x08,0x07,0x01,0x09,0x06,0x81,0x01,
+0x0A,0x04,0x81,0x01,0x0A,0x03,0x01,0x09,0x04,0x01,0x09,0x03,0x01,0x08,0x04,0x01,
+0x07,0x04,0x01,0x02,0x08,0x01,0x02,0x07,0x01,0x02,0x06,0x0B,0x15,0x01,0x03,0x13,
+0x82,0x01,0x11,0x05,0x01,0x10,0x05,0x01,0x0F,0x05,0x01,0x0E,0x05,0x01,0x0D,0x05,
+0x01,0x0C,0x05,0x01,0x0B,0x05,0x01,0x0A,0x05,0x01,0x09,0x05,0x01,0x08,0x05,0x01,
+0x07,0x05,0x01,0x06,0x05,0x01,0x05,0x05,0x01,0x04,0x05,0x01,0x03,0x05,0x01,0x03,
+0x13,0x82,0x01,0x25,0x01,0x0E,0x06,0x01,0x0C,0x08,0x01,0x0B,0x09,0x01,0x0A,0x05,
+0x01,0x0A,0x04,0x84,0x01,0x0A,0x05,0x01,0x0B,0x04,0x84,0x01,0x0A,0x05,0x01,0x09,
+0x05,0x01,0x05,0x08,0x01,0x05,0x06,0x01,0x05,0x08,0x01,0x09,0x05,0x01,0x0A,0x04,
+0x01,0x0B,0x04,0x84,0x01,0x0A,0x05,0x01,0x0A,0x04,0x84,0x01,0x0A,0x05,0x01,0x0B,
+0x09,0x01,0x0C,0x08,0x01,0x0E,0x06,0x01,0x25,0x01,0x0B,0x03,0xA4,0x01,0x25,0x01,
+0x04,0x06,0x01,0x04,0x08,0x01,0x04,0x09,0x01,0x09,0x05,0x01,0x0A,0x04,0x84,0x01,
+0x09,0x05,0x01,0x09,0x04,0x84,0x01,0x09,0x05,0x01,0x0A,0x05,0x01,0x0B,0x08,0x01,
+0x0D,0x06,0x01,0x0B,0x08,0x01,0x0A,0x05,0x01,0x09,0x05,0x01,0x09,0x04,0x84,0x01,
+0x09,0x05,0x01,0x0A,0x04,0x84,0x01,0x09,0x05,0x01,0x04,0x09,0x01,0x04,0x08,0x01,
+0x04,0x06,0x12,0x08,0x01,0x04,0x05,0x02,0x03,0x08,0x14,0x03,0x02,0x02,0x0A,0x14,
+0x03,0x03,0x02,0x03,0x08,0x06,0x14,0x03,0x03,0x01,0x03,0x0A,0x06,0x13,0x03,0x02,
+0x01,0x03,0x0C,0x0A,0x02,0x01,0x03,0x0D,0x08,0x01,0x0F,0x05,0x07,0x19,0x01,0x05,
+0x0E,0x02,0x05,0x01,0x12,0x01,0x96,0x01,0x05,0x0E,0x07,0x21,0x01,0x0B,0x09,0x01,
+0x09,0x0E,0x01,0x07,0x10,0x02,0x06,0x06,0x13,0x04,0x02,0x05,0x05,0x16,0x01,0x01,
+0x04,0x05,0x01,0x03,0x05,0x01,0x03,0x04,0x81,0x01,0x02,0x04,0x86,0x01,0x03,0x04,
+0x81,0x01,0x03,0x05,0x01,0x04,0x05,0x01,0x05,0x05,0x02,0x06,0x07,0x14,0x03,0x01,
+0x07,0x10,0x01,0x09,0x0E,0x01,0x0B,0x09,0x01,0x0D,0x02,0x01,0x0C,0x02,0x01,0x0C,
+0x04,0x01,0x0E,0x03,0x01,0x0F,0x03,0x81,0x01,0x0B,0x06,0x01,0x0B,0x05,0x04,0x1C,
+0x02,0x07,0x03,0x0F,0x03,0x82,0x00,0x83,0x02,0x03,0x04,0x10,0x04,0x8D,0x02,0x03,
+0x04,0x0F,0x05,0x02,0x03,0x04,0x0E,0x06,0x02,0x03,0x04,0x0D,0x07,0x03,0x03,0x05,
+0x0C,0x03,0x10,0x04,0x02,0x04,0x0B,0x10,0x04,0x02,0x05,0x08,0x10,0x04,0x02,0x06,
+0x06,0x10,0x04,0x01,0x1F,0x01,0x0D,0x04,0x01,0x0C,0x04,0x01,0x0C,0x03,0x01,0x0B,
+0x03,0x01,0x0A,0x03,0x01,0x09,0x03,0x00,0x83,0x01,0x0A,0x06,0x01,0x07,0x0B,0x01,
+0x06,0x0D,0x02,0x05,0x05,0x0F,0x05,0x02,0x05,0x04,0x10,0x04,0x02,0x04,0x04,0x11,
+0x03,0x02,0x04,0x04,0x11,0x04,0x02,0x03,0x04,0x11,0x04,0x81,0x01,0x03,0x12,0x82,
+0x01,0x03,0x04,0x81,0x01,0x04,0x04,0x81,0x01,0x04,0x05,0x02,0x05,0x06,0x12,0x03,
+0x01,0x06,0x0F,0x01,0x07,0x0E,0x01,0x0A,0x08,0x01,0x1F,0x01,0x09,0x06,0x81,0x01,
+0x08,0x08,0x02,0x07,0x04,0x0D,0x04,0x02,0x06,0x04,0x0E,0x04,0x02,0x05,0x03,0x10,
+0x03,0x00,0x83,0x01,0x08,0x09,0x01,0x05,0x0D,0x01,0x05,0x0E,0x02,0x05,0x03,0x0F,
+0x05,0x02,0x05,0x01,0x10,0x04,0x01,0x10,0x04,0x82,0x01,0x09,0x0B,0x01,0x07,0x0D,
+0x01,0x05,0x0F,0x02,0x04,0x06,0x10,0x04,0x02,0x04,0x04,0x10,0x04,0x02,0x03,0x04,
+0x10,0x04,0x82,0x02,0x03,0x04,0x0F,0x05,0x02,0x03,0x06,0x0D,0x08,0x02,0x04,0x0C,
+0x11,0x07,0x02,0x05,0x0A,0x11,0x07,0x02,0x07,0x06,0x13,0x04,0x04,0x1C,0x02,0x08,
+0x03,0x10,0x03,0x82,0x00,0x83,0x01,0x08,0x09,0x01,0x05,0x0D,0x01,0x05,0x0E,0x02,
+0x05,0x03,0x0F,0x05,0x02,0x05,0x01,0x10,0x04,0x01,0x10,0x04,0x82,0x01,0x09,0x0B,
+0x01,0x07,0x0D,0x01,0x05,0x0F,0x02,0x04,0x06,0x10,0x04,0x02,0x04,0x04,0x10,0x04,
+0x02,0x03,0x04,0x10,0x04,0x82,0x02,0x03,0x04,0x0F,0x05,0x02,0x03,0x06,0x0D,0x08,
+0x02,0x04,0x0C,0x11,0x07,0x02,0x05,0x0A,0x11,0x07,0x02,0x07,0x06,0x13,0x04,0x01,
+0x1F,0x01,0x07,0x04,0x01,0x08,0x04,0x01,0x09,0x03,0x01,0x0A,0x03,0x01,0x0B,0x03,
+0x01,0x0C,0x03,0x00,0x83,0x01,0x08,0x09,0x01,0x05,0x0D,0x01,0x05,0x0E,0x02,0x05,
+0x03,0x0F,0x05,0x02,0x05,0x01,0x10,0x04,0x01,0x10,0x04,0x82,0x01,0x09,0x0B,0x01,
+0x07,0x0D,0x01,0x05,0x0F,0x02,0x04,0x06,0x10,0x04,0x02,0x04,0x04,0x10,0x04,0x02,
+0x03,0x04,0x10,0x04,0x82,0x02,0x03,0x04,0x0F,0x05,0x02,0x03,0x06,0x0D,0x08,0x02,
+0x04,0x0C,0x11,0x07,0x02,0x05,0x0A,0x11,0x07,0x02,0x07,0x06,0x13,0x04,0x00,0x20,
+0x01,0x0A,0x03,0x02,0x09,0x01,0x0D,0x01,0x02,0x08,0x01,0x0E,0x01,0x82,0x02,0x09,
+0x01,0x0D,0x01,0x01,0x0A,0x03,0x00,0x83,0x01,0x08,0x09,0x01,0x05,0x0D,0x01,0x05,
+0x0E,0x02,0x05,0x03,0x0F,0x05,0x02,0x05,0x01,0x10,0x04,0x01,0x10,0x04,0x82,0x01,
+0x09,0x0B,0x01,0x07,0x0D,0x01,0x05,0x0F,0x02,0x04,0x06,0x10,0x04,0x02,0x04,0x04,
+0x10,0x04,0x02,0x03,0x04,0x10,0x04,0x82,0x02,0x03,0x04,0x0F,0x05,0x02,0x03,0x06,
+0x0D,0x08,0x02,0x04,0x0C,0x11,0x07,0x02,0x05,0x0A,0x11,0x07,0x02,0x07,0x06,0x13,
+0x04,0x0B,0x1D,0x01,0x0A,0x09,0x01,0x08,0x0D,0x01,0x06,0x0F,0x02,0x05,0x06,0x12,
+0x03,0x01,0x05,0x05,0x01,0x04,0x05,0x01,0x04,0x04,0x01,0x03,0x04,0x86,0x01,0x04,
+0x04,0x01,0x04,0x05,0x01,0x04,0x06,0x02,0x05,0x07,0x12,0x03,0x01,0x06,0x0F,0x01,
+0x08,0x0D,0x01,0x0A,0x09,0x01,0x0B,0x02,0x01,0x0A,0x02,0x01,0x0A,0x04,0x01,0x0C,
+0x03,0x01,0x0D,0x03,0x81,0x01,0x09,0x06,0x01,0x09,0x05,0x01,0x1F,0x01,0x0A,0x06,
+0x81,0x01,0x09,0x08,0x02,0x08,0x04,0x0E,0x04,0x02,0x07,0x04,0x0F,0x04,0x02,0x06,
+0x03,0x11,0x03,0x00,0x83,0x01,0x0A,0x06,0x01,0x07,0x0B,0x01,0x06,0x0D,0x02,0x05,
+0x05,0x0F,0x05,0x02,0x05,0x04,0x10,0x04,0x02,0x04,0x04,0x11,0x03,0x02,0x04,0x04,
+0x11,0x04,0x02,0x03,0x04,0x11,0x04,0x81,0x01,0x03,0x12,0x82,0x01,0x03,0x04,0x81,
+0x01,0x04,0x04,0x81,0x01,0x04,0x05,0x02,0x05,0x06,0x12,0x03,0x01,0x06,0x0F,0x01,
+0x07,0x0E,0x01,0x0A,0x08,0x04,0x1C,0x02,0x09,0x03,0x11,0x03,0x82,0x00,0x83,0x01,
+0x0A,0x06,0x01,0x07,0x0B,0x01,0x06,0x0D,0x02,0x05,0x05,0x0F,0x05,0x02,0x05,0x04,
+0x10,0x04,0x02,0x04,0x04,0x11,0x03,0x02,0x04,0x04,0x11,0x04,0x02,0x03,0x04,0x11,
+0x04,0x81,0x01,0x03,0x12,0x82,0x01,0x03,0x04,0x81,0x01,0x04,0x04,0x81,0x01,0x04,
+0x05,0x02,0x05,0x06,0x12,0x03,0x01,0x06,0x0F,0x01,0x07,0x0E,0x01,0x0A,0x08,0x01,
+0x1F,0x01,0x07,0x04,0x01,0x08,0x04,0x01,0x09,0x03,0x01,0x0A,0x03,0x01,0x0B,0x03,
+0x01,0x0C,0x03,0x00,0x83,0x01,0x0A,0x06,0x01,0x07,0x0B,0x01,0x06,0x0D,0x02,0x05,
+0x05,0x0F,0x05,0x02,0x05,0x04,0x10,0x04,0x02,0x04,0x04,0x11,0x03,0x02,0x04,0x04,
+0x11,0x04,0x02,0x03,0x04,0x11,0x04,0x81,0x01,0x03,0x12,0x82,0x01,0x03,0x04,0x81,
+0x01,0x04,0x04,0x81,0x01,0x04,0x05,0x02,0x05,0x06,0x12,0x03,0x01,0x06,0x0F,0x01,
+0x07,0x0E,0x01,0x0A,0x08,0x04,0x1C,0x02,0x08,0x03,0x10,0x03,0x82,0x00,0x83,0x01,
+0x03,0x0C,0x82,0x01,0x0B,0x04,0x91,0x01,0x1F,0x01,0x0A,0x06,0x81,0x01,0x09,0x08,
+0x02,0x08,0x04,0x0E,0x04,0x02,0x07,0x04,0x0F,0x04,0x02,0x06,0x03,0x11,0x03,0x00,
+0x83,0x01,0x03,0x0C,0x82,0x01,0x0B,0x04,0x91,0x01,0x1F,0x01,0x07,0x04,0x01,0x08,
+0x04,0x01,0x09,0x03,0x01,0x0A,0x03,0x01,0x0B,0x03,0x01,0x0C,0x03,0x00,0x83,0x01,
+0x03,0x0C,0x82,0x01,0x0B,0x04,0x91,0x00,0x20,0x02,0x06,0x03,0x10,0x03,0x82,0x00,
+0x83,0x01,0x0A,0x04,0x01,0x09,0x06,0x82,0x02,0x08,0x03,0x0C,0x04,0x81,0x02,0x07,
+0x04,0x0D,0x04,0x02,0x07,0x03,0x0D,0x04,0x81,0x02,0x06,0x04,0x0E,0x04,0x02,0x06,
+0x03,0x0E,0x04,0x02,0x05,0x04,0x0F,0x04,0x81,0x02,0x05,0x03,0x0F,0x04,0x02,0x04,
+0x04,0x10,0x04,0x81,0x01,0x03,0x12,0x82,0x02,0x02,0x04,0x12,0x04,0x81,0x02,0x01,
+0x05,0x12,0x05,0x02,0x01,0x04,0x13,0x04,0x81,0x02,0x00,0x04,0x13,0x05,0x00,0x20,
+0x01,0x0A,0x04,0x02,0x09,0x01,0x0E,0x01,0x02,0x08,0x01,0x0F,0x01,0x82,0x02,0x08,
+0x02,0x0E,0x02,0x01,0x09,0x06,0x01,0x0A,0x04,0x01,0x09,0x06,0x82,0x02,0x08,0x03,
+0x0C,0x04,0x81,0x02,0x07,0x04,0x0D,0x04,0x02,0x07,0x03,0x0D,0x04,0x81,0x02,0x06,
+0x04,0x0E,0x04,0x02,0x06,0x03,0x0E,0x04,0x02,0x05,0x04,0x0F,0x04,0x81,0x02,0x05,
+0x03,0x0F,0x04,0x02,0x04,0x04,0x10,0x04,0x81,0x01,0x03,0x12,0x82,0x02,0x02,0x04,
+0x12,0x04,0x81,0x02,0x01,0x05,0x12,0x05,0x02,0x01,0x04,0x13,0x04,0x81,0x02,0x00,
+0x04,0x14,0x04,0x00,0x20,0x01,0x0E,0x04,0x01,0x0D,0x04,0x01,0x0C,0x03,0x01,0x0B,
+0x03,0x00,0x82,0x01,0x04,0x11,0x82,0x01,0x04,0x04,0x87,0x01,0x04,0x0F,0x82,0x01,
+0x04,0x04,0x87,0x01,0x04,0x12,0x82,0x0B,0x15,0x02,0x05,0x06,0x0F,0x05,0x02,0x03,
+0x09,0x0E,0x08,0x01,0x03,0x13,0x03,0x03,0x01,0x09,0x07,0x13,0x04,0x02,0x0A,0x05,
+0x14,0x03,0x02,0x0A,0x04,0x14,0x04,0x82,0x01,0x06,0x12,0x01,0x04,0x14,0x01,0x03,
+0x15,0x02,0x02,0x05,0x0A,0x04,0x02,0x01,0x05,0x0A,0x04,0x02,0x01,0x04,0x0A,0x04,
+0x81,0x02,0x01,0x04,0x0A,0x05,0x81,0x03,0x01,0x05,0x09,0x07,0x16,0x02,0x02,0x02,
+0x09,0x0C,0x0C,0x02,0x03,0x07,0x0D,0x0B,0x02,0x04,0x05,0x0E,0x07,0x07,0x19,0x01,
+0x0B,0x0B,0x01,0x0A,0x0C,0x81,0x01,0x09,0x07,0x81,0x01,0x08,0x08,0x02,0x08,0x03,
+0x0C,0x04,0x81,0x02,0x07,0x03,0x0C,0x04,0x81,0x02,0x06,0x04,0x0C,0x04,0x02,0x06,
+0x03,0x0C,0x09,0x02,0x05,0x04,0x0C,0x09,0x02,0x05,0x03,0x0C,0x09,0x02,0x05,0x03,
+0x0C,0x04,0x02,0x04,0x03,0x0C,0x04,0x81,0x01,0x03,0x0D,0x81,0x01,0x02,0x0E,0x02,
+0x02,0x03,0x0C,0x04,0x81,0x02,0x01,0x03,0x0C,0x0B,0x81,0x02,0x00,0x04,0x0C,0x0B,
+0x01,0x1F,0x01,0x09,0x06,0x81,0x01,0x08,0x08,0x02,0x07,0x04,0x0D,0x04,0x02,0x06,
+0x04,0x0E,0x04,0x02,0x05,0x03,0x10,0x03,0x00,0x83,0x01,0x08,0x08,0x01,0x06,0x0C,
+0x01,0x05,0x0E,0x02,0x04,0x05,0x0F,0x05,0x02,0x03,0x05,0x10,0x05,0x02,0x03,0x04,
+0x11,0x04,0x81,0x02,0x02,0x04,0x12,0x04,0x86,0x02,0x03,0x04,0x11,0x04,0x81,0x02,
+0x03,0x05,0x10,0x05,0x02,0x04,0x05,0x0F,0x05,0x01,0x05,0x0E,0x01,0x06,0x0C,0x01,
+0x08,0x08,0x04,0x1C,0x02,0x07,0x03,0x0F,0x03,0x82,0x00,0x83,0x01,0x08,0x08,0x01,
+0x06,0x0C,0x01,0x05,0x0E,0x02,0x04,0x05,0x0F,0x05,0x02,0x03,0x05,0x10,0x05,0x02,
+0x03,0x04,0x11,0x04,0x81,0x02,0x02,0x04,0x12,0x04,0x86,0x02,0x03,0x04,0x11,0x04,
+0x81,0x02,0x03,0x05,0x10,0x05,0x02,0x04,0x05,0x0F,0x05,0x01,0x05,0x0E,0x01,0x06,
+0x0C,0x01,0x08,0x08,0x01,0x1F,0x01,0x06,0x04,0x01,0x07,0x04,0x01,0x08,0x03,0x01,
+0x09,0x03,0x01,0x0A,0x03,0x01,0x0B,0x03,0x00,0x83,0x01,0x08,0x08,0x01,0x06,0x0C,
+0x01,0x05,0x0E,0x02,0x04,0x05,0x0F,0x05,0x02,0x03,0x05,0x10,0x05,0x02,0x03,0x04,
+0x11,0x04,0x81,0x02,0x02,0x04,0x12,0x04,0x86,0x02,0x03,0x04,0x11,0x04,0x81,0x02,
+0x03,0x05,0x10,0x05,0x02,0x04,0x05,0x0F,0x05,0x01,0x05,0x0E,0x01,0x06,0x0C,0x01,
+0x08,0x08,0x01,0x1F,0x01,0x09,0x06,0x81,0x01,0x08,0x08,0x02,0x07,0x04,0x0D,0x04,
+0x02,0x06,0x04,0x0E,0x04,0x02,0x05,0x03,0x10,0x03,0x00,0x83,0x02,0x03,0x04,0x10,
+0x04,0x8D,0x02,0x03,0x04,0x0F,0x05,0x02,0x03,0x04,0x0E,0x06,0x02,0x03,0x04,0x0D,
+0x07,0x03,0x03,0x05,0x0C,0x03,0x10,0x04,0x02,0x04,0x0B,0x10,0x04,0x02,0x05,0x08,
+0x10,0x04,0x02,0x06,0x06,0x10,0x04,0x01,0x1F,0x01,0x06,0x04,0x01,0x07,0x04,0x01,
+0x08,0x03,0x01,0x09,0x03,0x01,0x0A,0x03,0x01,0x0B,0x03,0x00,0x83,0x02,0x03,0x04,
+0x10,0x04,0x8D,0x02,0x03,0x04,0x0F,0x05,0x02,0x03,0x04,0x0E,0x06,0x02,0x03,0x04,
+0x0D,0x07,0x03,0x03,0x05,0x0C,0x03,0x10,0x04,0x02,0x04,0x0B,0x10,0x04,0x02,0x05,
+0x08,0x10,0x04,0x02,0x06,0x06,0x10,0x04,0x04,0x24,0x02,0x08,0x03,0x10,0x03,0x82,
+0x00,0x83,0x02,0x01,0x05,0x13,0x04,0x02,0x02,0x04,0x13,0x03,0x02,0x02,0x05,0x12,
+0x04,0x02,0x03,0x04,0x12,0x03,0x02,0x03,0x04,0x11,0x04,0x02,0x03,0x05,0x11,0x03,
+0x02,0x04,0x04,0x10,0x04,0x02,0x04,0x05,0x10,0x04,0x02,0x05,0x04,0x0F,0x04,0x02,
+0x05,0x05,0x0F,0x04,0x02,0x06,0x04,0x0E,0x04,0x02,0x06,0x05,0x0E,0x04,0x02,0x07,
+0x04,0x0D,0x04,0x81,0x02,0x08,0x04,0x0D,0x03,0x01,0x08,0x08,0x01,0x08,0x07,0x01,
+0x09,0x06,0x81,0x01,0x0A,0x04,0x81,0x01,0x0A,0x03,0x01,0x09,0x04,0x01,0x09,0x03,
+0x01,0x08,0x04,0x01,0x07,0x04,0x01,0x02,0x08,0x01,0x02,0x07,0x01,0x02,0x06,0x00,
+0x20,0x02,0x06,0x03,0x10,0x03,0x82,0x00,0x83,0x01,0x08,0x08,0x01,0x06,0x0C,0x01,
+0x05,0x0E,0x02,0x04,0x05,0x0F,0x05,0x02,0x03,0x05,0x10,0x05,0x02,0x03,0x04,0x11,
+0x04,0x02,0x02,0x04,0x12,0x04,0x81,0x02,0x01,0x04,0x13,0x04,0x88,0x02,0x02,0x04,
+0x12,0x04,0x81,0x02,0x03,0x04,0x11,0x04,0x02,0x03,0x05,0x10,0x05,0x02,0x04,0x05,
+0x0F,0x05,0x01,0x05,0x0E,0x01,0x06,0x0C,0x01,0x08,0x08,0x00,0x20,0x02,0x07,0x03,
+0x11,0x03,0x82,0x00,0x83,0x02,0x03,0x04,0x12,0x04,0x92,0x02,0x04,0x04,0x11,0x04,
+0x02,0x04,0x04,0x10,0x05,0x02,0x05,0x05,0x0F,0x05,0x01,0x05,0x0F,0x01,0x07,0x0B,
+0x01,0x09,0x07,0x0B,0x15,0x02,0x08,0x07,0x13,0x03,0x01,0x06,0x0F,0x01,0x05,0x0F,
+0x02,0x04,0x05,0x0E,0x06,0x02,0x03,0x05,0x10,0x05,0x02,0x03,0x04,0x0F,0x06,0x02,
+0x03,0x04,0x0E,0x07,0x03,0x02,0x04,0x0D,0x03,0x12,0x04,0x03,0x02,0x04,0x0C,0x03,
+0x12,0x04,0x03,0x02,0x04,0x0B,0x03,0x12,0x04,0x03,0x02,0x04,0x0A,0x04,0x12,0x04,
+0x03,0x02,0x04,0x0A,0x03,0x12,0x04,0x03,0x02,0x04,0x09,0x03,0x12,0x04,0x03,0x02,
+0x04,0x08,0x03,0x12,0x04,0x02,0x03,0x07,0x11,0x04,0x02,0x03,0x06,0x11,0x04,0x02,
+0x03,0x05,0x10,0x05,0x02,0x04,0x06,0x0F,0x05,0x01,0x04,0x0F,0x01,0x03,0x0F,0x02,
+0x02,0x03,0x08,0x08,0x03,0x1D,0x01,0x0D,0x08,0x01,0x0C,0x09,0x01,0x0B,0x0A,0x02,
+0x0A,0x04,0x14,0x01,0x01,0x0A,0x04,0x01,0x09,0x04,0x86,0x01,0x06,0x0B,0x82,0x01,
+0x09,0x04,0x86,0x01,0x09,0x03,0x01,0x08,0x04,0x01,0x07,0x04,0x01,0x06,0x04,0x01,
+0x05,0x10,0x82,0x07,0x19,0x02,0x08,0x08,0x14,0x03,0x02,0x06,0x0C,0x13,0x03,0x01,
+0x05,0x10,0x02,0x04,0x05,0x0F,0x05,0x02,0x03,0x05,0x10,0x05,0x02,0x03,0x04,0x10,
+0x05,0x02,0x02,0x04,0x0F,0x07,0x02,0x02,0x04,0x0E,0x08,0x03,0x01,0x04,0x0E,0x03,
+0x13,0x04,0x03,0x01,0x04,0x0D,0x03,0x13,0x04,0x03,0x01,0x04,0x0C,0x03,0x13,0x04,
+0x03,0x01,0x04,0x0B,0x03,0x13,0x04,0x03,0x01,0x04,0x0A,0x04,0x13,0x04,0x03,0x01,
+0x04,0x0A,0x03,0x13,0x04,0x03,0x01,0x04,0x09,0x03,0x13,0x04,0x03,0x01,0x04,0x08,
+0x03,0x13,0x04,0x03,0x01,0x04,0x07,0x03,0x13,0x04,0x02,0x02,0x08,0x12,0x04,0x02,
+0x02,0x07,0x12,0x04,0x02,0x03,0x05,0x11,0x04,0x02,0x03,0x05,0x10,0x05,0x02,0x04,
+0x05,0x0F,0x05,0x01,0x03,0x10,0x02,0x02,0x03,0x06,0x0C,0x02,0x01,0x03,0x08,0x08,
+0x0B,0x15,0x02,0x03,0x01,0x13,0x01,0x02,0x02,0x03,0x12,0x03,0x02,0x01,0x05,0x11,
+0x05,0x02,0x02,0x05,0x10,0x05,0x02,0x03,0x05,0x0F,0x05,0x02,0x04,0x05,0x0E,0x05,
+0x02,0x05,0x05,0x0D,0x05,0x02,0x06,0x05,0x0C,0x05,0x01,0x07,0x09,0x01,0x08,0x07,
+0x01,0x09,0x05,0x01,0x08,0x07,0x01,0x07,0x09,0x02,0x06,0x05,0x0C,0x05,0x02,0x05,
+0x05,0x0D,0x05,0x02,0x04,0x05,0x0E,0x05,0x02,0x03,0x05,0x0F,0x05,0x02,0x02,0x05,
+0x10,0x05,0x02,0x01,0x05,0x11,0x05,0x02,0x02,0x03,0x12,0x03,0x02,0x03,0x01,0x13,
+0x01,0x01,0x27,0x01,0x0D,0x07,0x01,0x0B,0x0A,0x01,0x0A,0x0B,0x02,0x0A,0x04,0x14,
+0x01,0x01,0x09,0x04,0x85,0x01,0x05,0x0E,0x82,0x01,0x09,0x04,0x95,0x02,0x01,0x01,
+0x08,0x04,0x01,0x01,0x0B,0x01,0x01,0x0A,0x01,0x02,0x07,0x01,0x1F,0x01,0x0D,0x04,
+0x01,0x0C,0x04,0x01,0x0C,0x03,0x01,0x0B,0x03,0x01,0x0A,0x03,0x01,0x09,0x03,0x00,
+0x83,0x01,0x08,0x09,0x01,0x05,0x0D,0x01,0x05,0x0E,0x02,0x05,0x03,0x0F,0x05,0x02,
+0x05,0x01,0x10,0x04,0x01,0x10,0x04,0x82,0x01,0x09,0x0B,0x01,0x07,0x0D,0x01,0x05,
+0x0F,0x02,0x04,0x06,0x10,0x04,0x02,0x04,0x04,0x10,0x04,0x02,0x03,0x04,0x10,0x04,
+0x82,0x02,0x03,0x04,0x0F,0x05,0x02,0x03,0x06,0x0D,0x08,0x02,0x04,0x0C,0x11,0x07,
+0x02,0x05,0x0A,0x11,0x07,0x02,0x07,0x06,0x13,0x04,0x01,0x1F,0x01,0x0D,0x04,0x01,
+0x0C,0x04,0x01,0x0C,0x03,0x01,0x0B,0x03,0x01,0x0A,0x03,0x01,0x09,0x03,0x00,0x83,
+0x01,0x03,0x0C,0x82,0x01,0x0B,0x04,0x91,0x01,0x1F,0x01,0x0D,0x04,0x01,0x0C,0x04,
+0x01,0x0C,0x03,0x01,0x0B,0x03,0x01,0x0A,0x03,0x01,0x09,0x03,0x00,0x83,0x01,0x08,
+0x08,0x01,0x06,0x0C,0x01,0x05,0x0E,0x02,0x04,0x05,0x0F,0x05,0x02,0x03,0x05,0x10,
+0x05,0x02,0x03,0x04,0x11,0x04,0x81,0x02,0x02,0x04,0x12,0x04,0x86,0x02,0x03,0x04,
+0x11,0x04,0x81,0x02,0x03,0x05,0x10,0x05,0x02,0x04,0x05,0x0F,0x05,0x01,0x05,0x0E,
+0x01,0x06,0x0C,0x01,0x08,0x08,0x01,0x1F,0x01,0x0D,0x04,0x01,0x0C,0x04,0x01,0x0C,
+0x03,0x01,0x0B,0x03,0x01,0x0A,0x03,0x01,0x09,0x03,0x00,0x83,0x02,0x03,0x04,0x10,
+0x04,0x8D,0x02,0x03,0x04,0x0F,0x05,0x02,0x03,0x04,0x0E,0x06,0x02,0x03,0x04,0x0D,
+0x07,0x03,0x03,0x05,0x0C,0x03,0x10,0x04,0x02,0x04,0x0B,0x10,0x04,0x02,0x05,0x08,
+0x10,0x04,0x02,0x06,0x06,0x10,0x04,0x02,0x1E,0x02,0x08,0x04,0x11,0x02,0x02,0x07,
+0x07,0x11,0x02,0x01,0x06,0x0D,0x02,0x06,0x02,0x0B,0x07,0x02,0x06,0x02,0x0D,0x04,
+0x00,0x83,0x02,0x04,0x04,0x0D,0x06,0x02,0x04,0x04,0x0B,0x09,0x02,0x04,0x04,0x0A,
+0x0B,0x03,0x04,0x04,0x09,0x03,0x11,0x04,0x02,0x04,0x07,0x11,0x05,0x02,0x04,0x06,
+0x12,0x04,0x02,0x04,0x05,0x12,0x04,0x02,0x04,0x04,0x12,0x04,0x8D,0x00,0x20,0x02,
+0x08,0x04,0x11,0x02,0x02,0x07,0x07,0x10,0x03,0x02,0x06,0x03,0x0B,0x07,0x02,0x06,
+0x02,0x0D,0x04,0x00,0x82,0x02,0x03,0x04,0x12,0x03,0x81,0x02,0x03,0x05,0x12,0x03,
+0x02,0x03,0x06,0x12,0x03,0x81,0x02,0x03,0x07,0x12,0x03,0x02,0x03,0x08,0x12,0x03,
+0x03,0x03,0x03,0x07,0x04,0x12,0x03,0x03,0x03,0x03,0x07,0x05,0x12,0x03,0x03,0x03,
+0x03,0x08,0x05,0x12,0x03,0x81,0x03,0x03,0x03,0x09,0x05,0x12,0x03,0x03,0x03,0x03,
+0x0A,0x04,0x12,0x03,0x03,0x03,0x03,0x0A,0x05,0x12,0x03,0x03,0x03,0x03,0x0B,0x05,
+0x12,0x03,0x03,0x03,0x03,0x0C,0x04,0x12,0x03,0x03,0x03,0x03,0x0C,0x05,0x12,0x03,
+0x02,0x03,0x03,0x0D,0x08,0x81,0x02,0x03,0x03,0x0E,0x07,0x02,0x03,0x03,0x0F,0x06,
+0x81,0x02,0x03,0x03,0x10,0x05,0x02,0x03,0x03,0x11,0x04,0x81,0x03,0x0F,0x01,0x08,
+0x07,0x01,0x06,0x0B,0x02,0x06,0x03,0x0E,0x04,0x01,0x0F,0x03,0x82,0x01,0x09,0x09,
+0x01,0x07,0x0B,0x02,0x06,0x04,0x0F,0x03,0x02,0x05,0x03,0x0F,0x03,0x82,0x02,0x05,
+0x04,0x0D,0x05,0x02,0x06,0x08,0x10,0x04,0x02,0x07,0x05,0x10,0x04,0x03,0x0F,0x01,
+0x08,0x07,0x01,0x06,0x0B,0x02,0x05,0x04,0x0E,0x04,0x02,0x05,0x03,0x0F,0x03,0x02,
+0x04,0x03,0x10,0x03,0x86,0x02,0x05,0x03,0x0F,0x03,0x02,0x05,0x04,0x0E,0x04,0x01,
+0x06,0x0B,0x01,0x08,0x07,0x0B,0x1D,0x01,0x0C,0x04,0x83,0x00,0x83,0x01,0x0C,0x04,
+0x82,0x01,0x0C,0x03,0x01,0x0B,0x04,0x01,0x0A,0x04,0x01,0x09,0x05,0x01,0x08,0x05,
+0x01,0x07,0x04,0x01,0x06,0x04,0x01,0x05,0x04,0x01,0x04,0x04,0x01,0x03,0x04,0x81,
+0x02,0x03,0x04,0x12,0x03,0x81,0x02,0x03,0x05,0x12,0x03,0x02,0x04,0x06,0x12,0x03,
+0x01,0x04,0x11,0x01,0x06,0x0F,0x01,0x08,0x0A,0x03,0x11,0x01,0x09,0x05,0x01,0x07,
+0x09,0x02,0x05,0x04,0x0E,0x04,0x03,0x05,0x02,0x08,0x06,0x10,0x02,0x04,0x04,0x02,
+0x08,0x02,0x0D,0x02,0x11,0x02,0x81,0x04,0x03,0x02,0x08,0x02,0x0D,0x02,0x12,0x02,
+0x04,0x03,0x02,0x08,0x02,0x0C,0x02,0x12,0x02,0x03,0x03,0x02,0x08,0x05,0x12,0x02,
+0x04,0x03,0x02,0x08,0x02,0x0C,0x01,0x12,0x02,0x04,0x03,0x02,0x08,0x02,0x0C,0x02,
+0x12,0x02,0x04,0x04,0x02,0x08,0x02,0x0C,0x02,0x11,0x02,0x04,0x04,0x02,0x08,0x02,
+0x0D,0x02,0x11,0x02,0x02,0x05,0x02,0x10,0x02,0x02,0x05,0x04,0x0E,0x04,0x01,0x07,
+0x09,0x01,0x09,0x05,0x10,0x0A,0x01,0x02,0x15,0x82,0x01,0x14,0x03,0x86,0x03,0x1E,
+0x02,0x02,0x04,0x10,0x03,0x02,0x00,0x06,0x0F,0x03,0x81,0x02,0x03,0x03,0x0E,0x03,
+0x81,0x02,0x03,0x03,0x0D,0x03,0x81,0x02,0x03,0x03,0x0C,0x03,0x02,0x03,0x03,0x0B,
+0x03,0x81,0x02,0x03,0x03,0x0A,0x03,0x81,0x02,0x03,0x03,0x09,0x03,0x81,0x03,0x03,
+0x03,0x08,0x03,0x0F,0x06,0x02,0x08,0x03,0x0E,0x09,0x03,0x07,0x03,0x0E,0x01,0x14,
+0x04,0x02,0x07,0x03,0x15,0x03,0x02,0x06,0x03,0x15,0x03,0x81,0x02,0x05,0x03,0x14,
+0x03,0x02,0x05,0x03,0x12,0x04,0x02,0x04,0x03,0x11,0x04,0x02,0x03,0x03,0x10,0x03,
+0x02,0x03,0x03,0x0F,0x03,0x02,0x02,0x03,0x0E,0x03,0x02,0x02,0x03,0x0E,0x0A,0x02,
+0x01,0x03,0x0E,0x0A,0x81,0x01,0x00,0x03,0x03,0x1E,0x02,0x02,0x04,0x11,0x03,0x02,
+0x00,0x06,0x10,0x03,0x81,0x02,0x03,0x03,0x0F,0x03,0x81,0x02,0x03,0x03,0x0E,0x03,
+0x81,0x02,0x03,0x03,0x0D,0x03,0x02,0x03,0x03,0x0C,0x03,0x81,0x02,0x03,0x03,0x0B,
+0x03,0x81,0x02,0x03,0x03,0x0A,0x03,0x81,0x03,0x03,0x03,0x09,0x03,0x11,0x04,0x02,
+0x09,0x03,0x10,0x05,0x02,0x08,0x03,0x10,0x05,0x03,0x08,0x03,0x0F,0x02,0x12,0x03,
+0x03,0x07,0x03,0x0E,0x02,0x12,0x03,0x03,0x07,0x03,0x0D,0x03,0x12,0x03,0x03,0x06,
+0x03,0x0C,0x03,0x12,0x03,0x03,0x06,0x03,0x0C,0x02,0x12,0x03,0x03,0x05,0x03,0x0B,
+0x02,0x12,0x03,0x02,0x04,0x03,0x0B,0x0C,0x81,0x02,0x03,0x03,0x12,0x03,0x81,0x02,
+0x02,0x03,0x12,0x03,0x81,0x01,0x01,0x03,0x0B,0x1D,0x01,0x0A,0x04,0x83,0x00,0x83,
+0x01,0x0A,0x04,0x94,0x0D,0x11,0x02,0x0A,0x01,0x12,0x01,0x02,0x09,0x03,0x11,0x03,
+0x02,0x08,0x03,0x10,0x03,0x02,0x07,0x03,0x0F,0x03,0x02,0x06,0x03,0x0E,0x03,0x02,
+0x05,0x03,0x0D,0x03,0x02,0x04,0x03,0x0C,0x03,0x02,0x03,0x03,0x0B,0x03,0x02,0x02,
+0x03,0x0A,0x03,0x02,0x03,0x03,0x0B,0x03,0x02,0x04,0x03,0x0C,0x03,0x02,0x05,0x03,
+0x0D,0x03,0x02,0x06,0x03,0x0E,0x03,0x02,0x07,0x03,0x0F,0x03,0x02,0x08,0x03,0x10,
+0x03,0x02,0x09,0x03,0x11,0x03,0x02,0x0A,0x01,0x12,0x01,0x0D,0x11,0x02,0x03,0x01,
+0x0C,0x01,0x02,0x02,0x03,0x0B,0x03,0x02,0x03,0x04,0x0C,0x03,0x02,0x04,0x04,0x0D,
+0x03,0x02,0x05,0x04,0x0E,0x03,0x02,0x06,0x04,0x0F,0x03,0x02,0x07,0x04,0x10,0x03,
+0x02,0x09,0x03,0x11,0x03,0x02,0x09,0x04,0x12,0x03,0x02,0x08,0x04,0x11,0x03,0x02,
+0x07,0x04,0x10,0x03,0x02,0x06,0x04,0x0F,0x03,0x02,0x05,0x04,0x0E,0x03,0x02,0x04,
+0x04,0x0D,0x03,0x02,0x03,0x04,0x0C,0x03,0x02,0x02,0x04,0x0B,0x03,0x02,0x03,0x01,
+0x0C,0x01,0x00,0x24,0x03,0x00,0x04,0x08,0x04,0x10,0x04,0x83,0x00,0x83,0x03,0x00,
+0x04,0x08,0x04,0x10,0x04,0x83,0x00,0x83,0x03,0x00,0x04,0x08,0x04,0x10,0x04,0x83,
+0x00,0x83,0x03,0x00,0x04,0x08,0x04,0x10,0x04,0x83,0x00,0x83,0x03,0x00,0x04,0x08,
+0x04,0x10,0x04,0x83,0x00,0x28,0x03,0x04,0x04,0x0C,0x04,0x14,0x04,0x83,0x03,0x00,
+0x04,0x08,0x04,0x10,0x04,0x83,0x03,0x04,0x04,0x0C,0x04,0x14,0x04,0x83,0x03,0x00,
+0x04,0x08,0x04,0x10,0x04,0x83,0x03,0x04,0x04,0x0C,0x04,0x14,0x04,0x83,0x03,0x00,
+0x04,0x08,0x04,0x10,0x04,0x83,0x03,0x04,0x04,0x0C,0x04,0x14,0x04,0x83,0x03,0x00,
+0x04,0x08,0x04,0x10,0x04,0x83,0x03,0x04,0x04,0x0C,0x04,0x14,0x04,0x83,0x03,0x00,
+0x04,0x08,0x04,0x10,0x04,0x83,0x00,0x28,0x01,0x00,0x18,0x83,0x03,0x00,0x04,0x08,
+0x04,0x10,0x04,0x83,0x01,0x00,0x18,0x83,0x03,0x00,0x04,0x08,0x04,0x10,0x04,0x83,
+0x01,0x00,0x18,0x83,0x03,0x00,0x04,0x08,0x04,0x10,0x04,0x83,0x01,0x00,0x18,0x83,
+0x03,0x00,0x04,0x08,0x04,0x10,0x04,0x83,0x01,0x00,0x18,0x83,0x03,0x00,0x04,0x08,
+0x04,0x10,0x04,0x83,0x00,0x28,0x01,0x0B,0x03,0xA7,0x00,0x28,0x01,0x0B,0x03,0x92,
+0x01,0x00,0x0E,0x82,0x01,0x0B,0x03,0x91,0x00,0x20,0x01,0x0C,0x04,0x01,0x0B,0x04,
+0x01,0x0A,0x03,0x01,0x09,0x03,0x00,0x82,0x01,0x0A,0x04,0x01,0x09,0x06,0x82,0x02,
+0x08,0x03,0x0C,0x04,0x81,0x02,0x07,0x04,0x0D,0x04,0x02,0x07,0x03,0x0D,0x04,0x81,
+0x02,0x06,0x04,0x0E,0x04,0x02,0x06,0x03,0x0E,0x04,0x02,0x05,0x04,0x0F,0x04,0x81,
+0x02,0x05,0x03,0x0F,0x04,0x02,0x04,0x04,0x10,0x04,0x81,0x01,0x03,0x12,0x82,0x02,
+0x02,0x04,0x12,0x04,0x81,0x02,0x01,0x05,0x12,0x05,0x02,0x01,0x04,0x13,0x04,0x81,
+0x02,0x00,0x04,0x13,0x05,0x00,0x20,0x01,0x09,0x06,0x01,0x08,0x08,0x02,0x07,0x04,
+0x0D,0x04,0x02,0x06,0x03,0x0F,0x03,0x00,0x82,0x01,0x0A,0x04,0x01,0x09,0x06,0x82,
+0x02,0x08,0x03,0x0C,0x04,0x81,0x02,0x07,0x04,0x0D,0x04,0x02,0x07,0x03,0x0D,0x04,
+0x81,0x02,0x06,0x04,0x0E,0x04,0x02,0x06,0x03,0x0E,0x04,0x02,0x05,0x04,0x0F,0x04,
+0x81,0x02,0x05,0x03,0x0F,0x04,0x02,0x04,0x04,0x10,0x04,0x81,0x01,0x03,0x12,0x82,
+0x02,0x02,0x04,0x12,0x04,0x81,0x02,0x01,0x05,0x12,0x05,0x02,0x01,0x04,0x13,0x04,
+0x81,0x02,0x00,0x04,0x13,0x05,0x00,0x20,0x01,0x06,0x04,0x01,0x07,0x04,0x01,0x09,
+0x03,0x01,0x0A,0x03,0x00,0x82,0x01,0x0A,0x04,0x01,0x09,0x06,0x82,0x02,0x08,0x03,
+0x0C,0x04,0x81,0x02,0x07,0x04,0x0D,0x04,0x02,0x07,0x03,0x0D,0x04,0x81,0x02,0x06,
+0x04,0x0E,0x04,0x02,0x06,0x03,0x0E,0x04,0x02,0x05,0x04,0x0F,0x04,0x81,0x02,0x05,
+0x03,0x0F,0x04,0x02,0x04,0x04,0x10,0x04,0x81,0x01,0x03,0x12,0x82,0x02,0x02,0x04,
+0x12,0x04,0x81,0x02,0x01,0x05,0x12,0x05,0x02,0x01,0x04,0x13,0x04,0x81,0x02,0x00,
+0x04,0x13,0x05,0x03,0x1E,0x01,0x08,0x07,0x01,0x06,0x0B,0x02,0x05,0x03,0x0F,0x03,
+0x02,0x04,0x03,0x10,0x03,0x02,0x03,0x03,0x11,0x03,0x02,0x03,0x02,0x12,0x02,0x02,
+0x02,0x02,0x13,0x02,0x03,0x02,0x02,0x0A,0x06,0x13,0x02,0x03,0x02,0x02,0x08,0x09,
+0x13,0x02,0x03,0x01,0x02,0x07,0x0A,0x14,0x02,0x04,0x01,0x02,0x06,0x04,0x0F,0x02,
+0x14,0x02,0x03,0x01,0x02,0x06,0x03,0x14,0x02,0x03,0x01,0x02,0x05,0x03,0x14,0x02,
+0x84,0x03,0x01,0x02,0x05,0x04,0x14,0x02,0x03,0x01,0x02,0x06,0x03,0x14,0x02,0x04,
+0x01,0x02,0x06,0x05,0x10,0x01,0x14,0x02,0x03,0x01,0x02,0x07,0x0A,0x14,0x02,0x03,
+0x02,0x02,0x08,0x09,0x13,0x02,0x03,0x02,0x02,0x09,0x06,0x13,0x02,0x02,0x02,0x02,
+0x13,0x02,0x02,0x03,0x02,0x12,0x02,0x02,0x03,0x03,0x11,0x03,0x02,0x04,0x03,0x10,
+0x03,0x02,0x05,0x03,0x0F,0x03,0x01,0x06,0x0B,0x01,0x08,0x07,0x00,0x28,0x02,0x08,
+0x03,0x0E,0x03,0x8F,0x02,0x00,0x0B,0x0E,0x03,0x82,0x01,0x0E,0x03,0x82,0x02,0x00,
+0x0B,0x0E,0x03,0x82,0x02,0x08,0x03,0x0E,0x03,0x8E,0x00,0x28,0x02,0x08,0x03,0x0E,
+0x03,0xA7,0x10,0x18,0x01,0x00,0x11,0x82,0x01,0x0E,0x03,0x82,0x02,0x00,0x0B,0x0E,
+0x03,0x82,0x02,0x08,0x03,0x0E,0x03,0x8E,0x00,0x19,0x02,0x08,0x03,0x0E,0x03,0x8F,
+0x02,0x00,0x0B,0x0E,0x03,0x82,0x01,0x0E,0x03,0x82,0x01,0x00,0x11,0x82,0x03,0x1D,
+0x01,0x0C,0x02,0x82,0x01,0x0A,0x07,0x01,0x08,0x0B,0x01,0x07,0x0C,0x03,0x06,0x05,
+0x0C,0x02,0x10,0x03,0x02,0x05,0x04,0x0C,0x02,0x02,0x04,0x04,0x0C,0x02,0x81,0x02,
+0x03,0x05,0x0C,0x02,0x02,0x03,0x04,0x0C,0x02,0x86,0x02,0x03,0x05,0x0C,0x02,0x02,
+0x04,0x04,0x0C,0x02,0x02,0x04,0x05,0x0C,0x02,0x02,0x05,0x05,0x0C,0x02,0x02,0x05,
+0x09,0x11,0x02,0x01,0x06,0x0D,0x01,0x08,0x0B,0x01,0x0A,0x07,0x01,0x0C,0x02,0x82,
+0x03,0x1D,0x02,0x01,0x05,0x14,0x04,0x02,0x02,0x05,0x14,0x03,0x02,0x03,0x04,0x13,
+0x03,0x02,0x03,0x05,0x12,0x04,0x02,0x04,0x04,0x11,0x04,0x02,0x05,0x04,0x11,0x03,
+0x02,0x05,0x05,0x10,0x03,0x02,0x06,0x04,0x0F,0x04,0x02,0x06,0x05,0x0F,0x03,0x02,
+0x07,0x05,0x0E,0x03,0x02,0x08,0x04,0x0D,0x04,0x01,0x08,0x08,0x01,0x09,0x06,0x01,
+0x0A,0x05,0x01,0x04,0x10,0x82,0x01,0x0A,0x04,0x83,0x01,0x04,0x10,0x82,0x01,0x0A,
+0x04,0x84,0x13,0x15,0x01,0x00,0x0E,0x82,0x01,0x0B,0x03,0x91,0x00,0x16,0x01,0x0B,
+0x03,0x92,0x01,0x0B,0x0D,0x82,0x00,0x16,0x01,0x0B,0x03,0x92,0x01,0x00,0x18,0x82,
+0x13,0x15,0x01,0x00,0x18,0x82,0x01,0x0B,0x03,0x91,0x00,0x28,0x01,0x0B,0x03,0x92,
+0x01,0x0B,0x0D,0x82,0x01,0x0B,0x03,0x91,0x13,0x03,0x01,0x00,0x18,0x82,0x00,0x28,
+0x01,0x0B,0x03,0x92,0x01,0x00,0x18,0x82,0x01,0x0B,0x03,0x91,0x02,0x1E,0x02,0x08,
+0x04,0x11,0x02,0x02,0x07,0x07,0x11,0x02,0x01,0x06,0x0D,0x02,0x06,0x02,0x0B,0x07,
+0x02,0x06,0x02,0x0D,0x04,0x00,0x83,0x01,0x08,0x09,0x01,0x05,0x0D,0x01,0x05,0x0E,
+0x02,0x05,0x03,0x0F,0x05,0x02,0x05,0x01,0x10,0x04,0x01,0x10,0x04,0x82,0x01,0x09,
+0x0B,0x01,0x07,0x0D,0x01,0x05,0x0F,0x02,0x04,0x06,0x10,0x04,0x02,0x04,0x04,0x10,
+0x04,0x02,0x03,0x04,0x10,0x04,0x82,0x02,0x03,0x04,0x0F,0x05,0x02,0x03,0x06,0x0D,
+0x08,0x02,0x04,0x0C,0x11,0x07,0x02,0x05,0x0A,0x11,0x07,0x02,0x07,0x06,0x13,0x04,
+0x00,0x20,0x02,0x08,0x04,0x11,0x02,0x02,0x07,0x07,0x10,0x03,0x02,0x06,0x03,0x0B,
+0x07,0x02,0x06,0x02,0x0D,0x04,0x00,0x82,0x01,0x0A,0x04,0x01,0x09,0x06,0x82,0x02,
+0x08,0x03,0x0C,0x04,0x81,0x02,0x07,0x04,0x0D,0x04,0x02,0x07,0x03,0x0D,0x04,0x81,
+0x02,0x06,0x04,0x0E,0x04,0x02,0x06,0x03,0x0E,0x04,0x02,0x05,0x04,0x0F,0x04,0x81,
+0x02,0x05,0x03,0x0F,0x04,0x02,0x04,0x04,0x10,0x04,0x81,0x01,0x03,0x12,0x82,0x02,
+0x02,0x04,0x12,0x04,0x81,0x02,0x01,0x05,0x12,0x05,0x02,0x01,0x04,0x13,0x04,0x81,
+0x02,0x00,0x04,0x13,0x05,0x00,0x19,0x02,0x08,0x03,0x0E,0x03,0x8F,0x02,0x08,0x03,
+0x0E,0x0A,0x82,0x01,0x08,0x03,0x82,0x01,0x08,0x10,0x82,0x10,0x18,0x01,0x08,0x10,
+0x82,0x01,0x08,0x03,0x82,0x02,0x08,0x03,0x0E,0x0A,0x82,0x02,0x08,0x03,0x0E,0x03,
+0x8E,0x00,0x19,0x02,0x08,0x03,0x0E,0x03,0x8F,0x02,0x00,0x0B,0x0E,0x0A,0x82,0x00,
+0x82,0x01,0x00,0x18,0x82,0x10,0x18,0x01,0x00,0x18,0x82,0x00,0x82,0x02,0x00,0x0B,
+0x0E,0x0A,0x82,0x02,0x08,0x03,0x0E,0x03,0x8E,0x00,0x28,0x02,0x08,0x03,0x0E,0x03,
+0x8F,0x02,0x08,0x03,0x0E,0x0A,0x82,0x01,0x08,0x03,0x82,0x02,0x08,0x03,0x0E,0x0A,
+0x82,0x02,0x08,0x03,0x0E,0x03,0x8E,0x10,0x09,0x01,0x00,0x18,0x82,0x00,0x82,0x01,
+0x00,0x18,0x82,0x00,0x28,0x02,0x08,0x03,0x0E,0x03,0x8F,0x02,0x00,0x0B,0x0E,0x0A,
+0x82,0x00,0x82,0x02,0x00,0x0B,0x0E,0x0A,0x82,0x02,0x08,0x03,0x0E,0x03,0x8E,0x08,
+0x13,0x02,0x04,0x01,0x14,0x01,0x02,0x03,0x03,0x13,0x03,0x03,0x04,0x03,0x0A,0x05,
+0x12,0x03,0x01,0x05,0x0F,0x01,0x06,0x0D,0x02,0x06,0x04,0x0F,0x04,0x02,0x06,0x03,
+0x10,0x03,0x02,0x05,0x03,0x11,0x03,0x84,0x02,0x06,0x03,0x10,0x03,0x02,0x06,0x04,
+0x0F,0x04,0x01,0x06,0x0D,0x01,0x05,0x0F,0x03,0x04,0x03,0x0A,0x05,0x12,0x03,0x02,
+0x03,0x03,0x13,0x03,0x02,0x04,0x01,0x14,0x01,0x01,0x1F,0x02,0x02,0x05,0x0E,0x01,
+0x02,0x02,0x08,0x0C,0x04,0x01,0x02,0x0D,0x01,0x05,0x09,0x01,0x08,0x06,0x01,0x07,
+0x08,0x02,0x05,0x05,0x0B,0x06,0x02,0x05,0x03,0x0C,0x05,0x02,0x05,0x02,0x0D,0x05,
+0x01,0x0E,0x05,0x01,0x08,0x0C,0x01,0x06,0x0E,0x01,0x05,0x10,0x02,0x04,0x06,0x0F,
+0x06,0x02,0x04,0x04,0x10,0x05,0x02,0x03,0x04,0x11,0x05,0x81,0x02,0x02,0x04,0x12,
+0x04,0x86,0x02,0x03,0x04,0x11,0x04,0x81,0x02,0x04,0x04,0x10,0x04,0x02,0x04,0x06,
+0x0E,0x06,0x01,0x05,0x0E,0x01,0x06,0x0B,0x01,0x09,0x06,0x07,0x19,0x01,0x03,0x0C,
+0x01,0x03,0x0F,0x01,0x03,0x10,0x02,0x03,0x04,0x0E,0x06,0x02,0x03,0x04,0x10,0x05,
+0x02,0x03,0x04,0x11,0x05,0x02,0x03,0x04,0x12,0x04,0x81,0x02,0x03,0x04,0x13,0x04,
+0x81,0x02,0x00,0x0C,0x13,0x04,0x82,0x02,0x03,0x04,0x13,0x04,0x82,0x02,0x03,0x04,
+0x13,0x03,0x02,0x03,0x04,0x12,0x04,0x81,0x02,0x03,0x04,0x11,0x04,0x02,0x03,0x04,
+0x10,0x05,0x02,0x03,0x04,0x0D,0x07,0x01,0x03,0x10,0x01,0x03,0x0E,0x01,0x03,0x0C,
+0x00,0x20,0x01,0x0A,0x06,0x01,0x09,0x08,0x02,0x08,0x04,0x0E,0x04,0x02,0x07,0x03,
+0x10,0x03,0x00,0x82,0x01,0x04,0x11,0x82,0x01,0x04,0x04,0x87,0x01,0x04,0x0F,0x82,
+0x01,0x04,0x04,0x87,0x01,0x04,0x12,0x82,0x00,0x20,0x02,0x07,0x03,0x11,0x03,0x82,
+0x00,0x83,0x01,0x04,0x11,0x82,0x01,0x04,0x04,0x87,0x01,0x04,0x0F,0x82,0x01,0x04,
+0x04,0x87,0x01,0x04,0x12,0x82,0x00,0x20,0x01,0x07,0x04,0x01,0x08,0x04,0x01,0x0A,
+0x03,0x01,0x0B,0x03,0x00,0x82,0x01,0x04,0x11,0x82,0x01,0x04,0x04,0x87,0x01,0x04,
+0x0F,0x82,0x01,0x04,0x04,0x87,0x01,0x04,0x12,0x82,0x0B,0x15,0x01,0x03,0x0C,0x82,
+0x01,0x0B,0x04,0x91,0x00,0x20,0x01,0x0D,0x04,0x01,0x0C,0x04,0x01,0x0B,0x03,0x01,
+0x0A,0x03,0x00,0x82,0x01,0x03,0x12,0x82,0x01,0x0A,0x04,0x92,0x01,0x03,0x12,0x82,
+0x00,0x20,0x01,0x09,0x06,0x01,0x08,0x08,0x02,0x07,0x04,0x0D,0x04,0x02,0x06,0x03,
+0x0F,0x03,0x00,0x82,0x01,0x03,0x12,0x82,0x01,0x0A,0x04,0x92,0x01,0x03,0x12,0x82,
+0x00,0x20,0x02,0x06,0x03,0x10,0x03,0x82,0x00,0x83,0x01,0x03,0x12,0x82,0x01,0x0A,
+0x04,0x92,0x01,0x03,0x12,0x82,0x00,0x16,0x01,0x0B,0x03,0x92,0x01,0x00,0x0E,0x82,
+0x13,0x15,0x01,0x0B,0x0D,0x82,0x01,0x0B,0x03,0x91,0x00,0x28,0x01,0x00,0x18,0xA7,
+0x14,0x14,0x01,0x00,0x18,0x93,0x01,0x25,0x01,0x0B,0x03,0x8D,0x00,0x87,0x01,0x0B,
+0x03,0x8E,0x00,0x20,0x01,0x06,0x04,0x01,0x07,0x04,0x01,0x09,0x03,0x01,0x0A,0x03,
+0x00,0x82,0x01,0x03,0x12,0x82,0x01,0x0A,0x04,0x92,0x01,0x03,0x12,0x82,0x00,0x14,
+0x01,0x00,0x18,0x93,0x00,0x20,0x01,0x0D,0x04,0x01,0x0C,0x04,0x01,0x0B,0x03,0x01,
+0x0A,0x03,0x00,0x82,0x01,0x08,0x08,0x01,0x06,0x0C,0x01,0x05,0x0E,0x02,0x04,0x05,
+0x0F,0x05,0x02,0x03,0x05,0x10,0x05,0x02,0x03,0x04,0x11,0x04,0x02,0x02,0x04,0x12,
+0x04,0x81,0x02,0x01,0x04,0x13,0x04,0x88,0x02,0x02,0x04,0x12,0x04,0x81,0x02,0x03,
+0x04,0x11,0x04,0x02,0x03,0x05,0x10,0x05,0x02,0x04,0x05,0x0F,0x05,0x01,0x05,0x0E,
+0x01,0x06,0x0C,0x01,0x08,0x08,0x01,0x1F,0x01,0x07,0x07,0x01,0x05,0x0B,0x01,0x04,
+0x0D,0x02,0x04,0x05,0x0D,0x05,0x02,0x03,0x05,0x0E,0x04,0x02,0x03,0x04,0x0E,0x04,
+0x81,0x02,0x03,0x04,0x0E,0x03,0x02,0x03,0x04,0x0D,0x04,0x02,0x03,0x04,0x0C,0x04,
+0x81,0x02,0x03,0x04,0x0B,0x04,0x02,0x03,0x04,0x0A,0x04,0x82,0x02,0x03,0x04,0x0A,
+0x05,0x02,0x03,0x04,0x0B,0x05,0x02,0x03,0x04,0x0B,0x06,0x02,0x03,0x04,0x0C,0x07,
+0x02,0x03,0x04,0x0D,0x07,0x02,0x03,0x04,0x0F,0x05,0x02,0x03,0x04,0x10,0x05,0x02,
+0x03,0x04,0x11,0x05,0x02,0x03,0x04,0x12,0x04,0x83,0x03,0x03,0x04,0x09,0x03,0x11,
+0x04,0x02,0x03,0x04,0x09,0x0C,0x02,0x03,0x04,0x09,0x0B,0x02,0x03,0x04,0x0B,0x07,
+0x00,0x20,0x01,0x09,0x06,0x01,0x08,0x08,0x02,0x07,0x04,0x0D,0x04,0x02,0x06,0x03,
+0x0F,0x03,0x00,0x82,0x01,0x08,0x08,0x01,0x06,0x0C,0x01,0x05,0x0E,0x02,0x04,0x05,
+0x0F,0x05,0x02,0x03,0x05,0x10,0x05,0x02,0x03,0x04,0x11,0x04,0x02,0x02,0x04,0x12,
+0x04,0x81,0x02,0x01,0x04,0x13,0x04,0x88,0x02,0x02,0x04,0x12,0x04,0x81,0x02,0x03,
+0x04,0x11,0x04,0x02,0x03,0x05,0x10,0x05,0x02,0x04,0x05,0x0F,0x05,0x01,0x05,0x0E,
+0x01,0x06,0x0C,0x01,0x08,0x08,0x00,0x20,0x01,0x06,0x04,0x01,0x07,0x04,0x01,0x09,
+0x03,0x01,0x0A,0x03,0x00,0x82,0x01,0x08,0x08,0x01,0x06,0x0C,0x01,0x05,0x0E,0x02,
+0x04,0x05,0x0F,0x05,0x02,0x03,0x05,0x10,0x05,0x02,0x03,0x04,0x11,0x04,0x02,0x02,
+0x04,0x12,0x04,0x81,0x02,0x01,0x04,0x13,0x04,0x88,0x02,0x02,0x04,0x12,0x04,0x81,
+0x02,0x03,0x04,0x11,0x04,0x02,0x03,0x05,0x10,0x05,0x02,0x04,0x05,0x0F,0x05,0x01,
+0x05,0x0E,0x01,0x06,0x0C,0x01,0x08,0x08,0x02,0x1E,0x02,0x08,0x04,0x11,0x02,0x02,
+0x07,0x07,0x11,0x02,0x01,0x06,0x0D,0x02,0x06,0x02,0x0B,0x07,0x02,0x06,0x02,0x0D,
+0x04,0x00,0x83,0x01,0x08,0x08,0x01,0x06,0x0C,0x01,0x05,0x0E,0x02,0x04,0x05,0x0F,
+0x05,0x02,0x03,0x05,0x10,0x05,0x02,0x03,0x04,0x11,0x04,0x81,0x02,0x02,0x04,0x12,
+0x04,0x86,0x02,0x03,0x04,0x11,0x04,0x81,0x02,0x03,0x05,0x10,0x05,0x02,0x04,0x05,
+0x0F,0x05,0x01,0x05,0x0E,0x01,0x06,0x0C,0x01,0x08,0x08,0x00,0x20,0x02,0x08,0x04,
+0x11,0x02,0x02,0x07,0x07,0x10,0x03,0x02,0x06,0x03,0x0B,0x07,0x02,0x06,0x02,0x0D,
+0x04,0x00,0x82,0x01,0x08,0x08,0x01,0x06,0x0C,0x01,0x05,0x0E,0x02,0x04,0x05,0x0F,
+0x05,0x02,0x03,0x05,0x10,0x05,0x02,0x03,0x04,0x11,0x04,0x02,0x02,0x04,0x12,0x04,
+0x81,0x02,0x01,0x04,0x13,0x04,0x88,0x02,0x02,0x04,0x12,0x04,0x81,0x02,0x03,0x04,
+0x11,0x04,0x02,0x03,0x05,0x10,0x05,0x02,0x04,0x05,0x0F,0x05,0x01,0x05,0x0E,0x01,
+0x06,0x0C,0x01,0x08,0x08,0x0B,0x1D,0x02,0x04,0x04,0x11,0x04,0x8D,0x02,0x04,0x04,
+0x10,0x05,0x02,0x04,0x05,0x10,0x05,0x02,0x04,0x05,0x0F,0x06,0x02,0x04,0x07,0x0E,
+0x07,0x02,0x04,0x0C,0x11,0x04,0x03,0x04,0x04,0x09,0x06,0x11,0x05,0x03,0x04,0x04,
+0x0A,0x04,0x12,0x04,0x01,0x04,0x04,0x87,0x01,0x27,0x01,0x04,0x04,0x89,0x02,0x04,
+0x04,0x0C,0x05,0x02,0x04,0x04,0x0A,0x09,0x02,0x04,0x04,0x09,0x0B,0x03,0x04,0x04,
+0x09,0x03,0x10,0x05,0x02,0x04,0x06,0x11,0x04,0x02,0x04,0x05,0x11,0x04,0x02,0x04,
+0x04,0x12,0x04,0x87,0x02,0x04,0x04,0x11,0x04,0x81,0x02,0x04,0x05,0x10,0x05,0x02,
+0x04,0x07,0x0F,0x05,0x01,0x04,0x0F,0x02,0x04,0x04,0x09,0x09,0x02,0x04,0x04,0x0B,
+0x05,0x01,0x04,0x04,0x87,0x07,0x19,0x01,0x04,0x04,0x84,0x01,0x04,0x0E,0x01,0x04,
+0x10,0x01,0x04,0x11,0x02,0x04,0x04,0x10,0x05,0x02,0x04,0x04,0x11,0x05,0x02,0x04,
+0x04,0x12,0x04,0x83,0x02,0x04,0x04,0x11,0x05,0x02,0x04,0x04,0x10,0x05,0x02,0x04,
+0x04,0x0E,0x06,0x01,0x04,0x0F,0x01,0x04,0x0E,0x01,0x04,0x0B,0x01,0x04,0x04,0x84,
+0x00,0x20,0x01,0x0D,0x04,0x01,0x0C,0x04,0x01,0x0B,0x03,0x01,0x0A,0x03,0x00,0x82,
+0x02,0x03,0x04,0x12,0x04,0x92,0x02,0x04,0x04,0x11,0x04,0x02,0x04,0x04,0x10,0x05,
+0x02,0x05,0x05,0x0F,0x05,0x01,0x05,0x0F,0x01,0x07,0x0B,0x01,0x09,0x07,0x00,0x20,
+0x01,0x09,0x06,0x01,0x08,0x08,0x02,0x07,0x04,0x0D,0x04,0x02,0x06,0x03,0x0F,0x03,
+0x00,0x82,0x02,0x03,0x04,0x12,0x04,0x92,0x02,0x04,0x04,0x11,0x04,0x02,0x04,0x04,
+0x10,0x05,0x02,0x05,0x05,0x0F,0x05,0x01,0x05,0x0F,0x01,0x07,0x0B,0x01,0x09,0x07,
+0x00,0x20,0x01,0x07,0x04,0x01,0x08,0x04,0x01,0x0A,0x03,0x01,0x0B,0x03,0x00,0x82,
+0x02,0x03,0x04,0x12,0x04,0x92,0x02,0x04,0x04,0x11,0x04,0x02,0x04,0x04,0x10,0x05,
+0x02,0x05,0x05,0x0F,0x05,0x01,0x05,0x0F,0x01,0x07,0x0B,0x01,0x09,0x07,0x01,0x27,
+0x01,0x0D,0x04,0x01,0x0C,0x04,0x01,0x0C,0x03,0x01,0x0B,0x03,0x01,0x0A,0x03,0x01,
+0x09,0x03,0x00,0x83,0x02,0x01,0x05,0x13,0x04,0x02,0x02,0x04,0x13,0x03,0x02,0x02,
+0x05,0x12,0x04,0x02,0x03,0x04,0x12,0x03,0x02,0x03,0x04,0x11,0x04,0x02,0x03,0x05,
+0x11,0x03,0x02,0x04,0x04,0x10,0x04,0x02,0x04,0x05,0x10,0x04,0x02,0x05,0x04,0x0F,
+0x04,0x02,0x05,0x05,0x0F,0x04,0x02,0x06,0x04,0x0E,0x04,0x02,0x06,0x05,0x0E,0x04,
+0x02,0x07,0x04,0x0D,0x04,0x81,0x02,0x08,0x04,0x0D,0x03,0x01,0x08,0x08,0x01,0x08,
+0x07,0x01,0x09,0x06,0x81,0x01,0x0A,0x04,0x81,0x01,0x0A,0x03,0x01,0x09,0x04,0x01,
+0x09,0x03,0x01,0x08,0x04,0x01,0x07,0x04,0x01,0x02,0x08,0x01,0x02,0x07,0x01,0x02,
+0x06,0x00,0x20,0x01,0x0D,0x04,0x01,0x0C,0x04,0x01,0x0B,0x03,0x01,0x0A,0x03,0x00,
+0x82,0x02,0x01,0x05,0x14,0x04,0x02,0x02,0x04,0x13,0x04,0x02,0x03,0x04,0x13,0x03,
+0x02,0x03,0x05,0x12,0x04,0x02,0x04,0x04,0x12,0x03,0x02,0x05,0x04,0x11,0x04,0x02,
+0x05,0x05,0x10,0x04,0x02,0x06,0x05,0x10,0x03,0x02,0x07,0x04,0x0F,0x04,0x02,0x07,
+0x05,0x0F,0x03,0x02,0x08,0x05,0x0E,0x04,0x01,0x09,0x08,0x01,0x09,0x07,0x01,0x0A,
+0x06,0x01,0x0B,0x04,0x8A,0x00,0x03,0x01,0x00,0x18,0x82,0x00,0x04,0x01,0x0B,0x04,
+0x01,0x0A,0x04,0x01,0x09,0x03,0x01,0x08,0x03,0x12,0x03,0x01,0x04,0x10,0x82,0x0B,
+0x15,0x01,0x0B,0x03,0x85,0x01,0x02,0x15,0x82,0x01,0x0B,0x03,0x85,0x00,0x82,0x01,
+0x02,0x15,0x82,0x20,0x08,0x01,0x00,0x18,0x82,0x00,0x82,0x01,0x00,0x18,0x81,0x03,
+0x1E,0x02,0x01,0x08,0x15,0x03,0x02,0x01,0x09,0x14,0x03,0x03,0x01,0x01,0x07,0x04,
+0x13,0x03,0x02,0x08,0x03,0x13,0x03,0x02,0x08,0x03,0x12,0x03,0x02,0x07,0x03,0x11,
+0x03,0x02,0x03,0x06,0x11,0x03,0x02,0x03,0x05,0x10,0x03,0x02,0x05,0x05,0x0F,0x03,
+0x02,0x07,0x04,0x0F,0x03,0x02,0x08,0x03,0x0E,0x03,0x02,0x08,0x03,0x0D,0x03,0x03,
+0x01,0x01,0x07,0x04,0x0D,0x03,0x02,0x01,0x09,0x0C,0x03,0x03,0x01,0x07,0x0B,0x03,
+0x12,0x04,0x02,0x0B,0x03,0x11,0x05,0x02,0x0A,0x03,0x11,0x05,0x03,0x09,0x03,0x10,
+0x02,0x13,0x03,0x03,0x09,0x03,0x0F,0x02,0x13,0x03,0x03,0x08,0x03,0x0E,0x03,0x13,
+0x03,0x03,0x07,0x03,0x0D,0x03,0x13,0x03,0x03,0x07,0x03,0x0D,0x02,0x13,0x03,0x03,
+0x06,0x03,0x0C,0x02,0x13,0x03,0x02,0x05,0x03,0x0C,0x0C,0x81,0x02,0x04,0x03,0x13,
+0x03,0x02,0x03,0x03,0x13,0x03,0x81,0x02,0x02,0x03,0x13,0x03,0x01,0x01,0x03,0x03,
+0x23,0x01,0x07,0x0C,0x01,0x05,0x0E,0x02,0x04,0x08,0x11,0x02,0x02,0x03,0x09,0x11,
+0x02,0x86,0x02,0x04,0x08,0x11,0x02,0x81,0x02,0x05,0x07,0x11,0x02,0x02,0x06,0x06,
+0x11,0x02,0x02,0x08,0x04,0x11,0x02,0x02,0x0A,0x02,0x11,0x02,0x93,0x03,0x23,0x01,
+0x0A,0x08,0x01,0x08,0x0B,0x01,0x07,0x0C,0x02,0x06,0x04,0x11,0x02,0x01,0x05,0x04,
+0x01,0x05,0x03,0x82,0x01,0x05,0x05,0x01,0x06,0x05,0x01,0x07,0x07,0x01,0x07,0x09,
+0x01,0x07,0x0A,0x02,0x06,0x03,0x0C,0x06,0x02,0x06,0x02,0x0E,0x05,0x02,0x05,0x03,
+0x0F,0x05,0x02,0x05,0x03,0x10,0x04,0x02,0x05,0x03,0x11,0x03,0x02,0x05,0x04,0x11,
+0x03,0x02,0x06,0x05,0x11,0x03,0x02,0x06,0x06,0x10,0x03,0x02,0x07,0x08,0x10,0x03,
+0x01,0x09,0x09,0x01,0x0B,0x07,0x01,0x0D,0x06,0x01,0x0F,0x04,0x01,0x10,0x04,0x01,
+0x11,0x03,0x82,0x02,0x05,0x01,0x10,0x04,0x02,0x05,0x04,0x0F,0x04,0x01,0x05,0x0D,
+0x01,0x05,0x0C,0x01,0x08,0x07,0x0B,0x15,0x01,0x0A,0x04,0x83,0x00,0x84,0x01,0x02,
+0x15,0x82,0x00,0x84,0x01,0x0A,0x04,0x83,0x20,0x08,0x01,0x0B,0x02,0x01,0x0A,0x02,
+0x01,0x0A,0x04,0x01,0x0C,0x03,0x01,0x0D,0x03,0x81,0x01,0x09,0x06,0x01,0x09,0x05,
+0x03,0x09,0x01,0x09,0x05,0x01,0x08,0x07,0x02,0x07,0x03,0x0D,0x03,0x02,0x07,0x02,
+0x0E,0x02,0x82,0x02,0x07,0x03,0x0D,0x03,0x01,0x08,0x07,0x01,0x09,0x05,0x00,0x03,
+0x02,0x06,0x03,0x10,0x03,0x82,0x13,0x05,0x01,0x0A,0x05,0x84,0x03,0x0F,0x01,0x08,
+0x05,0x01,0x06,0x07,0x81,0x01,0x0A,0x03,0x8B,0x03,0x0F,0x01,0x08,0x08,0x01,0x06,
+0x0B,0x02,0x06,0x03,0x0E,0x04,0x01,0x0F,0x03,0x81,0x01,0x0D,0x04,0x01,0x08,0x08,
+0x01,0x08,0x07,0x01,0x0D,0x04,0x01,0x0F,0x03,0x82,0x02,0x06,0x03,0x0E,0x04,0x01,
+0x06,0x0B,0x01,0x07,0x08,0x03,0x0F,0x01,0x08,0x07,0x01,0x06,0x0B,0x02,0x06,0x02,
+0x0E,0x04,0x01,0x0F,0x03,0x82,0x01,0x0E,0x03,0x01,0x0C,0x04,0x01,0x0A,0x05,0x01,
+0x09,0x04,0x01,0x07,0x04,0x01,0x06,0x04,0x01,0x06,0x0C,0x82,0x0B,0x15,0x01,0x01,
+0x16,0x94,0xFF,
+};
+#endif
+
+#ifdef USE_FONT_SPAN_32X53
+/* 19682 bytes, 54272 as 1bpp bitmap */
+__UG_FONT_DATA unsigned char font_32x53_span[19682]={
+0x00,0x02,0x01,0x02,0xA4,0x02,0x11,0x03,0x64,0x03,0xD0,0x03,0x23,0x04,0x83,0x04,
+0x84,0x04,0x85,0x04,0x86,0x04,0x87,0x04,0x1C,0x05,0x84,0x05,0x85,0x05,0x06,0x06,
+0x64,0x06,0xC3,0x06,0x22,0x07,0x74,0x07,0x8F,0x07,0xCB,0x07,0x69,0x08,0x6F,0x08,
+0xD5,0x08,0xFD,0x08,0x29,0x09,0x59,0x09,0x89,0x09,0x93,0x09,0xDB,0x09,0x2A,0x0A,
+0x79,0x0A,0x7A,0x0A,0x8D,0x0A,0x9B,0x0A,0xF3,0x0A,0x82,0x0B,0x66,0x0C,0x20,0x0D,
+0x2A,0x0D,0x8E,0x0D,0xF2,0x0D,0x4F,0x0E,0x5D,0x0E,0x77,0x0E,0x7D,0x0E,0x83,0x0E,
+0xE7,0x0E,0x51,0x0F,0x77,0x0F,0xD4,0x0F,0x37,0x10,0xA5,0x10,0xEB,0x10,0x77,0x11,
+0xCC,0x11,0x5C,0x12,0xE8,0x12,0xF4,0x12,0x16,0x13,0x69,0x13,0x75,0x13,0xC8,0x13,
+0x1C,0x14,0xED,0x14,0x65,0x15,0xD8,0x15,0x30,0x16,0x8F,0x16,0xA5,0x16,0xB7,0x16,
+0x21,0x17,0x33,0x17,0x41,0x17,0x61,0x17,0x06,0x18,0x10,0x18,0xB0,0x18,0x45,0x19,
+0x9B,0x19,0xE2,0x19,0x50,0x1A,0xD2,0x1A,0x32,0x1B,0x3C,0x1B,0x65,0x1B,0xF3,0x1B,
+0x93,0x1C,0x2A,0x1D,0x81,0x1D,0xD6,0x1D,0xE4,0x1D,0x48,0x1E,0x56,0x1E,0xCE,0x1E,
+0xD4,0x1E,0xE8,0x1E,0x4D,0x1F,0xB0,0x1F,0xFC,0x1F,0x61,0x20,0xBB,0x20,0xE3,0x20,
+0x63,0x21,0xA1,0x21,0xB1,0x21,0xDD,0x21,0x6D,0x22,0x77,0x22,0xC2,0x22,0xFC,0x22,
+0x50,0x23,0xB3,0x23,0x16,0x24,0x4E,0x24,0xA3,0x24,0xC5,0x24,0xFD,0x24,0x6D,0x25,
+0x1F,0x26,0x9F,0x26,0x33,0x27,0x79,0x27,0xC8,0x27,0xCE,0x27,0x1D,0x28,0x51,0x28,
+0x61,0x28,0xD5,0x28,0x15,0x29,0x89,0x29,0x12,0x2A,0x7F,0x2A,0xFE,0x2A,0x81,0x2B,
+0xE9,0x2B,0x67,0x2C,0xC9,0x2C,0x3D,0x2D,0x4F,0x2D,0x7D,0x2D,0xA1,0x2D,0x21,0x2E,
+0xBD,0x2E,0xE7,0x2E,0x59,0x2F,0xC7,0x2F,0x3F,0x30,0x9B,0x30,0x09,0x31,0x65,0x31,
+0xB7,0x31,0x53,0x32,0xB1,0x32,0xE2,0x32,0x77,0x33,0xAF,0x33,0x62,0x34,0xE2,0x34,
+0x16,0x35,0x95,0x35,0xB9,0x35,0x27,0x36,0x79,0x36,0xD3,0x36,0x88,0x37,0xD1,0x37,
+0x0E,0x38,0x61,0x38,0xF7,0x38,0x01,0x39,0xA5,0x39,0x53,0x3A,0x66,0x3A,0xE0,0x3A,
+0x5A,0x3B,0x8C,0x3B,0xE1,0x3B,0x1F,0x3C,0x25,0x3C,0x33,0x3C,0xBF,0x3C,0x53,0x3D,
+0xDF,0x3D,0x9E,0x3E,0xBC,0x3E,0xC4,0x3E,0xDA,0x3E,0xF0,0x3E,0x4D,0x3F,0xB6,0x3F,
+0xC0,0x3F,0xCA,0x3F,0xD4,0x3F,0xDE,0x3F,0xEC,0x3F,0xF2,0x3F,0x00,0x40,0x85,0x40,
+0x1D,0x41,0x33,0x41,0x49,0x41,0x5D,0x41,0x71,0x41,0x8F,0x41,0x9B,0x41,0xB7,0x41,
+0x26,0x42,0xB2,0x42,0x1D,0x43,0x4F,0x43,0x6D,0x43,0x97,0x43,0xA1,0x43,0xC3,0x43,
+0xED,0x43,0x03,0x44,0x0D,0x44,0x17,0x44,0x1D,0x44,0x23,0x44,0x2F,0x44,0x51,0x44,
+0x57,0x44,0xC1,0x44,0x75,0x45,0xE7,0x45,0x51,0x46,0xC5,0x46,0x3B,0x47,0x79,0x47,
+0xE0,0x47,0x2B,0x48,0x68,0x48,0xAD,0x48,0xEA,0x48,0x98,0x49,0x03,0x4A,0x09,0x4A,
+0x1D,0x4A,0x23,0x4A,0x37,0x4A,0x43,0x4A,0x19,0x4B,0x55,0x4B,0xF3,0x4B,0x05,0x4C,
+0x26,0x4C,0x4E,0x4C,0x56,0x4C,0x5C,0x4C,0x69,0x4C,0xA6,0x4C,0xDB,0x4C,0xE1,0x4C,
+0xFF,0x0E,0x1C,0x01,0x0C,0x08,0x01,0x0A,0x0C,0x01,0x08,0x10,0x02,0x07,0x06,0x13,
+0x06,0x02,0x06,0x04,0x16,0x04,0x02,0x05,0x04,0x17,0x04,0x02,0x04,0x04,0x18,0x04,
+0x02,0x04,0x03,0x19,0x03,0x04,0x03,0x03,0x0A,0x03,0x13,0x03,0x1A,0x03,0x04,0x03,
+0x03,0x09,0x05,0x12,0x05,0x1A,0x03,0x04,0x02,0x04,0x09,0x05,0x12,0x05,0x1A,0x04,
+0x04,0x02,0x03,0x09,0x05,0x12,0x05,0x1B,0x03,0x04,0x02,0x03,0x0A,0x03,0x13,0x03,
+0x1B,0x03,0x02,0x02,0x03,0x1B,0x03,0x82,0x04,0x02,0x03,0x08,0x02,0x16,0x02,0x1B,
+0x03,0x04,0x02,0x04,0x08,0x02,0x16,0x02,0x1A,0x04,0x04,0x03,0x03,0x08,0x03,0x15,
+0x03,0x1A,0x03,0x04,0x03,0x03,0x09,0x04,0x13,0x04,0x1A,0x03,0x03,0x04,0x03,0x0A,
+0x0C,0x19,0x03,0x03,0x04,0x04,0x0B,0x0A,0x18,0x04,0x03,0x05,0x04,0x0D,0x06,0x17,
+0x04,0x02,0x06,0x04,0x16,0x04,0x02,0x07,0x06,0x13,0x06,0x01,0x08,0x10,0x01,0x0A,
+0x0C,0x01,0x0C,0x08,0x0E,0x1C,0x01,0x0C,0x08,0x01,0x0A,0x0C,0x01,0x08,0x10,0x01,
+0x07,0x12,0x01,0x06,0x14,0x01,0x05,0x16,0x01,0x04,0x18,0x81,0x03,0x03,0x07,0x0D,
+0x06,0x16,0x07,0x03,0x03,0x06,0x0E,0x04,0x17,0x06,0x03,0x02,0x07,0x0E,0x04,0x17,
+0x07,0x81,0x03,0x02,0x08,0x0D,0x06,0x16,0x08,0x01,0x02,0x1C,0x82,0x03,0x02,0x06,
+0x0A,0x0C,0x18,0x06,0x81,0x03,0x03,0x05,0x0B,0x0A,0x18,0x05,0x03,0x03,0x06,0x0D,
+0x06,0x17,0x06,0x02,0x04,0x06,0x16,0x06,0x02,0x04,0x07,0x15,0x07,0x02,0x05,0x08,
+0x13,0x08,0x01,0x06,0x14,0x01,0x07,0x12,0x01,0x08,0x10,0x01,0x0A,0x0C,0x01,0x0C,
+0x08,0x04,0x26,0x02,0x06,0x05,0x15,0x05,0x02,0x04,0x09,0x13,0x09,0x02,0x04,0x0A,
+0x12,0x0A,0x02,0x03,0x0C,0x11,0x0C,0x02,0x02,0x0D,0x11,0x0D,0x01,0x02,0x1C,0x81,
+0x01,0x01,0x1E,0x88,0x01,0x02,0x1C,0x82,0x01,0x03,0x1A,0x82,0x01,0x04,0x18,0x81,
+0x01,0x05,0x16,0x01,0x06,0x14,0x81,0x01,0x07,0x12,0x81,0x01,0x08,0x10,0x01,0x09,
+0x0E,0x01,0x0A,0x0C,0x81,0x01,0x0B,0x0A,0x01,0x0C,0x08,0x01,0x0D,0x06,0x01,0x0E,
+0x04,0x01,0x0F,0x02,0x04,0x26,0x01,0x0F,0x01,0x81,0x01,0x0E,0x03,0x01,0x0D,0x05,
+0x81,0x01,0x0C,0x07,0x01,0x0B,0x09,0x01,0x0B,0x0A,0x01,0x0A,0x0B,0x01,0x09,0x0D,
+0x01,0x08,0x0F,0x01,0x08,0x10,0x01,0x07,0x12,0x01,0x06,0x14,0x01,0x05,0x16,0x01,
+0x04,0x18,0x01,0x03,0x1A,0x01,0x02,0x1C,0x01,0x01,0x1E,0x01,0x02,0x1C,0x01,0x03,
+0x1A,0x01,0x04,0x18,0x01,0x05,0x16,0x01,0x06,0x14,0x01,0x06,0x13,0x01,0x07,0x11,
+0x01,0x08,0x0F,0x01,0x09,0x0E,0x01,0x0A,0x0C,0x01,0x0A,0x0B,0x01,0x0B,0x09,0x01,
+0x0C,0x08,0x01,0x0C,0x07,0x01,0x0D,0x05,0x81,0x01,0x0E,0x03,0x01,0x0F,0x01,0x81,
+0x04,0x26,0x01,0x0D,0x06,0x01,0x0C,0x08,0x01,0x0B,0x0A,0x01,0x0A,0x0C,0x01,0x09,
+0x0E,0x85,0x01,0x0A,0x0C,0x81,0x01,0x0B,0x0A,0x03,0x05,0x05,0x0B,0x0A,0x16,0x05,
+0x01,0x03,0x1A,0x81,0x01,0x02,0x1C,0x01,0x01,0x1E,0x85,0x02,0x02,0x0C,0x0F,0x0F,
+0x01,0x02,0x1C,0x03,0x03,0x0A,0x0E,0x04,0x13,0x0A,0x03,0x04,0x08,0x0E,0x04,0x14,
+0x08,0x03,0x05,0x05,0x0E,0x04,0x16,0x05,0x01,0x0E,0x04,0x01,0x0D,0x06,0x85,0x01,
+0x0C,0x08,0x82,0x04,0x26,0x01,0x0F,0x01,0x01,0x0F,0x02,0x01,0x0E,0x03,0x01,0x0D,
+0x05,0x01,0x0D,0x06,0x01,0x0C,0x07,0x01,0x0B,0x09,0x01,0x0A,0x0B,0x01,0x0A,0x0C,
+0x01,0x09,0x0E,0x01,0x08,0x10,0x01,0x07,0x11,0x01,0x06,0x13,0x01,0x05,0x15,0x01,
+0x04,0x17,0x01,0x04,0x18,0x01,0x03,0x1A,0x01,0x02,0x1C,0x81,0x01,0x01,0x1E,0x85,
+0x01,0x02,0x1C,0x03,0x03,0x0A,0x0E,0x04,0x13,0x0A,0x03,0x04,0x08,0x0E,0x04,0x14,
+0x08,0x03,0x05,0x05,0x0E,0x04,0x16,0x05,0x01,0x0E,0x04,0x01,0x0D,0x06,0x84,0x01,
+0x0C,0x08,0x82,0xFF,0xFF,0xFF,0xFF,0x03,0x27,0x01,0x1A,0x02,0x01,0x17,0x06,0x01,
+0x13,0x0A,0x01,0x0F,0x0E,0x01,0x0F,0x0F,0x02,0x0F,0x07,0x17,0x07,0x02,0x10,0x02,
+0x16,0x08,0x01,0x16,0x08,0x02,0x15,0x04,0x1B,0x04,0x02,0x14,0x05,0x1B,0x04,0x02,
+0x14,0x04,0x1B,0x04,0x02,0x13,0x05,0x1C,0x04,0x02,0x13,0x04,0x1C,0x04,0x03,0x09,
+0x08,0x12,0x04,0x1C,0x02,0x01,0x07,0x0F,0x01,0x05,0x10,0x01,0x04,0x12,0x02,0x03,
+0x07,0x10,0x07,0x02,0x02,0x06,0x12,0x06,0x02,0x02,0x05,0x13,0x05,0x02,0x01,0x05,
+0x14,0x05,0x02,0x01,0x04,0x15,0x04,0x02,0x00,0x05,0x15,0x05,0x02,0x00,0x04,0x16,
+0x04,0x85,0x02,0x00,0x05,0x15,0x05,0x02,0x01,0x04,0x15,0x04,0x02,0x01,0x05,0x14,
+0x05,0x02,0x02,0x05,0x13,0x05,0x02,0x02,0x06,0x12,0x06,0x02,0x03,0x07,0x10,0x07,
+0x01,0x04,0x12,0x01,0x05,0x10,0x01,0x07,0x0C,0x01,0x09,0x08,0x04,0x26,0x01,0x0C,
+0x08,0x01,0x0A,0x0C,0x01,0x08,0x10,0x01,0x07,0x12,0x02,0x06,0x07,0x13,0x07,0x02,
+0x05,0x06,0x15,0x06,0x02,0x05,0x05,0x16,0x05,0x02,0x04,0x05,0x17,0x05,0x02,0x04,
+0x04,0x18,0x04,0x02,0x03,0x05,0x18,0x05,0x02,0x03,0x04,0x19,0x04,0x84,0x02,0x03,
+0x05,0x18,0x05,0x02,0x04,0x04,0x18,0x04,0x02,0x04,0x05,0x17,0x05,0x02,0x04,0x06,
+0x16,0x06,0x02,0x05,0x06,0x15,0x06,0x02,0x06,0x07,0x13,0x07,0x01,0x07,0x12,0x01,
+0x08,0x10,0x01,0x09,0x0E,0x01,0x0C,0x08,0x01,0x0E,0x04,0x83,0x01,0x08,0x10,0x83,
+0x01,0x0E,0x04,0x84,0xFF,0x03,0x2F,0x01,0x1D,0x01,0x01,0x1B,0x03,0x01,0x19,0x05,
+0x01,0x17,0x07,0x01,0x14,0x0A,0x01,0x12,0x0C,0x01,0x10,0x0E,0x02,0x0E,0x0C,0x1B,
+0x03,0x02,0x0C,0x0C,0x1B,0x03,0x02,0x0B,0x0B,0x1B,0x03,0x02,0x0B,0x09,0x1B,0x03,
+0x02,0x0B,0x07,0x1B,0x03,0x02,0x0B,0x05,0x1B,0x03,0x02,0x0B,0x03,0x1B,0x03,0x8F,
+0x02,0x0B,0x03,0x15,0x09,0x02,0x0B,0x03,0x13,0x0B,0x02,0x0B,0x03,0x12,0x0C,0x02,
+0x0B,0x03,0x12,0x0B,0x02,0x0B,0x03,0x11,0x0C,0x02,0x0B,0x03,0x11,0x0B,0x02,0x0B,
+0x03,0x11,0x0A,0x02,0x0B,0x03,0x12,0x08,0x02,0x0B,0x03,0x13,0x05,0x01,0x05,0x09,
+0x01,0x03,0x0B,0x01,0x02,0x0B,0x01,0x01,0x0C,0x81,0x01,0x01,0x0B,0x01,0x01,0x0A,
+0x01,0x02,0x08,0x01,0x03,0x05,0x0A,0x1C,0x01,0x0E,0x04,0x82,0x03,0x06,0x02,0x0E,
+0x04,0x18,0x02,0x03,0x05,0x04,0x0C,0x08,0x17,0x04,0x01,0x05,0x16,0x01,0x06,0x14,
+0x01,0x07,0x12,0x02,0x07,0x07,0x12,0x07,0x02,0x07,0x05,0x14,0x05,0x02,0x06,0x05,
+0x15,0x05,0x81,0x02,0x02,0x08,0x16,0x08,0x83,0x02,0x06,0x05,0x15,0x05,0x81,0x02,
+0x07,0x05,0x14,0x05,0x02,0x07,0x07,0x12,0x07,0x01,0x07,0x12,0x01,0x06,0x14,0x01,
+0x05,0x16,0x03,0x05,0x04,0x0C,0x08,0x17,0x04,0x03,0x06,0x02,0x0E,0x04,0x18,0x02,
+0x01,0x0E,0x04,0x82,0x0B,0x1F,0x01,0x01,0x01,0x01,0x01,0x03,0x01,0x01,0x05,0x01,
+0x01,0x07,0x01,0x01,0x09,0x01,0x01,0x0B,0x01,0x01,0x0D,0x01,0x01,0x0F,0x01,0x01,
+0x10,0x01,0x01,0x12,0x01,0x01,0x14,0x01,0x01,0x16,0x01,0x01,0x18,0x01,0x01,0x1A,
+0x01,0x01,0x1C,0x01,0x01,0x1E,0x01,0x01,0x1C,0x01,0x01,0x1A,0x01,0x01,0x18,0x01,
+0x01,0x16,0x01,0x01,0x14,0x01,0x01,0x12,0x01,0x01,0x10,0x01,0x01,0x0F,0x01,0x01,
+0x0D,0x01,0x01,0x0B,0x01,0x01,0x09,0x01,0x01,0x07,0x01,0x01,0x05,0x01,0x01,0x03,
+0x01,0x01,0x01,0x0B,0x1F,0x01,0x1E,0x01,0x01,0x1C,0x03,0x01,0x1A,0x05,0x01,0x18,
+0x07,0x01,0x16,0x09,0x01,0x14,0x0B,0x01,0x12,0x0D,0x01,0x10,0x0F,0x01,0x0F,0x10,
+0x01,0x0D,0x12,0x01,0x0B,0x14,0x01,0x09,0x16,0x01,0x07,0x18,0x01,0x05,0x1A,0x01,
+0x03,0x1C,0x01,0x01,0x1E,0x01,0x03,0x1C,0x01,0x05,0x1A,0x01,0x07,0x18,0x01,0x09,
+0x16,0x01,0x0B,0x14,0x01,0x0D,0x12,0x01,0x0F,0x10,0x01,0x10,0x0F,0x01,0x12,0x0D,
+0x01,0x14,0x0B,0x01,0x16,0x09,0x01,0x18,0x07,0x01,0x1A,0x05,0x01,0x1C,0x03,0x01,
+0x1E,0x01,0x04,0x2E,0x01,0x0F,0x02,0x81,0x01,0x0E,0x04,0x01,0x0D,0x06,0x81,0x01,
+0x0C,0x08,0x01,0x0A,0x0C,0x03,0x09,0x04,0x0E,0x04,0x13,0x04,0x03,0x08,0x04,0x0E,
+0x04,0x14,0x04,0x03,0x08,0x03,0x0E,0x04,0x15,0x03,0x01,0x0E,0x04,0x99,0x03,0x08,
+0x03,0x0E,0x04,0x15,0x03,0x03,0x08,0x04,0x0E,0x04,0x14,0x04,0x03,0x09,0x04,0x0E,
+0x04,0x13,0x04,0x01,0x0A,0x0C,0x01,0x0C,0x08,0x01,0x0D,0x06,0x81,0x01,0x0E,0x04,
+0x01,0x0F,0x02,0x81,0x04,0x26,0x02,0x08,0x05,0x13,0x05,0x96,0x02,0x08,0x04,0x13,
+0x05,0x02,0x09,0x03,0x14,0x03,0x82,0x00,0x84,0x02,0x07,0x07,0x12,0x07,0x85,0x04,
+0x2E,0x01,0x09,0x11,0x01,0x06,0x14,0x01,0x05,0x15,0x02,0x04,0x0C,0x17,0x03,0x81,
+0x02,0x03,0x0D,0x17,0x03,0x86,0x02,0x04,0x0C,0x17,0x03,0x81,0x02,0x05,0x0B,0x17,
+0x03,0x02,0x06,0x0A,0x17,0x03,0x02,0x07,0x09,0x17,0x03,0x02,0x09,0x07,0x17,0x03,
+0x02,0x0B,0x05,0x17,0x03,0x02,0x0D,0x03,0x17,0x03,0x9A,0x03,0x2F,0x01,0x0E,0x09,
+0x01,0x0B,0x0F,0x01,0x09,0x11,0x01,0x08,0x12,0x02,0x07,0x07,0x16,0x04,0x01,0x07,
+0x05,0x01,0x06,0x05,0x83,0x01,0x06,0x06,0x01,0x07,0x06,0x01,0x07,0x08,0x01,0x08,
+0x09,0x01,0x09,0x0A,0x01,0x0A,0x0B,0x01,0x09,0x0E,0x02,0x08,0x04,0x0E,0x0A,0x02,
+0x07,0x05,0x10,0x09,0x02,0x07,0x04,0x12,0x08,0x02,0x06,0x05,0x14,0x06,0x02,0x06,
+0x05,0x15,0x06,0x81,0x02,0x06,0x05,0x16,0x05,0x02,0x06,0x06,0x16,0x05,0x02,0x07,
+0x06,0x16,0x05,0x02,0x07,0x08,0x16,0x04,0x02,0x08,0x08,0x15,0x05,0x02,0x09,0x09,
+0x15,0x04,0x01,0x0A,0x0E,0x01,0x0C,0x0B,0x01,0x0D,0x0A,0x01,0x10,0x08,0x01,0x11,
+0x08,0x01,0x13,0x07,0x01,0x14,0x06,0x01,0x15,0x06,0x01,0x16,0x05,0x82,0x02,0x06,
+0x01,0x16,0x05,0x02,0x06,0x03,0x15,0x05,0x02,0x06,0x06,0x13,0x07,0x01,0x06,0x13,
+0x01,0x06,0x12,0x01,0x08,0x0E,0x01,0x0B,0x09,0x11,0x09,0x01,0x02,0x1C,0x88,0x00,
+0x35,0x01,0x0F,0x02,0x81,0x01,0x0E,0x04,0x01,0x0D,0x06,0x81,0x01,0x0C,0x08,0x01,
+0x0A,0x0C,0x03,0x09,0x04,0x0E,0x04,0x13,0x04,0x03,0x08,0x04,0x0E,0x04,0x14,0x04,
+0x03,0x08,0x03,0x0E,0x04,0x15,0x03,0x03,0x08,0x01,0x0E,0x04,0x17,0x01,0x01,0x0E,
+0x04,0x97,0x03,0x08,0x01,0x0E,0x04,0x17,0x01,0x03,0x08,0x03,0x0E,0x04,0x15,0x03,
+0x03,0x08,0x04,0x0E,0x04,0x14,0x04,0x03,0x09,0x04,0x0E,0x04,0x13,0x04,0x01,0x0A,
+0x0C,0x01,0x0C,0x08,0x01,0x0D,0x06,0x81,0x01,0x0E,0x04,0x01,0x0F,0x02,0x81,0x00,
+0x82,0x01,0x08,0x10,0x83,0x04,0x2E,0x01,0x0F,0x02,0x81,0x01,0x0E,0x04,0x01,0x0D,
+0x06,0x81,0x01,0x0C,0x08,0x01,0x0A,0x0C,0x01,0x09,0x0E,0x03,0x08,0x04,0x0E,0x04,
+0x14,0x04,0x03,0x08,0x03,0x0E,0x04,0x15,0x03,0x01,0x0E,0x04,0xA3,0x04,0x2E,0x01,
+0x0E,0x04,0xA3,0x03,0x08,0x03,0x0E,0x04,0x15,0x03,0x03,0x08,0x04,0x0E,0x04,0x14,
+0x04,0x03,0x09,0x04,0x0E,0x04,0x13,0x04,0x01,0x0A,0x0C,0x01,0x0C,0x08,0x01,0x0D,
+0x06,0x81,0x01,0x0E,0x04,0x01,0x0F,0x02,0x81,0x13,0x10,0x01,0x13,0x03,0x01,0x14,
+0x03,0x01,0x14,0x04,0x01,0x15,0x04,0x01,0x15,0x05,0x01,0x16,0x05,0x01,0x02,0x1A,
+0x01,0x02,0x1C,0x81,0x01,0x02,0x1A,0x01,0x16,0x05,0x01,0x15,0x05,0x01,0x15,0x04,
+0x01,0x14,0x04,0x01,0x14,0x03,0x01,0x13,0x03,0x13,0x10,0x01,0x0A,0x03,0x01,0x09,
+0x03,0x01,0x08,0x04,0x01,0x07,0x04,0x01,0x06,0x05,0x01,0x05,0x05,0x01,0x04,0x1A,
+0x01,0x02,0x1C,0x81,0x01,0x04,0x1A,0x01,0x05,0x05,0x01,0x06,0x05,0x01,0x07,0x04,
+0x01,0x08,0x04,0x01,0x09,0x03,0x01,0x0A,0x03,0x0F,0x1B,0x01,0x02,0x04,0x96,0x01,
+0x02,0x1C,0x83,0x13,0x10,0x02,0x0A,0x03,0x13,0x03,0x02,0x09,0x03,0x14,0x03,0x02,
+0x08,0x04,0x14,0x04,0x02,0x07,0x04,0x15,0x04,0x02,0x06,0x05,0x15,0x05,0x02,0x05,
+0x05,0x16,0x05,0x01,0x04,0x18,0x01,0x02,0x1C,0x81,0x01,0x04,0x18,0x02,0x05,0x05,
+0x16,0x05,0x02,0x06,0x05,0x15,0x05,0x02,0x07,0x04,0x15,0x04,0x02,0x08,0x04,0x14,
+0x04,0x02,0x09,0x03,0x14,0x03,0x02,0x0A,0x03,0x13,0x03,0x0B,0x1F,0x01,0x0F,0x01,
+0x81,0x01,0x0E,0x03,0x81,0x01,0x0D,0x05,0x81,0x01,0x0C,0x07,0x81,0x01,0x0C,0x08,
+0x01,0x0B,0x09,0x01,0x0B,0x0A,0x01,0x0A,0x0B,0x01,0x0A,0x0C,0x01,0x09,0x0D,0x01,
+0x09,0x0E,0x01,0x08,0x0F,0x01,0x08,0x10,0x01,0x07,0x11,0x01,0x07,0x12,0x01,0x06,
+0x13,0x01,0x06,0x14,0x01,0x05,0x15,0x01,0x05,0x16,0x81,0x01,0x04,0x18,0x81,0x01,
+0x03,0x1A,0x81,0x01,0x02,0x1C,0x81,0x01,0x01,0x1E,0x0B,0x1F,0x01,0x01,0x1E,0x01,
+0x02,0x1C,0x81,0x01,0x03,0x1A,0x81,0x01,0x04,0x18,0x81,0x01,0x05,0x16,0x81,0x01,
+0x05,0x15,0x01,0x06,0x14,0x01,0x06,0x13,0x01,0x07,0x12,0x01,0x07,0x11,0x01,0x08,
+0x10,0x01,0x08,0x0F,0x01,0x09,0x0E,0x01,0x09,0x0D,0x01,0x0A,0x0C,0x01,0x0A,0x0B,
+0x01,0x0B,0x0A,0x01,0x0B,0x09,0x01,0x0C,0x08,0x01,0x0C,0x07,0x81,0x01,0x0D,0x05,
+0x81,0x01,0x0E,0x03,0x81,0x01,0x0F,0x01,0x81,0xFF,0x04,0x26,0x01,0x0D,0x05,0x96,
+0x01,0x0D,0x04,0x01,0x0E,0x03,0x82,0x00,0x84,0x01,0x0C,0x07,0x85,0x01,0x0E,0x02,
+0x06,0x06,0x13,0x06,0x84,0x02,0x07,0x04,0x14,0x04,0x88,0x04,0x26,0x02,0x0E,0x04,
+0x18,0x04,0x81,0x02,0x0D,0x04,0x17,0x04,0x83,0x02,0x0C,0x04,0x16,0x04,0x82,0x02,
+0x0B,0x04,0x15,0x04,0x81,0x01,0x05,0x1A,0x01,0x04,0x1B,0x81,0x01,0x04,0x1A,0x02,
+0x0A,0x04,0x14,0x04,0x81,0x02,0x09,0x04,0x13,0x04,0x82,0x02,0x08,0x04,0x12,0x04,
+0x81,0x01,0x02,0x1B,0x01,0x01,0x1C,0x01,0x01,0x1B,0x81,0x02,0x07,0x04,0x11,0x04,
+0x81,0x02,0x06,0x04,0x10,0x04,0x83,0x02,0x05,0x04,0x0F,0x04,0x83,0x02,0x04,0x04,
+0x0E,0x04,0x81,0x01,0x2C,0x01,0x0F,0x03,0x82,0x01,0x0C,0x0A,0x01,0x0A,0x0F,0x01,
+0x09,0x11,0x01,0x08,0x12,0x03,0x07,0x06,0x0F,0x03,0x16,0x04,0x03,0x07,0x05,0x0F,
+0x03,0x19,0x01,0x02,0x06,0x06,0x0F,0x03,0x02,0x06,0x05,0x0F,0x03,0x83,0x02,0x06,
+0x06,0x0F,0x03,0x02,0x07,0x05,0x0F,0x03,0x02,0x07,0x06,0x0F,0x03,0x02,0x08,0x06,
+0x0F,0x03,0x01,0x09,0x09,0x01,0x0A,0x08,0x01,0x0B,0x08,0x01,0x0C,0x08,0x01,0x0D,
+0x09,0x01,0x0F,0x08,0x01,0x0F,0x09,0x01,0x0F,0x0A,0x02,0x0F,0x03,0x13,0x07,0x02,
+0x0F,0x03,0x14,0x06,0x02,0x0F,0x03,0x15,0x06,0x02,0x0F,0x03,0x16,0x05,0x84,0x02,
+0x0F,0x03,0x15,0x05,0x03,0x05,0x03,0x0F,0x03,0x15,0x05,0x03,0x05,0x06,0x0F,0x03,
+0x13,0x06,0x01,0x05,0x14,0x01,0x05,0x13,0x01,0x07,0x0F,0x01,0x0A,0x0A,0x01,0x0F,
+0x03,0x82,0x03,0x28,0x01,0x1C,0x04,0x02,0x05,0x06,0x1B,0x04,0x02,0x03,0x0A,0x1A,
+0x04,0x02,0x02,0x0C,0x1A,0x04,0x03,0x01,0x05,0x0A,0x05,0x19,0x04,0x03,0x01,0x04,
+0x0B,0x04,0x18,0x04,0x03,0x01,0x04,0x0B,0x04,0x17,0x04,0x03,0x00,0x04,0x0C,0x04,
+0x17,0x04,0x03,0x00,0x04,0x0C,0x04,0x16,0x04,0x03,0x00,0x04,0x0C,0x04,0x15,0x04,
+0x81,0x03,0x00,0x04,0x0C,0x04,0x14,0x04,0x03,0x00,0x04,0x0C,0x04,0x13,0x04,0x03,
+0x01,0x04,0x0B,0x04,0x13,0x04,0x03,0x01,0x04,0x0B,0x04,0x12,0x04,0x03,0x02,0x04,
+0x0A,0x04,0x11,0x04,0x02,0x02,0x0C,0x10,0x04,0x02,0x03,0x0A,0x10,0x04,0x02,0x05,
+0x06,0x0F,0x04,0x01,0x0E,0x04,0x81,0x02,0x0D,0x04,0x15,0x06,0x02,0x0C,0x04,0x13,
+0x0A,0x02,0x0C,0x04,0x12,0x0C,0x03,0x0B,0x04,0x12,0x04,0x1A,0x04,0x03,0x0A,0x04,
+0x11,0x04,0x1B,0x04,0x03,0x09,0x04,0x11,0x04,0x1B,0x04,0x03,0x09,0x04,0x10,0x04,
+0x1C,0x04,0x03,0x08,0x04,0x10,0x04,0x1C,0x04,0x03,0x07,0x04,0x10,0x04,0x1C,0x04,
+0x81,0x03,0x06,0x04,0x10,0x04,0x1C,0x04,0x03,0x05,0x04,0x10,0x04,0x1C,0x04,0x03,
+0x05,0x04,0x11,0x04,0x1B,0x04,0x03,0x04,0x04,0x11,0x04,0x1B,0x04,0x03,0x03,0x04,
+0x12,0x04,0x1A,0x04,0x02,0x02,0x04,0x12,0x0C,0x02,0x02,0x04,0x13,0x0A,0x02,0x01,
+0x04,0x15,0x06,0x01,0x00,0x04,0x03,0x28,0x01,0x0D,0x07,0x01,0x0B,0x0B,0x01,0x0A,
+0x0D,0x01,0x09,0x0F,0x02,0x09,0x06,0x12,0x06,0x02,0x08,0x06,0x13,0x06,0x02,0x08,
+0x05,0x14,0x05,0x83,0x02,0x08,0x05,0x13,0x05,0x02,0x08,0x06,0x13,0x05,0x02,0x09,
+0x05,0x12,0x05,0x02,0x09,0x05,0x10,0x06,0x01,0x09,0x0C,0x01,0x0A,0x0A,0x01,0x0A,
+0x08,0x01,0x08,0x09,0x01,0x06,0x0B,0x02,0x05,0x0C,0x1B,0x05,0x03,0x04,0x06,0x0C,
+0x06,0x1B,0x05,0x03,0x03,0x06,0x0D,0x05,0x1B,0x05,0x03,0x02,0x06,0x0D,0x06,0x1B,
+0x05,0x03,0x02,0x05,0x0E,0x06,0x1B,0x04,0x03,0x01,0x05,0x0E,0x06,0x1B,0x04,0x03,
+0x01,0x05,0x0F,0x06,0x1B,0x04,0x03,0x01,0x05,0x10,0x06,0x1A,0x05,0x03,0x01,0x05,
+0x10,0x07,0x1A,0x04,0x03,0x01,0x05,0x11,0x06,0x1A,0x04,0x03,0x01,0x05,0x12,0x06,
+0x19,0x05,0x02,0x01,0x06,0x12,0x0B,0x02,0x01,0x06,0x13,0x09,0x02,0x02,0x06,0x14,
+0x08,0x02,0x02,0x07,0x15,0x06,0x02,0x03,0x07,0x14,0x08,0x02,0x04,0x07,0x11,0x0C,
+0x01,0x04,0x1A,0x02,0x06,0x10,0x18,0x07,0x02,0x07,0x0D,0x19,0x07,0x01,0x0A,0x07,
+0x01,0x10,0x01,0x0C,0x08,0x85,0x01,0x0D,0x06,0x89,0x01,0x31,0x01,0x19,0x03,0x01,
+0x16,0x06,0x01,0x14,0x08,0x01,0x13,0x09,0x01,0x11,0x09,0x01,0x10,0x08,0x01,0x0F,
+0x07,0x01,0x0F,0x05,0x01,0x0E,0x05,0x01,0x0D,0x06,0x01,0x0D,0x05,0x01,0x0C,0x05,
+0x01,0x0B,0x06,0x01,0x0B,0x05,0x81,0x01,0x0A,0x05,0x83,0x01,0x09,0x05,0x8A,0x01,
+0x0A,0x05,0x83,0x01,0x0B,0x05,0x81,0x01,0x0B,0x06,0x01,0x0C,0x05,0x01,0x0D,0x05,
+0x01,0x0D,0x06,0x01,0x0E,0x05,0x01,0x0F,0x05,0x01,0x0F,0x07,0x01,0x10,0x08,0x01,
+0x11,0x09,0x01,0x13,0x09,0x01,0x14,0x08,0x01,0x16,0x06,0x01,0x19,0x03,0x01,0x31,
+0x01,0x04,0x03,0x01,0x04,0x06,0x01,0x04,0x08,0x01,0x04,0x09,0x01,0x06,0x09,0x01,
+0x08,0x08,0x01,0x0A,0x07,0x01,0x0C,0x05,0x01,0x0D,0x05,0x01,0x0D,0x06,0x01,0x0E,
+0x06,0x01,0x0F,0x05,0x01,0x0F,0x06,0x01,0x10,0x05,0x81,0x01,0x11,0x05,0x83,0x01,
+0x12,0x05,0x8A,0x01,0x11,0x05,0x83,0x01,0x10,0x05,0x81,0x01,0x0F,0x06,0x01,0x0F,
+0x05,0x01,0x0E,0x05,0x01,0x0D,0x06,0x01,0x0D,0x05,0x01,0x0C,0x05,0x01,0x0A,0x07,
+0x01,0x08,0x08,0x01,0x06,0x09,0x01,0x04,0x09,0x01,0x04,0x08,0x01,0x04,0x06,0x01,
+0x04,0x03,0x04,0x16,0x01,0x0D,0x05,0x84,0x03,0x05,0x01,0x0E,0x03,0x19,0x01,0x03,
+0x05,0x03,0x0E,0x03,0x17,0x03,0x03,0x05,0x05,0x0E,0x03,0x15,0x05,0x02,0x05,0x07,
+0x13,0x07,0x02,0x04,0x09,0x12,0x09,0x02,0x05,0x07,0x13,0x07,0x02,0x0A,0x02,0x13,
+0x02,0x00,0x02,0x0C,0x01,0x12,0x01,0x02,0x0B,0x04,0x10,0x04,0x02,0x0A,0x04,0x11,
+0x04,0x02,0x09,0x05,0x11,0x05,0x02,0x08,0x05,0x12,0x05,0x02,0x07,0x06,0x12,0x06,
+0x02,0x07,0x05,0x13,0x05,0x02,0x08,0x03,0x14,0x03,0x02,0x0A,0x01,0x14,0x01,0x0F,
+0x1B,0x01,0x0E,0x04,0x8A,0x01,0x02,0x1C,0x83,0x01,0x0E,0x04,0x8B,0x22,0x10,0x01,
+0x0C,0x07,0x87,0x01,0x0F,0x04,0x81,0x01,0x0F,0x03,0x81,0x01,0x0E,0x04,0x01,0x0C,
+0x05,0x01,0x0C,0x04,0x01,0x0C,0x02,0x18,0x04,0x01,0x05,0x16,0x83,0x22,0x08,0x01,
+0x0C,0x08,0x87,0x01,0x31,0x01,0x1A,0x04,0x01,0x19,0x04,0x81,0x01,0x18,0x04,0x81,
+0x01,0x17,0x04,0x81,0x01,0x16,0x04,0x81,0x01,0x15,0x04,0x81,0x01,0x14,0x04,0x81,
+0x01,0x13,0x04,0x81,0x01,0x12,0x04,0x81,0x01,0x11,0x04,0x81,0x01,0x10,0x04,0x81,
+0x01,0x0F,0x04,0x81,0x01,0x0E,0x04,0x82,0x01,0x0D,0x04,0x81,0x01,0x0C,0x04,0x81,
+0x01,0x0B,0x04,0x81,0x01,0x0A,0x04,0x81,0x01,0x09,0x04,0x81,0x01,0x08,0x04,0x81,
+0x01,0x07,0x04,0x81,0x01,0x06,0x04,0x81,0x01,0x05,0x04,0x81,0x01,0x04,0x04,0x81,
+0x01,0x03,0x04,0x81,0x01,0x02,0x04,0x03,0x28,0x01,0x0D,0x06,0x01,0x0A,0x0C,0x01,
+0x09,0x0E,0x01,0x08,0x10,0x02,0x07,0x06,0x13,0x06,0x02,0x06,0x06,0x14,0x06,0x02,
+0x06,0x05,0x15,0x05,0x02,0x05,0x05,0x16,0x05,0x81,0x02,0x05,0x04,0x17,0x04,0x02,
+0x04,0x05,0x17,0x05,0x82,0x02,0x04,0x04,0x18,0x04,0x02,0x03,0x05,0x18,0x05,0x8B,
+0x02,0x04,0x04,0x18,0x04,0x02,0x04,0x05,0x17,0x05,0x82,0x02,0x05,0x04,0x17,0x04,
+0x02,0x05,0x05,0x16,0x05,0x81,0x02,0x06,0x05,0x15,0x05,0x02,0x06,0x06,0x14,0x06,
+0x02,0x07,0x06,0x13,0x06,0x01,0x08,0x10,0x01,0x09,0x0E,0x01,0x0A,0x0C,0x01,0x0D,
+0x06,0x03,0x27,0x01,0x12,0x02,0x01,0x0F,0x05,0x01,0x0C,0x08,0x01,0x09,0x0B,0x01,
+0x06,0x0E,0x01,0x05,0x0F,0x02,0x05,0x06,0x0F,0x05,0x02,0x05,0x02,0x0F,0x05,0x01,
+0x0F,0x05,0x9A,0x01,0x05,0x19,0x83,0x03,0x27,0x01,0x0A,0x08,0x01,0x06,0x0E,0x01,
+0x05,0x11,0x01,0x05,0x12,0x02,0x05,0x05,0x10,0x07,0x02,0x05,0x02,0x12,0x06,0x01,
+0x13,0x05,0x01,0x13,0x06,0x01,0x14,0x05,0x85,0x01,0x13,0x05,0x81,0x01,0x12,0x05,
+0x81,0x01,0x11,0x05,0x01,0x10,0x05,0x01,0x0F,0x05,0x01,0x0E,0x05,0x01,0x0D,0x05,
+0x01,0x0C,0x05,0x01,0x0B,0x05,0x01,0x0A,0x05,0x81,0x01,0x09,0x05,0x01,0x08,0x05,
+0x01,0x07,0x05,0x81,0x01,0x06,0x05,0x01,0x05,0x06,0x01,0x05,0x05,0x01,0x04,0x06,
+0x01,0x04,0x15,0x83,0x03,0x28,0x01,0x0B,0x09,0x01,0x07,0x0F,0x01,0x07,0x11,0x81,
+0x02,0x07,0x04,0x12,0x07,0x02,0x07,0x01,0x14,0x06,0x01,0x14,0x06,0x01,0x15,0x05,
+0x84,0x01,0x14,0x05,0x81,0x01,0x12,0x06,0x01,0x11,0x06,0x01,0x0A,0x0B,0x01,0x0A,
+0x0A,0x01,0x0A,0x0B,0x01,0x0A,0x0D,0x01,0x10,0x08,0x01,0x13,0x06,0x01,0x14,0x06,
+0x01,0x15,0x05,0x81,0x01,0x16,0x05,0x85,0x01,0x15,0x06,0x01,0x15,0x05,0x01,0x14,
+0x06,0x02,0x06,0x01,0x13,0x06,0x02,0x06,0x04,0x11,0x08,0x01,0x06,0x12,0x01,0x06,
+0x11,0x01,0x06,0x0F,0x01,0x09,0x09,0x04,0x26,0x01,0x13,0x05,0x01,0x12,0x06,0x01,
+0x11,0x07,0x81,0x01,0x10,0x08,0x01,0x0F,0x09,0x81,0x01,0x0E,0x0A,0x02,0x0D,0x05,
+0x13,0x05,0x02,0x0D,0x04,0x13,0x05,0x02,0x0C,0x05,0x13,0x05,0x02,0x0B,0x05,0x13,
+0x05,0x02,0x0B,0x04,0x13,0x05,0x02,0x0A,0x04,0x13,0x05,0x02,0x09,0x05,0x13,0x05,
+0x02,0x09,0x04,0x13,0x05,0x02,0x08,0x04,0x13,0x05,0x02,0x07,0x05,0x13,0x05,0x02,
+0x07,0x04,0x13,0x05,0x02,0x06,0x04,0x13,0x05,0x02,0x05,0x05,0x13,0x05,0x02,0x04,
+0x05,0x13,0x05,0x02,0x04,0x04,0x13,0x05,0x02,0x03,0x05,0x13,0x05,0x01,0x03,0x1A,
+0x83,0x01,0x13,0x05,0x89,0x04,0x27,0x01,0x08,0x12,0x84,0x01,0x08,0x04,0x89,0x01,
+0x08,0x09,0x01,0x08,0x0C,0x01,0x08,0x0E,0x01,0x08,0x0F,0x01,0x0F,0x09,0x01,0x12,
+0x07,0x01,0x14,0x06,0x01,0x15,0x05,0x81,0x01,0x16,0x05,0x85,0x01,0x15,0x06,0x01,
+0x15,0x05,0x01,0x14,0x06,0x02,0x07,0x01,0x13,0x06,0x02,0x07,0x04,0x11,0x07,0x01,
+0x07,0x11,0x01,0x07,0x0F,0x01,0x07,0x0E,0x01,0x0A,0x08,0x03,0x28,0x01,0x0F,0x08,
+0x01,0x0D,0x0E,0x01,0x0B,0x10,0x01,0x0A,0x11,0x02,0x09,0x07,0x17,0x04,0x02,0x08,
+0x06,0x1A,0x01,0x01,0x08,0x05,0x01,0x07,0x05,0x01,0x06,0x06,0x01,0x06,0x05,0x81,
+0x01,0x05,0x05,0x82,0x01,0x05,0x04,0x02,0x04,0x05,0x0F,0x06,0x02,0x04,0x05,0x0D,
+0x0A,0x02,0x04,0x05,0x0B,0x0E,0x02,0x04,0x05,0x0A,0x10,0x03,0x04,0x05,0x0A,0x04,
+0x13,0x08,0x02,0x04,0x08,0x15,0x06,0x02,0x04,0x07,0x16,0x06,0x02,0x04,0x07,0x17,
+0x05,0x02,0x04,0x06,0x17,0x06,0x02,0x04,0x06,0x18,0x05,0x82,0x02,0x05,0x05,0x18,
+0x05,0x83,0x02,0x06,0x04,0x17,0x05,0x02,0x06,0x05,0x17,0x05,0x02,0x06,0x06,0x16,
+0x06,0x02,0x07,0x06,0x15,0x06,0x02,0x08,0x06,0x14,0x06,0x01,0x08,0x11,0x01,0x09,
+0x0F,0x01,0x0B,0x0C,0x01,0x0D,0x08,0x04,0x26,0x01,0x05,0x17,0x84,0x01,0x17,0x04,
+0x01,0x16,0x05,0x01,0x16,0x04,0x01,0x15,0x05,0x01,0x15,0x04,0x01,0x14,0x04,0x01,
+0x13,0x05,0x01,0x13,0x04,0x01,0x12,0x05,0x01,0x12,0x04,0x01,0x11,0x05,0x01,0x11,
+0x04,0x01,0x10,0x05,0x01,0x0F,0x05,0x81,0x01,0x0E,0x05,0x81,0x01,0x0D,0x05,0x81,
+0x01,0x0C,0x05,0x01,0x0B,0x06,0x01,0x0B,0x05,0x01,0x0A,0x06,0x81,0x01,0x09,0x06,
+0x81,0x01,0x09,0x05,0x01,0x08,0x06,0x82,0x01,0x07,0x06,0x82,0x03,0x28,0x01,0x0D,
+0x07,0x01,0x0A,0x0D,0x01,0x09,0x0F,0x01,0x08,0x11,0x02,0x07,0x07,0x12,0x07,0x02,
+0x07,0x05,0x14,0x06,0x02,0x06,0x05,0x14,0x06,0x02,0x06,0x05,0x15,0x05,0x83,0x02,
+0x06,0x06,0x15,0x04,0x02,0x06,0x06,0x14,0x05,0x02,0x07,0x06,0x14,0x05,0x02,0x07,
+0x07,0x13,0x05,0x02,0x08,0x08,0x12,0x05,0x01,0x09,0x0D,0x01,0x0A,0x0B,0x01,0x0B,
+0x0A,0x01,0x09,0x0D,0x01,0x08,0x10,0x02,0x07,0x06,0x10,0x09,0x02,0x06,0x06,0x11,
+0x09,0x02,0x06,0x05,0x13,0x07,0x02,0x05,0x05,0x14,0x07,0x02,0x05,0x05,0x15,0x06,
+0x02,0x04,0x05,0x16,0x06,0x81,0x02,0x04,0x05,0x17,0x05,0x83,0x02,0x04,0x06,0x16,
+0x05,0x02,0x05,0x06,0x16,0x05,0x02,0x05,0x07,0x15,0x06,0x02,0x06,0x07,0x13,0x07,
+0x01,0x07,0x12,0x01,0x08,0x10,0x01,0x09,0x0D,0x01,0x0C,0x08,0x03,0x28,0x01,0x0C,
+0x08,0x01,0x0A,0x0C,0x01,0x09,0x0F,0x01,0x08,0x11,0x02,0x07,0x06,0x13,0x06,0x02,
+0x06,0x06,0x14,0x06,0x02,0x05,0x06,0x15,0x06,0x02,0x05,0x05,0x16,0x05,0x02,0x05,
+0x05,0x17,0x04,0x02,0x04,0x05,0x17,0x05,0x83,0x02,0x04,0x05,0x17,0x06,0x82,0x02,
+0x04,0x06,0x17,0x06,0x02,0x05,0x05,0x16,0x07,0x02,0x05,0x06,0x16,0x07,0x02,0x06,
+0x06,0x15,0x08,0x03,0x06,0x08,0x13,0x04,0x18,0x05,0x02,0x07,0x10,0x18,0x05,0x02,
+0x08,0x0E,0x18,0x05,0x02,0x0A,0x0A,0x18,0x05,0x02,0x0C,0x06,0x18,0x05,0x01,0x18,
+0x04,0x01,0x17,0x05,0x82,0x01,0x16,0x05,0x81,0x01,0x15,0x06,0x01,0x15,0x05,0x01,
+0x14,0x05,0x02,0x06,0x01,0x13,0x06,0x02,0x06,0x04,0x11,0x07,0x01,0x06,0x11,0x01,
+0x06,0x10,0x01,0x06,0x0E,0x01,0x0A,0x08,0x0E,0x1C,0x01,0x0C,0x08,0x87,0x00,0x8B,
+0x01,0x0C,0x08,0x87,0x0E,0x24,0x01,0x0C,0x08,0x87,0x00,0x8B,0x01,0x0C,0x08,0x87,
+0x01,0x0F,0x05,0x01,0x0F,0x04,0x81,0x01,0x0E,0x05,0x01,0x0E,0x04,0x01,0x0C,0x06,
+0x01,0x0C,0x05,0x01,0x0C,0x03,0x0F,0x1B,0x01,0x1D,0x01,0x01,0x1B,0x03,0x01,0x19,
+0x05,0x01,0x17,0x07,0x01,0x15,0x08,0x01,0x13,0x08,0x01,0x11,0x08,0x01,0x0E,0x09,
+0x01,0x0C,0x09,0x01,0x0A,0x09,0x01,0x08,0x09,0x01,0x06,0x09,0x01,0x04,0x09,0x01,
+0x02,0x09,0x01,0x04,0x09,0x01,0x06,0x09,0x01,0x08,0x09,0x01,0x0A,0x09,0x01,0x0C,
+0x09,0x01,0x0E,0x09,0x01,0x11,0x08,0x01,0x13,0x08,0x01,0x15,0x08,0x01,0x17,0x07,
+0x01,0x19,0x05,0x01,0x1B,0x03,0x01,0x1D,0x01,0x15,0x0E,0x01,0x02,0x1C,0x83,0x00,
+0x85,0x01,0x02,0x1C,0x83,0x0F,0x1B,0x01,0x02,0x01,0x01,0x02,0x03,0x01,0x02,0x05,
+0x01,0x02,0x07,0x01,0x03,0x08,0x01,0x05,0x08,0x01,0x07,0x08,0x01,0x09,0x09,0x01,
+0x0B,0x09,0x01,0x0D,0x09,0x01,0x0F,0x09,0x01,0x11,0x09,0x01,0x13,0x09,0x01,0x15,
+0x09,0x01,0x13,0x09,0x01,0x11,0x09,0x01,0x0F,0x09,0x01,0x0D,0x09,0x01,0x0B,0x09,
+0x01,0x09,0x09,0x01,0x07,0x08,0x01,0x05,0x08,0x01,0x03,0x08,0x01,0x02,0x07,0x01,
+0x02,0x05,0x01,0x02,0x03,0x01,0x02,0x01,0x03,0x27,0x01,0x08,0x0C,0x01,0x04,0x13,
+0x01,0x04,0x15,0x01,0x04,0x16,0x02,0x04,0x05,0x13,0x08,0x02,0x04,0x04,0x15,0x06,
+0x02,0x04,0x04,0x16,0x06,0x02,0x04,0x04,0x17,0x05,0x81,0x01,0x17,0x05,0x81,0x01,
+0x16,0x05,0x81,0x01,0x15,0x05,0x01,0x14,0x05,0x01,0x13,0x05,0x01,0x11,0x06,0x01,
+0x10,0x06,0x01,0x0F,0x05,0x01,0x0E,0x05,0x01,0x0D,0x05,0x01,0x0C,0x05,0x81,0x01,
+0x0C,0x04,0x01,0x0B,0x05,0x83,0x00,0x84,0x01,0x0A,0x07,0x85,0x03,0x28,0x01,0x0F,
+0x07,0x01,0x0C,0x0D,0x01,0x0A,0x10,0x02,0x09,0x06,0x15,0x06,0x02,0x08,0x05,0x17,
+0x05,0x02,0x07,0x05,0x18,0x04,0x02,0x06,0x05,0x18,0x04,0x02,0x06,0x04,0x19,0x04,
+0x03,0x05,0x04,0x13,0x05,0x19,0x04,0x02,0x04,0x05,0x11,0x0C,0x02,0x04,0x04,0x10,
+0x0D,0x03,0x04,0x04,0x0F,0x05,0x18,0x05,0x03,0x03,0x04,0x0F,0x04,0x19,0x04,0x03,
+0x03,0x04,0x0E,0x04,0x19,0x04,0x03,0x03,0x04,0x0D,0x04,0x19,0x04,0x03,0x02,0x05,
+0x0D,0x04,0x19,0x04,0x03,0x02,0x04,0x0D,0x04,0x19,0x04,0x03,0x02,0x04,0x0D,0x03,
+0x19,0x04,0x03,0x02,0x04,0x0C,0x04,0x18,0x05,0x82,0x03,0x02,0x04,0x0C,0x04,0x17,
+0x06,0x81,0x03,0x02,0x04,0x0C,0x04,0x16,0x07,0x81,0x04,0x02,0x04,0x0C,0x04,0x15,
+0x03,0x19,0x04,0x04,0x02,0x05,0x0C,0x05,0x14,0x04,0x19,0x04,0x04,0x03,0x04,0x0D,
+0x04,0x13,0x04,0x19,0x04,0x03,0x03,0x04,0x0D,0x0A,0x19,0x04,0x03,0x03,0x04,0x0E,
+0x08,0x19,0x07,0x03,0x04,0x04,0x0E,0x07,0x19,0x07,0x03,0x04,0x04,0x10,0x04,0x19,
+0x07,0x01,0x05,0x04,0x01,0x05,0x05,0x01,0x06,0x05,0x02,0x07,0x05,0x18,0x01,0x02,
+0x08,0x06,0x15,0x04,0x01,0x09,0x10,0x01,0x0B,0x0E,0x01,0x0D,0x08,0x09,0x21,0x01,
+0x0D,0x06,0x81,0x01,0x0C,0x08,0x82,0x02,0x0B,0x04,0x10,0x05,0x81,0x02,0x0A,0x05,
+0x10,0x06,0x02,0x0A,0x04,0x11,0x05,0x81,0x02,0x09,0x05,0x12,0x05,0x02,0x09,0x04,
+0x12,0x05,0x02,0x08,0x05,0x12,0x06,0x02,0x08,0x04,0x13,0x05,0x81,0x02,0x07,0x05,
+0x14,0x05,0x02,0x07,0x04,0x14,0x05,0x02,0x06,0x05,0x14,0x06,0x02,0x06,0x05,0x15,
+0x05,0x02,0x06,0x04,0x15,0x05,0x02,0x05,0x05,0x16,0x05,0x01,0x05,0x16,0x01,0x04,
+0x18,0x81,0x01,0x03,0x1A,0x02,0x03,0x05,0x18,0x05,0x81,0x02,0x02,0x05,0x18,0x06,
+0x02,0x02,0x05,0x19,0x05,0x02,0x01,0x06,0x19,0x06,0x02,0x01,0x05,0x1A,0x05,0x81,
+0x02,0x00,0x06,0x1A,0x06,0x09,0x21,0x01,0x05,0x10,0x01,0x05,0x13,0x01,0x05,0x15,
+0x01,0x05,0x16,0x02,0x05,0x05,0x14,0x07,0x02,0x05,0x05,0x16,0x06,0x02,0x05,0x05,
+0x17,0x05,0x83,0x02,0x05,0x05,0x16,0x05,0x02,0x05,0x05,0x15,0x05,0x02,0x05,0x05,
+0x12,0x07,0x01,0x05,0x13,0x01,0x05,0x11,0x01,0x05,0x12,0x01,0x05,0x14,0x02,0x05,
+0x05,0x11,0x09,0x02,0x05,0x05,0x14,0x07,0x02,0x05,0x05,0x16,0x06,0x02,0x05,0x05,
+0x17,0x05,0x02,0x05,0x05,0x17,0x06,0x02,0x05,0x05,0x18,0x05,0x83,0x02,0x05,0x05,
+0x17,0x06,0x02,0x05,0x05,0x17,0x05,0x02,0x05,0x05,0x14,0x08,0x01,0x05,0x16,0x01,
+0x05,0x15,0x01,0x05,0x14,0x01,0x05,0x11,0x08,0x23,0x01,0x10,0x0A,0x01,0x0D,0x11,
+0x01,0x0B,0x13,0x01,0x09,0x15,0x02,0x08,0x09,0x19,0x05,0x02,0x07,0x07,0x1C,0x02,
+0x01,0x06,0x07,0x01,0x06,0x06,0x01,0x05,0x06,0x01,0x05,0x05,0x01,0x04,0x06,0x01,
+0x04,0x05,0x81,0x01,0x03,0x05,0x88,0x01,0x04,0x05,0x81,0x01,0x04,0x06,0x01,0x05,
+0x05,0x01,0x05,0x06,0x01,0x06,0x06,0x01,0x06,0x07,0x02,0x07,0x08,0x1D,0x01,0x02,
+0x08,0x09,0x1A,0x04,0x01,0x09,0x15,0x01,0x0B,0x13,0x01,0x0D,0x10,0x01,0x10,0x09,
+0x09,0x21,0x01,0x03,0x0F,0x01,0x03,0x12,0x01,0x03,0x14,0x01,0x03,0x15,0x02,0x03,
+0x05,0x11,0x08,0x02,0x03,0x05,0x13,0x07,0x02,0x03,0x05,0x15,0x06,0x02,0x03,0x05,
+0x16,0x05,0x02,0x03,0x05,0x16,0x06,0x02,0x03,0x05,0x17,0x05,0x81,0x02,0x03,0x05,
+0x17,0x06,0x02,0x03,0x05,0x18,0x05,0x88,0x02,0x03,0x05,0x17,0x05,0x82,0x02,0x03,
+0x05,0x16,0x05,0x81,0x02,0x03,0x05,0x15,0x05,0x02,0x03,0x05,0x13,0x07,0x02,0x03,
+0x05,0x10,0x09,0x01,0x03,0x15,0x01,0x03,0x14,0x01,0x03,0x12,0x01,0x03,0x0E,0x09,
+0x21,0x01,0x06,0x17,0x83,0x01,0x06,0x05,0x89,0x01,0x06,0x14,0x83,0x01,0x06,0x05,
+0x8A,0x01,0x06,0x18,0x83,0x09,0x21,0x01,0x06,0x18,0x83,0x01,0x06,0x05,0x8A,0x01,
+0x06,0x15,0x83,0x01,0x06,0x05,0x8D,0x08,0x23,0x01,0x0F,0x0A,0x01,0x0C,0x11,0x01,
+0x0A,0x13,0x01,0x08,0x15,0x02,0x07,0x09,0x18,0x05,0x02,0x06,0x07,0x1B,0x02,0x01,
+0x05,0x07,0x01,0x05,0x06,0x01,0x04,0x06,0x01,0x04,0x05,0x01,0x03,0x06,0x01,0x03,
+0x05,0x81,0x01,0x02,0x05,0x84,0x02,0x02,0x05,0x12,0x0B,0x83,0x02,0x03,0x05,0x18,
+0x05,0x81,0x02,0x03,0x06,0x18,0x05,0x02,0x04,0x05,0x18,0x05,0x02,0x04,0x06,0x18,
+0x05,0x02,0x05,0x06,0x18,0x05,0x02,0x05,0x07,0x18,0x05,0x02,0x06,0x08,0x18,0x05,
+0x02,0x07,0x0A,0x18,0x05,0x01,0x08,0x15,0x01,0x0A,0x13,0x01,0x0C,0x11,0x01,0x0F,
+0x09,0x09,0x21,0x02,0x04,0x05,0x17,0x05,0x8D,0x01,0x04,0x18,0x83,0x02,0x04,0x05,
+0x17,0x05,0x8E,0x09,0x21,0x01,0x04,0x17,0x83,0x01,0x0D,0x05,0x98,0x01,0x04,0x17,
+0x83,0x09,0x22,0x01,0x08,0x10,0x83,0x01,0x13,0x05,0x95,0x01,0x12,0x05,0x81,0x01,
+0x11,0x06,0x02,0x06,0x04,0x10,0x06,0x01,0x06,0x0F,0x81,0x01,0x06,0x0D,0x01,0x09,
+0x08,0x09,0x21,0x02,0x04,0x05,0x16,0x06,0x02,0x04,0x05,0x15,0x06,0x02,0x04,0x05,
+0x15,0x05,0x02,0x04,0x05,0x14,0x05,0x02,0x04,0x05,0x13,0x05,0x02,0x04,0x05,0x12,
+0x05,0x02,0x04,0x05,0x11,0x05,0x02,0x04,0x05,0x10,0x06,0x02,0x04,0x05,0x10,0x05,
+0x02,0x04,0x05,0x0F,0x05,0x02,0x04,0x05,0x0E,0x05,0x02,0x04,0x05,0x0D,0x05,0x02,
+0x04,0x05,0x0C,0x05,0x02,0x04,0x05,0x0B,0x06,0x02,0x04,0x05,0x0A,0x06,0x02,0x04,
+0x05,0x0A,0x05,0x01,0x04,0x0C,0x02,0x04,0x05,0x0A,0x07,0x02,0x04,0x05,0x0B,0x06,
+0x02,0x04,0x05,0x0C,0x06,0x02,0x04,0x05,0x0D,0x06,0x02,0x04,0x05,0x0E,0x06,0x02,
+0x04,0x05,0x0F,0x06,0x02,0x04,0x05,0x10,0x06,0x02,0x04,0x05,0x11,0x06,0x02,0x04,
+0x05,0x11,0x07,0x02,0x04,0x05,0x12,0x07,0x02,0x04,0x05,0x13,0x07,0x02,0x04,0x05,
+0x14,0x07,0x02,0x04,0x05,0x15,0x07,0x02,0x04,0x05,0x16,0x07,0x02,0x04,0x05,0x17,
+0x07,0x02,0x04,0x05,0x18,0x07,0x09,0x21,0x01,0x06,0x05,0x9C,0x01,0x06,0x17,0x83,
+0x09,0x21,0x02,0x02,0x07,0x17,0x06,0x02,0x02,0x07,0x16,0x07,0x81,0x02,0x02,0x08,
+0x16,0x07,0x02,0x02,0x08,0x15,0x08,0x81,0x03,0x02,0x09,0x15,0x03,0x19,0x04,0x04,
+0x02,0x04,0x07,0x04,0x14,0x04,0x19,0x04,0x04,0x02,0x04,0x07,0x05,0x14,0x04,0x19,
+0x04,0x04,0x02,0x04,0x08,0x04,0x14,0x03,0x19,0x04,0x04,0x02,0x04,0x08,0x04,0x13,
+0x04,0x19,0x04,0x04,0x02,0x04,0x08,0x05,0x13,0x04,0x19,0x04,0x04,0x02,0x04,0x09,
+0x04,0x12,0x04,0x19,0x04,0x81,0x04,0x02,0x04,0x09,0x05,0x12,0x04,0x19,0x04,0x04,
+0x02,0x04,0x0A,0x04,0x11,0x04,0x19,0x04,0x81,0x04,0x02,0x04,0x0A,0x05,0x11,0x04,
+0x19,0x04,0x04,0x02,0x04,0x0B,0x04,0x10,0x04,0x19,0x04,0x81,0x03,0x02,0x04,0x0B,
+0x08,0x19,0x04,0x03,0x02,0x04,0x0C,0x07,0x19,0x04,0x81,0x03,0x02,0x04,0x0C,0x06,
+0x19,0x04,0x03,0x02,0x04,0x0D,0x05,0x19,0x04,0x81,0x02,0x02,0x04,0x19,0x04,0x86,
+0x09,0x21,0x02,0x04,0x05,0x18,0x04,0x02,0x04,0x06,0x18,0x04,0x81,0x02,0x04,0x07,
+0x18,0x04,0x81,0x02,0x04,0x08,0x18,0x04,0x02,0x04,0x09,0x18,0x04,0x81,0x02,0x04,
+0x0A,0x18,0x04,0x03,0x04,0x04,0x09,0x06,0x18,0x04,0x81,0x03,0x04,0x04,0x0A,0x06,
+0x18,0x04,0x03,0x04,0x04,0x0B,0x06,0x18,0x04,0x81,0x03,0x04,0x04,0x0C,0x06,0x18,
+0x04,0x03,0x04,0x04,0x0D,0x05,0x18,0x04,0x03,0x04,0x04,0x0D,0x06,0x18,0x04,0x03,
+0x04,0x04,0x0E,0x06,0x18,0x04,0x81,0x03,0x04,0x04,0x0F,0x06,0x18,0x04,0x03,0x04,
+0x04,0x10,0x06,0x18,0x04,0x81,0x03,0x04,0x04,0x11,0x06,0x18,0x04,0x03,0x04,0x04,
+0x12,0x05,0x18,0x04,0x02,0x04,0x04,0x12,0x0A,0x02,0x04,0x04,0x13,0x09,0x81,0x02,
+0x04,0x04,0x14,0x08,0x02,0x04,0x04,0x15,0x07,0x81,0x02,0x04,0x04,0x16,0x06,0x02,
+0x04,0x04,0x17,0x05,0x81,0x08,0x23,0x01,0x0C,0x08,0x01,0x0A,0x0C,0x01,0x08,0x10,
+0x01,0x07,0x12,0x02,0x06,0x07,0x13,0x07,0x02,0x05,0x06,0x15,0x06,0x02,0x05,0x05,
+0x16,0x05,0x02,0x04,0x05,0x17,0x05,0x81,0x02,0x03,0x05,0x18,0x05,0x82,0x02,0x02,
+0x05,0x19,0x05,0x8A,0x02,0x03,0x05,0x18,0x05,0x82,0x02,0x04,0x05,0x17,0x05,0x81,
+0x02,0x05,0x05,0x16,0x05,0x02,0x05,0x06,0x15,0x06,0x02,0x06,0x07,0x13,0x07,0x01,
+0x07,0x12,0x01,0x08,0x10,0x01,0x0A,0x0C,0x01,0x0C,0x08,0x09,0x21,0x01,0x06,0x11,
+0x01,0x06,0x14,0x01,0x06,0x15,0x01,0x06,0x16,0x02,0x06,0x05,0x15,0x08,0x02,0x06,
+0x05,0x17,0x06,0x02,0x06,0x05,0x18,0x06,0x02,0x06,0x05,0x19,0x05,0x84,0x02,0x06,
+0x05,0x18,0x05,0x02,0x06,0x05,0x17,0x06,0x02,0x06,0x05,0x16,0x07,0x02,0x06,0x05,
+0x13,0x09,0x01,0x06,0x15,0x01,0x06,0x13,0x01,0x06,0x11,0x01,0x06,0x0E,0x01,0x06,
+0x05,0x8C,0x08,0x2B,0x01,0x0C,0x08,0x01,0x0A,0x0C,0x01,0x08,0x10,0x01,0x07,0x12,
+0x02,0x06,0x07,0x13,0x07,0x02,0x05,0x06,0x15,0x06,0x02,0x05,0x05,0x16,0x05,0x02,
+0x04,0x05,0x17,0x05,0x81,0x02,0x03,0x05,0x18,0x05,0x82,0x02,0x02,0x05,0x19,0x05,
+0x8A,0x02,0x03,0x05,0x18,0x05,0x82,0x02,0x04,0x05,0x17,0x05,0x81,0x02,0x05,0x05,
+0x16,0x05,0x02,0x05,0x06,0x15,0x06,0x02,0x06,0x07,0x13,0x07,0x01,0x07,0x12,0x01,
+0x08,0x10,0x01,0x0A,0x0C,0x01,0x0C,0x0B,0x01,0x12,0x07,0x01,0x13,0x08,0x01,0x14,
+0x09,0x01,0x16,0x0A,0x01,0x17,0x08,0x01,0x19,0x06,0x01,0x1A,0x04,0x01,0x1C,0x02,
+0x09,0x21,0x01,0x05,0x10,0x01,0x05,0x12,0x01,0x05,0x14,0x01,0x05,0x15,0x02,0x05,
+0x05,0x13,0x07,0x02,0x05,0x05,0x15,0x06,0x02,0x05,0x05,0x16,0x05,0x84,0x02,0x05,
+0x05,0x15,0x05,0x02,0x05,0x05,0x14,0x06,0x02,0x05,0x05,0x13,0x06,0x02,0x05,0x05,
+0x11,0x07,0x01,0x05,0x12,0x01,0x05,0x11,0x01,0x05,0x0F,0x81,0x02,0x05,0x05,0x0F,
+0x06,0x02,0x05,0x05,0x10,0x06,0x02,0x05,0x05,0x10,0x07,0x02,0x05,0x05,0x11,0x06,
+0x02,0x05,0x05,0x12,0x06,0x02,0x05,0x05,0x13,0x06,0x02,0x05,0x05,0x13,0x07,0x02,
+0x05,0x05,0x14,0x06,0x02,0x05,0x05,0x15,0x06,0x02,0x05,0x05,0x16,0x06,0x02,0x05,
+0x05,0x16,0x07,0x02,0x05,0x05,0x17,0x06,0x02,0x05,0x05,0x18,0x06,0x02,0x05,0x05,
+0x19,0x06,0x08,0x23,0x01,0x0B,0x0A,0x01,0x09,0x10,0x01,0x07,0x13,0x01,0x06,0x14,
+0x02,0x05,0x07,0x14,0x06,0x02,0x05,0x05,0x18,0x02,0x01,0x04,0x05,0x84,0x01,0x04,
+0x06,0x01,0x05,0x07,0x01,0x05,0x09,0x01,0x06,0x0A,0x01,0x07,0x0C,0x01,0x08,0x0E,
+0x01,0x0A,0x0E,0x01,0x0C,0x0D,0x01,0x0F,0x0B,0x01,0x12,0x09,0x01,0x14,0x07,0x01,
+0x16,0x06,0x81,0x01,0x17,0x05,0x83,0x02,0x04,0x01,0x16,0x05,0x02,0x04,0x04,0x15,
+0x06,0x02,0x04,0x07,0x13,0x07,0x01,0x04,0x15,0x01,0x04,0x14,0x01,0x06,0x10,0x01,
+0x0A,0x09,0x09,0x21,0x01,0x01,0x1E,0x83,0x01,0x0E,0x05,0x9C,0x09,0x22,0x02,0x04,
+0x05,0x18,0x05,0x98,0x02,0x05,0x05,0x17,0x05,0x81,0x02,0x05,0x06,0x16,0x06,0x02,
+0x06,0x06,0x15,0x06,0x02,0x06,0x07,0x14,0x07,0x01,0x07,0x13,0x01,0x08,0x11,0x01,
+0x0A,0x0D,0x01,0x0C,0x09,0x09,0x21,0x02,0x00,0x06,0x1B,0x05,0x02,0x01,0x05,0x1B,
+0x04,0x02,0x01,0x05,0x1A,0x05,0x02,0x01,0x06,0x1A,0x05,0x02,0x02,0x05,0x1A,0x04,
+0x02,0x02,0x06,0x19,0x05,0x02,0x03,0x05,0x19,0x04,0x02,0x03,0x05,0x18,0x05,0x02,
+0x03,0x06,0x18,0x04,0x02,0x04,0x05,0x17,0x05,0x02,0x04,0x06,0x17,0x05,0x02,0x05,
+0x05,0x17,0x04,0x02,0x05,0x05,0x16,0x05,0x02,0x05,0x06,0x16,0x04,0x02,0x06,0x05,
+0x15,0x05,0x02,0x06,0x06,0x15,0x04,0x02,0x06,0x06,0x14,0x05,0x02,0x07,0x05,0x14,
+0x05,0x02,0x07,0x06,0x13,0x05,0x02,0x08,0x05,0x13,0x05,0x02,0x08,0x06,0x13,0x04,
+0x02,0x08,0x06,0x12,0x05,0x02,0x09,0x06,0x12,0x04,0x02,0x09,0x06,0x11,0x05,0x02,
+0x0A,0x05,0x11,0x05,0x01,0x0A,0x0B,0x81,0x01,0x0B,0x09,0x81,0x01,0x0C,0x07,0x82,
+0x01,0x0D,0x05,0x09,0x21,0x02,0x00,0x05,0x1C,0x04,0x82,0x02,0x01,0x04,0x1B,0x04,
+0x83,0x03,0x01,0x05,0x0E,0x05,0x1B,0x04,0x03,0x01,0x05,0x0D,0x06,0x1B,0x04,0x03,
+0x01,0x05,0x0D,0x06,0x1A,0x04,0x03,0x02,0x04,0x0D,0x07,0x1A,0x04,0x81,0x03,0x02,
+0x04,0x0C,0x08,0x1A,0x04,0x03,0x02,0x05,0x0C,0x08,0x1A,0x04,0x03,0x02,0x05,0x0C,
+0x09,0x1A,0x04,0x04,0x02,0x05,0x0C,0x03,0x10,0x05,0x19,0x04,0x04,0x03,0x04,0x0B,
+0x04,0x11,0x04,0x19,0x04,0x82,0x04,0x03,0x04,0x0A,0x04,0x11,0x05,0x19,0x04,0x04,
+0x03,0x05,0x0A,0x04,0x12,0x04,0x19,0x04,0x04,0x03,0x05,0x0A,0x04,0x12,0x04,0x18,
+0x04,0x81,0x04,0x04,0x04,0x09,0x04,0x12,0x05,0x18,0x04,0x04,0x04,0x04,0x09,0x04,
+0x13,0x04,0x18,0x04,0x81,0x04,0x04,0x04,0x09,0x04,0x13,0x04,0x18,0x03,0x02,0x04,
+0x09,0x13,0x08,0x02,0x04,0x08,0x14,0x07,0x02,0x05,0x07,0x14,0x07,0x82,0x02,0x05,
+0x06,0x15,0x05,0x09,0x21,0x02,0x01,0x07,0x1A,0x05,0x02,0x02,0x06,0x19,0x05,0x02,
+0x03,0x06,0x18,0x05,0x02,0x04,0x06,0x17,0x05,0x02,0x04,0x07,0x17,0x05,0x02,0x05,
+0x06,0x16,0x05,0x02,0x06,0x06,0x15,0x05,0x02,0x07,0x06,0x14,0x05,0x02,0x07,0x07,
+0x13,0x05,0x02,0x08,0x06,0x13,0x05,0x02,0x09,0x06,0x12,0x05,0x02,0x0A,0x06,0x11,
+0x05,0x01,0x0A,0x0B,0x01,0x0B,0x0A,0x01,0x0C,0x08,0x01,0x0D,0x06,0x01,0x0D,0x07,
+0x01,0x0C,0x08,0x01,0x0B,0x0A,0x01,0x0B,0x0B,0x02,0x0A,0x05,0x10,0x07,0x02,0x09,
+0x05,0x11,0x06,0x02,0x08,0x05,0x12,0x06,0x02,0x08,0x05,0x13,0x06,0x02,0x07,0x05,
+0x13,0x07,0x02,0x06,0x05,0x14,0x06,0x02,0x05,0x05,0x15,0x06,0x02,0x04,0x05,0x16,
+0x06,0x02,0x04,0x05,0x16,0x07,0x02,0x03,0x05,0x17,0x06,0x02,0x02,0x05,0x18,0x06,
+0x02,0x01,0x05,0x19,0x06,0x02,0x00,0x05,0x19,0x07,0x09,0x21,0x02,0x01,0x06,0x1B,
+0x05,0x02,0x02,0x06,0x1A,0x05,0x02,0x03,0x06,0x19,0x05,0x81,0x02,0x04,0x06,0x18,
+0x05,0x02,0x05,0x05,0x17,0x05,0x02,0x05,0x06,0x17,0x05,0x02,0x06,0x06,0x16,0x05,
+0x02,0x07,0x05,0x15,0x05,0x02,0x07,0x06,0x15,0x05,0x02,0x08,0x06,0x14,0x05,0x02,
+0x09,0x05,0x13,0x05,0x02,0x09,0x06,0x13,0x05,0x02,0x0A,0x06,0x12,0x05,0x02,0x0B,
+0x05,0x11,0x05,0x01,0x0B,0x0B,0x01,0x0C,0x09,0x01,0x0D,0x07,0x81,0x01,0x0E,0x05,
+0x8D,0x09,0x21,0x01,0x04,0x1A,0x83,0x01,0x18,0x06,0x01,0x17,0x06,0x01,0x16,0x06,
+0x01,0x15,0x06,0x01,0x14,0x06,0x01,0x13,0x06,0x01,0x13,0x05,0x01,0x12,0x06,0x01,
+0x11,0x06,0x01,0x10,0x06,0x01,0x0F,0x06,0x01,0x0E,0x06,0x01,0x0E,0x05,0x01,0x0D,
+0x06,0x01,0x0C,0x06,0x01,0x0B,0x06,0x01,0x0A,0x06,0x01,0x09,0x06,0x01,0x08,0x06,
+0x01,0x08,0x05,0x01,0x07,0x06,0x01,0x06,0x06,0x01,0x05,0x06,0x01,0x04,0x06,0x01,
+0x03,0x06,0x01,0x03,0x1B,0x83,0x01,0x31,0x01,0x0B,0x10,0x83,0x01,0x0B,0x04,0xA8,
+0x01,0x0B,0x10,0x83,0x01,0x31,0x01,0x02,0x04,0x01,0x03,0x04,0x81,0x01,0x04,0x04,
+0x81,0x01,0x05,0x04,0x81,0x01,0x06,0x04,0x81,0x01,0x07,0x04,0x81,0x01,0x08,0x04,
+0x81,0x01,0x09,0x04,0x81,0x01,0x0A,0x04,0x81,0x01,0x0B,0x04,0x81,0x01,0x0C,0x04,
+0x81,0x01,0x0D,0x04,0x81,0x01,0x0E,0x04,0x82,0x01,0x0F,0x04,0x81,0x01,0x10,0x04,
+0x81,0x01,0x11,0x04,0x81,0x01,0x12,0x04,0x81,0x01,0x13,0x04,0x81,0x01,0x14,0x04,
+0x81,0x01,0x15,0x04,0x81,0x01,0x16,0x04,0x81,0x01,0x17,0x04,0x81,0x01,0x18,0x04,
+0x81,0x01,0x19,0x04,0x81,0x01,0x1A,0x04,0x01,0x31,0x01,0x04,0x10,0x83,0x01,0x10,
+0x04,0xA8,0x01,0x04,0x10,0x83,0x04,0x1E,0x01,0x0F,0x01,0x81,0x01,0x0E,0x03,0x81,
+0x01,0x0D,0x05,0x81,0x01,0x0D,0x06,0x01,0x0C,0x07,0x01,0x0C,0x08,0x02,0x0B,0x04,
+0x10,0x04,0x02,0x0B,0x04,0x10,0x05,0x02,0x0A,0x05,0x11,0x04,0x02,0x0A,0x04,0x11,
+0x05,0x02,0x09,0x05,0x12,0x04,0x02,0x09,0x04,0x12,0x05,0x02,0x09,0x04,0x13,0x04,
+0x02,0x08,0x04,0x13,0x04,0x02,0x08,0x04,0x14,0x04,0x02,0x07,0x04,0x14,0x04,0x02,
+0x07,0x04,0x15,0x04,0x02,0x06,0x04,0x15,0x04,0x02,0x06,0x04,0x16,0x04,0x02,0x05,
+0x04,0x16,0x04,0x02,0x05,0x04,0x17,0x04,0x02,0x04,0x05,0x17,0x04,0x02,0x04,0x04,
+0x18,0x04,0x81,0x02,0x03,0x04,0x19,0x04,0x81,0x02,0x02,0x04,0x1A,0x04,0x2A,0x04,
+0x01,0x00,0x20,0x83,0x00,0x06,0x01,0x0B,0x06,0x01,0x0C,0x06,0x01,0x0D,0x06,0x01,
+0x0F,0x05,0x01,0x10,0x05,0x01,0x11,0x05,0x0E,0x1D,0x01,0x0A,0x0A,0x01,0x07,0x0F,
+0x01,0x05,0x12,0x01,0x05,0x13,0x02,0x05,0x05,0x11,0x07,0x02,0x05,0x02,0x13,0x06,
+0x01,0x13,0x06,0x01,0x14,0x05,0x84,0x01,0x0C,0x0D,0x01,0x09,0x10,0x01,0x07,0x12,
+0x02,0x06,0x07,0x14,0x05,0x02,0x05,0x05,0x14,0x05,0x02,0x04,0x05,0x14,0x05,0x02,
+0x04,0x04,0x14,0x05,0x02,0x03,0x05,0x14,0x05,0x82,0x02,0x03,0x05,0x13,0x06,0x02,
+0x03,0x06,0x12,0x07,0x02,0x04,0x06,0x10,0x0A,0x02,0x04,0x10,0x15,0x09,0x02,0x05,
+0x0E,0x15,0x09,0x02,0x06,0x0B,0x16,0x08,0x02,0x08,0x07,0x18,0x05,0x01,0x2A,0x01,
+0x04,0x05,0x8C,0x02,0x04,0x05,0x0F,0x06,0x02,0x04,0x05,0x0D,0x0A,0x02,0x04,0x05,
+0x0C,0x0C,0x02,0x04,0x05,0x0B,0x0E,0x03,0x04,0x05,0x0A,0x05,0x13,0x07,0x02,0x04,
+0x09,0x15,0x05,0x02,0x04,0x07,0x16,0x05,0x02,0x04,0x06,0x16,0x05,0x81,0x02,0x04,
+0x05,0x17,0x05,0x89,0x02,0x04,0x05,0x16,0x05,0x81,0x02,0x04,0x05,0x15,0x06,0x02,
+0x04,0x06,0x15,0x05,0x02,0x04,0x08,0x14,0x06,0x02,0x04,0x09,0x12,0x07,0x02,0x04,
+0x05,0x0A,0x0E,0x02,0x04,0x04,0x0B,0x0C,0x02,0x04,0x04,0x0C,0x0A,0x01,0x0E,0x06,
+0x0E,0x1D,0x01,0x0E,0x09,0x01,0x0B,0x10,0x01,0x09,0x12,0x01,0x08,0x13,0x02,0x07,
+0x08,0x17,0x04,0x02,0x06,0x07,0x1A,0x01,0x01,0x06,0x06,0x01,0x05,0x06,0x01,0x05,
+0x05,0x81,0x01,0x04,0x06,0x01,0x04,0x05,0x86,0x01,0x04,0x06,0x01,0x05,0x05,0x81,
+0x01,0x05,0x06,0x01,0x06,0x06,0x02,0x06,0x07,0x1B,0x01,0x02,0x07,0x09,0x18,0x04,
+0x01,0x08,0x14,0x01,0x0A,0x12,0x01,0x0B,0x11,0x01,0x0E,0x0A,0x01,0x2A,0x01,0x16,
+0x05,0x8C,0x02,0x0B,0x07,0x16,0x05,0x02,0x09,0x0B,0x16,0x05,0x02,0x08,0x0D,0x16,
+0x05,0x01,0x07,0x14,0x02,0x06,0x07,0x12,0x09,0x02,0x05,0x06,0x13,0x08,0x02,0x05,
+0x05,0x15,0x06,0x02,0x04,0x06,0x16,0x05,0x02,0x04,0x05,0x16,0x05,0x81,0x02,0x03,
+0x05,0x16,0x05,0x89,0x02,0x04,0x05,0x15,0x06,0x02,0x04,0x05,0x14,0x07,0x02,0x04,
+0x05,0x13,0x08,0x02,0x05,0x05,0x12,0x09,0x03,0x05,0x07,0x10,0x05,0x16,0x05,0x02,
+0x06,0x0E,0x16,0x05,0x02,0x07,0x0C,0x16,0x05,0x02,0x08,0x0A,0x16,0x05,0x01,0x0A,
+0x06,0x0E,0x1D,0x01,0x0D,0x08,0x01,0x0B,0x0C,0x01,0x09,0x0F,0x01,0x08,0x11,0x02,
+0x07,0x07,0x13,0x07,0x02,0x07,0x05,0x15,0x05,0x02,0x06,0x05,0x16,0x05,0x02,0x05,
+0x05,0x16,0x05,0x02,0x05,0x05,0x17,0x04,0x02,0x05,0x05,0x17,0x05,0x02,0x04,0x05,
+0x17,0x05,0x81,0x01,0x04,0x18,0x83,0x01,0x04,0x05,0x82,0x01,0x05,0x05,0x81,0x01,
+0x05,0x06,0x01,0x06,0x06,0x02,0x06,0x07,0x1B,0x01,0x02,0x07,0x08,0x17,0x05,0x01,
+0x08,0x14,0x01,0x09,0x13,0x01,0x0B,0x10,0x01,0x0E,0x09,0x00,0x2A,0x01,0x12,0x0A,
+0x01,0x10,0x0F,0x01,0x0E,0x11,0x01,0x0D,0x12,0x02,0x0C,0x08,0x1C,0x03,0x01,0x0C,
+0x06,0x01,0x0C,0x05,0x01,0x0B,0x06,0x01,0x0B,0x05,0x86,0x01,0x03,0x1B,0x83,0x01,
+0x0B,0x05,0x96,0x0E,0x27,0x02,0x0B,0x07,0x17,0x05,0x02,0x09,0x0B,0x17,0x05,0x02,
+0x08,0x0E,0x17,0x05,0x01,0x07,0x15,0x02,0x06,0x07,0x12,0x0A,0x02,0x05,0x06,0x14,
+0x08,0x02,0x05,0x05,0x16,0x06,0x02,0x04,0x06,0x17,0x05,0x02,0x04,0x05,0x17,0x05,
+0x81,0x02,0x03,0x05,0x17,0x05,0x88,0x02,0x04,0x05,0x16,0x06,0x81,0x02,0x04,0x06,
+0x15,0x07,0x02,0x05,0x06,0x13,0x09,0x03,0x05,0x07,0x11,0x05,0x17,0x05,0x02,0x06,
+0x0F,0x17,0x05,0x02,0x07,0x0D,0x17,0x05,0x02,0x08,0x0B,0x17,0x05,0x02,0x0A,0x07,
+0x17,0x05,0x01,0x17,0x05,0x81,0x01,0x16,0x05,0x81,0x01,0x15,0x06,0x02,0x06,0x01,
+0x14,0x06,0x02,0x05,0x05,0x12,0x07,0x01,0x05,0x14,0x01,0x05,0x12,0x01,0x05,0x11,
+0x01,0x09,0x0A,0x01,0x29,0x01,0x05,0x05,0x8C,0x02,0x05,0x05,0x10,0x07,0x02,0x05,
+0x05,0x0E,0x0B,0x02,0x05,0x05,0x0D,0x0D,0x02,0x05,0x05,0x0C,0x0F,0x02,0x05,0x05,
+0x0B,0x10,0x02,0x05,0x0B,0x15,0x07,0x02,0x05,0x09,0x16,0x06,0x02,0x05,0x08,0x17,
+0x05,0x02,0x05,0x07,0x17,0x05,0x02,0x05,0x06,0x17,0x05,0x02,0x05,0x05,0x17,0x05,
+0x91,0x02,0x28,0x01,0x0F,0x06,0x85,0x00,0x85,0x01,0x05,0x0F,0x83,0x01,0x0F,0x05,
+0x97,0x02,0x33,0x01,0x11,0x06,0x85,0x00,0x85,0x01,0x06,0x10,0x83,0x01,0x11,0x05,
+0x9A,0x01,0x11,0x04,0x01,0x10,0x05,0x02,0x03,0x01,0x10,0x05,0x02,0x03,0x04,0x0E,
+0x06,0x01,0x03,0x11,0x01,0x03,0x10,0x01,0x03,0x0F,0x01,0x06,0x09,0x01,0x29,0x01,
+0x06,0x05,0x8C,0x02,0x06,0x05,0x17,0x06,0x02,0x06,0x05,0x16,0x06,0x02,0x06,0x05,
+0x15,0x06,0x02,0x06,0x05,0x14,0x06,0x02,0x06,0x05,0x13,0x06,0x02,0x06,0x05,0x12,
+0x06,0x02,0x06,0x05,0x11,0x06,0x02,0x06,0x05,0x10,0x06,0x02,0x06,0x05,0x10,0x05,
+0x02,0x06,0x05,0x0F,0x05,0x02,0x06,0x05,0x0E,0x05,0x02,0x06,0x05,0x0D,0x05,0x02,
+0x06,0x05,0x0C,0x05,0x01,0x06,0x0C,0x02,0x06,0x05,0x0C,0x06,0x02,0x06,0x05,0x0D,
+0x06,0x02,0x06,0x05,0x0E,0x06,0x02,0x06,0x05,0x0F,0x06,0x02,0x06,0x05,0x10,0x06,
+0x02,0x06,0x05,0x11,0x06,0x02,0x06,0x05,0x11,0x07,0x02,0x06,0x05,0x12,0x07,0x02,
+0x06,0x05,0x13,0x07,0x02,0x06,0x05,0x14,0x07,0x02,0x06,0x05,0x15,0x07,0x02,0x06,
+0x05,0x16,0x07,0x02,0x06,0x05,0x17,0x07,0x02,0x06,0x05,0x18,0x07,0x01,0x29,0x01,
+0x04,0x10,0x83,0x01,0x0F,0x05,0xA4,0x0E,0x1C,0x03,0x02,0x04,0x0A,0x04,0x16,0x04,
+0x03,0x02,0x04,0x09,0x06,0x14,0x07,0x03,0x02,0x04,0x08,0x08,0x13,0x09,0x03,0x02,
+0x04,0x07,0x09,0x12,0x0A,0x04,0x02,0x08,0x0C,0x05,0x12,0x03,0x18,0x05,0x03,0x02,
+0x07,0x0D,0x07,0x19,0x04,0x03,0x02,0x06,0x0D,0x06,0x19,0x04,0x03,0x02,0x05,0x0D,
+0x06,0x19,0x04,0x03,0x02,0x05,0x0D,0x05,0x19,0x04,0x03,0x02,0x04,0x0D,0x04,0x19,
+0x04,0x92,0x0E,0x1C,0x02,0x05,0x05,0x10,0x07,0x02,0x05,0x05,0x0E,0x0B,0x02,0x05,
+0x05,0x0D,0x0D,0x02,0x05,0x05,0x0C,0x0F,0x02,0x05,0x05,0x0B,0x10,0x02,0x05,0x0B,
+0x15,0x07,0x02,0x05,0x09,0x16,0x06,0x02,0x05,0x08,0x17,0x05,0x02,0x05,0x07,0x17,
+0x05,0x02,0x05,0x06,0x17,0x05,0x02,0x05,0x05,0x17,0x05,0x91,0x0E,0x1D,0x01,0x0C,
+0x08,0x01,0x09,0x0E,0x01,0x08,0x10,0x01,0x07,0x12,0x02,0x06,0x07,0x13,0x07,0x02,
+0x05,0x06,0x15,0x06,0x02,0x05,0x05,0x16,0x05,0x02,0x04,0x06,0x16,0x06,0x02,0x04,
+0x05,0x17,0x05,0x81,0x02,0x03,0x05,0x18,0x05,0x88,0x02,0x04,0x05,0x17,0x05,0x81,
+0x02,0x04,0x06,0x16,0x06,0x02,0x05,0x05,0x16,0x05,0x02,0x05,0x06,0x15,0x06,0x02,
+0x06,0x07,0x13,0x07,0x01,0x07,0x12,0x01,0x08,0x10,0x01,0x09,0x0E,0x01,0x0C,0x08,
+0x0E,0x26,0x02,0x05,0x05,0x10,0x06,0x02,0x05,0x05,0x0E,0x0A,0x02,0x05,0x05,0x0C,
+0x0D,0x02,0x05,0x05,0x0B,0x0F,0x03,0x05,0x05,0x0B,0x05,0x14,0x07,0x02,0x05,0x09,
+0x16,0x05,0x02,0x05,0x07,0x17,0x05,0x02,0x05,0x06,0x17,0x05,0x81,0x02,0x05,0x05,
+0x18,0x05,0x89,0x02,0x05,0x05,0x17,0x05,0x81,0x02,0x05,0x05,0x16,0x06,0x02,0x05,
+0x06,0x16,0x05,0x02,0x05,0x08,0x15,0x06,0x02,0x05,0x09,0x13,0x07,0x01,0x05,0x14,
+0x02,0x05,0x05,0x0B,0x0D,0x02,0x05,0x05,0x0C,0x0B,0x02,0x05,0x05,0x0E,0x07,0x01,
+0x05,0x05,0x88,0x0E,0x26,0x02,0x0B,0x07,0x17,0x04,0x02,0x09,0x0B,0x17,0x04,0x02,
+0x08,0x0D,0x16,0x05,0x01,0x07,0x14,0x02,0x06,0x07,0x12,0x09,0x02,0x05,0x06,0x13,
+0x08,0x02,0x05,0x05,0x15,0x06,0x02,0x04,0x06,0x16,0x05,0x02,0x04,0x05,0x16,0x05,
+0x81,0x02,0x03,0x05,0x16,0x05,0x89,0x02,0x04,0x05,0x15,0x06,0x81,0x02,0x04,0x05,
+0x14,0x07,0x02,0x05,0x05,0x12,0x09,0x03,0x05,0x07,0x10,0x05,0x16,0x05,0x02,0x06,
+0x0E,0x16,0x05,0x02,0x07,0x0C,0x16,0x05,0x02,0x08,0x0A,0x16,0x05,0x02,0x0A,0x06,
+0x16,0x05,0x01,0x16,0x05,0x88,0x0E,0x1C,0x02,0x08,0x05,0x14,0x08,0x02,0x08,0x05,
+0x12,0x0B,0x02,0x08,0x05,0x10,0x0D,0x02,0x08,0x05,0x0F,0x0E,0x03,0x08,0x05,0x0E,
+0x06,0x19,0x04,0x02,0x08,0x0A,0x19,0x04,0x02,0x08,0x08,0x19,0x04,0x02,0x08,0x07,
+0x19,0x04,0x02,0x08,0x06,0x19,0x04,0x01,0x08,0x06,0x01,0x08,0x05,0x91,0x0E,0x1D,
+0x01,0x0C,0x0A,0x01,0x0A,0x10,0x01,0x08,0x12,0x01,0x07,0x13,0x02,0x07,0x07,0x16,
+0x04,0x01,0x06,0x06,0x01,0x06,0x05,0x82,0x01,0x06,0x06,0x01,0x06,0x08,0x01,0x07,
+0x0A,0x01,0x08,0x0C,0x01,0x09,0x0E,0x01,0x0B,0x0E,0x01,0x0E,0x0C,0x01,0x11,0x0A,
+0x01,0x14,0x07,0x01,0x16,0x06,0x01,0x17,0x05,0x82,0x01,0x16,0x06,0x02,0x05,0x03,
+0x15,0x06,0x02,0x05,0x06,0x13,0x08,0x01,0x05,0x15,0x01,0x05,0x14,0x01,0x06,0x11,
+0x01,0x0A,0x0A,0x09,0x22,0x01,0x0A,0x05,0x85,0x01,0x03,0x18,0x83,0x01,0x0A,0x05,
+0x91,0x01,0x0B,0x05,0x02,0x0B,0x07,0x1B,0x01,0x01,0x0B,0x11,0x01,0x0C,0x10,0x01,
+0x0D,0x0F,0x01,0x10,0x0B,0x0E,0x1D,0x02,0x05,0x05,0x17,0x05,0x92,0x02,0x05,0x05,
+0x16,0x06,0x02,0x05,0x05,0x15,0x07,0x02,0x05,0x05,0x14,0x08,0x02,0x05,0x06,0x13,
+0x09,0x02,0x05,0x07,0x11,0x0B,0x02,0x06,0x10,0x17,0x05,0x02,0x06,0x0F,0x17,0x05,
+0x02,0x07,0x0D,0x17,0x05,0x02,0x08,0x0B,0x17,0x05,0x01,0x0A,0x07,0x0E,0x1C,0x02,
+0x02,0x06,0x18,0x06,0x02,0x03,0x05,0x18,0x05,0x81,0x02,0x03,0x06,0x17,0x06,0x02,
+0x04,0x05,0x17,0x05,0x02,0x04,0x05,0x16,0x06,0x02,0x05,0x05,0x16,0x05,0x81,0x02,
+0x05,0x06,0x15,0x05,0x02,0x06,0x05,0x15,0x05,0x02,0x06,0x05,0x14,0x06,0x02,0x07,
+0x05,0x14,0x05,0x81,0x02,0x07,0x05,0x13,0x05,0x02,0x08,0x05,0x13,0x05,0x02,0x08,
+0x05,0x13,0x04,0x02,0x08,0x06,0x12,0x05,0x02,0x09,0x05,0x12,0x05,0x02,0x09,0x05,
+0x11,0x05,0x02,0x0A,0x05,0x11,0x05,0x02,0x0A,0x05,0x11,0x04,0x01,0x0A,0x0B,0x01,
+0x0B,0x09,0x81,0x01,0x0C,0x08,0x01,0x0C,0x07,0x81,0x01,0x0D,0x05,0x0E,0x1C,0x02,
+0x00,0x05,0x1C,0x04,0x81,0x02,0x00,0x05,0x1C,0x03,0x03,0x01,0x04,0x0E,0x05,0x1B,
+0x04,0x03,0x01,0x05,0x0D,0x06,0x1B,0x04,0x81,0x03,0x01,0x05,0x0D,0x07,0x1B,0x04,
+0x03,0x01,0x05,0x0D,0x07,0x1B,0x03,0x03,0x02,0x04,0x0C,0x08,0x1A,0x04,0x04,0x02,
+0x04,0x0C,0x03,0x11,0x03,0x1A,0x04,0x04,0x02,0x05,0x0C,0x03,0x11,0x04,0x1A,0x04,
+0x81,0x04,0x02,0x05,0x0B,0x04,0x11,0x04,0x1A,0x03,0x04,0x03,0x04,0x0B,0x03,0x12,
+0x03,0x19,0x04,0x04,0x03,0x04,0x0B,0x03,0x12,0x04,0x19,0x04,0x04,0x03,0x04,0x0A,
+0x04,0x12,0x04,0x19,0x04,0x04,0x03,0x05,0x0A,0x04,0x12,0x04,0x19,0x04,0x04,0x03,
+0x05,0x0A,0x03,0x13,0x03,0x19,0x03,0x04,0x03,0x05,0x0A,0x03,0x13,0x04,0x19,0x03,
+0x04,0x04,0x04,0x09,0x04,0x13,0x04,0x18,0x04,0x04,0x04,0x04,0x09,0x03,0x13,0x04,
+0x18,0x04,0x03,0x04,0x08,0x14,0x03,0x18,0x04,0x02,0x04,0x08,0x14,0x07,0x81,0x02,
+0x05,0x06,0x14,0x07,0x02,0x05,0x06,0x15,0x06,0x81,0x02,0x05,0x06,0x15,0x05,0x0E,
+0x1C,0x02,0x02,0x07,0x17,0x06,0x02,0x03,0x06,0x17,0x05,0x02,0x04,0x06,0x16,0x05,
+0x02,0x05,0x06,0x15,0x06,0x02,0x05,0x07,0x15,0x05,0x02,0x06,0x07,0x14,0x05,0x02,
+0x07,0x06,0x13,0x05,0x02,0x08,0x06,0x12,0x06,0x02,0x09,0x06,0x12,0x05,0x02,0x09,
+0x07,0x11,0x05,0x01,0x0A,0x0C,0x01,0x0B,0x0A,0x01,0x0C,0x08,0x01,0x0C,0x07,0x01,
+0x0C,0x08,0x01,0x0B,0x09,0x01,0x0B,0x0A,0x02,0x0A,0x05,0x10,0x06,0x02,0x09,0x05,
+0x10,0x07,0x02,0x08,0x06,0x11,0x06,0x02,0x08,0x05,0x12,0x06,0x02,0x07,0x05,0x13,
+0x06,0x02,0x06,0x05,0x13,0x07,0x02,0x05,0x06,0x14,0x07,0x02,0x05,0x05,0x15,0x06,
+0x02,0x04,0x05,0x16,0x06,0x02,0x03,0x05,0x17,0x06,0x02,0x02,0x06,0x17,0x07,0x0E,
+0x26,0x02,0x02,0x06,0x1A,0x05,0x02,0x03,0x05,0x1A,0x04,0x02,0x03,0x06,0x19,0x05,
+0x02,0x04,0x05,0x19,0x04,0x02,0x04,0x06,0x18,0x05,0x02,0x04,0x06,0x18,0x04,0x02,
+0x05,0x05,0x17,0x05,0x02,0x05,0x06,0x17,0x05,0x02,0x06,0x05,0x16,0x05,0x02,0x06,
+0x06,0x16,0x05,0x02,0x07,0x05,0x15,0x05,0x02,0x07,0x06,0x15,0x05,0x02,0x08,0x05,
+0x15,0x04,0x02,0x08,0x06,0x14,0x05,0x02,0x09,0x05,0x14,0x04,0x02,0x09,0x06,0x13,
+0x05,0x02,0x09,0x06,0x13,0x04,0x02,0x0A,0x05,0x12,0x05,0x02,0x0A,0x06,0x12,0x04,
+0x02,0x0B,0x05,0x11,0x05,0x01,0x0B,0x0B,0x01,0x0C,0x09,0x81,0x01,0x0D,0x07,0x81,
+0x01,0x0E,0x05,0x81,0x01,0x0E,0x04,0x01,0x0D,0x05,0x01,0x0D,0x04,0x01,0x0C,0x05,
+0x01,0x0B,0x05,0x81,0x01,0x09,0x06,0x01,0x03,0x0C,0x01,0x03,0x0B,0x01,0x03,0x09,
+0x01,0x03,0x07,0x0E,0x1C,0x01,0x05,0x18,0x83,0x01,0x16,0x07,0x01,0x16,0x06,0x01,
+0x15,0x06,0x01,0x14,0x06,0x01,0x13,0x06,0x01,0x12,0x06,0x01,0x11,0x06,0x01,0x10,
+0x06,0x01,0x0F,0x06,0x01,0x0E,0x06,0x01,0x0D,0x06,0x01,0x0C,0x06,0x01,0x0B,0x06,
+0x01,0x0A,0x06,0x01,0x09,0x06,0x01,0x08,0x06,0x01,0x07,0x06,0x01,0x06,0x06,0x01,
+0x05,0x06,0x01,0x04,0x06,0x01,0x04,0x19,0x83,0x01,0x31,0x01,0x13,0x08,0x01,0x10,
+0x0B,0x01,0x0F,0x0C,0x01,0x0E,0x0D,0x01,0x0E,0x07,0x01,0x0D,0x06,0x01,0x0D,0x05,
+0x85,0x01,0x0D,0x06,0x01,0x0E,0x05,0x86,0x01,0x0D,0x05,0x01,0x0B,0x07,0x01,0x06,
+0x0B,0x01,0x06,0x09,0x81,0x01,0x06,0x0A,0x01,0x0B,0x06,0x01,0x0D,0x05,0x01,0x0E,
+0x05,0x87,0x01,0x0D,0x05,0x86,0x01,0x0D,0x06,0x01,0x0E,0x07,0x01,0x0E,0x0D,0x01,
+0x0F,0x0C,0x01,0x11,0x0A,0x01,0x13,0x08,0x01,0x31,0x01,0x0E,0x04,0xB0,0x01,0x31,
+0x01,0x05,0x08,0x01,0x05,0x0B,0x01,0x05,0x0C,0x01,0x05,0x0D,0x01,0x0B,0x07,0x01,
+0x0D,0x06,0x01,0x0E,0x05,0x85,0x01,0x0D,0x06,0x01,0x0D,0x05,0x86,0x01,0x0E,0x05,
+0x01,0x0E,0x07,0x01,0x0F,0x0B,0x01,0x11,0x09,0x81,0x01,0x10,0x0A,0x01,0x0F,0x06,
+0x01,0x0E,0x05,0x01,0x0D,0x05,0x87,0x01,0x0E,0x05,0x86,0x01,0x0D,0x06,0x01,0x0B,
+0x07,0x01,0x05,0x0D,0x01,0x05,0x0C,0x01,0x05,0x0B,0x01,0x05,0x08,0x17,0x0A,0x01,
+0x07,0x05,0x02,0x05,0x09,0x1A,0x04,0x02,0x04,0x0C,0x1A,0x04,0x02,0x03,0x0E,0x1A,
+0x04,0x03,0x03,0x04,0x0B,0x08,0x19,0x05,0x03,0x02,0x05,0x0D,0x08,0x19,0x04,0x02,
+0x02,0x04,0x0F,0x0E,0x02,0x02,0x04,0x10,0x0C,0x02,0x02,0x04,0x12,0x09,0x01,0x14,
+0x05,0x09,0x21,0x01,0x07,0x12,0x81,0x02,0x07,0x01,0x18,0x01,0x9C,0x01,0x07,0x12,
+0x81,0x08,0x2D,0x01,0x10,0x0A,0x01,0x0D,0x11,0x01,0x0B,0x13,0x01,0x09,0x15,0x02,
+0x08,0x09,0x19,0x05,0x02,0x07,0x07,0x1C,0x02,0x01,0x06,0x07,0x01,0x06,0x06,0x01,
+0x05,0x06,0x01,0x05,0x05,0x01,0x04,0x06,0x01,0x04,0x05,0x81,0x01,0x03,0x05,0x88,
+0x01,0x04,0x05,0x81,0x01,0x04,0x06,0x01,0x05,0x05,0x01,0x05,0x06,0x01,0x06,0x06,
+0x01,0x06,0x07,0x02,0x07,0x08,0x1D,0x01,0x02,0x08,0x09,0x1A,0x04,0x01,0x09,0x15,
+0x01,0x0B,0x13,0x01,0x0D,0x10,0x01,0x10,0x09,0x01,0x11,0x02,0x01,0x10,0x03,0x01,
+0x10,0x06,0x01,0x0F,0x08,0x01,0x13,0x05,0x01,0x14,0x04,0x81,0x01,0x13,0x05,0x01,
+0x0F,0x08,0x01,0x0F,0x06,0x04,0x27,0x02,0x0A,0x04,0x14,0x04,0x83,0x00,0x85,0x02,
+0x05,0x05,0x17,0x05,0x92,0x02,0x05,0x05,0x16,0x06,0x02,0x05,0x05,0x15,0x07,0x02,
+0x05,0x05,0x14,0x08,0x02,0x05,0x06,0x13,0x09,0x02,0x05,0x07,0x11,0x0B,0x02,0x06,
+0x10,0x17,0x05,0x02,0x06,0x0F,0x17,0x05,0x02,0x07,0x0D,0x17,0x05,0x02,0x08,0x0B,
+0x17,0x05,0x01,0x0A,0x07,0x00,0x2B,0x01,0x13,0x05,0x01,0x12,0x05,0x01,0x11,0x05,
+0x01,0x10,0x05,0x01,0x10,0x04,0x01,0x0F,0x04,0x01,0x0E,0x04,0x01,0x0D,0x04,0x00,
+0x85,0x01,0x0D,0x08,0x01,0x0B,0x0C,0x01,0x09,0x0F,0x01,0x08,0x11,0x02,0x07,0x07,
+0x13,0x07,0x02,0x07,0x05,0x15,0x05,0x02,0x06,0x05,0x16,0x05,0x02,0x05,0x05,0x16,
+0x05,0x02,0x05,0x05,0x17,0x04,0x02,0x05,0x05,0x17,0x05,0x02,0x04,0x05,0x17,0x05,
+0x81,0x01,0x04,0x18,0x83,0x01,0x04,0x05,0x82,0x01,0x05,0x05,0x81,0x01,0x05,0x06,
+0x01,0x06,0x06,0x02,0x06,0x07,0x1B,0x01,0x02,0x07,0x08,0x17,0x05,0x01,0x08,0x14,
+0x01,0x09,0x13,0x01,0x0B,0x10,0x01,0x0E,0x09,0x00,0x2B,0x01,0x0D,0x06,0x01,0x0C,
+0x08,0x01,0x0B,0x0A,0x02,0x0A,0x05,0x11,0x05,0x02,0x0A,0x04,0x12,0x04,0x02,0x09,
+0x04,0x13,0x04,0x02,0x08,0x04,0x14,0x04,0x02,0x07,0x04,0x15,0x04,0x00,0x85,0x01,
+0x0A,0x0A,0x01,0x07,0x0F,0x01,0x05,0x12,0x01,0x05,0x13,0x02,0x05,0x05,0x11,0x07,
+0x02,0x05,0x02,0x13,0x06,0x01,0x13,0x06,0x01,0x14,0x05,0x84,0x01,0x0C,0x0D,0x01,
+0x09,0x10,0x01,0x07,0x12,0x02,0x06,0x07,0x14,0x05,0x02,0x05,0x05,0x14,0x05,0x02,
+0x04,0x05,0x14,0x05,0x02,0x04,0x04,0x14,0x05,0x02,0x03,0x05,0x14,0x05,0x82,0x02,
+0x03,0x05,0x13,0x06,0x02,0x03,0x06,0x12,0x07,0x02,0x04,0x06,0x10,0x0A,0x02,0x04,
+0x10,0x15,0x09,0x02,0x05,0x0E,0x15,0x09,0x02,0x06,0x0B,0x16,0x08,0x02,0x08,0x07,
+0x18,0x05,0x04,0x27,0x02,0x0A,0x04,0x14,0x04,0x83,0x00,0x85,0x01,0x0A,0x0A,0x01,
+0x07,0x0F,0x01,0x05,0x12,0x01,0x05,0x13,0x02,0x05,0x05,0x11,0x07,0x02,0x05,0x02,
+0x13,0x06,0x01,0x13,0x06,0x01,0x14,0x05,0x84,0x01,0x0C,0x0D,0x01,0x09,0x10,0x01,
+0x07,0x12,0x02,0x06,0x07,0x14,0x05,0x02,0x05,0x05,0x14,0x05,0x02,0x04,0x05,0x14,
+0x05,0x02,0x04,0x04,0x14,0x05,0x02,0x03,0x05,0x14,0x05,0x82,0x02,0x03,0x05,0x13,
+0x06,0x02,0x03,0x06,0x12,0x07,0x02,0x04,0x06,0x10,0x0A,0x02,0x04,0x10,0x15,0x09,
+0x02,0x05,0x0E,0x15,0x09,0x02,0x06,0x0B,0x16,0x08,0x02,0x08,0x07,0x18,0x05,0x00,
+0x2B,0x01,0x08,0x05,0x01,0x09,0x05,0x01,0x0A,0x05,0x01,0x0B,0x05,0x01,0x0C,0x04,
+0x01,0x0D,0x04,0x01,0x0E,0x04,0x01,0x0F,0x04,0x00,0x85,0x01,0x0A,0x0A,0x01,0x07,
+0x0F,0x01,0x05,0x12,0x01,0x05,0x13,0x02,0x05,0x05,0x11,0x07,0x02,0x05,0x02,0x13,
+0x06,0x01,0x13,0x06,0x01,0x14,0x05,0x84,0x01,0x0C,0x0D,0x01,0x09,0x10,0x01,0x07,
+0x12,0x02,0x06,0x07,0x14,0x05,0x02,0x05,0x05,0x14,0x05,0x02,0x04,0x05,0x14,0x05,
+0x02,0x04,0x04,0x14,0x05,0x02,0x03,0x05,0x14,0x05,0x82,0x02,0x03,0x05,0x13,0x06,
+0x02,0x03,0x06,0x12,0x07,0x02,0x04,0x06,0x10,0x0A,0x02,0x04,0x10,0x15,0x09,0x02,
+0x05,0x0E,0x15,0x09,0x02,0x06,0x0B,0x16,0x08,0x02,0x08,0x07,0x18,0x05,0x00,0x2B,
+0x01,0x0E,0x04,0x01,0x0C,0x08,0x02,0x0C,0x02,0x12,0x02,0x02,0x0B,0x02,0x13,0x02,
+0x83,0x02,0x0C,0x02,0x12,0x02,0x01,0x0C,0x08,0x01,0x0E,0x04,0x00,0x83,0x01,0x0A,
+0x0A,0x01,0x07,0x0F,0x01,0x05,0x12,0x01,0x05,0x13,0x02,0x05,0x05,0x11,0x07,0x02,
+0x05,0x02,0x13,0x06,0x01,0x13,0x06,0x01,0x14,0x05,0x84,0x01,0x0C,0x0D,0x01,0x09,
+0x10,0x01,0x07,0x12,0x02,0x06,0x07,0x14,0x05,0x02,0x05,0x05,0x14,0x05,0x02,0x04,
+0x05,0x14,0x05,0x02,0x04,0x04,0x14,0x05,0x02,0x03,0x05,0x14,0x05,0x82,0x02,0x03,
+0x05,0x13,0x06,0x02,0x03,0x06,0x12,0x07,0x02,0x04,0x06,0x10,0x0A,0x02,0x04,0x10,
+0x15,0x09,0x02,0x05,0x0E,0x15,0x09,0x02,0x06,0x0B,0x16,0x08,0x02,0x08,0x07,0x18,
+0x05,0x0E,0x27,0x01,0x0E,0x09,0x01,0x0B,0x10,0x01,0x09,0x12,0x01,0x08,0x13,0x02,
+0x07,0x08,0x17,0x04,0x02,0x06,0x07,0x1A,0x01,0x01,0x06,0x06,0x01,0x05,0x06,0x01,
+0x05,0x05,0x81,0x01,0x04,0x06,0x01,0x04,0x05,0x86,0x01,0x04,0x06,0x01,0x05,0x05,
+0x81,0x01,0x05,0x06,0x01,0x06,0x06,0x02,0x06,0x07,0x1B,0x01,0x02,0x07,0x09,0x18,
+0x04,0x01,0x08,0x14,0x01,0x0A,0x12,0x01,0x0B,0x11,0x01,0x0E,0x0A,0x01,0x0F,0x02,
+0x01,0x0E,0x03,0x01,0x0E,0x06,0x01,0x0D,0x08,0x01,0x11,0x05,0x01,0x12,0x04,0x81,
+0x01,0x11,0x05,0x01,0x0D,0x08,0x01,0x0D,0x06,0x00,0x2B,0x01,0x0E,0x06,0x01,0x0D,
+0x08,0x01,0x0C,0x0A,0x02,0x0B,0x05,0x12,0x05,0x02,0x0B,0x04,0x13,0x04,0x02,0x0A,
+0x04,0x14,0x04,0x02,0x09,0x04,0x15,0x04,0x02,0x08,0x04,0x16,0x04,0x00,0x85,0x01,
+0x0D,0x08,0x01,0x0B,0x0C,0x01,0x09,0x0F,0x01,0x08,0x11,0x02,0x07,0x07,0x13,0x07,
+0x02,0x07,0x05,0x15,0x05,0x02,0x06,0x05,0x16,0x05,0x02,0x05,0x05,0x16,0x05,0x02,
+0x05,0x05,0x17,0x04,0x02,0x05,0x05,0x17,0x05,0x02,0x04,0x05,0x17,0x05,0x81,0x01,
+0x04,0x18,0x83,0x01,0x04,0x05,0x82,0x01,0x05,0x05,0x81,0x01,0x05,0x06,0x01,0x06,
+0x06,0x02,0x06,0x07,0x1B,0x01,0x02,0x07,0x08,0x17,0x05,0x01,0x08,0x14,0x01,0x09,
+0x13,0x01,0x0B,0x10,0x01,0x0E,0x09,0x04,0x27,0x02,0x0B,0x04,0x15,0x04,0x83,0x00,
+0x85,0x01,0x0D,0x08,0x01,0x0B,0x0C,0x01,0x09,0x0F,0x01,0x08,0x11,0x02,0x07,0x07,
+0x13,0x07,0x02,0x07,0x05,0x15,0x05,0x02,0x06,0x05,0x16,0x05,0x02,0x05,0x05,0x16,
+0x05,0x02,0x05,0x05,0x17,0x04,0x02,0x05,0x05,0x17,0x05,0x02,0x04,0x05,0x17,0x05,
+0x81,0x01,0x04,0x18,0x83,0x01,0x04,0x05,0x82,0x01,0x05,0x05,0x81,0x01,0x05,0x06,
+0x01,0x06,0x06,0x02,0x06,0x07,0x1B,0x01,0x02,0x07,0x08,0x17,0x05,0x01,0x08,0x14,
+0x01,0x09,0x13,0x01,0x0B,0x10,0x01,0x0E,0x09,0x00,0x2B,0x01,0x09,0x05,0x01,0x0A,
+0x05,0x01,0x0B,0x05,0x01,0x0C,0x05,0x01,0x0D,0x04,0x01,0x0E,0x04,0x01,0x0F,0x04,
+0x01,0x10,0x04,0x00,0x85,0x01,0x0D,0x08,0x01,0x0B,0x0C,0x01,0x09,0x0F,0x01,0x08,
+0x11,0x02,0x07,0x07,0x13,0x07,0x02,0x07,0x05,0x15,0x05,0x02,0x06,0x05,0x16,0x05,
+0x02,0x05,0x05,0x16,0x05,0x02,0x05,0x05,0x17,0x04,0x02,0x05,0x05,0x17,0x05,0x02,
+0x04,0x05,0x17,0x05,0x81,0x01,0x04,0x18,0x83,0x01,0x04,0x05,0x82,0x01,0x05,0x05,
+0x81,0x01,0x05,0x06,0x01,0x06,0x06,0x02,0x06,0x07,0x1B,0x01,0x02,0x07,0x08,0x17,
+0x05,0x01,0x08,0x14,0x01,0x09,0x13,0x01,0x0B,0x10,0x01,0x0E,0x09,0x04,0x26,0x02,
+0x0A,0x04,0x14,0x04,0x83,0x00,0x85,0x01,0x05,0x0F,0x83,0x01,0x0F,0x05,0x97,0x00,
+0x2A,0x01,0x0E,0x06,0x01,0x0D,0x08,0x01,0x0C,0x0A,0x02,0x0B,0x05,0x12,0x05,0x02,
+0x0B,0x04,0x13,0x04,0x02,0x0A,0x04,0x14,0x04,0x02,0x09,0x04,0x15,0x04,0x02,0x08,
+0x04,0x16,0x04,0x00,0x85,0x01,0x05,0x0F,0x83,0x01,0x0F,0x05,0x97,0x00,0x2A,0x01,
+0x09,0x05,0x01,0x0A,0x05,0x01,0x0B,0x05,0x01,0x0C,0x05,0x01,0x0D,0x04,0x01,0x0E,
+0x04,0x01,0x0F,0x04,0x01,0x10,0x04,0x00,0x85,0x01,0x05,0x0F,0x83,0x01,0x0F,0x05,
+0x97,0x00,0x2A,0x02,0x07,0x04,0x14,0x04,0x83,0x00,0x84,0x01,0x0D,0x06,0x81,0x01,
+0x0C,0x08,0x82,0x02,0x0B,0x04,0x10,0x05,0x81,0x02,0x0A,0x05,0x10,0x06,0x02,0x0A,
+0x04,0x11,0x05,0x81,0x02,0x09,0x05,0x12,0x05,0x02,0x09,0x04,0x12,0x05,0x02,0x08,
+0x05,0x12,0x06,0x02,0x08,0x04,0x13,0x05,0x81,0x02,0x07,0x05,0x14,0x05,0x02,0x07,
+0x04,0x14,0x05,0x02,0x06,0x05,0x14,0x06,0x02,0x06,0x05,0x15,0x05,0x02,0x06,0x04,
+0x15,0x05,0x02,0x05,0x05,0x16,0x05,0x01,0x05,0x16,0x01,0x04,0x18,0x81,0x01,0x03,
+0x1A,0x02,0x03,0x05,0x18,0x05,0x81,0x02,0x02,0x05,0x18,0x06,0x02,0x02,0x05,0x19,
+0x05,0x02,0x01,0x06,0x19,0x06,0x02,0x01,0x05,0x1A,0x05,0x81,0x02,0x00,0x06,0x1A,
+0x06,0x00,0x2A,0x01,0x0D,0x05,0x01,0x0C,0x07,0x02,0x0C,0x02,0x11,0x02,0x02,0x0B,
+0x02,0x12,0x02,0x82,0x02,0x0B,0x03,0x11,0x03,0x01,0x0C,0x07,0x81,0x01,0x0D,0x05,
+0x01,0x0C,0x07,0x82,0x01,0x0B,0x09,0x81,0x02,0x0A,0x05,0x10,0x05,0x02,0x0A,0x04,
+0x10,0x05,0x02,0x0A,0x04,0x10,0x06,0x02,0x09,0x05,0x11,0x05,0x02,0x09,0x04,0x11,
+0x05,0x02,0x08,0x05,0x12,0x05,0x02,0x08,0x04,0x12,0x05,0x02,0x08,0x04,0x12,0x06,
+0x02,0x07,0x05,0x13,0x05,0x02,0x07,0x04,0x13,0x06,0x02,0x06,0x05,0x14,0x05,0x81,
+0x02,0x06,0x04,0x15,0x05,0x02,0x05,0x05,0x15,0x05,0x02,0x05,0x05,0x15,0x06,0x01,
+0x05,0x16,0x01,0x04,0x18,0x81,0x01,0x03,0x19,0x02,0x03,0x05,0x17,0x06,0x02,0x03,
+0x05,0x18,0x05,0x02,0x02,0x05,0x18,0x06,0x02,0x02,0x05,0x19,0x05,0x02,0x01,0x06,
+0x19,0x06,0x02,0x01,0x05,0x1A,0x05,0x81,0x02,0x00,0x06,0x1A,0x06,0x00,0x2A,0x01,
+0x13,0x06,0x01,0x12,0x06,0x01,0x11,0x06,0x01,0x10,0x05,0x01,0x0F,0x05,0x01,0x0E,
+0x05,0x00,0x82,0x01,0x06,0x17,0x83,0x01,0x06,0x05,0x89,0x01,0x06,0x14,0x83,0x01,
+0x06,0x05,0x8A,0x01,0x06,0x18,0x83,0x0E,0x1D,0x02,0x06,0x07,0x14,0x05,0x02,0x03,
+0x0C,0x12,0x09,0x02,0x03,0x0D,0x11,0x0B,0x01,0x03,0x1A,0x03,0x03,0x02,0x0B,0x09,
+0x18,0x05,0x02,0x0C,0x07,0x19,0x05,0x02,0x0D,0x06,0x1A,0x04,0x02,0x0D,0x05,0x1A,
+0x04,0x02,0x0D,0x05,0x1A,0x05,0x83,0x01,0x08,0x17,0x01,0x06,0x19,0x01,0x04,0x1B,
+0x02,0x03,0x06,0x0D,0x12,0x02,0x02,0x06,0x0D,0x05,0x02,0x02,0x05,0x0D,0x05,0x02,
+0x01,0x05,0x0D,0x05,0x82,0x02,0x01,0x05,0x0D,0x06,0x81,0x02,0x01,0x06,0x0C,0x08,
+0x03,0x02,0x06,0x0B,0x0A,0x1C,0x03,0x01,0x02,0x1D,0x02,0x03,0x0B,0x10,0x0F,0x02,
+0x04,0x09,0x11,0x0D,0x02,0x06,0x05,0x13,0x08,0x09,0x21,0x01,0x0F,0x0F,0x01,0x0E,
+0x10,0x81,0x01,0x0D,0x11,0x01,0x0D,0x08,0x01,0x0C,0x09,0x81,0x02,0x0B,0x04,0x10,
+0x05,0x82,0x02,0x0A,0x04,0x10,0x05,0x81,0x02,0x09,0x04,0x10,0x05,0x81,0x02,0x08,
+0x04,0x10,0x05,0x02,0x08,0x04,0x10,0x0C,0x02,0x07,0x04,0x10,0x0C,0x81,0x02,0x06,
+0x05,0x10,0x0C,0x02,0x06,0x04,0x10,0x05,0x81,0x02,0x05,0x04,0x10,0x05,0x01,0x05,
+0x10,0x01,0x04,0x11,0x81,0x01,0x03,0x12,0x02,0x03,0x04,0x10,0x05,0x02,0x02,0x05,
+0x10,0x05,0x02,0x02,0x04,0x10,0x05,0x02,0x02,0x04,0x10,0x0F,0x02,0x01,0x04,0x10,
+0x0F,0x81,0x02,0x00,0x05,0x10,0x0F,0x00,0x2B,0x01,0x0D,0x06,0x01,0x0C,0x08,0x01,
+0x0B,0x0A,0x02,0x0A,0x05,0x11,0x05,0x02,0x0A,0x04,0x12,0x04,0x02,0x09,0x04,0x13,
+0x04,0x02,0x08,0x04,0x14,0x04,0x02,0x07,0x04,0x15,0x04,0x00,0x85,0x01,0x0C,0x08,
+0x01,0x09,0x0E,0x01,0x08,0x10,0x01,0x07,0x12,0x02,0x06,0x07,0x13,0x07,0x02,0x05,
+0x06,0x15,0x06,0x02,0x05,0x05,0x16,0x05,0x02,0x04,0x06,0x16,0x06,0x02,0x04,0x05,
+0x17,0x05,0x81,0x02,0x03,0x05,0x18,0x05,0x88,0x02,0x04,0x05,0x17,0x05,0x81,0x02,
+0x04,0x06,0x16,0x06,0x02,0x05,0x05,0x16,0x05,0x02,0x05,0x06,0x15,0x06,0x02,0x06,
+0x07,0x13,0x07,0x01,0x07,0x12,0x01,0x08,0x10,0x01,0x09,0x0E,0x01,0x0C,0x08,0x04,
+0x27,0x02,0x09,0x04,0x13,0x04,0x83,0x00,0x85,0x01,0x0C,0x08,0x01,0x09,0x0E,0x01,
+0x08,0x10,0x01,0x07,0x12,0x02,0x06,0x07,0x13,0x07,0x02,0x05,0x06,0x15,0x06,0x02,
+0x05,0x05,0x16,0x05,0x02,0x04,0x06,0x16,0x06,0x02,0x04,0x05,0x17,0x05,0x81,0x02,
+0x03,0x05,0x18,0x05,0x88,0x02,0x04,0x05,0x17,0x05,0x81,0x02,0x04,0x06,0x16,0x06,
+0x02,0x05,0x05,0x16,0x05,0x02,0x05,0x06,0x15,0x06,0x02,0x06,0x07,0x13,0x07,0x01,
+0x07,0x12,0x01,0x08,0x10,0x01,0x09,0x0E,0x01,0x0C,0x08,0x00,0x2B,0x01,0x08,0x05,
+0x01,0x09,0x05,0x01,0x0A,0x05,0x01,0x0B,0x05,0x01,0x0C,0x04,0x01,0x0D,0x04,0x01,
+0x0E,0x04,0x01,0x0F,0x04,0x00,0x85,0x01,0x0C,0x08,0x01,0x09,0x0E,0x01,0x08,0x10,
+0x01,0x07,0x12,0x02,0x06,0x07,0x13,0x07,0x02,0x05,0x06,0x15,0x06,0x02,0x05,0x05,
+0x16,0x05,0x02,0x04,0x06,0x16,0x06,0x02,0x04,0x05,0x17,0x05,0x81,0x02,0x03,0x05,
+0x18,0x05,0x88,0x02,0x04,0x05,0x17,0x05,0x81,0x02,0x04,0x06,0x16,0x06,0x02,0x05,
+0x05,0x16,0x05,0x02,0x05,0x06,0x15,0x06,0x02,0x06,0x07,0x13,0x07,0x01,0x07,0x12,
+0x01,0x08,0x10,0x01,0x09,0x0E,0x01,0x0C,0x08,0x00,0x2B,0x01,0x0D,0x06,0x01,0x0C,
+0x08,0x01,0x0B,0x0A,0x02,0x0A,0x05,0x11,0x05,0x02,0x0A,0x04,0x12,0x04,0x02,0x09,
+0x04,0x13,0x04,0x02,0x08,0x04,0x14,0x04,0x02,0x07,0x04,0x15,0x04,0x00,0x85,0x02,
+0x05,0x05,0x17,0x05,0x92,0x02,0x05,0x05,0x16,0x06,0x02,0x05,0x05,0x15,0x07,0x02,
+0x05,0x05,0x14,0x08,0x02,0x05,0x06,0x13,0x09,0x02,0x05,0x07,0x11,0x0B,0x02,0x06,
+0x10,0x17,0x05,0x02,0x06,0x0F,0x17,0x05,0x02,0x07,0x0D,0x17,0x05,0x02,0x08,0x0B,
+0x17,0x05,0x01,0x0A,0x07,0x00,0x2B,0x01,0x08,0x05,0x01,0x09,0x05,0x01,0x0A,0x05,
+0x01,0x0B,0x05,0x01,0x0C,0x04,0x01,0x0D,0x04,0x01,0x0E,0x04,0x01,0x0F,0x04,0x00,
+0x85,0x02,0x05,0x05,0x17,0x05,0x92,0x02,0x05,0x05,0x16,0x06,0x02,0x05,0x05,0x15,
+0x07,0x02,0x05,0x05,0x14,0x08,0x02,0x05,0x06,0x13,0x09,0x02,0x05,0x07,0x11,0x0B,
+0x02,0x06,0x10,0x17,0x05,0x02,0x06,0x0F,0x17,0x05,0x02,0x07,0x0D,0x17,0x05,0x02,
+0x08,0x0B,0x17,0x05,0x01,0x0A,0x07,0x04,0x30,0x02,0x0A,0x04,0x14,0x04,0x83,0x00,
+0x85,0x02,0x02,0x06,0x1A,0x05,0x02,0x03,0x05,0x1A,0x04,0x02,0x03,0x06,0x19,0x05,
+0x02,0x04,0x05,0x19,0x04,0x02,0x04,0x06,0x18,0x05,0x02,0x04,0x06,0x18,0x04,0x02,
+0x05,0x05,0x17,0x05,0x02,0x05,0x06,0x17,0x05,0x02,0x06,0x05,0x16,0x05,0x02,0x06,
+0x06,0x16,0x05,0x02,0x07,0x05,0x15,0x05,0x02,0x07,0x06,0x15,0x05,0x02,0x08,0x05,
+0x15,0x04,0x02,0x08,0x06,0x14,0x05,0x02,0x09,0x05,0x14,0x04,0x02,0x09,0x06,0x13,
+0x05,0x02,0x09,0x06,0x13,0x04,0x02,0x0A,0x05,0x12,0x05,0x02,0x0A,0x06,0x12,0x04,
+0x02,0x0B,0x05,0x11,0x05,0x01,0x0B,0x0B,0x01,0x0C,0x09,0x81,0x01,0x0D,0x07,0x81,
+0x01,0x0E,0x05,0x81,0x01,0x0E,0x04,0x01,0x0D,0x05,0x01,0x0D,0x04,0x01,0x0C,0x05,
+0x01,0x0B,0x05,0x81,0x01,0x09,0x06,0x01,0x03,0x0C,0x01,0x03,0x0B,0x01,0x03,0x09,
+0x01,0x03,0x07,0x00,0x2B,0x02,0x07,0x04,0x14,0x04,0x83,0x00,0x83,0x01,0x0C,0x08,
+0x01,0x0A,0x0C,0x01,0x08,0x10,0x01,0x07,0x12,0x02,0x06,0x07,0x13,0x07,0x02,0x05,
+0x06,0x15,0x06,0x02,0x05,0x05,0x16,0x05,0x02,0x04,0x05,0x17,0x05,0x81,0x02,0x03,
+0x05,0x18,0x05,0x82,0x02,0x02,0x05,0x19,0x05,0x8A,0x02,0x03,0x05,0x18,0x05,0x82,
+0x02,0x04,0x05,0x17,0x05,0x81,0x02,0x05,0x05,0x16,0x05,0x02,0x05,0x06,0x15,0x06,
+0x02,0x06,0x07,0x13,0x07,0x01,0x07,0x12,0x01,0x08,0x10,0x01,0x0A,0x0C,0x01,0x0C,
+0x08,0x00,0x2B,0x02,0x08,0x04,0x15,0x04,0x83,0x00,0x84,0x02,0x04,0x05,0x18,0x05,
+0x98,0x02,0x05,0x05,0x17,0x05,0x81,0x02,0x05,0x06,0x16,0x06,0x02,0x06,0x06,0x15,
+0x06,0x02,0x06,0x07,0x14,0x07,0x01,0x07,0x13,0x01,0x08,0x11,0x01,0x0A,0x0D,0x01,
+0x0C,0x09,0x0E,0x1D,0x02,0x0C,0x08,0x19,0x04,0x02,0x09,0x0D,0x18,0x04,0x01,0x08,
+0x13,0x01,0x07,0x13,0x02,0x06,0x07,0x13,0x07,0x02,0x05,0x06,0x15,0x06,0x02,0x05,
+0x05,0x14,0x07,0x02,0x04,0x06,0x14,0x08,0x02,0x04,0x05,0x13,0x09,0x03,0x04,0x05,
+0x12,0x04,0x17,0x05,0x03,0x03,0x05,0x11,0x04,0x18,0x05,0x03,0x03,0x05,0x10,0x04,
+0x18,0x05,0x81,0x03,0x03,0x05,0x0F,0x04,0x18,0x05,0x03,0x03,0x05,0x0E,0x04,0x18,
+0x05,0x03,0x03,0x05,0x0D,0x04,0x18,0x05,0x03,0x03,0x05,0x0C,0x04,0x18,0x05,0x81,
+0x03,0x03,0x05,0x0B,0x04,0x18,0x05,0x03,0x04,0x05,0x0A,0x04,0x17,0x05,0x02,0x04,
+0x09,0x17,0x05,0x02,0x04,0x08,0x16,0x06,0x02,0x05,0x07,0x16,0x05,0x02,0x05,0x06,
+0x15,0x06,0x02,0x06,0x07,0x13,0x07,0x01,0x06,0x13,0x01,0x05,0x13,0x02,0x04,0x04,
+0x09,0x0E,0x02,0x03,0x04,0x0C,0x08,0x03,0x27,0x01,0x12,0x08,0x01,0x10,0x0B,0x01,
+0x0F,0x0C,0x01,0x0E,0x0D,0x02,0x0D,0x06,0x19,0x02,0x01,0x0D,0x05,0x01,0x0D,0x04,
+0x01,0x0C,0x05,0x89,0x01,0x08,0x0E,0x83,0x01,0x0C,0x05,0x87,0x01,0x0C,0x04,0x01,
+0x0B,0x05,0x01,0x0B,0x04,0x01,0x0A,0x04,0x01,0x08,0x05,0x01,0x07,0x15,0x84,0x08,
+0x23,0x02,0x0C,0x08,0x1A,0x04,0x02,0x0A,0x0C,0x19,0x04,0x01,0x08,0x14,0x01,0x07,
+0x15,0x02,0x06,0x07,0x13,0x08,0x02,0x05,0x06,0x15,0x06,0x02,0x05,0x05,0x16,0x05,
+0x02,0x04,0x05,0x15,0x07,0x81,0x02,0x03,0x05,0x14,0x09,0x03,0x03,0x05,0x13,0x04,
+0x18,0x05,0x03,0x03,0x05,0x12,0x04,0x18,0x05,0x03,0x02,0x05,0x12,0x04,0x19,0x05,
+0x03,0x02,0x05,0x11,0x04,0x19,0x05,0x03,0x02,0x05,0x10,0x04,0x19,0x05,0x03,0x02,
+0x05,0x0F,0x04,0x19,0x05,0x81,0x03,0x02,0x05,0x0E,0x04,0x19,0x05,0x03,0x02,0x05,
+0x0D,0x04,0x19,0x05,0x81,0x03,0x02,0x05,0x0C,0x04,0x19,0x05,0x03,0x02,0x05,0x0B,
+0x04,0x19,0x05,0x03,0x02,0x05,0x0A,0x04,0x19,0x05,0x03,0x03,0x05,0x0A,0x04,0x18,
+0x05,0x03,0x03,0x05,0x09,0x04,0x18,0x05,0x02,0x03,0x09,0x18,0x05,0x02,0x04,0x07,
+0x17,0x05,0x81,0x02,0x05,0x05,0x16,0x05,0x02,0x05,0x06,0x15,0x06,0x02,0x05,0x08,
+0x13,0x07,0x01,0x04,0x15,0x01,0x04,0x14,0x02,0x03,0x04,0x0A,0x0C,0x02,0x02,0x04,
+0x0C,0x08,0x0E,0x1C,0x02,0x04,0x01,0x1B,0x01,0x02,0x03,0x03,0x1A,0x03,0x02,0x02,
+0x05,0x19,0x05,0x02,0x03,0x05,0x18,0x05,0x02,0x04,0x05,0x17,0x05,0x02,0x05,0x05,
+0x16,0x05,0x02,0x06,0x05,0x15,0x05,0x02,0x07,0x05,0x14,0x05,0x02,0x08,0x05,0x13,
+0x05,0x02,0x09,0x05,0x12,0x05,0x02,0x0A,0x05,0x11,0x05,0x01,0x0B,0x0A,0x01,0x0C,
+0x08,0x01,0x0D,0x06,0x81,0x01,0x0C,0x08,0x01,0x0B,0x0A,0x02,0x0A,0x05,0x11,0x05,
+0x02,0x09,0x05,0x12,0x05,0x02,0x08,0x05,0x13,0x05,0x02,0x07,0x05,0x14,0x05,0x02,
+0x06,0x05,0x15,0x05,0x02,0x05,0x05,0x16,0x05,0x02,0x04,0x05,0x17,0x05,0x02,0x03,
+0x05,0x18,0x05,0x02,0x02,0x05,0x19,0x05,0x02,0x03,0x03,0x1A,0x03,0x02,0x04,0x01,
+0x1B,0x01,0x00,0x35,0x01,0x12,0x09,0x01,0x10,0x0C,0x01,0x0E,0x0E,0x81,0x02,0x0D,
+0x06,0x1A,0x02,0x01,0x0D,0x05,0x01,0x0C,0x05,0x87,0x01,0x07,0x12,0x83,0x01,0x0C,
+0x05,0x9C,0x01,0x0B,0x05,0x02,0x01,0x02,0x0A,0x06,0x01,0x01,0x0F,0x01,0x01,0x0E,
+0x01,0x01,0x0D,0x01,0x02,0x09,0x00,0x2B,0x01,0x13,0x05,0x01,0x12,0x05,0x01,0x11,
+0x05,0x01,0x10,0x05,0x01,0x10,0x04,0x01,0x0F,0x04,0x01,0x0E,0x04,0x01,0x0D,0x04,
+0x00,0x85,0x01,0x0A,0x0A,0x01,0x07,0x0F,0x01,0x05,0x12,0x01,0x05,0x13,0x02,0x05,
+0x05,0x11,0x07,0x02,0x05,0x02,0x13,0x06,0x01,0x13,0x06,0x01,0x14,0x05,0x84,0x01,
+0x0C,0x0D,0x01,0x09,0x10,0x01,0x07,0x12,0x02,0x06,0x07,0x14,0x05,0x02,0x05,0x05,
+0x14,0x05,0x02,0x04,0x05,0x14,0x05,0x02,0x04,0x04,0x14,0x05,0x02,0x03,0x05,0x14,
+0x05,0x82,0x02,0x03,0x05,0x13,0x06,0x02,0x03,0x06,0x12,0x07,0x02,0x04,0x06,0x10,
+0x0A,0x02,0x04,0x10,0x15,0x09,0x02,0x05,0x0E,0x15,0x09,0x02,0x06,0x0B,0x16,0x08,
+0x02,0x08,0x07,0x18,0x05,0x00,0x2A,0x01,0x13,0x05,0x01,0x12,0x05,0x01,0x11,0x05,
+0x01,0x10,0x05,0x01,0x10,0x04,0x01,0x0F,0x04,0x01,0x0E,0x04,0x01,0x0D,0x04,0x00,
+0x85,0x01,0x05,0x0F,0x83,0x01,0x0F,0x05,0x97,0x00,0x2B,0x01,0x12,0x05,0x01,0x11,
+0x05,0x01,0x10,0x05,0x01,0x0F,0x05,0x01,0x0F,0x04,0x01,0x0E,0x04,0x01,0x0D,0x04,
+0x01,0x0C,0x04,0x00,0x85,0x01,0x0C,0x08,0x01,0x09,0x0E,0x01,0x08,0x10,0x01,0x07,
+0x12,0x02,0x06,0x07,0x13,0x07,0x02,0x05,0x06,0x15,0x06,0x02,0x05,0x05,0x16,0x05,
+0x02,0x04,0x06,0x16,0x06,0x02,0x04,0x05,0x17,0x05,0x81,0x02,0x03,0x05,0x18,0x05,
+0x88,0x02,0x04,0x05,0x17,0x05,0x81,0x02,0x04,0x06,0x16,0x06,0x02,0x05,0x05,0x16,
+0x05,0x02,0x05,0x06,0x15,0x06,0x02,0x06,0x07,0x13,0x07,0x01,0x07,0x12,0x01,0x08,
+0x10,0x01,0x09,0x0E,0x01,0x0C,0x08,0x00,0x2B,0x01,0x12,0x05,0x01,0x11,0x05,0x01,
+0x10,0x05,0x01,0x0F,0x05,0x01,0x0F,0x04,0x01,0x0E,0x04,0x01,0x0D,0x04,0x01,0x0C,
+0x04,0x00,0x85,0x02,0x05,0x05,0x17,0x05,0x92,0x02,0x05,0x05,0x16,0x06,0x02,0x05,
+0x05,0x15,0x07,0x02,0x05,0x05,0x14,0x08,0x02,0x05,0x06,0x13,0x09,0x02,0x05,0x07,
+0x11,0x0B,0x02,0x06,0x10,0x17,0x05,0x02,0x06,0x0F,0x17,0x05,0x02,0x07,0x0D,0x17,
+0x05,0x02,0x08,0x0B,0x17,0x05,0x01,0x0A,0x07,0x03,0x27,0x02,0x0A,0x04,0x15,0x03,
+0x02,0x08,0x08,0x15,0x03,0x02,0x08,0x0A,0x14,0x04,0x02,0x07,0x04,0x0D,0x0A,0x02,
+0x07,0x03,0x0F,0x08,0x02,0x07,0x03,0x11,0x04,0x00,0x84,0x02,0x05,0x05,0x10,0x07,
+0x02,0x05,0x05,0x0E,0x0B,0x02,0x05,0x05,0x0D,0x0D,0x02,0x05,0x05,0x0C,0x0F,0x02,
+0x05,0x05,0x0B,0x10,0x02,0x05,0x0B,0x15,0x07,0x02,0x05,0x09,0x16,0x06,0x02,0x05,
+0x08,0x17,0x05,0x02,0x05,0x07,0x17,0x05,0x02,0x05,0x06,0x17,0x05,0x02,0x05,0x05,
+0x17,0x05,0x91,0x00,0x2A,0x02,0x0A,0x04,0x15,0x03,0x02,0x08,0x08,0x15,0x03,0x02,
+0x08,0x0A,0x14,0x04,0x02,0x07,0x04,0x0D,0x0A,0x02,0x07,0x03,0x0F,0x08,0x02,0x07,
+0x03,0x11,0x04,0x00,0x82,0x02,0x04,0x05,0x18,0x04,0x02,0x04,0x06,0x18,0x04,0x81,
+0x02,0x04,0x07,0x18,0x04,0x81,0x02,0x04,0x08,0x18,0x04,0x02,0x04,0x09,0x18,0x04,
+0x81,0x02,0x04,0x0A,0x18,0x04,0x03,0x04,0x04,0x09,0x06,0x18,0x04,0x81,0x03,0x04,
+0x04,0x0A,0x06,0x18,0x04,0x03,0x04,0x04,0x0B,0x06,0x18,0x04,0x81,0x03,0x04,0x04,
+0x0C,0x06,0x18,0x04,0x03,0x04,0x04,0x0D,0x05,0x18,0x04,0x03,0x04,0x04,0x0D,0x06,
+0x18,0x04,0x03,0x04,0x04,0x0E,0x06,0x18,0x04,0x81,0x03,0x04,0x04,0x0F,0x06,0x18,
+0x04,0x03,0x04,0x04,0x10,0x06,0x18,0x04,0x81,0x03,0x04,0x04,0x11,0x06,0x18,0x04,
+0x03,0x04,0x04,0x12,0x05,0x18,0x04,0x02,0x04,0x04,0x12,0x0A,0x02,0x04,0x04,0x13,
+0x09,0x81,0x02,0x04,0x04,0x14,0x08,0x02,0x04,0x04,0x15,0x07,0x81,0x02,0x04,0x04,
+0x16,0x06,0x02,0x04,0x04,0x17,0x05,0x81,0x03,0x14,0x01,0x0A,0x09,0x01,0x07,0x0E,
+0x01,0x07,0x0F,0x02,0x07,0x04,0x11,0x06,0x02,0x07,0x02,0x12,0x05,0x01,0x13,0x04,
+0x82,0x01,0x0C,0x0B,0x01,0x09,0x0E,0x01,0x08,0x0F,0x02,0x07,0x06,0x13,0x04,0x02,
+0x06,0x05,0x13,0x04,0x02,0x06,0x04,0x13,0x04,0x81,0x02,0x06,0x04,0x12,0x05,0x02,
+0x06,0x05,0x10,0x08,0x01,0x07,0x13,0x02,0x08,0x09,0x14,0x06,0x02,0x09,0x06,0x15,
+0x04,0x03,0x14,0x01,0x0C,0x08,0x01,0x0A,0x0C,0x01,0x09,0x0E,0x02,0x08,0x05,0x13,
+0x05,0x02,0x07,0x05,0x14,0x05,0x02,0x07,0x04,0x15,0x04,0x02,0x06,0x05,0x15,0x05,
+0x02,0x06,0x04,0x16,0x04,0x86,0x02,0x07,0x04,0x15,0x04,0x02,0x07,0x05,0x14,0x05,
+0x02,0x08,0x05,0x13,0x05,0x01,0x09,0x0E,0x01,0x0A,0x0C,0x01,0x0C,0x08,0x0E,0x26,
+0x01,0x0F,0x07,0x85,0x00,0x84,0x01,0x10,0x05,0x83,0x01,0x10,0x04,0x01,0x0F,0x05,
+0x01,0x0E,0x05,0x01,0x0D,0x06,0x01,0x0C,0x06,0x01,0x0B,0x06,0x01,0x0A,0x05,0x01,
+0x08,0x06,0x01,0x07,0x06,0x01,0x06,0x05,0x01,0x05,0x05,0x81,0x01,0x04,0x05,0x81,
+0x02,0x04,0x05,0x18,0x04,0x81,0x02,0x04,0x06,0x18,0x04,0x02,0x04,0x07,0x18,0x04,
+0x02,0x05,0x08,0x17,0x05,0x01,0x06,0x16,0x01,0x07,0x15,0x01,0x09,0x13,0x01,0x0C,
+0x0C,0x03,0x16,0x01,0x0C,0x06,0x01,0x09,0x0C,0x02,0x08,0x04,0x12,0x04,0x02,0x07,
+0x03,0x14,0x03,0x03,0x06,0x03,0x0B,0x07,0x15,0x03,0x03,0x05,0x03,0x0B,0x08,0x16,
+0x03,0x04,0x05,0x02,0x0B,0x02,0x11,0x03,0x17,0x02,0x04,0x05,0x02,0x0B,0x02,0x12,
+0x02,0x17,0x02,0x04,0x04,0x02,0x0B,0x02,0x12,0x02,0x18,0x02,0x04,0x04,0x02,0x0B,
+0x02,0x11,0x03,0x18,0x02,0x03,0x04,0x02,0x0B,0x08,0x18,0x02,0x03,0x04,0x02,0x0B,
+0x07,0x18,0x02,0x04,0x04,0x02,0x0B,0x02,0x0F,0x03,0x18,0x02,0x04,0x04,0x02,0x0B,
+0x02,0x10,0x03,0x18,0x02,0x04,0x05,0x02,0x0B,0x02,0x10,0x03,0x17,0x02,0x04,0x05,
+0x02,0x0B,0x02,0x11,0x03,0x17,0x02,0x04,0x05,0x03,0x0B,0x02,0x11,0x03,0x16,0x03,
+0x03,0x06,0x03,0x0B,0x02,0x12,0x06,0x02,0x07,0x03,0x14,0x03,0x02,0x08,0x04,0x12,
+0x04,0x01,0x09,0x0C,0x01,0x0C,0x06,0x15,0x0D,0x01,0x02,0x1C,0x83,0x01,0x1A,0x04,
+0x88,0x03,0x28,0x02,0x04,0x05,0x15,0x04,0x02,0x00,0x09,0x14,0x04,0x81,0x02,0x00,
+0x09,0x13,0x04,0x02,0x04,0x05,0x13,0x04,0x02,0x04,0x05,0x12,0x04,0x81,0x02,0x04,
+0x05,0x11,0x04,0x81,0x02,0x04,0x05,0x10,0x04,0x02,0x04,0x05,0x0F,0x04,0x81,0x02,
+0x04,0x05,0x0E,0x04,0x81,0x02,0x04,0x05,0x0D,0x04,0x81,0x02,0x04,0x05,0x0C,0x04,
+0x81,0x02,0x04,0x05,0x0B,0x04,0x03,0x04,0x05,0x0B,0x04,0x13,0x08,0x02,0x0A,0x04,
+0x11,0x0C,0x02,0x0A,0x04,0x11,0x0D,0x03,0x09,0x04,0x11,0x02,0x19,0x06,0x02,0x09,
+0x04,0x1A,0x05,0x02,0x08,0x04,0x1A,0x05,0x81,0x02,0x07,0x04,0x19,0x06,0x02,0x07,
+0x04,0x18,0x06,0x02,0x06,0x04,0x17,0x06,0x02,0x06,0x04,0x16,0x06,0x02,0x05,0x04,
+0x15,0x05,0x02,0x04,0x04,0x14,0x05,0x02,0x04,0x04,0x13,0x04,0x02,0x03,0x04,0x12,
+0x04,0x02,0x03,0x04,0x11,0x05,0x02,0x02,0x04,0x11,0x0E,0x81,0x02,0x01,0x04,0x11,
+0x0E,0x81,0x01,0x00,0x04,0x03,0x28,0x02,0x04,0x05,0x16,0x04,0x02,0x00,0x09,0x15,
+0x04,0x81,0x02,0x00,0x09,0x14,0x04,0x02,0x04,0x05,0x14,0x04,0x02,0x04,0x05,0x13,
+0x04,0x81,0x02,0x04,0x05,0x12,0x04,0x81,0x02,0x04,0x05,0x11,0x04,0x02,0x04,0x05,
+0x10,0x04,0x81,0x02,0x04,0x05,0x0F,0x04,0x81,0x02,0x04,0x05,0x0E,0x04,0x81,0x02,
+0x04,0x05,0x0D,0x04,0x81,0x02,0x04,0x05,0x0C,0x04,0x03,0x04,0x05,0x0C,0x04,0x16,
+0x06,0x02,0x0B,0x04,0x15,0x07,0x81,0x02,0x0A,0x04,0x14,0x08,0x03,0x0A,0x04,0x13,
+0x03,0x17,0x05,0x03,0x09,0x04,0x12,0x03,0x17,0x05,0x03,0x09,0x04,0x11,0x03,0x17,
+0x05,0x03,0x08,0x04,0x10,0x03,0x17,0x05,0x03,0x08,0x04,0x0F,0x04,0x17,0x05,0x03,
+0x07,0x04,0x0F,0x03,0x17,0x05,0x03,0x07,0x04,0x0E,0x03,0x17,0x05,0x03,0x06,0x04,
+0x0D,0x03,0x17,0x05,0x02,0x05,0x04,0x0D,0x12,0x81,0x02,0x04,0x04,0x0D,0x12,0x02,
+0x04,0x04,0x17,0x05,0x02,0x03,0x04,0x17,0x05,0x81,0x02,0x02,0x04,0x17,0x05,0x81,
+0x01,0x01,0x04,0x0E,0x26,0x01,0x0D,0x07,0x85,0x00,0x84,0x01,0x0F,0x03,0x82,0x01,
+0x0E,0x04,0x01,0x0E,0x05,0x96,0x10,0x18,0x02,0x0E,0x01,0x19,0x01,0x02,0x0D,0x03,
+0x18,0x03,0x02,0x0C,0x05,0x17,0x05,0x02,0x0B,0x05,0x16,0x05,0x02,0x0A,0x05,0x15,
+0x05,0x02,0x09,0x05,0x14,0x05,0x02,0x08,0x05,0x13,0x05,0x02,0x07,0x05,0x12,0x05,
+0x02,0x06,0x05,0x11,0x05,0x02,0x05,0x05,0x10,0x05,0x02,0x04,0x05,0x0F,0x05,0x02,
+0x04,0x04,0x0F,0x04,0x02,0x03,0x05,0x0E,0x05,0x02,0x04,0x05,0x0F,0x05,0x02,0x05,
+0x05,0x10,0x05,0x02,0x06,0x05,0x11,0x05,0x02,0x07,0x05,0x12,0x05,0x02,0x08,0x05,
+0x13,0x05,0x02,0x09,0x05,0x14,0x05,0x02,0x0A,0x05,0x15,0x05,0x02,0x0B,0x05,0x16,
+0x05,0x02,0x0C,0x05,0x17,0x05,0x02,0x0D,0x03,0x18,0x03,0x02,0x0E,0x01,0x19,0x01,
+0x10,0x18,0x02,0x06,0x01,0x11,0x01,0x02,0x05,0x03,0x10,0x03,0x02,0x04,0x05,0x0F,
+0x05,0x02,0x05,0x05,0x10,0x05,0x02,0x06,0x05,0x11,0x05,0x02,0x07,0x05,0x12,0x05,
+0x02,0x08,0x05,0x13,0x05,0x02,0x09,0x05,0x14,0x05,0x02,0x0A,0x05,0x15,0x05,0x02,
+0x0B,0x05,0x16,0x05,0x02,0x0C,0x05,0x17,0x05,0x02,0x0D,0x05,0x18,0x05,0x02,0x0D,
+0x04,0x18,0x04,0x02,0x0C,0x04,0x17,0x04,0x02,0x0B,0x05,0x16,0x05,0x02,0x0A,0x05,
+0x15,0x05,0x02,0x09,0x05,0x14,0x05,0x02,0x08,0x05,0x13,0x05,0x02,0x07,0x05,0x12,
+0x05,0x02,0x06,0x05,0x11,0x05,0x02,0x05,0x05,0x10,0x05,0x02,0x04,0x05,0x0F,0x05,
+0x02,0x05,0x03,0x10,0x03,0x02,0x06,0x01,0x11,0x01,0x00,0x2F,0x03,0x00,0x05,0x0B,
+0x05,0x15,0x05,0x84,0x00,0x85,0x03,0x00,0x05,0x0B,0x05,0x15,0x05,0x84,0x00,0x84,
+0x03,0x00,0x05,0x0B,0x05,0x15,0x05,0x84,0x00,0x85,0x03,0x00,0x05,0x0B,0x05,0x15,
+0x05,0x84,0x00,0x84,0x03,0x00,0x05,0x0B,0x05,0x15,0x05,0x84,0x00,0x35,0x03,0x05,
+0x05,0x10,0x05,0x1B,0x05,0x84,0x03,0x00,0x05,0x0B,0x05,0x15,0x05,0x84,0x00,0x03,
+0x05,0x05,0x10,0x05,0x1B,0x05,0x84,0x03,0x00,0x05,0x0B,0x05,0x15,0x05,0x84,0x03,
+0x05,0x05,0x10,0x05,0x1B,0x05,0x84,0x00,0x03,0x00,0x05,0x0B,0x05,0x15,0x05,0x84,
+0x03,0x05,0x05,0x10,0x05,0x1B,0x05,0x84,0x03,0x00,0x05,0x0B,0x05,0x15,0x05,0x84,
+0x03,0x05,0x05,0x10,0x05,0x1B,0x05,0x84,0x00,0x03,0x00,0x05,0x0B,0x05,0x15,0x05,
+0x84,0x00,0x35,0x01,0x00,0x20,0x84,0x03,0x00,0x05,0x0B,0x05,0x15,0x05,0x85,0x01,
+0x00,0x20,0x84,0x03,0x00,0x05,0x0B,0x05,0x15,0x05,0x84,0x01,0x00,0x20,0x84,0x03,
+0x00,0x05,0x0B,0x05,0x15,0x05,0x85,0x01,0x00,0x20,0x84,0x03,0x00,0x05,0x0B,0x05,
+0x15,0x05,0x84,0x01,0x00,0x20,0x84,0x03,0x00,0x05,0x0B,0x05,0x15,0x05,0x85,0x00,
+0x35,0x01,0x0E,0x04,0xB4,0x00,0x35,0x01,0x0E,0x04,0x98,0x01,0x00,0x12,0x83,0x01,
+0x0E,0x04,0x97,0x00,0x2A,0x01,0x11,0x06,0x01,0x10,0x06,0x01,0x0F,0x06,0x01,0x0E,
+0x05,0x01,0x0D,0x05,0x01,0x0C,0x05,0x00,0x82,0x01,0x0D,0x06,0x81,0x01,0x0C,0x08,
+0x82,0x02,0x0B,0x04,0x10,0x05,0x81,0x02,0x0A,0x05,0x10,0x06,0x02,0x0A,0x04,0x11,
+0x05,0x81,0x02,0x09,0x05,0x12,0x05,0x02,0x09,0x04,0x12,0x05,0x02,0x08,0x05,0x12,
+0x06,0x02,0x08,0x04,0x13,0x05,0x81,0x02,0x07,0x05,0x14,0x05,0x02,0x07,0x04,0x14,
+0x05,0x02,0x06,0x05,0x14,0x06,0x02,0x06,0x05,0x15,0x05,0x02,0x06,0x04,0x15,0x05,
+0x02,0x05,0x05,0x16,0x05,0x01,0x05,0x16,0x01,0x04,0x18,0x81,0x01,0x03,0x1A,0x02,
+0x03,0x05,0x18,0x05,0x81,0x02,0x02,0x05,0x18,0x06,0x02,0x02,0x05,0x19,0x05,0x02,
+0x01,0x06,0x19,0x06,0x02,0x01,0x05,0x1A,0x05,0x81,0x02,0x00,0x06,0x1A,0x06,0x00,
+0x2A,0x01,0x0C,0x09,0x01,0x0B,0x0B,0x02,0x0A,0x06,0x11,0x06,0x02,0x09,0x06,0x12,
+0x06,0x02,0x08,0x05,0x14,0x05,0x02,0x07,0x05,0x15,0x05,0x00,0x82,0x01,0x0D,0x06,
+0x81,0x01,0x0C,0x08,0x82,0x02,0x0B,0x04,0x10,0x05,0x81,0x02,0x0A,0x05,0x10,0x06,
+0x02,0x0A,0x04,0x11,0x05,0x81,0x02,0x09,0x05,0x12,0x05,0x02,0x09,0x04,0x12,0x05,
+0x02,0x08,0x05,0x12,0x06,0x02,0x08,0x04,0x13,0x05,0x81,0x02,0x07,0x05,0x14,0x05,
+0x02,0x07,0x04,0x14,0x05,0x02,0x06,0x05,0x14,0x06,0x02,0x06,0x05,0x15,0x05,0x02,
+0x06,0x04,0x15,0x05,0x02,0x05,0x05,0x16,0x05,0x01,0x05,0x16,0x01,0x04,0x18,0x81,
+0x01,0x03,0x1A,0x02,0x03,0x05,0x18,0x05,0x81,0x02,0x02,0x05,0x18,0x06,0x02,0x02,
+0x05,0x19,0x05,0x02,0x01,0x06,0x19,0x06,0x02,0x01,0x05,0x1A,0x05,0x81,0x02,0x00,
+0x06,0x1A,0x06,0x00,0x2A,0x01,0x08,0x06,0x01,0x09,0x06,0x01,0x0A,0x06,0x01,0x0C,
+0x05,0x01,0x0D,0x05,0x01,0x0E,0x05,0x00,0x82,0x01,0x0D,0x06,0x81,0x01,0x0C,0x08,
+0x82,0x02,0x0B,0x04,0x10,0x05,0x81,0x02,0x0A,0x05,0x10,0x06,0x02,0x0A,0x04,0x11,
+0x05,0x81,0x02,0x09,0x05,0x12,0x05,0x02,0x09,0x04,0x12,0x05,0x02,0x08,0x05,0x12,
+0x06,0x02,0x08,0x04,0x13,0x05,0x81,0x02,0x07,0x05,0x14,0x05,0x02,0x07,0x04,0x14,
+0x05,0x02,0x06,0x05,0x14,0x06,0x02,0x06,0x05,0x15,0x05,0x02,0x06,0x04,0x15,0x05,
+0x02,0x05,0x05,0x16,0x05,0x01,0x05,0x16,0x01,0x04,0x18,0x81,0x01,0x03,0x1A,0x02,
+0x03,0x05,0x18,0x05,0x81,0x02,0x02,0x05,0x18,0x06,0x02,0x02,0x05,0x19,0x05,0x02,
+0x01,0x06,0x19,0x06,0x02,0x01,0x05,0x1A,0x05,0x81,0x02,0x00,0x06,0x1A,0x06,0x03,
+0x28,0x01,0x0C,0x09,0x01,0x0A,0x0D,0x01,0x08,0x11,0x02,0x07,0x06,0x14,0x06,0x02,
+0x06,0x05,0x16,0x05,0x02,0x05,0x04,0x18,0x04,0x02,0x05,0x03,0x19,0x03,0x02,0x04,
+0x04,0x19,0x04,0x02,0x04,0x03,0x1A,0x03,0x03,0x03,0x04,0x0E,0x08,0x1A,0x04,0x03,
+0x03,0x03,0x0C,0x0C,0x1B,0x03,0x03,0x03,0x03,0x0A,0x0E,0x1B,0x03,0x04,0x03,0x03,
+0x09,0x06,0x15,0x03,0x1B,0x03,0x03,0x02,0x04,0x09,0x04,0x1B,0x04,0x03,0x02,0x03,
+0x08,0x04,0x1C,0x03,0x81,0x03,0x02,0x03,0x07,0x04,0x1C,0x03,0x86,0x03,0x02,0x03,
+0x07,0x05,0x1C,0x03,0x03,0x02,0x03,0x08,0x04,0x1C,0x03,0x03,0x02,0x03,0x08,0x05,
+0x1C,0x03,0x03,0x02,0x04,0x09,0x05,0x1B,0x04,0x04,0x03,0x03,0x09,0x06,0x15,0x03,
+0x1B,0x03,0x03,0x03,0x03,0x0A,0x0E,0x1B,0x03,0x03,0x03,0x03,0x0C,0x0C,0x1B,0x03,
+0x03,0x03,0x04,0x0E,0x07,0x1A,0x04,0x02,0x04,0x03,0x1A,0x03,0x02,0x04,0x04,0x19,
+0x04,0x02,0x05,0x03,0x19,0x03,0x02,0x05,0x04,0x18,0x04,0x02,0x06,0x05,0x16,0x05,
+0x02,0x07,0x06,0x14,0x06,0x01,0x08,0x11,0x01,0x0A,0x0D,0x01,0x0C,0x09,0x00,0x35,
+0x02,0x0A,0x04,0x12,0x04,0x94,0x02,0x00,0x0E,0x12,0x04,0x83,0x01,0x12,0x04,0x83,
+0x02,0x00,0x0E,0x12,0x04,0x83,0x02,0x0A,0x04,0x12,0x04,0x93,0x00,0x35,0x02,0x0A,
+0x04,0x12,0x04,0xB4,0x15,0x20,0x01,0x00,0x16,0x83,0x01,0x12,0x04,0x83,0x02,0x00,
+0x0E,0x12,0x04,0x83,0x02,0x0A,0x04,0x12,0x04,0x93,0x00,0x21,0x02,0x0A,0x04,0x12,
+0x04,0x94,0x02,0x00,0x0E,0x12,0x04,0x83,0x01,0x12,0x04,0x83,0x01,0x00,0x16,0x83,
+0x04,0x26,0x01,0x10,0x03,0x83,0x01,0x0E,0x08,0x01,0x0C,0x0E,0x01,0x0A,0x10,0x01,
+0x09,0x11,0x03,0x08,0x07,0x10,0x03,0x16,0x04,0x03,0x07,0x06,0x10,0x03,0x19,0x01,
+0x02,0x07,0x05,0x10,0x03,0x02,0x06,0x05,0x10,0x03,0x82,0x02,0x05,0x05,0x10,0x03,
+0x88,0x02,0x06,0x05,0x10,0x03,0x81,0x02,0x06,0x06,0x10,0x03,0x02,0x07,0x06,0x10,
+0x03,0x03,0x07,0x07,0x10,0x03,0x19,0x01,0x02,0x08,0x0B,0x16,0x04,0x01,0x09,0x11,
+0x01,0x0A,0x10,0x01,0x0B,0x0E,0x01,0x0E,0x08,0x01,0x10,0x03,0x84,0x04,0x26,0x02,
+0x01,0x06,0x1A,0x05,0x02,0x02,0x06,0x1A,0x04,0x02,0x03,0x06,0x19,0x04,0x02,0x03,
+0x06,0x18,0x05,0x02,0x04,0x06,0x18,0x04,0x02,0x04,0x07,0x17,0x04,0x02,0x05,0x06,
+0x16,0x05,0x02,0x06,0x06,0x15,0x05,0x02,0x06,0x06,0x15,0x04,0x02,0x07,0x06,0x14,
+0x05,0x02,0x08,0x06,0x13,0x05,0x02,0x08,0x06,0x13,0x04,0x02,0x09,0x06,0x12,0x05,
+0x02,0x09,0x07,0x11,0x05,0x02,0x0A,0x06,0x11,0x04,0x01,0x0B,0x0A,0x01,0x0B,0x09,
+0x01,0x0C,0x07,0x01,0x0D,0x06,0x01,0x05,0x15,0x83,0x01,0x0D,0x05,0x84,0x01,0x05,
+0x15,0x83,0x01,0x0D,0x05,0x85,0x19,0x1C,0x01,0x00,0x12,0x83,0x01,0x0E,0x04,0x97,
+0x00,0x1D,0x01,0x0E,0x04,0x98,0x01,0x0E,0x12,0x83,0x00,0x1D,0x01,0x0E,0x04,0x98,
+0x01,0x00,0x20,0x83,0x19,0x1C,0x01,0x00,0x20,0x83,0x01,0x0E,0x04,0x97,0x00,0x35,
+0x01,0x0E,0x04,0x98,0x01,0x0E,0x12,0x83,0x01,0x0E,0x04,0x97,0x19,0x04,0x01,0x00,
+0x20,0x83,0x00,0x35,0x01,0x0E,0x04,0x98,0x01,0x00,0x20,0x83,0x01,0x0E,0x04,0x97,
+0x03,0x28,0x02,0x0A,0x04,0x15,0x03,0x02,0x08,0x08,0x15,0x03,0x02,0x08,0x0A,0x14,
+0x04,0x02,0x07,0x04,0x0D,0x0A,0x02,0x07,0x03,0x0F,0x08,0x02,0x07,0x03,0x11,0x04,
+0x00,0x84,0x01,0x0A,0x0A,0x01,0x07,0x0F,0x01,0x05,0x12,0x01,0x05,0x13,0x02,0x05,
+0x05,0x11,0x07,0x02,0x05,0x02,0x13,0x06,0x01,0x13,0x06,0x01,0x14,0x05,0x84,0x01,
+0x0C,0x0D,0x01,0x09,0x10,0x01,0x07,0x12,0x02,0x06,0x07,0x14,0x05,0x02,0x05,0x05,
+0x14,0x05,0x02,0x04,0x05,0x14,0x05,0x02,0x04,0x04,0x14,0x05,0x02,0x03,0x05,0x14,
+0x05,0x82,0x02,0x03,0x05,0x13,0x06,0x02,0x03,0x06,0x12,0x07,0x02,0x04,0x06,0x10,
+0x0A,0x02,0x04,0x10,0x15,0x09,0x02,0x05,0x0E,0x15,0x09,0x02,0x06,0x0B,0x16,0x08,
+0x02,0x08,0x07,0x18,0x05,0x00,0x2A,0x02,0x0A,0x04,0x15,0x03,0x02,0x08,0x08,0x15,
+0x03,0x02,0x08,0x0A,0x14,0x04,0x02,0x07,0x04,0x0D,0x0A,0x02,0x07,0x03,0x0F,0x08,
+0x02,0x07,0x03,0x11,0x04,0x00,0x82,0x01,0x0D,0x06,0x81,0x01,0x0C,0x08,0x82,0x02,
+0x0B,0x04,0x10,0x05,0x81,0x02,0x0A,0x05,0x10,0x06,0x02,0x0A,0x04,0x11,0x05,0x81,
+0x02,0x09,0x05,0x12,0x05,0x02,0x09,0x04,0x12,0x05,0x02,0x08,0x05,0x12,0x06,0x02,
+0x08,0x04,0x13,0x05,0x81,0x02,0x07,0x05,0x14,0x05,0x02,0x07,0x04,0x14,0x05,0x02,
+0x06,0x05,0x14,0x06,0x02,0x06,0x05,0x15,0x05,0x02,0x06,0x04,0x15,0x05,0x02,0x05,
+0x05,0x16,0x05,0x01,0x05,0x16,0x01,0x04,0x18,0x81,0x01,0x03,0x1A,0x02,0x03,0x05,
+0x18,0x05,0x81,0x02,0x02,0x05,0x18,0x06,0x02,0x02,0x05,0x19,0x05,0x02,0x01,0x06,
+0x19,0x06,0x02,0x01,0x05,0x1A,0x05,0x81,0x02,0x00,0x06,0x1A,0x06,0x00,0x21,0x02,
+0x0A,0x04,0x12,0x04,0x94,0x02,0x0A,0x04,0x12,0x0E,0x83,0x01,0x0A,0x04,0x83,0x01,
+0x0A,0x16,0x83,0x15,0x20,0x01,0x0A,0x16,0x83,0x01,0x0A,0x04,0x83,0x02,0x0A,0x04,
+0x12,0x0E,0x83,0x02,0x0A,0x04,0x12,0x04,0x93,0x00,0x21,0x02,0x0A,0x04,0x12,0x04,
+0x94,0x02,0x00,0x0E,0x12,0x0E,0x83,0x00,0x83,0x01,0x00,0x20,0x83,0x15,0x20,0x01,
+0x00,0x20,0x83,0x00,0x83,0x02,0x00,0x0E,0x12,0x0E,0x83,0x02,0x0A,0x04,0x12,0x04,
+0x93,0x00,0x35,0x02,0x0A,0x04,0x12,0x04,0x94,0x02,0x0A,0x04,0x12,0x0E,0x83,0x01,
+0x0A,0x04,0x83,0x02,0x0A,0x04,0x12,0x0E,0x83,0x02,0x0A,0x04,0x12,0x04,0x93,0x15,
+0x0C,0x01,0x00,0x20,0x83,0x00,0x83,0x01,0x00,0x20,0x83,0x00,0x35,0x02,0x0A,0x04,
+0x12,0x04,0x94,0x02,0x00,0x0E,0x12,0x0E,0x83,0x00,0x83,0x02,0x00,0x0E,0x12,0x0E,
+0x83,0x02,0x0A,0x04,0x12,0x04,0x93,0x0A,0x19,0x01,0x05,0x01,0x02,0x04,0x03,0x1A,
+0x02,0x02,0x03,0x05,0x19,0x04,0x03,0x04,0x05,0x0D,0x06,0x18,0x04,0x03,0x05,0x05,
+0x0B,0x0A,0x17,0x04,0x01,0x06,0x14,0x01,0x07,0x12,0x02,0x08,0x06,0x12,0x06,0x02,
+0x07,0x05,0x14,0x05,0x02,0x07,0x04,0x15,0x04,0x02,0x06,0x05,0x15,0x05,0x02,0x06,
+0x04,0x16,0x04,0x83,0x02,0x06,0x05,0x15,0x05,0x02,0x07,0x04,0x15,0x04,0x02,0x07,
+0x05,0x14,0x05,0x02,0x08,0x06,0x12,0x06,0x01,0x07,0x12,0x01,0x06,0x14,0x03,0x05,
+0x04,0x0B,0x0A,0x17,0x04,0x03,0x04,0x04,0x0D,0x06,0x18,0x04,0x02,0x03,0x04,0x19,
+0x04,0x02,0x04,0x02,0x1A,0x02,0x01,0x2A,0x02,0x03,0x06,0x13,0x01,0x02,0x03,0x09,
+0x11,0x03,0x02,0x03,0x0B,0x10,0x05,0x01,0x03,0x11,0x01,0x07,0x0C,0x01,0x0A,0x08,
+0x01,0x0A,0x0A,0x01,0x09,0x0C,0x02,0x07,0x06,0x0F,0x07,0x02,0x06,0x05,0x10,0x07,
+0x02,0x07,0x03,0x11,0x07,0x01,0x12,0x06,0x01,0x13,0x06,0x01,0x0C,0x0E,0x01,0x0A,
+0x10,0x01,0x08,0x13,0x01,0x07,0x14,0x02,0x06,0x07,0x13,0x08,0x02,0x05,0x06,0x15,
+0x07,0x02,0x05,0x05,0x16,0x06,0x02,0x04,0x06,0x17,0x05,0x02,0x04,0x05,0x17,0x06,
+0x81,0x02,0x03,0x05,0x18,0x05,0x87,0x02,0x03,0x05,0x18,0x04,0x02,0x04,0x05,0x17,
+0x05,0x81,0x02,0x04,0x06,0x16,0x05,0x02,0x05,0x05,0x16,0x05,0x02,0x05,0x06,0x15,
+0x05,0x02,0x06,0x07,0x13,0x07,0x01,0x07,0x12,0x01,0x08,0x10,0x01,0x0A,0x0C,0x01,
+0x0C,0x08,0x09,0x21,0x01,0x03,0x0F,0x01,0x03,0x12,0x01,0x03,0x14,0x01,0x03,0x15,
+0x02,0x03,0x05,0x11,0x08,0x02,0x03,0x05,0x13,0x07,0x02,0x03,0x05,0x15,0x06,0x02,
+0x03,0x05,0x16,0x05,0x02,0x03,0x05,0x16,0x06,0x02,0x03,0x05,0x17,0x05,0x81,0x02,
+0x03,0x05,0x17,0x06,0x02,0x03,0x05,0x18,0x05,0x81,0x02,0x00,0x0E,0x18,0x05,0x83,
+0x02,0x03,0x05,0x18,0x05,0x82,0x02,0x03,0x05,0x17,0x05,0x82,0x02,0x03,0x05,0x16,
+0x05,0x81,0x02,0x03,0x05,0x15,0x05,0x02,0x03,0x05,0x13,0x07,0x02,0x03,0x05,0x10,
+0x09,0x01,0x03,0x15,0x01,0x03,0x14,0x01,0x03,0x12,0x01,0x03,0x0E,0x00,0x2A,0x01,
+0x0E,0x09,0x01,0x0D,0x0B,0x02,0x0C,0x06,0x13,0x06,0x02,0x0B,0x06,0x14,0x06,0x02,
+0x0A,0x05,0x16,0x05,0x02,0x09,0x05,0x17,0x05,0x00,0x82,0x01,0x06,0x17,0x83,0x01,
+0x06,0x05,0x89,0x01,0x06,0x14,0x83,0x01,0x06,0x05,0x8A,0x01,0x06,0x18,0x83,0x00,
+0x2A,0x02,0x08,0x04,0x15,0x04,0x83,0x00,0x84,0x01,0x06,0x17,0x83,0x01,0x06,0x05,
+0x89,0x01,0x06,0x14,0x83,0x01,0x06,0x05,0x8A,0x01,0x06,0x18,0x83,0x00,0x2A,0x01,
+0x0A,0x06,0x01,0x0B,0x06,0x01,0x0C,0x06,0x01,0x0E,0x05,0x01,0x0F,0x05,0x01,0x10,
+0x05,0x00,0x82,0x01,0x06,0x17,0x83,0x01,0x06,0x05,0x89,0x01,0x06,0x14,0x83,0x01,
+0x06,0x05,0x8A,0x01,0x06,0x18,0x83,0x0E,0x1C,0x01,0x05,0x0F,0x83,0x01,0x0F,0x05,
+0x97,0x00,0x2A,0x01,0x11,0x06,0x01,0x10,0x06,0x01,0x0F,0x06,0x01,0x0E,0x05,0x01,
+0x0D,0x05,0x01,0x0C,0x05,0x00,0x82,0x01,0x04,0x17,0x83,0x01,0x0D,0x05,0x98,0x01,
+0x04,0x17,0x83,0x00,0x2A,0x01,0x0C,0x09,0x01,0x0B,0x0B,0x02,0x0A,0x06,0x11,0x06,
+0x02,0x09,0x06,0x12,0x06,0x02,0x08,0x05,0x14,0x05,0x02,0x07,0x05,0x15,0x05,0x00,
+0x82,0x01,0x04,0x17,0x83,0x01,0x0D,0x05,0x98,0x01,0x04,0x17,0x83,0x00,0x2A,0x02,
+0x07,0x04,0x14,0x04,0x83,0x00,0x84,0x01,0x04,0x17,0x83,0x01,0x0D,0x05,0x98,0x01,
+0x04,0x17,0x83,0x00,0x1D,0x01,0x0E,0x04,0x98,0x01,0x00,0x12,0x83,0x19,0x1C,0x01,
+0x0E,0x12,0x83,0x01,0x0E,0x04,0x97,0x00,0x35,0x01,0x00,0x20,0xB4,0x1B,0x1A,0x01,
+0x00,0x20,0x99,0x01,0x31,0x01,0x0E,0x04,0x92,0x00,0x8A,0x01,0x0E,0x04,0x92,0x00,
+0x2A,0x01,0x09,0x06,0x01,0x0A,0x06,0x01,0x0B,0x06,0x01,0x0D,0x05,0x01,0x0E,0x05,
+0x01,0x0F,0x05,0x00,0x82,0x01,0x04,0x17,0x83,0x01,0x0D,0x05,0x98,0x01,0x04,0x17,
+0x83,0x00,0x1B,0x01,0x00,0x20,0x9A,0x00,0x2B,0x01,0x11,0x06,0x01,0x10,0x06,0x01,
+0x0F,0x06,0x01,0x0E,0x05,0x01,0x0D,0x05,0x01,0x0C,0x05,0x00,0x81,0x01,0x0C,0x08,
+0x01,0x0A,0x0C,0x01,0x08,0x10,0x01,0x07,0x12,0x02,0x06,0x07,0x13,0x07,0x02,0x05,
+0x06,0x15,0x06,0x02,0x05,0x05,0x16,0x05,0x02,0x04,0x05,0x17,0x05,0x81,0x02,0x03,
+0x05,0x18,0x05,0x82,0x02,0x02,0x05,0x19,0x05,0x8A,0x02,0x03,0x05,0x18,0x05,0x82,
+0x02,0x04,0x05,0x17,0x05,0x81,0x02,0x05,0x05,0x16,0x05,0x02,0x05,0x06,0x15,0x06,
+0x02,0x06,0x07,0x13,0x07,0x01,0x07,0x12,0x01,0x08,0x10,0x01,0x0A,0x0C,0x01,0x0C,
+0x08,0x00,0x2B,0x01,0x0A,0x08,0x01,0x08,0x0D,0x01,0x06,0x10,0x01,0x06,0x11,0x02,
+0x05,0x06,0x11,0x07,0x02,0x05,0x05,0x12,0x06,0x02,0x04,0x06,0x13,0x05,0x02,0x04,
+0x05,0x13,0x05,0x82,0x02,0x04,0x05,0x13,0x04,0x02,0x04,0x05,0x12,0x05,0x02,0x04,
+0x05,0x12,0x04,0x02,0x04,0x05,0x11,0x05,0x02,0x04,0x05,0x10,0x05,0x02,0x04,0x05,
+0x10,0x04,0x02,0x04,0x05,0x0F,0x05,0x02,0x04,0x05,0x0F,0x04,0x02,0x04,0x05,0x0E,
+0x05,0x81,0x02,0x04,0x05,0x0E,0x06,0x02,0x04,0x05,0x0E,0x07,0x02,0x04,0x05,0x0F,
+0x07,0x02,0x04,0x05,0x0F,0x08,0x02,0x04,0x05,0x10,0x08,0x02,0x04,0x05,0x11,0x08,
+0x02,0x04,0x05,0x12,0x08,0x02,0x04,0x05,0x13,0x08,0x02,0x04,0x05,0x14,0x08,0x02,
+0x04,0x05,0x15,0x08,0x02,0x04,0x05,0x17,0x06,0x02,0x04,0x05,0x18,0x06,0x81,0x02,
+0x04,0x05,0x19,0x05,0x83,0x03,0x04,0x05,0x0D,0x01,0x18,0x06,0x03,0x04,0x05,0x0D,
+0x04,0x17,0x06,0x02,0x04,0x05,0x0D,0x10,0x02,0x04,0x05,0x0D,0x0F,0x02,0x04,0x05,
+0x0D,0x0D,0x01,0x11,0x07,0x00,0x2B,0x01,0x0C,0x09,0x01,0x0B,0x0B,0x02,0x0A,0x06,
+0x11,0x06,0x02,0x09,0x06,0x12,0x06,0x02,0x08,0x05,0x14,0x05,0x02,0x07,0x05,0x15,
+0x05,0x00,0x81,0x01,0x0C,0x08,0x01,0x0A,0x0C,0x01,0x08,0x10,0x01,0x07,0x12,0x02,
+0x06,0x07,0x13,0x07,0x02,0x05,0x06,0x15,0x06,0x02,0x05,0x05,0x16,0x05,0x02,0x04,
+0x05,0x17,0x05,0x81,0x02,0x03,0x05,0x18,0x05,0x82,0x02,0x02,0x05,0x19,0x05,0x8A,
+0x02,0x03,0x05,0x18,0x05,0x82,0x02,0x04,0x05,0x17,0x05,0x81,0x02,0x05,0x05,0x16,
+0x05,0x02,0x05,0x06,0x15,0x06,0x02,0x06,0x07,0x13,0x07,0x01,0x07,0x12,0x01,0x08,
+0x10,0x01,0x0A,0x0C,0x01,0x0C,0x08,0x00,0x2B,0x01,0x09,0x06,0x01,0x0A,0x06,0x01,
+0x0B,0x06,0x01,0x0D,0x05,0x01,0x0E,0x05,0x01,0x0F,0x05,0x00,0x81,0x01,0x0C,0x08,
+0x01,0x0A,0x0C,0x01,0x08,0x10,0x01,0x07,0x12,0x02,0x06,0x07,0x13,0x07,0x02,0x05,
+0x06,0x15,0x06,0x02,0x05,0x05,0x16,0x05,0x02,0x04,0x05,0x17,0x05,0x81,0x02,0x03,
+0x05,0x18,0x05,0x82,0x02,0x02,0x05,0x19,0x05,0x8A,0x02,0x03,0x05,0x18,0x05,0x82,
+0x02,0x04,0x05,0x17,0x05,0x81,0x02,0x05,0x05,0x16,0x05,0x02,0x05,0x06,0x15,0x06,
+0x02,0x06,0x07,0x13,0x07,0x01,0x07,0x12,0x01,0x08,0x10,0x01,0x0A,0x0C,0x01,0x0C,
+0x08,0x03,0x28,0x02,0x0A,0x04,0x15,0x03,0x02,0x08,0x08,0x15,0x03,0x02,0x08,0x0A,
+0x14,0x04,0x02,0x07,0x04,0x0D,0x0A,0x02,0x07,0x03,0x0F,0x08,0x02,0x07,0x03,0x11,
+0x04,0x00,0x84,0x01,0x0C,0x08,0x01,0x09,0x0E,0x01,0x08,0x10,0x01,0x07,0x12,0x02,
+0x06,0x07,0x13,0x07,0x02,0x05,0x06,0x15,0x06,0x02,0x05,0x05,0x16,0x05,0x02,0x04,
+0x06,0x16,0x06,0x02,0x04,0x05,0x17,0x05,0x81,0x02,0x03,0x05,0x18,0x05,0x88,0x02,
+0x04,0x05,0x17,0x05,0x81,0x02,0x04,0x06,0x16,0x06,0x02,0x05,0x05,0x16,0x05,0x02,
+0x05,0x06,0x15,0x06,0x02,0x06,0x07,0x13,0x07,0x01,0x07,0x12,0x01,0x08,0x10,0x01,
+0x09,0x0E,0x01,0x0C,0x08,0x00,0x2B,0x02,0x0A,0x04,0x15,0x03,0x02,0x08,0x08,0x15,
+0x03,0x02,0x08,0x0A,0x14,0x04,0x02,0x07,0x04,0x0D,0x0A,0x02,0x07,0x03,0x0F,0x08,
+0x02,0x07,0x03,0x11,0x04,0x00,0x81,0x01,0x0C,0x08,0x01,0x0A,0x0C,0x01,0x08,0x10,
+0x01,0x07,0x12,0x02,0x06,0x07,0x13,0x07,0x02,0x05,0x06,0x15,0x06,0x02,0x05,0x05,
+0x16,0x05,0x02,0x04,0x05,0x17,0x05,0x81,0x02,0x03,0x05,0x18,0x05,0x82,0x02,0x02,
+0x05,0x19,0x05,0x8A,0x02,0x03,0x05,0x18,0x05,0x82,0x02,0x04,0x05,0x17,0x05,0x81,
+0x02,0x05,0x05,0x16,0x05,0x02,0x05,0x06,0x15,0x06,0x02,0x06,0x07,0x13,0x07,0x01,
+0x07,0x12,0x01,0x08,0x10,0x01,0x0A,0x0C,0x01,0x0C,0x08,0x0E,0x27,0x02,0x05,0x05,
+0x17,0x05,0x92,0x02,0x05,0x06,0x16,0x06,0x81,0x02,0x05,0x07,0x15,0x07,0x02,0x05,
+0x08,0x14,0x08,0x02,0x05,0x09,0x13,0x09,0x02,0x05,0x11,0x17,0x05,0x02,0x05,0x11,
+0x17,0x06,0x03,0x05,0x05,0x0B,0x0A,0x18,0x05,0x03,0x05,0x05,0x0C,0x08,0x18,0x05,
+0x02,0x05,0x05,0x0E,0x05,0x01,0x05,0x05,0x89,0x01,0x33,0x01,0x05,0x05,0x8C,0x02,
+0x05,0x05,0x10,0x06,0x02,0x05,0x05,0x0E,0x0A,0x02,0x05,0x05,0x0D,0x0C,0x02,0x05,
+0x05,0x0C,0x0E,0x03,0x05,0x05,0x0B,0x05,0x14,0x07,0x02,0x05,0x09,0x16,0x05,0x02,
+0x05,0x07,0x17,0x05,0x02,0x05,0x06,0x17,0x05,0x81,0x02,0x05,0x05,0x18,0x05,0x89,
+0x02,0x05,0x05,0x17,0x05,0x81,0x02,0x05,0x05,0x16,0x06,0x02,0x05,0x06,0x16,0x05,
+0x02,0x05,0x08,0x15,0x06,0x02,0x05,0x09,0x13,0x07,0x01,0x05,0x14,0x02,0x05,0x05,
+0x0B,0x0D,0x02,0x05,0x05,0x0C,0x0B,0x02,0x05,0x05,0x0E,0x07,0x01,0x05,0x05,0x88,
+0x09,0x21,0x01,0x06,0x05,0x85,0x01,0x06,0x11,0x01,0x06,0x14,0x01,0x06,0x15,0x01,
+0x06,0x16,0x02,0x06,0x05,0x15,0x08,0x02,0x06,0x05,0x17,0x06,0x02,0x06,0x05,0x18,
+0x06,0x02,0x06,0x05,0x19,0x05,0x84,0x02,0x06,0x05,0x18,0x05,0x02,0x06,0x05,0x17,
+0x06,0x02,0x06,0x05,0x16,0x07,0x02,0x06,0x05,0x13,0x09,0x01,0x06,0x15,0x01,0x06,
+0x13,0x01,0x06,0x11,0x01,0x06,0x0E,0x01,0x06,0x05,0x86,0x00,0x2B,0x01,0x12,0x06,
+0x01,0x11,0x06,0x01,0x10,0x06,0x01,0x0F,0x05,0x01,0x0E,0x05,0x01,0x0D,0x05,0x00,
+0x82,0x02,0x04,0x05,0x18,0x05,0x98,0x02,0x05,0x05,0x17,0x05,0x81,0x02,0x05,0x06,
+0x16,0x06,0x02,0x06,0x06,0x15,0x06,0x02,0x06,0x07,0x14,0x07,0x01,0x07,0x13,0x01,
+0x08,0x11,0x01,0x0A,0x0D,0x01,0x0C,0x09,0x00,0x2B,0x01,0x0C,0x09,0x01,0x0B,0x0B,
+0x02,0x0A,0x06,0x11,0x06,0x02,0x09,0x06,0x12,0x06,0x02,0x08,0x05,0x14,0x05,0x02,
+0x07,0x05,0x15,0x05,0x00,0x82,0x02,0x04,0x05,0x18,0x05,0x98,0x02,0x05,0x05,0x17,
+0x05,0x81,0x02,0x05,0x06,0x16,0x06,0x02,0x06,0x06,0x15,0x06,0x02,0x06,0x07,0x14,
+0x07,0x01,0x07,0x13,0x01,0x08,0x11,0x01,0x0A,0x0D,0x01,0x0C,0x09,0x00,0x2B,0x01,
+0x09,0x06,0x01,0x0A,0x06,0x01,0x0B,0x06,0x01,0x0D,0x05,0x01,0x0E,0x05,0x01,0x0F,
+0x05,0x00,0x82,0x02,0x04,0x05,0x18,0x05,0x98,0x02,0x05,0x05,0x17,0x05,0x81,0x02,
+0x05,0x06,0x16,0x06,0x02,0x06,0x06,0x15,0x06,0x02,0x06,0x07,0x14,0x07,0x01,0x07,
+0x13,0x01,0x08,0x11,0x01,0x0A,0x0D,0x01,0x0C,0x09,0x00,0x34,0x01,0x13,0x05,0x01,
+0x12,0x05,0x01,0x11,0x05,0x01,0x10,0x05,0x01,0x10,0x04,0x01,0x0F,0x04,0x01,0x0E,
+0x04,0x01,0x0D,0x04,0x00,0x85,0x02,0x02,0x06,0x1A,0x05,0x02,0x03,0x05,0x1A,0x04,
+0x02,0x03,0x06,0x19,0x05,0x02,0x04,0x05,0x19,0x04,0x02,0x04,0x06,0x18,0x05,0x02,
+0x04,0x06,0x18,0x04,0x02,0x05,0x05,0x17,0x05,0x02,0x05,0x06,0x17,0x05,0x02,0x06,
+0x05,0x16,0x05,0x02,0x06,0x06,0x16,0x05,0x02,0x07,0x05,0x15,0x05,0x02,0x07,0x06,
+0x15,0x05,0x02,0x08,0x05,0x15,0x04,0x02,0x08,0x06,0x14,0x05,0x02,0x09,0x05,0x14,
+0x04,0x02,0x09,0x06,0x13,0x05,0x02,0x09,0x06,0x13,0x04,0x02,0x0A,0x05,0x12,0x05,
+0x02,0x0A,0x06,0x12,0x04,0x02,0x0B,0x05,0x11,0x05,0x01,0x0B,0x0B,0x01,0x0C,0x09,
+0x81,0x01,0x0D,0x07,0x81,0x01,0x0E,0x05,0x81,0x01,0x0E,0x04,0x01,0x0D,0x05,0x01,
+0x0D,0x04,0x01,0x0C,0x05,0x01,0x0B,0x05,0x81,0x01,0x09,0x06,0x01,0x03,0x0C,0x01,
+0x03,0x0B,0x01,0x03,0x09,0x01,0x03,0x07,0x00,0x2A,0x01,0x12,0x06,0x01,0x11,0x06,
+0x01,0x10,0x06,0x01,0x0F,0x05,0x01,0x0E,0x05,0x01,0x0D,0x05,0x00,0x82,0x02,0x01,
+0x06,0x1B,0x05,0x02,0x02,0x06,0x1A,0x05,0x02,0x03,0x06,0x19,0x05,0x81,0x02,0x04,
+0x06,0x18,0x05,0x02,0x05,0x05,0x17,0x05,0x02,0x05,0x06,0x17,0x05,0x02,0x06,0x06,
+0x16,0x05,0x02,0x07,0x05,0x15,0x05,0x02,0x07,0x06,0x15,0x05,0x02,0x08,0x06,0x14,
+0x05,0x02,0x09,0x05,0x13,0x05,0x02,0x09,0x06,0x13,0x05,0x02,0x0A,0x06,0x12,0x05,
+0x02,0x0B,0x05,0x11,0x05,0x01,0x0B,0x0B,0x01,0x0C,0x09,0x01,0x0D,0x07,0x81,0x01,
+0x0E,0x05,0x8D,0x00,0x04,0x01,0x00,0x20,0x83,0x00,0x06,0x01,0x0F,0x06,0x01,0x0E,
+0x06,0x01,0x0D,0x06,0x01,0x0C,0x05,0x01,0x0B,0x05,0x01,0x0A,0x05,0x18,0x04,0x01,
+0x05,0x16,0x83,0x0E,0x1C,0x01,0x0E,0x04,0x87,0x01,0x02,0x1C,0x83,0x01,0x0E,0x04,
+0x87,0x00,0x83,0x01,0x02,0x1C,0x83,0x2A,0x0B,0x01,0x00,0x20,0x83,0x00,0x83,0x01,
+0x00,0x20,0x82,0x03,0x28,0x02,0x02,0x09,0x1B,0x05,0x02,0x01,0x0C,0x1A,0x05,0x02,
+0x01,0x0D,0x19,0x05,0x03,0x01,0x02,0x09,0x06,0x19,0x05,0x02,0x0A,0x05,0x18,0x05,
+0x02,0x0A,0x05,0x17,0x05,0x02,0x0A,0x04,0x17,0x05,0x02,0x08,0x06,0x16,0x05,0x02,
+0x03,0x09,0x15,0x05,0x02,0x03,0x07,0x15,0x05,0x02,0x03,0x09,0x14,0x05,0x02,0x07,
+0x07,0x14,0x05,0x02,0x09,0x05,0x13,0x05,0x02,0x0A,0x05,0x12,0x05,0x81,0x02,0x0A,
+0x05,0x11,0x05,0x03,0x01,0x02,0x09,0x06,0x10,0x05,0x02,0x01,0x0D,0x10,0x05,0x02,
+0x01,0x0C,0x0F,0x05,0x03,0x02,0x08,0x0E,0x05,0x17,0x06,0x02,0x0E,0x05,0x16,0x07,
+0x02,0x0D,0x05,0x16,0x07,0x02,0x0C,0x05,0x15,0x08,0x03,0x0C,0x05,0x14,0x03,0x18,
+0x05,0x03,0x0B,0x05,0x13,0x03,0x18,0x05,0x03,0x0A,0x05,0x12,0x03,0x18,0x05,0x03,
+0x0A,0x05,0x11,0x03,0x18,0x05,0x03,0x09,0x05,0x10,0x04,0x18,0x05,0x03,0x08,0x05,
+0x0F,0x04,0x18,0x05,0x03,0x08,0x05,0x0F,0x03,0x18,0x05,0x03,0x07,0x05,0x0E,0x03,
+0x18,0x05,0x02,0x07,0x05,0x0E,0x12,0x02,0x06,0x05,0x0E,0x12,0x02,0x05,0x05,0x0E,
+0x12,0x02,0x05,0x05,0x18,0x05,0x02,0x04,0x05,0x18,0x05,0x02,0x03,0x05,0x18,0x05,
+0x81,0x02,0x02,0x05,0x18,0x05,0x01,0x01,0x05,0x04,0x2E,0x01,0x09,0x11,0x01,0x06,
+0x14,0x01,0x05,0x15,0x02,0x04,0x0C,0x17,0x03,0x81,0x02,0x03,0x0D,0x17,0x03,0x86,
+0x02,0x04,0x0C,0x17,0x03,0x81,0x02,0x05,0x0B,0x17,0x03,0x02,0x06,0x0A,0x17,0x03,
+0x02,0x07,0x09,0x17,0x03,0x02,0x09,0x07,0x17,0x03,0x02,0x0B,0x05,0x17,0x03,0x02,
+0x0D,0x03,0x17,0x03,0x9A,0x03,0x2F,0x01,0x0E,0x09,0x01,0x0B,0x0F,0x01,0x09,0x11,
+0x01,0x08,0x12,0x02,0x07,0x07,0x16,0x04,0x01,0x07,0x05,0x01,0x06,0x05,0x83,0x01,
+0x06,0x06,0x01,0x07,0x06,0x01,0x07,0x08,0x01,0x08,0x09,0x01,0x09,0x0A,0x01,0x0A,
+0x0B,0x01,0x09,0x0E,0x02,0x08,0x04,0x0E,0x0A,0x02,0x07,0x05,0x10,0x09,0x02,0x07,
+0x04,0x12,0x08,0x02,0x06,0x05,0x14,0x06,0x02,0x06,0x05,0x15,0x06,0x81,0x02,0x06,
+0x05,0x16,0x05,0x02,0x06,0x06,0x16,0x05,0x02,0x07,0x06,0x16,0x05,0x02,0x07,0x08,
+0x16,0x04,0x02,0x08,0x08,0x15,0x05,0x02,0x09,0x09,0x15,0x04,0x01,0x0A,0x0E,0x01,
+0x0C,0x0B,0x01,0x0D,0x0A,0x01,0x10,0x08,0x01,0x11,0x08,0x01,0x13,0x07,0x01,0x14,
+0x06,0x01,0x15,0x06,0x01,0x16,0x05,0x82,0x02,0x06,0x01,0x16,0x05,0x02,0x06,0x03,
+0x15,0x05,0x02,0x06,0x06,0x13,0x07,0x01,0x06,0x13,0x01,0x06,0x12,0x01,0x08,0x0E,
+0x01,0x0B,0x09,0x0F,0x1B,0x01,0x0D,0x06,0x85,0x00,0x84,0x01,0x02,0x1B,0x83,0x00,
+0x85,0x01,0x0D,0x06,0x85,0x2A,0x0B,0x01,0x0F,0x03,0x01,0x0F,0x02,0x01,0x0E,0x03,
+0x01,0x0E,0x06,0x01,0x0D,0x08,0x01,0x11,0x05,0x01,0x12,0x04,0x81,0x01,0x11,0x05,
+0x01,0x0D,0x08,0x01,0x0D,0x06,0x03,0x0B,0x01,0x0D,0x05,0x01,0x0C,0x07,0x02,0x0B,
+0x03,0x11,0x03,0x02,0x0A,0x03,0x12,0x03,0x02,0x0A,0x02,0x13,0x02,0x82,0x02,0x0A,
+0x03,0x12,0x03,0x02,0x0B,0x03,0x11,0x03,0x01,0x0C,0x07,0x01,0x0D,0x05,0x00,0x04,
+0x02,0x07,0x04,0x14,0x04,0x83,0x19,0x06,0x01,0x0D,0x06,0x85,0x03,0x14,0x01,0x0E,
+0x05,0x01,0x09,0x0A,0x82,0x01,0x0E,0x05,0x8F,0x03,0x14,0x01,0x0C,0x09,0x01,0x08,
+0x10,0x81,0x02,0x08,0x04,0x13,0x06,0x02,0x08,0x01,0x14,0x05,0x01,0x14,0x05,0x01,
+0x13,0x05,0x01,0x11,0x07,0x01,0x0B,0x0B,0x01,0x0B,0x09,0x01,0x0B,0x0B,0x01,0x11,
+0x07,0x01,0x13,0x06,0x01,0x14,0x05,0x82,0x02,0x08,0x04,0x12,0x07,0x01,0x08,0x10,
+0x01,0x08,0x0F,0x01,0x0B,0x09,0x03,0x14,0x01,0x0B,0x0A,0x01,0x08,0x0F,0x01,0x08,
+0x10,0x02,0x08,0x04,0x12,0x07,0x02,0x08,0x01,0x14,0x05,0x01,0x14,0x05,0x82,0x01,
+0x12,0x06,0x01,0x11,0x06,0x01,0x0F,0x07,0x01,0x0D,0x07,0x01,0x0C,0x06,0x01,0x0A,
+0x06,0x01,0x09,0x05,0x01,0x08,0x05,0x01,0x08,0x11,0x83,0x0E,0x1C,0x01,0x02,0x1C,
+0x9B,0xFF,
+};
+#endif
@@ -4,15 +4,66 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/semphr.h"
 #include "freertos/task.h"
+#include "freertos/queue.h"
+#include "esp_attr.h"
+#include "esp_timer.h"
+
+#include <stdlib.h>
 
 
 static volatile bool input_task_is_running = false;
-static volatile odroid_gamepad_state gamepad_state;
-static odroid_gamepad_state previous_gamepad_state;
-static uint8_t debounce[ODROID_INPUT_MAX];
 static volatile bool input_gamepad_initialized = false;
-static SemaphoreHandle_t xSemaphore;
 
+// Buttons and change count, see input_snapshot. Only the input task writes
+// it, readers load it without a lock.
+static uint32_t input_state;
+_Static_assert(ODROID_INPUT_MAX <= 16, "buttons must fit the low half of input_state");
+
+// In ODROID_INPUT_* order
+static const gpio_num_t input_pins[ODROID_INPUT_MAX] =
+{
+    ODROID_GAMEPAD_IO_UP, ODROID_GAMEPAD_IO_RIGHT, ODROID_GAMEPAD_IO_DOWN, ODROID_GAMEPAD_IO_LEFT,
+    ODROID_GAMEPAD_IO_SELECT, ODROID_GAMEPAD_IO_START, ODROID_GAMEPAD_IO_A, ODROID_GAMEPAD_IO_B,
+    ODROID_GAMEPAD_IO_MENU, ODROID_GAMEPAD_IO_VOLUME,
+};
+
+// Written by the edge interrupt: first edge since the pin was last stable
+// (0 = none) and the latest edge
+static portMUX_TYPE input_edge_lock = portMUX_INITIALIZER_UNLOCKED;
+static int64_t input_edge_first[ODROID_INPUT_MAX];
+static int64_t input_edge_last[ODROID_INPUT_MAX];
+
+// Given by the interrupt and by the timer, which runs out when a pin has
+// settled or a repeat is due
+static SemaphoreHandle_t input_wake;
+static esp_timer_handle_t input_timer;
+static QueueHandle_t input_events;
+
+// Statistics and repeat settings
+static SemaphoreHandle_t input_lock;
+static odroid_input_stats input_stats;
+static odroid_input_repeat input_repeat;
+
+// Of the buttons held down, 0 = no repeat due
+static int64_t input_repeat_next[ODROID_INPUT_MAX];
+static uint32_t input_repeat_interval[ODROID_INPUT_MAX];
+static uint16_t input_repeat_count[ODROID_INPUT_MAX];
+
+// Recording, under input_lock (NULL = not recording)
+static odroid_input_record* input_records;
+static int input_record_count;
+static int input_record_max;
+static int64_t input_record_time;
+
+// Replay: the buttons it holds down and the next event, which its timer plays
+#define INPUT_REPLAY_WAIT_US (1000)
+static volatile bool input_replaying;
+static volatile uint16_t input_replay_buttons;
+static odroid_input_record* input_replay_records;
+static int input_replay_count;
+static volatile int input_replay_next;
+static int64_t input_replay_time;
+static esp_timer_handle_t input_replay_timer;
 
 
 
@@ -20,6 +71,16 @@ odroid_gamepad_state input_read_raw()
 {
     odroid_gamepad_state state = {0};
 
+    if (input_replaying)
+    {
+        const uint16_t buttons = input_replay_buttons;
+        for (int i = 0; i < ODROID_INPUT_MAX; ++i)
+        {
+            state.values[i] = (buttons >> i) & 1;
+        }
+        return state;
+    }
+
     state.values[ODROID_INPUT_UP] = !(gpio_get_level(ODROID_GAMEPAD_IO_UP));
     state.values[ODROID_INPUT_DOWN] = !(gpio_get_level(ODROID_GAMEPAD_IO_DOWN));
     state.values[ODROID_INPUT_LEFT] = !(gpio_get_level(ODROID_GAMEPAD_IO_LEFT));
@@ -37,72 +98,416 @@ odroid_gamepad_state input_read_raw()
     return state;
 }
 
+uint32_t input_snapshot()
+{
+    return __atomic_load_n(&input_state, __ATOMIC_ACQUIRE);
+}
+
+int input_snapshot_missed(uint32_t before, uint32_t after)
+{
+    const uint16_t changes = INPUT_SNAPSHOT_CHANGES(after) - INPUT_SNAPSHOT_CHANGES(before);
+    return changes - __builtin_popcount(INPUT_SNAPSHOT_BUTTONS(before) ^ INPUT_SNAPSHOT_BUTTONS(after));
+}
+
 void input_read(odroid_gamepad_state* out_state)
 {
     if (!input_gamepad_initialized) abort();
 
-    xSemaphoreTake(xSemaphore, portMAX_DELAY);
+    const uint16_t buttons = INPUT_SNAPSHOT_BUTTONS(input_snapshot());
+    for (int i = 0; i < ODROID_INPUT_MAX; ++i)
+    {
+        out_state->values[i] = (buttons >> i) & 1;
+    }
+}
+
+bool input_wait_event(odroid_input_event* out_event, uint32_t timeout_ms)
+{
+    // Rounded up, a timeout shorter than a tick must still wait
+    const TickType_t ticks = (timeout_ms == portMAX_DELAY) ? portMAX_DELAY :
+        (timeout_ms + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS;
+    if (xQueueReceive(input_events, out_event, ticks) != pdTRUE) return false;
+
+    const int64_t latency = esp_timer_get_time() - out_event->time;
 
-    *out_state = gamepad_state;
+    xSemaphoreTake(input_lock, portMAX_DELAY);
+    ++input_stats.received;
+    input_stats.latency_total_us += latency;
+    if (latency > input_stats.latency_max_us) input_stats.latency_max_us = latency;
+    xSemaphoreGive(input_lock);
 
-    xSemaphoreGive(xSemaphore);
+    return true;
 }
 
-static void input_task(void *arg)
+void input_flush_events()
 {
-    input_task_is_running = true;
+    xQueueReset(input_events);
+}
+
+int input_pending_events()
+{
+    return uxQueueMessagesWaiting(input_events);
+}
+
+void input_set_repeat(const odroid_input_repeat* repeat)
+{
+    xSemaphoreTake(input_lock, portMAX_DELAY);
+    input_repeat = *repeat;
+    xSemaphoreGive(input_lock);
+
+    // Held buttons keep repeating with the old timing until released
+}
+
+void input_get_stats(odroid_input_stats* out_stats)
+{
+    xSemaphoreTake(input_lock, portMAX_DELAY);
+    *out_stats = input_stats;
+    xSemaphoreGive(input_lock);
+}
+
+void input_record_start(int max_events)
+{
+    odroid_input_record* records = malloc(max_events * sizeof(odroid_input_record));
+    if (!records) abort();
+
+    xSemaphoreTake(input_lock, portMAX_DELAY);
+    free(input_records);
+    input_records = records;
+    input_record_count = 0;
+    input_record_max = max_events;
+    input_record_time = esp_timer_get_time();
+    xSemaphoreGive(input_lock);
+}
+
+int input_record_stop(FILE* file)
+{
+    xSemaphoreTake(input_lock, portMAX_DELAY);
+    odroid_input_record* records = input_records;
+    const int count = input_record_count;
+    input_records = NULL;
+    xSemaphoreGive(input_lock);
+
+    for (int i = 0; file && i < count; ++i)
+    {
+        fprintf(file, "input_event us=%u button=%u pressed=%d\n",
+            (unsigned)records[i].time_us, (unsigned)records[i].button, records[i].pressed ? 1 : 0);
+    }
+
+    free(records);
+
+    return count;
+}
+
+// Marks the replay's next change as edges, in the esp_timer task
+static void input_replay_step(void* arg)
+{
+    const int64_t now = esp_timer_get_time();
+    int64_t delay = 0;
+    bool finished = false;
+
+    // Stopping frees the events under the same lock
+    portENTER_CRITICAL(&input_edge_lock);
+    int next = input_replay_next;
+    if (input_replaying && next < input_replay_count)
+    {
+        // A change the input task has not published yet would be undone
+        // before it is seen: wait for it
+        const uint16_t published = INPUT_SNAPSHOT_BUTTONS(input_snapshot());
+        const uint32_t due = input_replay_records[next].time_us;
+
+        if (((input_replay_buttons ^ published) >> input_replay_records[next].button) & 1)
+        {
+            delay = INPUT_REPLAY_WAIT_US;
+        }
+        else
+        {
+            // Late: the rest moves with it, so presses keep their length
+            if (input_replay_time + due < now) input_replay_time = now - due;
+
+            while (next < input_replay_count && input_replay_records[next].time_us == due &&
+                !(((input_replay_buttons ^ published) >> input_replay_records[next].button) & 1))
+            {
+                const odroid_input_record* record = &input_replay_records[next++];
+
+                if (record->pressed) input_replay_buttons |= 1u << record->button;
+                else input_replay_buttons &= ~(1u << record->button);
+
+                if (!input_edge_first[record->button]) input_edge_first[record->button] = input_replay_time + due;
+                input_edge_last[record->button] = input_replay_time + due;
+            }
+
+            // After the last one, come back to see it published
+            delay = INPUT_REPLAY_WAIT_US;
+            if (next < input_replay_count) delay = input_replay_time + input_replay_records[next].time_us - now;
+            if (delay < 1) delay = 1;
+        }
+    }
+    else if (input_replaying)
+    {
+        // All played: the pins are the buttons again once the task has
+        // published the last change
+        finished = input_replay_buttons == INPUT_SNAPSHOT_BUTTONS(input_snapshot());
+        if (!finished) delay = INPUT_REPLAY_WAIT_US;
+    }
+    input_replay_next = next;
+    portEXIT_CRITICAL(&input_edge_lock);
 
-    // Initialize state
-    for(int i = 0; i < ODROID_INPUT_MAX; ++i)
+    xSemaphoreGive(input_wake);
+
+    if (finished) input_replay_stop();
+    if (delay) esp_timer_start_once(input_replay_timer, delay);
+}
+
+bool input_replay_start(FILE* file)
+{
+    input_replay_stop();
+
+    int max = 64;
+    int count = 0;
+    odroid_input_record* records = malloc(max * sizeof(odroid_input_record));
+    if (!records) abort();
+
+    char line[80];
+    uint32_t previous = 0;
+    while (fgets(line, sizeof(line), file))
+    {
+        unsigned time, button, pressed;
+        if (sscanf(line, "input_event us=%u button=%u pressed=%u", &time, &button, &pressed) != 3) continue;
+
+        // Out of order events would never be played
+        if (button >= ODROID_INPUT_MAX || time < previous) continue;
+        previous = time;
+
+        if (count == max)
+        {
+            max *= 2;
+            records = realloc(records, max * sizeof(odroid_input_record));
+            if (!records) abort();
+        }
+
+        records[count].time_us = time;
+        records[count].button = button;
+        records[count].pressed = pressed != 0;
+        ++count;
+    }
+
+    if (count == 0)
+    {
+        free(records);
+        return false;
+    }
+
+    // From the buttons shown now, so the first events are changes
+    portENTER_CRITICAL(&input_edge_lock);
+    input_replay_buttons = INPUT_SNAPSHOT_BUTTONS(input_snapshot());
+    input_replay_records = records;
+    input_replay_count = count;
+    input_replay_next = 0;
+    input_replay_time = esp_timer_get_time();
+    input_replaying = true;
+    portEXIT_CRITICAL(&input_edge_lock);
+
+    esp_timer_start_once(input_replay_timer, records[0].time_us);
+
+    printf("%s: %d events, %ums.\n", __func__, count, (unsigned)(records[count - 1].time_us / 1000));
+
+    return true;
+}
+
+bool input_replay_done()
+{
+    return !input_replaying || input_replay_next == input_replay_count;
+}
+
+void input_replay_stop()
+{
+    if (!input_replaying) return;
+
+    esp_timer_stop(input_replay_timer);
+
+    // The task compares every pin with the published state
+    const int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&input_edge_lock);
+    if (!input_replaying)
+    {
+        // Ended by itself meanwhile
+        portEXIT_CRITICAL(&input_edge_lock);
+        return;
+    }
+    input_replaying = false;
+    odroid_input_record* records = input_replay_records;
+    input_replay_records = NULL;
+    input_replay_count = 0;
+    for (int i = 0; i < ODROID_INPUT_MAX; ++i)
     {
-        debounce[i] = 0xff;
+        if (!input_edge_first[i]) input_edge_first[i] = now;
+        input_edge_last[i] = now;
     }
+    portEXIT_CRITICAL(&input_edge_lock);
 
+    xSemaphoreGive(input_wake);
+    free(records);
+}
+
+static void IRAM_ATTR input_isr(void* arg)
+{
+    // The pins are not the buttons during a replay
+    if (input_replaying) return;
+
+    const int i = (int)(intptr_t)arg;
+    const int64_t now = esp_timer_get_time();
+
+    portENTER_CRITICAL_ISR(&input_edge_lock);
+    if (!input_edge_first[i]) input_edge_first[i] = now;
+    input_edge_last[i] = now;
+    portEXIT_CRITICAL_ISR(&input_edge_lock);
+
+    BaseType_t woken = pdFALSE;
+    xSemaphoreGiveFromISR(input_wake, &woken);
+    if (woken) portYIELD_FROM_ISR();
+}
+
+static void input_timer_expired(void* arg)
+{
+    xSemaphoreGive(input_wake);
+}
+
+static void input_task(void *arg)
+{
+    input_task_is_running = true;
 
     while(input_task_is_running)
     {
-        // Shift current values
-        for(int i = 0; i < ODROID_INPUT_MAX; ++i)
-		{
-			debounce[i] <<= 1;
-		}
+        xSemaphoreTake(input_wake, portMAX_DELAY);
 
-        // Read hardware
+        const int64_t now = esp_timer_get_time();
         odroid_gamepad_state state = input_read_raw();
 
-        // Debounce
-        xSemaphoreTake(xSemaphore, portMAX_DELAY);
-
-        for(int i = 0; i < ODROID_INPUT_MAX; ++i)
-		{
-            debounce[i] |= state.values[i] ? 1 : 0;
-            uint8_t val = debounce[i] & 0x03; //0x0f;
-            switch (val) {
-                case 0x00:
-                    gamepad_state.values[i] = 0;
-                    break;
-
-                case 0x03: //0x0f:
-                    gamepad_state.values[i] = 1;
-                    break;
-
-                default:
-                    // ignore
-                    break;
+        int64_t edgeFirst[ODROID_INPUT_MAX];
+        int64_t edgeLast[ODROID_INPUT_MAX];
+
+        portENTER_CRITICAL(&input_edge_lock);
+        for (int i = 0; i < ODROID_INPUT_MAX; ++i)
+        {
+            edgeFirst[i] = input_edge_first[i];
+            edgeLast[i] = input_edge_last[i];
+        }
+        portEXIT_CRITICAL(&input_edge_lock);
+
+        // Pins still bouncing are looked at again when they have settled
+        int64_t deadline = 0;
+        bool settled[ODROID_INPUT_MAX] = {0};
+
+        xSemaphoreTake(input_lock, portMAX_DELAY);
+        const odroid_input_repeat repeat = input_repeat;
+        xSemaphoreGive(input_lock);
+
+        odroid_input_event events[ODROID_INPUT_MAX * 2];
+        int eventCount = 0;
+        uint32_t published = input_state;
+
+        for (int i = 0; i < ODROID_INPUT_MAX; ++i)
+        {
+            const bool down = (INPUT_SNAPSHOT_BUTTONS(published) >> i) & 1;
+
+            if (state.values[i] == down)
+            {
+                // Bounced back
+                settled[i] = true;
+            }
+            else if (now - edgeLast[i] >= INPUT_DEBOUNCE_US)
+            {
+                published = (published ^ (1u << i)) + (1u << 16);
+                settled[i] = true;
+
+                odroid_input_event* event = &events[eventCount++];
+                event->time = edgeFirst[i] ? edgeFirst[i] : now;
+                event->button = i;
+                event->pressed = state.values[i];
+                event->repeat = 0;
+
+                input_repeat_next[i] = 0;
+                if (event->pressed && (repeat.buttons & (1u << i)))
+                {
+                    input_repeat_next[i] = event->time + repeat.delay_us;
+                    input_repeat_interval[i] = repeat.interval_us;
+                    input_repeat_count[i] = 0;
+                }
+            }
+            else if (!deadline || edgeLast[i] + INPUT_DEBOUNCE_US < deadline)
+            {
+                deadline = edgeLast[i] + INPUT_DEBOUNCE_US;
+            }
+        }
+
+        // Repeats of the buttons held down, each interval shorter than the
+        // one before down to the minimum
+        for (int i = 0; i < ODROID_INPUT_MAX; ++i)
+        {
+            if (!input_repeat_next[i]) continue;
+
+            if (now >= input_repeat_next[i])
+            {
+                odroid_input_event* event = &events[eventCount++];
+                event->time = input_repeat_next[i];
+                event->button = i;
+                event->pressed = true;
+                event->repeat = ++input_repeat_count[i];
+
+                const uint32_t interval = input_repeat_interval[i];
+                input_repeat_next[i] += interval;
+                input_repeat_interval[i] = interval * repeat.accel_percent / 100;
+                if (input_repeat_interval[i] < repeat.min_interval_us) input_repeat_interval[i] = repeat.min_interval_us;
+
+                // Late (the task did not run): no burst to catch up
+                if (input_repeat_next[i] <= now) input_repeat_next[i] = now + interval;
             }
-		}
-
-        previous_gamepad_state = gamepad_state;
-
-        xSemaphoreGive(xSemaphore);
 
-        // delay
-        vTaskDelay(10 / portTICK_PERIOD_MS);
+            if (!deadline || input_repeat_next[i] < deadline) deadline = input_repeat_next[i];
+        }
+
+        // Readers of an event see its change in the snapshot
+        __atomic_store_n(&input_state, published, __ATOMIC_RELEASE);
+
+        int dropped = 0;
+        for (int i = 0; i < eventCount; ++i)
+        {
+            if (xQueueSend(input_events, &events[i], 0) != pdTRUE) ++dropped;
+        }
+
+        xSemaphoreTake(input_lock, portMAX_DELAY);
+        ++input_stats.wakeups;
+        input_stats.events += eventCount;
+        input_stats.dropped += dropped;
+
+        for (int i = 0; input_records && i < eventCount; ++i)
+        {
+            if (events[i].repeat || input_record_count == input_record_max) continue;
+
+            odroid_input_record* record = &input_records[input_record_count++];
+            record->time_us = events[i].time > input_record_time ? events[i].time - input_record_time : 0;
+            record->button = events[i].button;
+            record->pressed = events[i].pressed;
+        }
+        xSemaphoreGive(input_lock);
+
+        // An edge after the copy above keeps its first time
+        portENTER_CRITICAL(&input_edge_lock);
+        for (int i = 0; i < ODROID_INPUT_MAX; ++i)
+        {
+            if (settled[i] && input_edge_last[i] == edgeLast[i]) input_edge_first[i] = 0;
+        }
+        portEXIT_CRITICAL(&input_edge_lock);
+
+        if (deadline)
+        {
+            esp_timer_stop(input_timer);
+            esp_timer_start_once(input_timer, deadline - now);
+        }
     }
 
     input_gamepad_initialized = false;
 
-    vSemaphoreDelete(xSemaphore);
+    vSemaphoreDelete(input_lock);
 
     // Remove the task from scheduler
     vTaskDelete(NULL);
@@ -113,9 +518,9 @@ static void input_task(void *arg)
 
 void input_init()
 {
-    xSemaphore = xSemaphoreCreateMutex();
+    input_lock = xSemaphoreCreateMutex();
 
-    if(xSemaphore == NULL)
+    if(input_lock == NULL)
     {
         printf("xSemaphoreCreateMutex failed.\n");
         abort();
@@ -150,10 +555,39 @@ void input_init()
 	gpio_set_direction(ODROID_GAMEPAD_IO_VOLUME, GPIO_MODE_INPUT);
     gpio_set_direction(ODROID_GAMEPAD_IO_VOLUME, GPIO_PULLUP_ONLY);
 
+    input_wake = xSemaphoreCreateBinary();
+    input_events = xQueueCreate(INPUT_EVENT_QUEUE_SIZE, sizeof(odroid_input_event));
+    if (!input_wake || !input_events) abort();
+
+    const esp_timer_create_args_t timerArgs = {
+        .callback = &input_timer_expired,
+        .name = "input_debounce",
+    };
+    if (esp_timer_create(&timerArgs, &input_timer) != ESP_OK) abort();
+
+    const esp_timer_create_args_t replayArgs = {
+        .callback = &input_replay_step,
+        .name = "input_replay",
+    };
+    if (esp_timer_create(&replayArgs, &input_replay_timer) != ESP_OK) abort();
+
+    // Buttons held at start are not events
+    odroid_gamepad_state state = input_read_raw();
+    for (int i = 0; i < ODROID_INPUT_MAX; ++i)
+    {
+        if (state.values[i]) input_state |= 1u << i;
+    }
+
     input_gamepad_initialized = true;
 
-    // Start background polling
     xTaskCreatePinnedToCore(&input_task, "input_task", 1024 * 2, NULL, 5, NULL, 1);
 
+    gpio_install_isr_service(0);
+    for (int i = 0; i < ODROID_INPUT_MAX; ++i)
+    {
+        gpio_set_intr_type(input_pins[i], GPIO_INTR_ANYEDGE);
+        gpio_isr_handler_add(input_pins[i], &input_isr, (void*)(intptr_t)i);
+    }
+
   	printf("%s: done.\n", __func__);
 }
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
 
 #define ODROID_GAMEPAD_IO_UP GPIO_NUM_4
 #define ODROID_GAMEPAD_IO_DOWN GPIO_NUM_32
@@ -37,6 +39,95 @@ typedef struct
 } odroid_gamepad_state;
 
 
+// Buttons raise GPIO edge interrupts. A change counts once the pin has kept
+// its level for INPUT_DEBOUNCE_US after its last edge; it is then published
+// in the snapshot and queued as an event stamped with the time of the first
+// edge. Nothing runs while no button changes.
+#define INPUT_DEBOUNCE_US (5000)
+#define INPUT_EVENT_QUEUE_SIZE (32)
+
+typedef struct
+{
+    int64_t time;       // esp_timer_get_time() of the first edge, or when the repeat was due
+    uint8_t button;     // ODROID_INPUT_*
+    bool pressed;
+    uint16_t repeat;    // 0 for a change, n for the n-th repeat of a held button
+} odroid_input_event;
+
+// Auto repeat: a button in buttons (bits 1 << ODROID_INPUT_*) held for
+// delay_us is pressed again after interval_us, and then after each interval
+// shortened to accel_percent of the one before, down to min_interval_us.
+// Repeats are events only, the snapshot keeps the button down.
+typedef struct
+{
+    uint16_t buttons;
+    uint32_t delay_us;
+    uint32_t interval_us;
+    uint32_t min_interval_us;
+    uint8_t accel_percent;
+} odroid_input_repeat;
+
+typedef struct
+{
+    uint32_t wakeups;       // of the input task
+    uint32_t events;
+    uint32_t dropped;       // queue full
+    uint32_t received;
+    uint32_t latency_max_us;    // first edge to input_wait_event returning
+    uint64_t latency_total_us;
+} odroid_input_stats;
+
 void input_init();
+// Debounced state of all buttons, unpacked from input_snapshot
 void input_read(odroid_gamepad_state* out_state);
+
+// The debounced state as one word, read without a lock: bit
+// (1 << ODROID_INPUT_*) is set while that button is down, the high half
+// counts changes (wrapping).
+uint32_t input_snapshot();
+#define INPUT_SNAPSHOT_BUTTONS(snapshot) ((uint16_t)(snapshot))
+#define INPUT_SNAPSHOT_CHANGES(snapshot) ((uint16_t)((snapshot) >> 16))
+// Changes between two snapshots that their buttons do not show, such as a
+// press and release in between
+int input_snapshot_missed(uint32_t before, uint32_t after);
 odroid_gamepad_state input_read_raw();
+
+// Next press or release, false if there was none within timeout_ms
+// (portMAX_DELAY waits for ever)
+bool input_wait_event(odroid_input_event* out_event, uint32_t timeout_ms);
+// Drops events nobody took, such as presses handled through input_read
+void input_flush_events();
+// Events waiting, so a reader can draw once after taking a burst of repeats
+int input_pending_events();
+// No button repeats until this is called
+void input_set_repeat(const odroid_input_repeat* repeat);
+void input_get_stats(odroid_input_stats* out_stats);
+
+// Record and replay of the debounced presses and releases, timed from the
+// start of the recording. Repeats are left out, the replay makes them again
+// from how long a button is held. One line per event, other lines are
+// skipped when loading, so a serial log can be replayed as it is:
+//   input_event us=<time> button=<ODROID_INPUT_*> pressed=<0|1>
+typedef struct
+{
+    uint32_t time_us;
+    uint8_t button;
+    bool pressed;
+} odroid_input_record;
+
+// Keeps up to max_events in memory until stopped
+void input_record_start(int max_events);
+// Writes the recording to file (stdout for serial, NULL drops it) and
+// returns the number of events, events past max_events are lost
+int input_record_stop(FILE* file);
+
+// While a replay runs, input_read_raw returns its buttons instead of the
+// pins, and the pins raise no events. Each event is an edge at its time
+// after this call, debounced as a real one; when it is played late the
+// later events move with it. False if file has no events.
+bool input_replay_start(FILE* file);
+// All events were played
+bool input_replay_done();
+// Back to the pins, the buttons they show become events. A replay also
+// ends by itself once its last change is published.
+void input_replay_stop();
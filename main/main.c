@@ -1,4 +1,6 @@
 #include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
 #include "esp_wifi.h"
 #include "esp_system.h"
 #include "esp_event.h"
@@ -10,12 +12,22 @@
 #include "esp_heap_caps.h"
 #include "esp_flash.h"
 #include "esp_flash_partitions.h"
+#include "esp_timer.h"
 #include "rom/crc.h"
 
 #include <string.h>
+#include <stdarg.h>
+#include <limits.h>
 
 #include "odroid_sdcard.h"
+#include "odroid_filelist.h"
+#include "odroid_catalog.h"
+#include "odroid_atlas.h"
+#include "odroid_tilecache.h"
 #include "odroid_display.h"
+#include "odroid_spibus.h"
+#include "odroid_storagebench.h"
+#include "odroid_latency.h"
 #include "input.h"
 
 #include "../components/ugui/ugui.h"
@@ -51,11 +63,19 @@ typedef struct
 uint16_t fb[320 * 240];
 UG_GUI gui;
 char tempstring[512];
+char logstring[128];
 
 #define ITEM_COUNT (4)
-char** files;
+odroid_filelist_t* files;
 int fileCount;
+odroid_catalog_t* catalog = NULL;
+odroid_atlas_t* atlas = NULL;
 const char* path = "/sd/odroid/firmware";
+// Where the storage benchmark keeps its test file
+const char* STORAGEBENCH_PATH = "/sd/odroid";
+const char* INPUT_REPLAY_PATH = "/sd/odroid/input_replay.txt";  // see UI_INPUT_SESSIONS
+const char* INPUT_RECORD_PATH = "/sd/odroid/input_record.txt";
+const char* ui_path = NULL;     // directory shown by the menu
 char* VERSION = NULL;
 
 #define TILE_WIDTH (86)
@@ -63,6 +83,37 @@ char* VERSION = NULL;
 #define TILE_LENGTH (TILE_WIDTH * TILE_HEIGHT * 2)
 //uint8_t TileData[TILE_LENGTH];
 
+// Decoded tiles: the current page and both neighbours
+#define TILE_CACHE_COUNT (ITEM_COUNT * 3)
+odroid_tilecache_t* tileCache = NULL;
+
+// Install log area (between the progress message and the footer bar)
+#define LOG_TOP (166)
+#define LOG_BOTTOM (221)
+
+// Banded rendering: menu pages are recorded into a uGUI command list and
+// replayed by both cores, each one drawing its own half of the screen.
+// Comment out to draw everything on the main core.
+#define UI_BANDED_RENDERING
+
+// Input sessions, for benchmarks: the menu records its buttons to
+// INPUT_RECORD_PATH and, once per boot, plays INPUT_REPLAY_PATH in their
+// place. A replay that opens a file asks the buttons before installing it.
+// Off unless defined.
+//#define UI_INPUT_SESSIONS
+
+#define UI_CMD_COUNT (48)
+#define UI_CMD_TEXT_SIZE (512)
+#define UI_BAND_SPLIT (120)
+
+static UG_CMDLIST ui_cmdlist;
+static UG_CMD ui_cmds[UI_CMD_COUNT];
+static char ui_cmd_text[UI_CMD_TEXT_SIZE];
+static bool ui_banded = false;
+static UG_GUI ui_band_gui;
+static SemaphoreHandle_t ui_band_start;
+static SemaphoreHandle_t ui_band_done;
+
 
 static void pset(UG_S16 x, UG_S16 y, UG_COLOR color)
 {
@@ -74,18 +125,77 @@ static void ui_update_display()
     ili9341_write_frame_rectangleLE(0, 0, 320, 240, fb);
 }
 
+static void ui_update_rows(short top, short bottom)
+{
+    ili9341_write_frame_rectangleLE(0, top, 320, bottom - top + 1, fb + top * 320);
+}
+
 static void ui_draw_image(short x, short y, short width, short height, uint16_t* data)
 {
-    for (short i = 0 ; i < height; ++i)
+    UG_DrawImage(x, y, width, height, data);
+}
+
+static void ui_band_task(void* arg)
+{
+    // uGUI contexts are per task: this one only draws the bottom band
+    UG_Init(&ui_band_gui, pset, 320, 240);
+    UG_SetFramebuffer(fb);
+    UG_SetClip(0, UI_BAND_SPLIT, 319, 239);
+
+    while (1)
     {
-        for (short j = 0; j < width; ++j)
-        {
-            uint16_t pixel = data[i * width + j];
-            UG_DrawPixel(x + j, y + i, pixel);
-        }
+        xSemaphoreTake(ui_band_start, portMAX_DELAY);
+        UG_CmdListExecute(&ui_cmdlist);
+        xSemaphoreGive(ui_band_done);
     }
 }
 
+static void ui_banded_init()
+{
+    UG_CmdListInit(&ui_cmdlist, ui_cmds, UI_CMD_COUNT, ui_cmd_text, UI_CMD_TEXT_SIZE);
+
+    ui_band_start = xSemaphoreCreateBinary();
+    ui_band_done = xSemaphoreCreateBinary();
+    if (!ui_band_start || !ui_band_done) abort();
+
+    if (xTaskCreatePinnedToCore(&ui_band_task, "ui_band", 1024 * 3, NULL, 5, NULL, 1) != pdPASS) abort();
+
+    ui_banded = true;
+}
+
+static void ui_frame_begin()
+{
+    if (ui_banded) UG_CmdListBegin(&ui_cmdlist);
+}
+
+static void ui_frame_end()
+{
+    if (!ui_banded) return;
+
+    UG_CmdListEnd();
+
+    // Bottom band on the other core, top band on this one
+    xSemaphoreGive(ui_band_start);
+
+    UG_SetClip(0, 0, 319, UI_BAND_SPLIT - 1);
+    UG_CmdListExecute(&ui_cmdlist);
+    UG_ResetClip();
+
+    xSemaphoreTake(ui_band_done, portMAX_DELAY);
+}
+
+static char* ui_path_join(const char* dir, const char* name)
+{
+    char* result = (char*)malloc(strlen(dir) + 1 + strlen(name) + 1);
+    if (!result) abort();
+
+    strcpy(result, dir);
+    strcat(result, "/");
+    strcat(result, name);
+
+    return result;
+}
+
 // TODO: default bad image tile
 void ui_firmware_image_get(const char* filename, uint16_t* outData)
 {
@@ -126,9 +236,8 @@ void ui_firmware_image_get(const char* filename, uint16_t* outData)
 
     //printf("Header OK: '%s'\n", header);
 
-    // read description
-    count = fread(FirmwareDescription, 1, FIRMWARE_DESCRIPTION_SIZE, file);
-    if (count != FIRMWARE_DESCRIPTION_SIZE)
+    // skip description, FirmwareDescription belongs to the main task
+    if (fseek(file, FIRMWARE_DESCRIPTION_SIZE, SEEK_CUR) != 0)
     {
         memset(outData, DEFAULT_DATA, TILE_LENGTH);
         goto ui_firmware_image_get_exit;
@@ -147,6 +256,374 @@ ui_firmware_image_get_exit:
     fclose(file);
 }
 
+// Reads the tile at the offset recorded in the catalog, without parsing the
+// header. False if the placeholder was used.
+static bool ui_firmware_tile_get(const char* fileName, uint16_t* outData)
+{
+    const uint8_t DEFAULT_DATA = 0xff;
+    bool result = true;
+
+    char* fullPath = ui_path_join(ui_path, fileName);
+
+    odroid_catalog_info_t info;
+    if (catalog && odroid_catalog_lookup(catalog, fileName, &info))
+    {
+        FILE* file = NULL;
+        if (info.status == ODROID_CATALOG_OK) file = odroid_sdcard_acquire(fullPath);
+
+        if (!file ||
+            fseek(file, info.tile_offset, SEEK_SET) != 0 ||
+            fread(outData, 1, TILE_LENGTH, file) != TILE_LENGTH)
+        {
+            memset(outData, DEFAULT_DATA, TILE_LENGTH);
+            result = false;
+        }
+
+        odroid_sdcard_release(file);
+    }
+    else
+    {
+        ui_firmware_image_get(fullPath, outData);
+    }
+
+    free(fullPath);
+    return result;
+}
+
+// Tile loader: all card access for the menu (catalog and tiles) happens on
+// this task. Pages are drawn with placeholders for missing tiles, which are
+// queued first; neighbour pages are queued as prefetch while the user idles.
+typedef struct
+{
+    const char* name;   // owned by the file list
+    bool prefetch;
+} ui_tile_request_t;
+
+#define TILE_QUEUE_SIZE (ITEM_COUNT * 3)
+#define UI_PREFETCH_IDLE_MS (200)
+// Wakeups of the menu while the scan or the tile loader are busy
+#define UI_POLL_MS (10)
+// Holding a direction moves on, faster the longer it is held
+#define UI_REPEAT_DELAY_MS (400)
+#define UI_REPEAT_INTERVAL_MS (150)
+#define UI_REPEAT_MIN_INTERVAL_MS (40)
+#define UI_REPEAT_ACCEL_PERCENT (85)
+
+#define UI_RECORD_EVENTS (1024)
+static bool ui_replayed = false;
+
+static ui_tile_request_t ui_tile_queue[TILE_QUEUE_SIZE];
+static int ui_tile_queue_count;
+static int ui_tile_queue_next;
+static int ui_tile_queue_max;
+static bool ui_tile_prune;
+static bool ui_tile_verify;     // requests were queued since the last batch
+static bool ui_atlas_listed;    // the listing is complete
+static bool ui_atlas_check;     // compare the atlas with the listing when idle
+static bool ui_atlas_running;
+static volatile bool ui_atlas_stop;
+static volatile bool ui_tile_busy;
+static volatile uint32_t ui_tile_arrived;
+static SemaphoreHandle_t ui_tile_lock;      // queue
+static SemaphoreHandle_t ui_tile_wake;
+static SemaphoreHandle_t ui_tile_cache_lock;
+
+static const char* ui_filelist_name(void* arg, int index)
+{
+    return odroid_filelist_name((odroid_filelist_t*)arg, index);
+}
+
+static void ui_tile_store(const ui_tile_request_t* request, const uint16_t* tile)
+{
+    xSemaphoreTake(ui_tile_cache_lock, portMAX_DELAY);
+    memcpy(odroid_tilecache_put(tileCache, request->name, request->prefetch), tile, TILE_LENGTH);
+    xSemaphoreGive(ui_tile_cache_lock);
+
+    if (!request->prefetch) ++ui_tile_arrived;
+}
+
+// Atlas of the open directory (see odroid_atlas.h). It is rewritten on this
+// task when idle, after the listing is complete, if it does not match the
+// listing or a tile in it turned out to be stale.
+static const char* ui_atlas_name(void* arg, int index)
+{
+    odroid_filelist_t* list = (odroid_filelist_t*)arg;
+    return odroid_filelist_is_directory(list, index) ? NULL : odroid_filelist_name(list, index);
+}
+
+static bool ui_atlas_tile(void* arg, const char* name, uint32_t* size, uint32_t* mtime, uint16_t* tile)
+{
+    odroid_catalog_info_t info;
+    if (!catalog || !odroid_catalog_lookup(catalog, name, &info)) return false;
+
+    *size = info.size;
+    *mtime = info.mtime;
+    return info.status == ODROID_CATALOG_OK && ui_firmware_tile_get(name, tile);
+}
+
+static void ui_atlas_update()
+{
+    const int count = odroid_filelist_count(files);
+    if (!atlas || odroid_atlas_current(atlas, ui_atlas_name, files, count)) return;
+
+    odroid_atlas_update(atlas, ui_atlas_name, ui_atlas_tile, files, count, &ui_atlas_stop);
+}
+
+typedef struct
+{
+    const ui_tile_request_t* requests;  // of the run
+    int first;
+} ui_atlas_run_t;
+
+static void ui_atlas_done(void* arg, int index, const uint16_t* tile)
+{
+    const ui_atlas_run_t* run = (const ui_atlas_run_t*)arg;
+    ui_tile_store(&run->requests[index - run->first], tile);
+}
+
+// Tiles of the requests that are in the atlas, a page at a time with one
+// read for those that are next to each other in it
+static void ui_atlas_load(const ui_tile_request_t* requests, int count, uint16_t* tile)
+{
+    if (!atlas || !catalog || odroid_atlas_count(atlas) == 0) return;
+
+    int indices[TILE_QUEUE_SIZE];
+    for (int i = 0; i < count; ++i)
+    {
+        indices[i] = -1;
+
+        xSemaphoreTake(ui_tile_cache_lock, portMAX_DELAY);
+        bool cached = odroid_tilecache_contains(tileCache, requests[i].name);
+        xSemaphoreGive(ui_tile_cache_lock);
+
+        odroid_catalog_info_t info;
+        if (!cached && odroid_catalog_lookup(catalog, requests[i].name, &info) && info.status == ODROID_CATALOG_OK)
+        {
+            indices[i] = odroid_atlas_find(atlas, requests[i].name, info.size, info.mtime);
+        }
+    }
+
+    for (int i = 0; i < count; )
+    {
+        int length = 1;
+        while (i + length < count && length < ITEM_COUNT && indices[i] >= 0 &&
+            indices[i + length] == indices[i] + length) ++length;
+
+        if (indices[i] >= 0)
+        {
+            ui_atlas_run_t run = { &requests[i], indices[i] };
+            odroid_atlas_read(atlas, indices[i], length, tile, &ui_atlas_done, &run);
+        }
+
+        i += length;
+    }
+
+    if (ui_atlas_listed && odroid_atlas_stale(atlas))
+    {
+        xSemaphoreTake(ui_tile_lock, portMAX_DELAY);
+        ui_atlas_check = true;
+        xSemaphoreGive(ui_tile_lock);
+    }
+}
+
+static void ui_tile_task(void* arg)
+{
+    uint16_t* tile = malloc(TILE_LENGTH);
+    if (!tile) abort();
+
+    ui_tile_request_t batch[TILE_QUEUE_SIZE];
+    const char* batchNames[TILE_QUEUE_SIZE];
+
+    while (1)
+    {
+        xSemaphoreTake(ui_tile_wake, portMAX_DELAY);
+
+        while (1)
+        {
+            xSemaphoreTake(ui_tile_lock, portMAX_DELAY);
+
+            const bool prune = ui_tile_prune;
+            ui_tile_prune = false;
+
+            // Catalog entries of everything queued, checked together
+            int batchCount = 0;
+            if (!prune && ui_tile_verify)
+            {
+                for (int i = ui_tile_queue_next; i < ui_tile_queue_count; ++i)
+                {
+                    batch[batchCount] = ui_tile_queue[i];
+                    batchNames[batchCount] = ui_tile_queue[i].name;
+                    ++batchCount;
+                }
+                ui_tile_verify = false;
+            }
+
+            ui_tile_request_t request = { NULL, false };
+            if (!prune && ui_tile_queue_next < ui_tile_queue_count)
+            {
+                request = ui_tile_queue[ui_tile_queue_next++];
+            }
+
+            // Nothing else to do: bring the atlas up to date
+            const bool update = !prune && !request.name && ui_atlas_check;
+            if (update)
+            {
+                ui_atlas_check = false;
+                ui_atlas_stop = false;
+                ui_atlas_running = true;
+            }
+
+            ui_tile_busy = prune || request.name || update;
+            xSemaphoreGive(ui_tile_lock);
+
+            // Headers of new files are read in card order, not list order
+            if (batchCount > 1 && catalog) odroid_catalog_verify(catalog, batchNames, batchCount);
+            if (batchCount > 0) ui_atlas_load(batch, batchCount, tile);
+
+            if (prune)
+            {
+                // Complete listing: forget firmware that was deleted
+                odroid_catalog_prune(catalog, ui_filelist_name, files, odroid_filelist_count(files));
+
+                xSemaphoreTake(ui_tile_lock, portMAX_DELAY);
+                ui_atlas_listed = true;
+                ui_atlas_check = true;
+                xSemaphoreGive(ui_tile_lock);
+                continue;
+            }
+
+            if (update)
+            {
+                ui_atlas_update();
+
+                xSemaphoreTake(ui_tile_lock, portMAX_DELAY);
+                ui_atlas_running = false;
+                xSemaphoreGive(ui_tile_lock);
+                continue;
+            }
+
+            if (!request.name) break;
+
+            xSemaphoreTake(ui_tile_cache_lock, portMAX_DELAY);
+            bool cached = odroid_tilecache_contains(tileCache, request.name);
+            xSemaphoreGive(ui_tile_cache_lock);
+            if (cached) continue;
+
+            ui_firmware_tile_get(request.name, tile);
+            ui_tile_store(&request, tile);
+        }
+    }
+}
+
+static void ui_tile_init()
+{
+    ui_tile_lock = xSemaphoreCreateMutex();
+    ui_tile_wake = xSemaphoreCreateBinary();
+    ui_tile_cache_lock = xSemaphoreCreateMutex();
+    if (!ui_tile_lock || !ui_tile_wake || !ui_tile_cache_lock) abort();
+
+    if (xTaskCreatePinnedToCore(&ui_tile_task, "ui_tile", 1024 * 3, NULL, 4, NULL, 1) != pdPASS) abort();
+}
+
+// Queues a tile load. Visible tiles replace whatever was queued before.
+static void ui_tile_request(const char* name, bool prefetch, bool clear)
+{
+    xSemaphoreTake(ui_tile_lock, portMAX_DELAY);
+
+    if (clear)
+    {
+        ui_tile_queue_count = 0;
+        ui_tile_queue_next = 0;
+    }
+
+    if (name && ui_tile_queue_count < TILE_QUEUE_SIZE)
+    {
+        ui_tile_queue[ui_tile_queue_count].name = name;
+        ui_tile_queue[ui_tile_queue_count].prefetch = prefetch;
+        ++ui_tile_queue_count;
+        ui_tile_verify = true;
+
+        // Shown tiles first, the atlas update starts over later
+        if (!prefetch && ui_atlas_running)
+        {
+            ui_atlas_stop = true;
+            ui_atlas_check = true;
+        }
+
+        const int depth = ui_tile_queue_count - ui_tile_queue_next;
+        if (depth > ui_tile_queue_max) ui_tile_queue_max = depth;
+    }
+
+    xSemaphoreGive(ui_tile_lock);
+    xSemaphoreGive(ui_tile_wake);
+}
+
+static void ui_tile_prune_request()
+{
+    xSemaphoreTake(ui_tile_lock, portMAX_DELAY);
+    ui_tile_prune = true;
+    xSemaphoreGive(ui_tile_lock);
+    xSemaphoreGive(ui_tile_wake);
+}
+
+static int ui_tile_queue_depth()
+{
+    xSemaphoreTake(ui_tile_lock, portMAX_DELAY);
+    int result = ui_tile_queue_count - ui_tile_queue_next;
+    xSemaphoreGive(ui_tile_lock);
+
+    return result;
+}
+
+// Drops queued loads and waits for the one in progress
+static void ui_tile_cancel()
+{
+    xSemaphoreTake(ui_tile_lock, portMAX_DELAY);
+    ui_tile_prune = false;
+    ui_atlas_listed = false;
+    ui_atlas_check = false;
+    ui_atlas_stop = true;
+    xSemaphoreGive(ui_tile_lock);
+
+    ui_tile_request(NULL, false, true);
+    while (ui_tile_busy || ui_tile_queue_depth() > 0)
+    {
+        vTaskDelay(1);
+    }
+}
+
+// Subdirectories are scanned when they are opened. The listings of the
+// directories above the open one are kept, so going back is immediate and
+// memory grows with the open path rather than with the whole library.
+#define UI_DIR_DEPTH (8)
+
+typedef struct
+{
+    const char* path;       // owned, except for the top directory
+    odroid_filelist_t* files;
+    const char* selected;   // owned by files
+} ui_dir_t;
+
+static ui_dir_t ui_dirs[UI_DIR_DEPTH];
+static int ui_dir_depth;
+
+// Points the tile loader at another directory. Tiles are keyed by name only.
+static void ui_dir_open(const char* dirPath)
+{
+    ui_tile_cancel();
+
+    xSemaphoreTake(ui_tile_cache_lock, portMAX_DELAY);
+    odroid_tilecache_clear(tileCache);
+    xSemaphoreGive(ui_tile_cache_lock);
+
+    if (catalog) odroid_catalog_close(catalog);
+    catalog = odroid_catalog_open(dirPath);
+
+    if (atlas) odroid_atlas_close(atlas);
+    atlas = odroid_atlas_open(dirPath);
+
+    ui_path = dirPath;
+}
 
 static void UpdateDisplay()
 {
@@ -158,6 +635,11 @@ static void DisplayError(const char* message)
     UG_FontSelect(&FONT_8X12);
     short left = (320 / 2) - (strlen(message) * 9 / 2);
     short top = (240 / 2) - (12 / 2);
+
+    // Dim the screen between header and footer, translucent box behind the message
+    UG_DimFrame(0, 16, 319, 239 - 17, 128);
+    UG_BlendFrame(0, top - 10, 319, top + 12 + 10, C_WHITE, 208);
+
     UG_SetForecolor(C_RED);
     UG_SetBackcolor(C_WHITE);
     UG_FillFrame(0, top, 319, top + 12, C_WHITE);
@@ -166,16 +648,23 @@ static void DisplayError(const char* message)
     UpdateDisplay();
 }
 
-static void DisplayMessage(const char* message)
+#define PROGRESS_TOP ((240 / 2) - (12 / 2) + 16)
+#define MESSAGE_TOP ((240 / 2) + 8 + (12 / 2) + 16)
+
+static void ui_draw_message(const char* message)
 {
     UG_FontSelect(&FONT_8X12);
     short left = (320 / 2) - (strlen(message) * 9 / 2);
-    short top = (240 / 2) + 8 + (12 / 2) + 16;
+    short top = MESSAGE_TOP;
     UG_SetForecolor(C_BLACK);
     UG_SetBackcolor(C_WHITE);
     UG_FillFrame(0, top, 319, top + 12, C_WHITE);
     UG_PutString(left, top, message);
+}
 
+static void DisplayMessage(const char* message)
+{
+    ui_draw_message(message);
     UpdateDisplay();
 }
 
@@ -188,7 +677,7 @@ static void DisplayProgress(int percent)
     const int FILL_WIDTH = WIDTH * (percent / 100.0f);
 
     short left = (320 / 2) - (WIDTH / 2);
-    short top = (240 / 2) - (HEIGHT / 2) + 16;
+    short top = PROGRESS_TOP;
     UG_FillFrame(left - 1, top - 1, left + WIDTH + 1, top + HEIGHT + 1, C_WHITE);
     UG_DrawFrame(left - 1, top - 1, left + WIDTH + 1, top + HEIGHT + 1, C_BLACK);
 
@@ -213,6 +702,62 @@ static void DisplayFooter(const char* message)
     UpdateDisplay();
 }
 
+static void ui_log_begin_at(short top)
+{
+    UG_FontSelect(&FONT_6X8);
+    UG_ConsoleSetArea(4, top, 315, LOG_BOTTOM);
+    UG_ConsoleSetForecolor(C_DIM_GRAY);
+    UG_ConsoleSetBackcolor(C_WHITE);
+    UG_ConsoleSetScroll(1);
+    UG_FillFrame(0, top, 319, LOG_BOTTOM, C_WHITE);
+    ui_update_rows(top, LOG_BOTTOM);
+}
+
+static void ui_log_begin()
+{
+    ui_log_begin_at(LOG_TOP);
+}
+
+// Print a line to the serial console and to the on-screen log. Only the
+// console rows that changed are sent to the LCD.
+static void ui_log(const char* format, ...)
+{
+    va_list args;
+
+    logstring[0] = '\n';
+    va_start(args, format);
+    vsnprintf(logstring + 1, sizeof(logstring) - 1, format, args);
+    va_end(args);
+
+    printf("%s\n", logstring + 1);
+
+    UG_FontSelect(&FONT_6X8);
+    UG_ConsolePutString(logstring);
+
+    UG_AREA area;
+    if (UG_ConsoleGetDirtyArea(&area) == UG_RESULT_OK)
+    {
+        ui_update_rows(area.ys, area.ye);
+    }
+}
+
+// Progress of a write, shown for the first block and then once per
+// UI_INSTALL_UPDATE_BYTES: a log line, and the bar and the message sent as
+// the rows they cover.
+#define UI_INSTALL_UPDATE_BYTES (32 * 1024)
+static int ui_install_shown;
+
+static void ui_install_progress(const char* message, int offset, int length)
+{
+    if (offset != 0 && offset / UI_INSTALL_UPDATE_BYTES == ui_install_shown / UI_INSTALL_UPDATE_BYTES) return;
+    ui_install_shown = offset;
+
+    ui_log("%s - %#08x", message, offset);
+    DisplayProgress(length > 0 ? (int)((int64_t)offset * 100 / length) : 100);
+    ui_draw_message(message);
+    ui_update_rows(PROGRESS_TOP - 1, MESSAGE_TOP + 12);
+}
+
 static void DisplayHeader(const char* message)
 {
     UG_FontSelect(&FONT_8X12);
@@ -264,7 +809,7 @@ static void write_partition_table(odroid_partition_t* parts, size_t parts_count)
 
 
     // Read table
-    const esp_partition_info_t* partition_data = (const esp_partition_info_t*)malloc(ESP_PARTITION_TABLE_MAX_LEN);
+    esp_partition_info_t* partition_data = (esp_partition_info_t*)malloc(ESP_PARTITION_TABLE_MAX_LEN);
     if (!partition_data)
     {
         DisplayError("TABLE MEMORY ERROR");
@@ -354,6 +899,37 @@ static void write_partition_table(odroid_partition_t* parts, size_t parts_count)
     esp_partition_unload_all();
 }
 
+// First 64 KB aligned address past the factory partition and the partitions
+// installed after it, 0 if there is no factory partition
+static uint32_t flash_free_address()
+{
+    esp_partition_info_t* partition_data = (esp_partition_info_t*)malloc(ESP_PARTITION_TABLE_MAX_LEN);
+    if (!partition_data) return 0;
+
+    uint32_t result = 0;
+    if (esp_flash_read(NULL, partition_data, ESP_PARTITION_TABLE_OFFSET, ESP_PARTITION_TABLE_MAX_LEN) == ESP_OK)
+    {
+        bool factory = false;
+        for (int i = 0; i < ESP_PARTITION_TABLE_MAX_ENTRIES; ++i)
+        {
+            const esp_partition_info_t *part = &partition_data[i];
+            if (part->magic == 0xffff) break;
+            if (part->magic != ESP_PARTITION_MAGIC) continue;
+
+            if (part->type == PART_TYPE_APP && part->subtype == PART_SUBTYPE_FACTORY) factory = true;
+
+            const uint32_t end = part->pos.offset + part->pos.size;
+            if (end > result) result = end;
+        }
+
+        if (!factory) result = 0;
+    }
+
+    free(partition_data);
+
+    return (result + 0xffff) & 0xffff0000;
+}
+
 
 static void ui_draw_title();
 
@@ -363,7 +939,12 @@ void flash_firmware(const char* fullPath)
 {
     size_t count;
 
-    printf("%s: HEAP=%#010lx\n", __func__, esp_get_free_heap_size());
+    printf("%s: HEAP=%#010lx largest=%u\n", __func__, esp_get_free_heap_size(),
+        (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
+
+    // Progress updates must not hold up the card reads
+    odroid_spibus_set_priority(ODROID_SPIBUS_SD);
+    odroid_spibus_reset_stats();
 
     ui_draw_title();
     ui_update_display();
@@ -469,12 +1050,16 @@ void flash_firmware(const char* fullPath)
     DisplayFooter("");
     //UpdateDisplay();
 
+    ui_log_begin();
 
     DisplayMessage("Verifying ...");
+    ui_log("Verifying '%s'", fullPath);
 
 
     const int ERASE_BLOCK_SIZE = 4096;
-    void* data = malloc(ERASE_BLOCK_SIZE);
+
+    // Double buffer shared by all the streams below
+    void* data = heap_caps_malloc(ODROID_SDCARD_STREAM_CHUNK * 2, MALLOC_CAP_DMA);
     if (!data)
     {
         DisplayError("DATA MEMORY ERROR");
@@ -496,28 +1081,32 @@ void flash_firmware(const char* fullPath)
     {
         DisplayError("CHECKSUM READ ERROR");
     }
-    printf("%s: expected_checksum=%#010lx\n", __func__, expected_checksum);
+    ui_log("expected_checksum=%#010lx", expected_checksum);
 
 
-    fseek(file, 0, SEEK_SET);
+    odroid_sdcard_stream_t* stream = odroid_sdcard_stream_open(fullPath, 0, file_size - sizeof(expected_checksum),
+        ODROID_SDCARD_STREAM_CHUNK, data);
+    if (!stream)
+    {
+        DisplayError("STREAM ERROR");
+    }
 
     uint32_t checksum = 0;
-    size_t check_offset = 0;
-    while(true)
+    const int64_t checkStart = esp_timer_get_time();
+    const void* chunk;
+    while ((chunk = odroid_sdcard_stream_next(stream, &count)) != NULL)
     {
-        count = fread(data, 1, ERASE_BLOCK_SIZE, file);
-        if (check_offset + count == file_size)
-        {
-            count -= 4;
-        }
-
-        checksum = crc32_le(checksum, data, count);
-        check_offset += count;
+        checksum = crc32_le(checksum, chunk, count);
+    }
+    const int64_t checkTime = esp_timer_get_time() - checkStart;
 
-        if (count < ERASE_BLOCK_SIZE) break;
+    if (!odroid_sdcard_stream_ok(stream))
+    {
+        DisplayError("DATA READ ERROR");
     }
+    odroid_sdcard_stream_close(stream);
 
-    printf("%s: checksum=%#010lx\n", __func__, checksum);
+    ui_log("checksum=%#010lx (%d KB/s)", checksum, (int)(checkTime > 0 ? (int64_t)file_size * 1000000 / 1024 / checkTime : 0));
 
     if (checksum != expected_checksum)
     {
@@ -541,7 +1130,7 @@ void flash_firmware(const char* fullPath)
     }
 
     const size_t FLASH_START_ADDRESS = factory_part->address + factory_part->size;
-    printf("%s: FLASH_START_ADDRESS=%#010x\n", __func__, FLASH_START_ADDRESS);
+    ui_log("FLASH_START_ADDRESS=%#010x", FLASH_START_ADDRESS);
 
 
     const size_t PARTS_MAX = 20;
@@ -596,7 +1185,7 @@ void flash_firmware(const char* fullPath)
         uint32_t length;
         count = fread(&length, 1, sizeof(length), file);
         strncpy(tempstring, (char*)slot.label, 16);
-        printf("slot:type(%d),subtype(%d),label(%s),length(%d),data_size(%d)\n", slot.type, slot.subtype, tempstring, (int)slot.length, (int)length);
+        ui_log("slot:type(%d),subtype(%d),label(%s),length(%d),data_size(%d)", slot.type, slot.subtype, tempstring, (int)slot.length, (int)length);
         if (count != sizeof(length))
         {
             DisplayError("LENGTH READ ERROR");
@@ -621,7 +1210,7 @@ void flash_firmware(const char* fullPath)
             // Display
             sprintf(tempstring, "Erasing ... (%d)", parts_count);
 
-            printf("%s\n", tempstring);
+            ui_log("%s", tempstring);
             DisplayProgress(0);
             DisplayMessage(tempstring);
 
@@ -633,43 +1222,48 @@ void flash_firmware(const char* fullPath)
             }
 
 
-            // Write data
+            // Write data, the next chunk is read while this one is written
+            stream = odroid_sdcard_stream_open(fullPath, ftell(file), length, ODROID_SDCARD_STREAM_CHUNK, data);
+            if (!stream)
+            {
+                DisplayError("STREAM ERROR");
+            }
+
             int totalCount = 0;
-            for (int offset = 0; offset < length; offset += ERASE_BLOCK_SIZE)
+            size_t chunkCount;
+            while ((chunk = odroid_sdcard_stream_next(stream, &chunkCount)) != NULL)
             {
-                // Display
-                sprintf(tempstring, "Writing %s (%d%%)", (char*)slot.label, (int)(100*offset/length));
+                for (size_t chunkOffset = 0; chunkOffset < chunkCount; chunkOffset += count)
+                {
+                    const int offset = totalCount;
 
-                printf("%s - %#08x\n", tempstring, offset);
-                DisplayProgress((float)offset / (float)(length - ERASE_BLOCK_SIZE) * 100.0f);
-                DisplayMessage(tempstring);
+                    // Display
+                    sprintf(tempstring, "Writing %s (%d%%)", (char*)slot.label, (int)(100*offset/length));
 
-                // read
-                //printf("Reading offset=0x%x\n", offset);
-                count = fread(data, 1, ERASE_BLOCK_SIZE, file);
-                if (count <= 0)
-                {
-                    DisplayError("DATA READ ERROR");
-                }
+                    ui_install_progress(tempstring, offset, length);
 
-                if (offset + count >= length)
-                {
-                    count = length - offset;
-                }
+                    count = chunkCount - chunkOffset;
+                    if (count > ERASE_BLOCK_SIZE) count = ERASE_BLOCK_SIZE;
 
+                    // flash
+                    //printf("Writing offset=0x%x\n", offset);
+                    //ret = esp_partition_write(part, offset, data, count);
+                    ret = esp_flash_write(NULL, (const uint8_t*)chunk + chunkOffset, curren_flash_address + offset, count);
+                    if (ret != ESP_OK)
+            		{
+            			printf("esp_flash_write failed. address=%#08x\n", curren_flash_address + offset);
+                        DisplayError("WRITE ERROR");
+            		}
 
-                // flash
-                //printf("Writing offset=0x%x\n", offset);
-                //ret = esp_partition_write(part, offset, data, count);
-                ret = esp_flash_write(NULL, data, curren_flash_address + offset, count);
-                if (ret != ESP_OK)
-        		{
-        			printf("esp_flash_write failed. address=%#08x\n", curren_flash_address + offset);
-                    DisplayError("WRITE ERROR");
-        		}
+                    totalCount += count;
+                }
+            }
 
-                totalCount += count;
+            if (!odroid_sdcard_stream_ok(stream))
+            {
+                DisplayError("DATA READ ERROR");
             }
+            odroid_sdcard_stream_close(stream);
 
             if (totalCount != length)
             {
@@ -684,9 +1278,9 @@ void flash_firmware(const char* fullPath)
 
 
             // Notify OK
-            sprintf(tempstring, "OK: [%d] Length=%#08lx", parts_count, length);
+            sprintf(tempstring, "OK: [%d] Length=%#08lx", parts_count, (unsigned long)length);
 
-            printf("%s\n", tempstring);
+            ui_log("%s", tempstring);
             //DisplayFooter(tempstring);
         }
 
@@ -706,7 +1300,8 @@ void flash_firmware(const char* fullPath)
 
 
     // Utility
-    FILE* util = fopen("/sd/odroid/firmware/utility.bin", "rb");
+    const char* UTILITY_PATH = "/sd/odroid/firmware/utility.bin";
+    FILE* util = fopen(UTILITY_PATH, "rb");
     if (util)
     {
         if ((curren_flash_address & 0xffff0000) != curren_flash_address)
@@ -720,7 +1315,7 @@ void flash_firmware(const char* fullPath)
         size_t length = ftell(util);
         fseek(util, 0, SEEK_SET);
 
-        printf("utility.bin - length=%d\n", length);
+        ui_log("utility.bin - length=%d", length);
 
 
         // TODO: Determine if there is room
@@ -732,7 +1327,7 @@ void flash_firmware(const char* fullPath)
         // Display
         sprintf(tempstring, "Erasing Utility ...");
 
-        printf("%s\n", tempstring);
+        ui_log("%s", tempstring);
         DisplayProgress(0);
         DisplayMessage(tempstring);
 
@@ -745,42 +1340,47 @@ void flash_firmware(const char* fullPath)
 
 
         // Write data
+        stream = odroid_sdcard_stream_open(UTILITY_PATH, 0, length, ODROID_SDCARD_STREAM_CHUNK, data);
+        if (!stream)
+        {
+            DisplayError("STREAM ERROR");
+        }
+
         int totalCount = 0;
-        for (int offset = 0; offset < length; offset += ERASE_BLOCK_SIZE)
+        size_t chunkCount;
+        while ((chunk = odroid_sdcard_stream_next(stream, &chunkCount)) != NULL)
         {
-            // Display
-            sprintf(tempstring, "Writing Utility");
+            for (size_t chunkOffset = 0; chunkOffset < chunkCount; chunkOffset += count)
+            {
+                const int offset = totalCount;
 
-            printf("%s - %#08x\n", tempstring, offset);
-            DisplayProgress((float)offset / (float)(length - ERASE_BLOCK_SIZE) * 100.0f);
-            DisplayMessage(tempstring);
+                // Display
+                sprintf(tempstring, "Writing Utility");
 
-            // read
-            //printf("Reading offset=0x%x\n", offset);
-            count = fread(data, 1, ERASE_BLOCK_SIZE, util);
-            if (count <= 0)
-            {
-                DisplayError("DATA READ ERROR");
-            }
+                ui_install_progress(tempstring, offset, length);
 
-            if (offset + count >= length)
-            {
-                count = length - offset;
-            }
+                count = chunkCount - chunkOffset;
+                if (count > ERASE_BLOCK_SIZE) count = ERASE_BLOCK_SIZE;
 
+                // flash
+                //printf("Writing offset=0x%x\n", offset);
+                //ret = esp_partition_write(part, offset, data, count);
+                ret = esp_flash_write(NULL, (const uint8_t*)chunk + chunkOffset, curren_flash_address + offset, count);
+                if (ret != ESP_OK)
+                {
+                    printf("esp_flash_write failed. address=%#08x\n", curren_flash_address + offset);
+                    DisplayError("WRITE ERROR");
+                }
 
-            // flash
-            //printf("Writing offset=0x%x\n", offset);
-            //ret = esp_partition_write(part, offset, data, count);
-            ret = esp_flash_write(NULL, data, curren_flash_address + offset, count);
-            if (ret != ESP_OK)
-            {
-                printf("esp_flash_write failed. address=%#08x\n", curren_flash_address + offset);
-                DisplayError("WRITE ERROR");
+                totalCount += count;
             }
+        }
 
-            totalCount += count;
+        if (!odroid_sdcard_stream_ok(stream))
+        {
+            DisplayError("DATA READ ERROR");
         }
+        odroid_sdcard_stream_close(stream);
 
         // Add partition
         odroid_partition_t util_part;
@@ -809,7 +1409,14 @@ void flash_firmware(const char* fullPath)
     write_partition_table(parts, parts_count);
 
 
-    free(data);
+    heap_caps_free(data);
+
+    odroid_spibus_stats_t sdStats;
+    odroid_spibus_stats_t lcdStats;
+    odroid_spibus_get_stats(ODROID_SPIBUS_SD, &sdStats);
+    odroid_spibus_get_stats(ODROID_SPIBUS_LCD, &lcdStats);
+    printf("%s: spibus sd=%u grants, %u us max wait; lcd=%u grants, %u us max wait\n", __func__,
+        (unsigned)sdStats.grants, (unsigned)sdStats.max_wait_us, (unsigned)lcdStats.grants, (unsigned)lcdStats.max_wait_us);
 
     // Close SD card
     odroid_sdcard_close();
@@ -844,13 +1451,46 @@ static void ui_draw_title()
     UG_PutString(footerLeft, 240 - 4 - 8, VERSION);
 }
 
-static void ui_draw_page(char** files, int fileCount, int currentItem)
+// Input to photon percentiles in the header, toggled with VOLUME
+static bool ui_latency_overlay = false;
+
+static void ui_draw_latency()
+{
+    odroid_latency_histogram_t histogram;
+    odroid_latency_get(&histogram);
+
+    char text[32];
+    snprintf(text, sizeof(text), "%u/%u/%ums",
+        (unsigned)(odroid_latency_percentile(&histogram, 50) / 1000),
+        (unsigned)(odroid_latency_percentile(&histogram, 95) / 1000),
+        (unsigned)(histogram.max_us / 1000));
+
+    UG_FontSelect(&FONT_6X8);
+    UG_SetForecolor(C_YELLOW);
+    UG_SetBackcolor(C_MIDNIGHT_BLUE);
+    UG_PutString(4, 4, text);
+}
+
+// Lines of the current page drawn with a placeholder instead of the tile
+static bool ui_tile_pending[ITEM_COUNT];
+
+// Stands in for the tile of a subdirectory
+static void ui_draw_folder(short x, short y)
 {
-    printf("%s: HEAP=%#010lx\n", __func__, esp_get_free_heap_size());
+    UG_FillFrame(x + 8, y + 4, x + 34, y + 9, C_GOLDEN_ROD);
+    UG_FillFrame(x + 8, y + 10, x + TILE_WIDTH - 9, y + TILE_HEIGHT - 5, C_GOLDEN_ROD);
+    UG_DrawFrame(x + 8, y + 10, x + TILE_WIDTH - 9, y + TILE_HEIGHT - 5, C_SADDLE_BROWN);
+}
+
+static void ui_draw_page(odroid_filelist_t* files, int fileCount, int currentItem)
+{
+    printf("%s: HEAP=%#010lx queue=%d max=%d\n", __func__, esp_get_free_heap_size(),
+        ui_tile_queue_depth(), ui_tile_queue_max);
 
     int page = currentItem / ITEM_COUNT;
     page *= ITEM_COUNT;
 
+    ui_frame_begin();
     ui_draw_title();
 
     const int innerHeight = 240 - (16 * 2); // 208
@@ -871,19 +1511,24 @@ static void ui_draw_page(char** files, int fileCount, int currentItem)
         // uint16_t id = TXB_ID_0 + (ITEM_COUNT / 2);
         // UG_TextboxSetText(&window1, id, (char*)text);
 
+        ui_frame_end();
         ui_update_display();
 	}
 	else
 	{
-        uint16_t* tile = malloc(TILE_LENGTH);
-        if (!tile) abort();
-
         char* displayStrings[ITEM_COUNT];
         for(int i = 0; i < ITEM_COUNT; ++i)
         {
             displayStrings[i] = NULL;
+            ui_tile_pending[i] = false;
         }
 
+        // Loads for other pages are stale now
+        ui_tile_request(NULL, false, true);
+
+        // Recorded images are only drawn in ui_frame_end: no evictions until then
+        xSemaphoreTake(ui_tile_cache_lock, portMAX_DELAY);
+
 	    for (int line = 0; line < ITEM_COUNT; ++line)
 	    {
 			if (page + line >= fileCount) break;
@@ -904,25 +1549,31 @@ static void ui_draw_page(char** files, int fileCount, int currentItem)
                 UG_FillFrame(0, top + 2, 319, top + itemHeight - 1 - 1, C_WHITE);
 	        }
 
-			char* fileName = files[page + line];
+			const char* fileName = odroid_filelist_name(files, page + line);
 			if (!fileName) abort();
 
 			displayStrings[line] = (char*)malloc(strlen(fileName) + 1);
             strcpy(displayStrings[line], fileName);
-            displayStrings[line][strlen(fileName) - 3] = 0; // ".fw" = 3
-
 
-            size_t fullPathLength = strlen(path) + 1 + strlen(fileName) + 1;
-            char* fullPath = (char*)malloc(fullPathLength);
-            if (!fullPath) abort();
+            const bool directory = odroid_filelist_is_directory(files, page + line);
+            if (!directory) displayStrings[line][strlen(fileName) - 3] = 0; // ".fw" = 3
 
-            strcpy(fullPath, path);
-            strcat(fullPath, "/");
-            strcat(fullPath, fileName);
-            ui_firmware_image_get(fullPath, tile);
-            ui_draw_image(imageLeft, top + 2, TILE_WIDTH, TILE_HEIGHT, tile);
 
-            free(fullPath);
+            const uint16_t* tile = directory ? NULL : odroid_tilecache_get(tileCache, fileName);
+            if (directory)
+            {
+                ui_draw_folder(imageLeft, top + 2);
+            }
+            else if (tile)
+            {
+                ui_draw_image(imageLeft, top + 2, TILE_WIDTH, TILE_HEIGHT, (uint16_t*)tile);
+            }
+            else
+            {
+                UG_FillFrame(imageLeft, top + 2, imageLeft + TILE_WIDTH - 1, top + 2 + TILE_HEIGHT - 1, C_LIGHT_GRAY);
+                ui_tile_pending[line] = true;
+                ui_tile_request(fileName, false, false);
+            }
 
             // Tile border
             //UG_DrawFrame(imageLeft - 1, top + 1, imageLeft + TILE_WIDTH, top + 2 + TILE_HEIGHT, C_BLACK);
@@ -932,25 +1583,153 @@ static void ui_draw_page(char** files, int fileCount, int currentItem)
             UG_PutString(textLeft, top + 2 + 2 + 16, displayStrings[line]);
 	    }
 
+        if (ui_latency_overlay) ui_draw_latency();
+
+        ui_frame_end();
+        xSemaphoreGive(ui_tile_cache_lock);
+
         ui_update_display();
 
         for(int i = 0; i < ITEM_COUNT; ++i)
         {
             free(displayStrings[i]);
         }
-
-        free(tile);
 	}
 }
 
+// Replaces the placeholders of the current page with tiles that were loaded
+static void ui_draw_pending_tiles(odroid_filelist_t* files, int currentItem)
+{
+    const int page = (currentItem / ITEM_COUNT) * ITEM_COUNT;
+    const int itemHeight = (240 - (16 * 2)) / ITEM_COUNT;
+    const short imageLeft = ((320 - 213) / 2) - (86 / 2);
+
+    xSemaphoreTake(ui_tile_cache_lock, portMAX_DELAY);
+
+    for (int line = 0; line < ITEM_COUNT; ++line)
+    {
+        if (!ui_tile_pending[line]) continue;
+
+        const char* fileName = odroid_filelist_name(files, page + line);
+        if (!fileName || !odroid_tilecache_contains(tileCache, fileName)) continue;
+
+        const short top = 16 + (line * itemHeight) - 1;
+        ui_draw_image(imageLeft, top + 2, TILE_WIDTH, TILE_HEIGHT, (uint16_t*)odroid_tilecache_get(tileCache, fileName));
+        ui_update_rows(top + 2, top + 2 + TILE_HEIGHT - 1);
+
+        ui_tile_pending[line] = false;
+    }
+
+    xSemaphoreGive(ui_tile_cache_lock);
+}
+
+// Queues the tiles of the pages RIGHT and LEFT lead to
+static void ui_tile_prefetch(odroid_filelist_t* files, int fileCount, int currentItem)
+{
+    const int page = (currentItem / ITEM_COUNT) * ITEM_COUNT;
+    const int lastPage = ((fileCount - 1) / ITEM_COUNT) * ITEM_COUNT;
+    const int next = (page + ITEM_COUNT < fileCount) ? page + ITEM_COUNT : 0;
+    const int previous = (page - ITEM_COUNT >= 0) ? page - ITEM_COUNT : lastPage;
+
+    for (int i = 0; i < 2; ++i)
+    {
+        const int start = i ? previous : next;
+        if (start == page || (i && previous == next)) continue;
+
+        for (int item = start; item < start + ITEM_COUNT && item < fileCount; ++item)
+        {
+            const char* fileName = odroid_filelist_name(files, item);
+            if (!fileName) break;
+            if (odroid_filelist_is_directory(files, item)) continue;
+
+            xSemaphoreTake(ui_tile_cache_lock, portMAX_DELAY);
+            const bool cached = odroid_tilecache_contains(tileCache, fileName);
+            xSemaphoreGive(ui_tile_cache_lock);
+
+            if (!cached) ui_tile_request(fileName, true, false);
+        }
+    }
+}
+
+static void ui_storagebench_result(const odroid_storagebench_result_t* result, void* arg)
+{
+    ui_log("%-12s %6u bytes %6u KB/s%s", result->test, (unsigned)result->block,
+        (unsigned)odroid_storagebench_kb_per_sec(result), result->ok ? "" : " FAILED");
+}
+
+// Card and flash throughput, to tell which one makes installs slow. The
+// flash test only uses space that no partition covers.
+static void ui_storagebench(const char* dir)
+{
+    ui_draw_title();
+    DisplayHeader("Storage benchmark");
+    ui_log_begin_at(16 + 16 + 16);
+
+    ui_log("SD card, %u KB file in %s", ODROID_STORAGEBENCH_FILE_SIZE / 1024, dir);
+    if (!odroid_storagebench_sd(dir, &ui_storagebench_result, NULL))
+    {
+        ui_log("SD card test failed.");
+    }
+
+    uint32_t flashSize = 0;
+    esp_flash_get_size(NULL, &flashSize);
+
+    const uint32_t address = flash_free_address();
+    if (address == 0 || address + ODROID_STORAGEBENCH_FLASH_SIZE > flashSize)
+    {
+        ui_log("No free flash to test.");
+    }
+    else
+    {
+        ui_log("Flash, %u KB at %#08x", ODROID_STORAGEBENCH_FLASH_SIZE / 1024, address);
+        if (!odroid_storagebench_flash(address, ODROID_STORAGEBENCH_FLASH_SIZE, &ui_storagebench_result, NULL))
+        {
+            ui_log("Flash test failed.");
+        }
+    }
+
+    ui_log("[B] Back");
+}
+
+// A replay that opens a file ends there: the buttons decide the install
+static bool ui_replay_confirm(int64_t sessionStart)
+{
+    input_replay_stop();
+    printf("%s: replay ms=%u\n", __func__, (unsigned)((esp_timer_get_time() - sessionStart) / 1000));
+
+    DisplayMessage("Replay done. [A] Install [B] Back");
+    input_flush_events();
+
+    odroid_input_event event;
+    do
+    {
+        input_wait_event(&event, portMAX_DELAY);
+    } while (!event.pressed || (event.button != ODROID_INPUT_A && event.button != ODROID_INPUT_B));
+
+    return event.button == ODROID_INPUT_A;
+}
+
 const char* ui_choose_file(const char* path)
 {
     const char* result = NULL;
 
-    printf("%s: HEAP=%#010lx\n", __func__, esp_get_free_heap_size());
+    printf("%s: HEAP=%#010lx largest=%u\n", __func__, esp_get_free_heap_size(),
+        (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
 
-    files = 0;
-    fileCount = odroid_sdcard_files_get(path, ".fw", &files);
+    // Keep navigation responsive while tiles are read
+    odroid_spibus_set_priority(ODROID_SPIBUS_LCD);
+
+    // Draw as soon as the first page is known, the rest of the directory
+    // is read (and then sorted) in the background
+    ui_path = path;
+    if (!catalog) catalog = odroid_catalog_open(path);
+    if (!atlas) atlas = odroid_atlas_open(path);
+    tileCache = odroid_tilecache_create(TILE_CACHE_COUNT, TILE_LENGTH);
+    if (!ui_tile_lock) ui_tile_init();
+
+    files = odroid_filelist_scan(path, ".fw");
+    fileCount = odroid_filelist_wait(files, ITEM_COUNT);
+    uint32_t generation = odroid_filelist_generation(files);
     printf("%s: fileCount=%d\n", __func__, fileCount);
 
     // At least one firmware must be available
@@ -962,34 +1741,196 @@ const char* ui_choose_file(const char* path)
 
     // Selection
     int currentItem = 0;
+    const char* selectedName = odroid_filelist_name(files, currentItem);
     ui_draw_page(files, fileCount, currentItem);
 
+    const odroid_input_repeat repeat = {
+        .buttons = (1 << ODROID_INPUT_UP) | (1 << ODROID_INPUT_DOWN) | (1 << ODROID_INPUT_LEFT) | (1 << ODROID_INPUT_RIGHT),
+        .delay_us = UI_REPEAT_DELAY_MS * 1000,
+        .interval_us = UI_REPEAT_INTERVAL_MS * 1000,
+        .min_interval_us = UI_REPEAT_MIN_INTERVAL_MS * 1000,
+        .accel_percent = UI_REPEAT_ACCEL_PERCENT,
+    };
+    input_set_repeat(&repeat);
+
+    // Presses made before the list was shown are not for it
+    input_flush_events();
     odroid_gamepad_state previousState;
     input_read(&previousState);
 
-    while (true)
+    bool replay = false;
+    int64_t sessionStart = esp_timer_get_time();
+#ifdef UI_INPUT_SESSIONS
+    FILE* replayFile = ui_replayed ? NULL : fopen(INPUT_REPLAY_PATH, "r");
+    ui_replayed = true;
+    if (replayFile)
     {
-		odroid_gamepad_state state;
-		input_read(&state);
+        // From the top of the sorted list, as every replay must see it
+        odroid_filelist_wait(files, INT_MAX);
+        fileCount = odroid_filelist_count(files);
+        generation = odroid_filelist_generation(files);
+        selectedName = odroid_filelist_name(files, currentItem);
+        ui_draw_page(files, fileCount, currentItem);
+
+        replay = input_replay_start(replayFile);
+        fclose(replayFile);
+    }
+    input_record_start(UI_RECORD_EVENTS);
+    sessionStart = esp_timer_get_time();
+#endif
+
+    uint32_t arrived = ui_tile_arrived;
+    int64_t lastInput = esp_timer_get_time();
+    int prefetchPage = -1;
+
+    // Moves wait to be drawn until the queued repeats are taken
+    bool redraw = false;
+    uint32_t repeats = 0;
+    uint32_t moveDraws = 0;
 
+    while (true)
+    {
         int page = currentItem / ITEM_COUNT;
         page *= ITEM_COUNT;
 
-		if (fileCount > 0)
+        // Sleep until a button changes, polling only while the scan or the
+        // tile loader still have something to show
+        bool pressed = false;
+        for (int i = 0; i < ODROID_INPUT_MAX; ++i)
+        {
+            if (previousState.values[i]) pressed = true;
+        }
+
+        uint32_t timeout = portMAX_DELAY;
+        if (!odroid_filelist_done(files) || ui_tile_busy || ui_tile_queue_depth() > 0 || ui_tile_arrived != arrived)
+        {
+            timeout = UI_POLL_MS;
+        }
+        else if (prefetchPage != page && !pressed)
+        {
+            const int64_t idle = (esp_timer_get_time() - lastInput) / 1000;
+            timeout = idle < UI_PREFETCH_IDLE_MS ? UI_PREFETCH_IDLE_MS - idle : 0;
+        }
+
+        // One change per pass, so a short press between two frames still
+        // shows up as a press and a release
+        odroid_gamepad_state state = previousState;
+        odroid_input_event event;
+        const bool taken = input_wait_event(&event, timeout);
+        if (taken)
+        {
+            // A repeat counts as a new press
+            if (event.repeat)
+            {
+                previousState.values[event.button] = 0;
+                ++repeats;
+            }
+
+            state.values[event.button] = event.pressed;
+            pressed = state.values[event.button] || pressed;
+            lastInput = event.time;
+        }
+
+        // Tiles loaded since the last frame
+        if (ui_tile_arrived != arrived && !redraw)
+        {
+            arrived = ui_tile_arrived;
+            ui_draw_pending_tiles(files, currentItem);
+        }
+
+        // Prefetch the neighbour pages once nothing was pressed for a while
+        const bool idle = !pressed && esp_timer_get_time() - lastInput >= UI_PREFETCH_IDLE_MS * 1000;
+        if (idle && prefetchPage != page && ui_tile_queue_depth() == 0)
+        {
+            ui_tile_prefetch(files, fileCount, currentItem);
+            prefetchPage = page;
+        }
+
+        // Entries found by the scan since the last frame
+        const int count = odroid_filelist_count(files);
+        const uint32_t currentGeneration = odroid_filelist_generation(files);
+        if (currentGeneration != generation)
+        {
+            // Sorted: keep the same file selected
+            generation = currentGeneration;
+            fileCount = count;
+            currentItem = selectedName ? odroid_filelist_find(files, selectedName) : 0;
+            if (currentItem < 0) currentItem = 0;
+
+            // Complete listing: forget firmware that was deleted
+            ui_tile_prune_request();
+
+            ui_draw_page(files, fileCount, currentItem);
+            page = (currentItem / ITEM_COUNT) * ITEM_COUNT;
+            prefetchPage = -1;
+        }
+        else if (count != fileCount)
+        {
+            // Only redraw if the current page was not full yet
+            const bool visible = (page + ITEM_COUNT > fileCount);
+            fileCount = count;
+            if (visible) ui_draw_page(files, fileCount, currentItem);
+        }
+
+        // The next frame answers this press, unless it changes nothing
+        if (taken && event.pressed) odroid_latency_begin(event.time);
+
+        if (!previousState.values[ODROID_INPUT_VOLUME] && state.values[ODROID_INPUT_VOLUME])
+        {
+            ui_latency_overlay = !ui_latency_overlay;
+            odroid_latency_dump();
+            redraw = true;
+        }
+        else if (!previousState.values[ODROID_INPUT_B] && state.values[ODROID_INPUT_B] && ui_dir_depth > 0)
+        {
+            // Back to the parent, its listing was kept
+            ui_tile_cancel();
+            odroid_filelist_free(files);
+            free((char*)ui_path);
+
+            --ui_dir_depth;
+            ui_dir_open(ui_dirs[ui_dir_depth].path);
+            files = ui_dirs[ui_dir_depth].files;
+            fileCount = odroid_filelist_count(files);
+            generation = odroid_filelist_generation(files);
+
+            currentItem = odroid_filelist_find(files, ui_dirs[ui_dir_depth].selected);
+            if (currentItem < 0) currentItem = 0;
+
+            ui_draw_page(files, fileCount, currentItem);
+            prefetchPage = -1;
+        }
+		else if (fileCount > 0)
 		{
-	        if(!previousState.values[ODROID_INPUT_DOWN] && state.values[ODROID_INPUT_DOWN])
+            const bool forward = (!previousState.values[ODROID_INPUT_DOWN] && state.values[ODROID_INPUT_DOWN]) ||
+                (!previousState.values[ODROID_INPUT_RIGHT] && state.values[ODROID_INPUT_RIGHT]);
+            const bool backward = (!previousState.values[ODROID_INPUT_UP] && state.values[ODROID_INPUT_UP]) ||
+                (!previousState.values[ODROID_INPUT_LEFT] && state.values[ODROID_INPUT_LEFT]);
+
+            if (state.values[ODROID_INPUT_SELECT] && (forward || backward))
+            {
+                // Jump to the next (or previous) first letter, only that page is drawn
+                const int item = forward ? odroid_filelist_next_group(files, currentItem) :
+                    odroid_filelist_previous_group(files, currentItem);
+                if (item != currentItem)
+                {
+                    currentItem = item;
+                    redraw = true;
+                }
+            }
+	        else if(!previousState.values[ODROID_INPUT_DOWN] && state.values[ODROID_INPUT_DOWN])
 	        {
 	            if (fileCount > 0)
 				{
 					if (currentItem + 1 < fileCount)
 		            {
 		                ++currentItem;
-		                ui_draw_page(files, fileCount, currentItem);
+		                redraw = true;
 		            }
 					else
 					{
 						currentItem = 0;
-		                ui_draw_page(files, fileCount, currentItem);
+		                redraw = true;
 					}
 				}
 	        }
@@ -1000,12 +1941,12 @@ const char* ui_choose_file(const char* path)
 					if (currentItem > 0)
 		            {
 		                --currentItem;
-		                ui_draw_page(files, fileCount, currentItem);
+		                redraw = true;
 		            }
 					else
 					{
 						currentItem = fileCount - 1;
-						ui_draw_page(files, fileCount, currentItem);
+						redraw = true;
 					}
 				}
 	        }
@@ -1016,12 +1957,12 @@ const char* ui_choose_file(const char* path)
 					if (page + ITEM_COUNT < fileCount)
 		            {
 		                currentItem = page + ITEM_COUNT;
-		                ui_draw_page(files, fileCount, currentItem);
+		                redraw = true;
 		            }
 					else
 					{
 						currentItem = 0;
-						ui_draw_page(files, fileCount, currentItem);
+						redraw = true;
 					}
 				}
 	        }
@@ -1032,7 +1973,7 @@ const char* ui_choose_file(const char* path)
 					if (page - ITEM_COUNT >= 0)
 		            {
 		                currentItem = page - ITEM_COUNT;
-		                ui_draw_page(files, fileCount, currentItem);
+		                redraw = true;
 		            }
 					else
 					{
@@ -1042,24 +1983,66 @@ const char* ui_choose_file(const char* path)
 							currentItem += ITEM_COUNT;
 						}
 
-		                ui_draw_page(files, fileCount, currentItem);
+		                redraw = true;
 					}
 				}
 	        }
 	        else if(!previousState.values[ODROID_INPUT_A] && state.values[ODROID_INPUT_A])
 	        {
-	            size_t fullPathLength = strlen(path) + 1 + strlen(files[currentItem]) + 1;
+	            const char* fileName = odroid_filelist_name(files, currentItem);
+	            char* fullPath = ui_path_join(ui_path, fileName);
 
-	            char* fullPath = (char*)malloc(fullPathLength);
-	            if (!fullPath) abort();
+                if (!odroid_filelist_is_directory(files, currentItem))
+                {
+                    if (!replay || ui_replay_confirm(sessionStart))
+                    {
+                        result = fullPath;
+                        break;
+                    }
+
+                    // Back to the menu, on the buttons
+                    free(fullPath);
+                    replay = false;
+                    input_read(&state);
+                    ui_draw_page(files, fileCount, currentItem);
+                    prefetchPage = -1;
+                }
+                else if (ui_dir_depth >= UI_DIR_DEPTH)
+                {
+                    free(fullPath);
+                }
+                else
+                {
+                    // Keep this listing for going back
+                    ui_dirs[ui_dir_depth].path = ui_path;
+                    ui_dirs[ui_dir_depth].files = files;
+                    ui_dirs[ui_dir_depth].selected = fileName;
+                    ++ui_dir_depth;
+
+                    ui_dir_open(fullPath);
+                    files = odroid_filelist_scan(fullPath, ".fw");
+                    fileCount = odroid_filelist_wait(files, ITEM_COUNT);
+                    generation = odroid_filelist_generation(files);
+                    printf("%s: '%s' fileCount=%d\n", __func__, fullPath, fileCount);
+
+                    currentItem = 0;
+                    ui_draw_page(files, fileCount, currentItem);
+                    prefetchPage = -1;
+                }
+	        }
+            else if (!previousState.values[ODROID_INPUT_START] && state.values[ODROID_INPUT_START])
+            {
+                // The benchmark has the card to itself
+                ui_tile_cancel();
+                ui_storagebench(STORAGEBENCH_PATH);
 
-	            strcpy(fullPath, path);
-	            strcat(fullPath, "/");
-	            strcat(fullPath, files[currentItem]);
+                input_flush_events();
+                while (!input_wait_event(&event, portMAX_DELAY) || event.button != ODROID_INPUT_B || !event.pressed);
+                input_read(&state);
 
-	            result = fullPath;
-                break;
-	        }
+                ui_draw_page(files, fileCount, currentItem);
+                prefetchPage = -1;
+            }
             else if (!previousState.values[ODROID_INPUT_MENU] && state.values[ODROID_INPUT_MENU])
             {
                 ui_draw_title();
@@ -1073,11 +2056,98 @@ const char* ui_choose_file(const char* path)
             }
 		}
 
+        if (redraw && input_pending_events() == 0)
+        {
+            ui_draw_page(files, fileCount, currentItem);
+            redraw = false;
+            ++moveDraws;
+        }
+
+        if (!redraw) odroid_latency_cancel();
+
         previousState = state;
-        vTaskDelay(10 / portTICK_PERIOD_MS);
+        selectedName = odroid_filelist_name(files, currentItem);
+    }
+
+    const uint32_t sessionMs = (esp_timer_get_time() - sessionStart) / 1000;
+
+    const odroid_input_repeat noRepeat = {0};
+    input_set_repeat(&noRepeat);
+
+    ui_tile_cancel();
+    odroid_filelist_free(files);
+
+    // Start from the top directory next time
+    if (ui_dir_depth > 0)
+    {
+        free((char*)ui_path);
+        odroid_catalog_close(catalog);
+        catalog = NULL;
+        odroid_atlas_close(atlas);
+        atlas = NULL;
     }
 
-    odroid_sdcard_files_free(files, fileCount);
+    while (ui_dir_depth > 0)
+    {
+        --ui_dir_depth;
+        odroid_filelist_free(ui_dirs[ui_dir_depth].files);
+        if (ui_dir_depth > 0) free((char*)ui_dirs[ui_dir_depth].path);
+    }
+    ui_path = path;
+
+    odroid_tilecache_stats_t stats;
+    odroid_tilecache_stats(tileCache, &stats);
+    printf("%s: tiles hits=%u misses=%u evictions=%u prefetch=%u/%u queue_max=%d\n", __func__,
+        (unsigned)stats.hits, (unsigned)stats.misses, (unsigned)stats.evictions,
+        (unsigned)stats.prefetch_hits, (unsigned)stats.prefetches, ui_tile_queue_max);
+
+    odroid_sdcard_cache_stats_t cacheStats;
+    odroid_sdcard_cache_stats(&cacheStats);
+    printf("%s: sd cache hits=%u misses=%u readahead=%u/%u bypassed=%u\n", __func__,
+        (unsigned)cacheStats.hits, (unsigned)cacheStats.misses, (unsigned)cacheStats.readahead_hits,
+        (unsigned)cacheStats.readahead, (unsigned)cacheStats.bypassed);
+
+    odroid_input_stats inputStats;
+    input_get_stats(&inputStats);
+    printf("%s: input events=%u dropped=%u wakeups=%u latency avg=%uus max=%uus\n", __func__,
+        (unsigned)inputStats.events, (unsigned)inputStats.dropped, (unsigned)inputStats.wakeups,
+        (unsigned)(inputStats.received ? inputStats.latency_total_us / inputStats.received : 0),
+        (unsigned)inputStats.latency_max_us);
+    printf("%s: repeats=%u move draws=%u\n", __func__, (unsigned)repeats, (unsigned)moveDraws);
+    odroid_latency_dump();
+
+#ifdef UI_INPUT_SESSIONS
+    input_replay_stop();
+    printf("%s: session ms=%u\n", __func__, (unsigned)sessionMs);
+
+    FILE* recordFile = fopen(INPUT_RECORD_PATH, "w");
+    if (recordFile)
+    {
+        const int recorded = input_record_stop(recordFile);
+        fclose(recordFile);
+        printf("%s: recorded %d events to '%s'\n", __func__, recorded, INPUT_RECORD_PATH);
+    }
+    else
+    {
+        // No card: not to serial either
+        input_record_stop(NULL);
+    }
+#else
+    (void)sessionMs;
+#endif
+
+    odroid_sdcard_handle_stats_t handleStats;
+    odroid_sdcard_handle_stats(&handleStats);
+    printf("%s: sd handles reused=%u opened=%u, stat cached=%u read=%u\n", __func__,
+        (unsigned)handleStats.handle_hits, (unsigned)handleStats.handle_opens,
+        (unsigned)handleStats.stat_hits, (unsigned)handleStats.stat_lookups);
+
+    // The installer opens the chosen file itself
+    odroid_sdcard_flush_handles();
+
+    // Flashing needs the memory
+    odroid_tilecache_free(tileCache);
+    tileCache = NULL;
 
     return result;
 }
@@ -1108,7 +2178,7 @@ static void menu_main()
 
         flash_firmware(fileName);
 
-        free(fileName);
+        free((char*)fileName);
     }
 }
 
@@ -1130,11 +2200,17 @@ void app_main(void)
 
     input_init();
 
+    odroid_spibus_init();
 
     ili9341_init();
     ili9341_clear(0xffff);
 
     UG_Init(&gui, pset, 320, 240);
+    UG_SetFramebuffer(fb);
+
+#ifdef UI_BANDED_RENDERING
+    ui_banded_init();
+#endif
 
     menu_main();
 
@@ -0,0 +1,541 @@
+#include "odroid_atlas.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+
+#define ATLAS_MAGIC "ODROIDGO_ATL_V01"
+#define ATLAS_NAME_SIZE (64)
+#define ATLAS_TMP_FILE ".atlas.tmp"
+
+// File layout: header, tiles in list order, records in the same order
+typedef struct
+{
+    char magic[16];
+    uint32_t count;
+    uint32_t index_offset;  // first record
+    uint32_t tile_size;
+    uint32_t _reserved;
+} atlas_header_t;
+
+typedef struct
+{
+    char name[ATLAS_NAME_SIZE];
+    uint32_t size;      // of the .fw
+    uint32_t mtime;
+    uint32_t offset;    // of the tile
+    uint32_t length;    // ODROID_ATLAS_TILE_SIZE = raw, less = run length encoded, 0 = no tile
+} atlas_record_t;
+
+_Static_assert(sizeof(atlas_record_t) == 80, "atlas_record_t");
+
+// In memory record, found by name hash
+typedef struct
+{
+    uint32_t hash;
+    uint32_t name;      // in the name pool
+    uint32_t size;
+    uint32_t mtime;
+    uint32_t offset;
+    uint32_t length;
+    bool stale;
+} atlas_entry_t;
+
+// The names of a set of entries, packed
+typedef struct
+{
+    char* data;
+    size_t size;
+    size_t used;
+} atlas_names_t;
+
+struct odroid_atlas
+{
+    char* path;
+    char* filename;
+
+    atlas_entry_t* entries;     // in file order
+    atlas_names_t names;
+    int* sorted;                // entry indices by hash
+    int count;
+};
+
+
+
+static uint32_t name_hash(const char* name)
+{
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    while (*name)
+    {
+        hash ^= (uint8_t)*name++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static char* path_join(const char* path, const char* name)
+{
+    char* result = malloc(strlen(path) + 1 + strlen(name) + 1);
+    if (!result) abort();
+
+    strcpy(result, path);
+    strcat(result, "/");
+    strcat(result, name);
+    return result;
+}
+
+static uint32_t names_add(atlas_names_t* names, const char* name)
+{
+    const size_t length = strlen(name) + 1;
+    if (names->used + length > names->size)
+    {
+        size_t size = names->size ? names->size * 2 : 1024;
+        while (size < names->used + length) size *= 2;
+
+        char* data = realloc(names->data, size);
+        if (!data) abort();
+
+        names->data = data;
+        names->size = size;
+    }
+
+    const uint32_t result = names->used;
+    memcpy(names->data + names->used, name, length);
+    names->used += length;
+    return result;
+}
+
+static const atlas_entry_t* sort_entries;
+
+static int sorted_compare(const void* a, const void* b)
+{
+    const uint32_t x = sort_entries[*(const int*)a].hash;
+    const uint32_t y = sort_entries[*(const int*)b].hash;
+    return (x > y) - (x < y);
+}
+
+static void atlas_set_entries(odroid_atlas_t* atlas, atlas_entry_t* entries, const atlas_names_t* names, int count)
+{
+    free(atlas->entries);
+    free(atlas->names.data);
+    free(atlas->sorted);
+
+    atlas->entries = entries;
+    atlas->names = *names;
+    atlas->count = count;
+
+    atlas->sorted = malloc((count ? count : 1) * sizeof(int));
+    if (!atlas->sorted) abort();
+
+    for (int i = 0; i < count; ++i) atlas->sorted[i] = i;
+
+    // Only the menu task uses an atlas
+    sort_entries = entries;
+    qsort(atlas->sorted, count, sizeof(int), sorted_compare);
+}
+
+static int atlas_lookup(odroid_atlas_t* atlas, const char* name)
+{
+    const uint32_t hash = name_hash(name);
+
+    int low = 0;
+    int high = atlas->count;
+    while (low < high)
+    {
+        int mid = (low + high) / 2;
+        if (atlas->entries[atlas->sorted[mid]].hash < hash)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    for (; low < atlas->count && atlas->entries[atlas->sorted[low]].hash == hash; ++low)
+    {
+        const atlas_entry_t* entry = &atlas->entries[atlas->sorted[low]];
+        if (strcmp(atlas->names.data + entry->name, name) == 0) return atlas->sorted[low];
+    }
+    return -1;
+}
+
+// Name of file index if it can have a tile in the atlas: names of
+// ATLAS_NAME_SIZE characters or more do not fit a record
+static const char* atlas_name(odroid_atlas_name_func name, void* arg, int index)
+{
+    const char* result = name(arg, index);
+    return (result && strlen(result) < ATLAS_NAME_SIZE) ? result : NULL;
+}
+
+static bool atlas_load(odroid_atlas_t* atlas)
+{
+    FILE* file = fopen(atlas->filename, "rb");
+    if (!file) return false;
+
+    atlas_entry_t* entries = NULL;
+    atlas_names_t names = { 0 };
+    atlas_header_t header;
+    if (fread(&header, 1, sizeof(header), file) != sizeof(header) ||
+        memcmp(header.magic, ATLAS_MAGIC, sizeof(header.magic)) != 0 ||
+        header.tile_size != ODROID_ATLAS_TILE_SIZE ||
+        fseek(file, header.index_offset, SEEK_SET) != 0)
+    {
+        printf("%s: invalid atlas.\n", __func__);
+        goto atlas_load_fail;
+    }
+
+    entries = malloc((header.count ? header.count : 1) * sizeof(atlas_entry_t));
+    if (!entries) abort();
+
+    // One sequential pass over the records
+    atlas_record_t record;
+    for (uint32_t i = 0; i < header.count; ++i)
+    {
+        if (fread(&record, 1, sizeof(record), file) != sizeof(record) ||
+            record.length > ODROID_ATLAS_TILE_SIZE)
+        {
+            printf("%s: invalid record.\n", __func__);
+            goto atlas_load_fail;
+        }
+
+        record.name[ATLAS_NAME_SIZE - 1] = 0;
+
+        atlas_entry_t* entry = &entries[i];
+        entry->hash = name_hash(record.name);
+        entry->name = names_add(&names, record.name);
+        entry->size = record.size;
+        entry->mtime = record.mtime;
+        entry->offset = record.offset;
+        entry->length = record.length;
+        entry->stale = false;
+    }
+
+    fclose(file);
+    atlas_set_entries(atlas, entries, &names, header.count);
+    return true;
+
+atlas_load_fail:
+    free(entries);
+    free(names.data);
+    fclose(file);
+    return false;
+}
+
+// Runs of 2 to 129 equal pixels: 0x80 + run - 2, pixel. Up to 128 other
+// pixels: count - 1, pixels. Returns 0 if the result is not shorter.
+static size_t atlas_encode(const uint16_t* tile, uint8_t* out)
+{
+    const size_t total = ODROID_ATLAS_TILE_SIZE / 2;
+    size_t length = 0;
+
+    for (size_t i = 0; i < total; )
+    {
+        size_t run = 1;
+        while (i + run < total && run < 129 && tile[i + run] == tile[i]) ++run;
+
+        if (run >= 2)
+        {
+            if (length + 3 >= ODROID_ATLAS_TILE_SIZE) return 0;
+
+            out[length++] = 0x80 + run - 2;
+            memcpy(out + length, &tile[i], sizeof(uint16_t));
+            length += sizeof(uint16_t);
+            i += run;
+            continue;
+        }
+
+        // Up to the next pair of equal pixels
+        size_t count = 1;
+        while (i + count < total && count < 128 &&
+            !(i + count + 1 < total && tile[i + count] == tile[i + count + 1])) ++count;
+
+        if (length + 1 + count * sizeof(uint16_t) >= ODROID_ATLAS_TILE_SIZE) return 0;
+
+        out[length++] = count - 1;
+        memcpy(out + length, &tile[i], count * sizeof(uint16_t));
+        length += count * sizeof(uint16_t);
+        i += count;
+    }
+
+    return length;
+}
+
+static bool atlas_decode(const uint8_t* data, size_t length, uint16_t* tile)
+{
+    if (length == ODROID_ATLAS_TILE_SIZE)
+    {
+        memcpy(tile, data, ODROID_ATLAS_TILE_SIZE);
+        return true;
+    }
+
+    const size_t total = ODROID_ATLAS_TILE_SIZE / 2;
+    const uint8_t* end = data + length;
+    size_t i = 0;
+
+    while (data < end)
+    {
+        const uint8_t control = *data++;
+        if (control >= 0x80)
+        {
+            const size_t run = control - 0x80 + 2;
+            if ((size_t)(end - data) < sizeof(uint16_t) || i + run > total) return false;
+
+            uint16_t pixel;
+            memcpy(&pixel, data, sizeof(uint16_t));
+            data += sizeof(uint16_t);
+
+            for (size_t j = 0; j < run; ++j) tile[i++] = pixel;
+        }
+        else
+        {
+            const size_t count = control + 1;
+            if ((size_t)(end - data) < count * sizeof(uint16_t) || i + count > total) return false;
+
+            memcpy(&tile[i], data, count * sizeof(uint16_t));
+            data += count * sizeof(uint16_t);
+            i += count;
+        }
+    }
+
+    return i == total;
+}
+
+
+odroid_atlas_t* odroid_atlas_open(const char* path)
+{
+    odroid_atlas_t* atlas = calloc(1, sizeof(odroid_atlas_t));
+    if (!atlas) abort();
+
+    atlas->path = strdup(path);
+    if (!atlas->path) abort();
+
+    atlas->filename = path_join(path, ODROID_ATLAS_FILE);
+    if (!atlas_load(atlas))
+    {
+        const atlas_names_t names = { 0 };
+        atlas_set_entries(atlas, NULL, &names, 0);
+    }
+
+    printf("%s: %d tiles.\n", __func__, atlas->count);
+    return atlas;
+}
+
+void odroid_atlas_close(odroid_atlas_t* atlas)
+{
+    free(atlas->entries);
+    free(atlas->names.data);
+    free(atlas->sorted);
+    free(atlas->filename);
+    free(atlas->path);
+    free(atlas);
+}
+
+int odroid_atlas_count(odroid_atlas_t* atlas)
+{
+    return atlas->count;
+}
+
+int odroid_atlas_find(odroid_atlas_t* atlas, const char* name, uint32_t size, uint32_t mtime)
+{
+    const int index = atlas_lookup(atlas, name);
+    if (index < 0) return -1;
+
+    atlas_entry_t* entry = &atlas->entries[index];
+    if (entry->size != size || entry->mtime != mtime) entry->stale = true;
+
+    return (entry->stale || entry->length == 0) ? -1 : index;
+}
+
+bool odroid_atlas_stale(odroid_atlas_t* atlas)
+{
+    for (int i = 0; i < atlas->count; ++i)
+    {
+        if (atlas->entries[i].stale) return true;
+    }
+    return false;
+}
+
+bool odroid_atlas_read(odroid_atlas_t* atlas, int first, int count, uint16_t* tile, odroid_atlas_done_func done, void* arg)
+{
+    if (count <= 0 || first < 0 || first + count > atlas->count) return false;
+
+    const atlas_entry_t* last = &atlas->entries[first + count - 1];
+    const uint32_t start = atlas->entries[first].offset;
+    const size_t length = last->offset + last->length - start;
+
+    FILE* file = fopen(atlas->filename, "rb");
+    if (!file) return false;
+
+    uint8_t* data = malloc(length);
+    if (!data) abort();
+
+    // The whole run at once, unbuffered
+    setvbuf(file, NULL, _IONBF, 0);
+    const bool result = fseek(file, start, SEEK_SET) == 0 && fread(data, 1, length, file) == length;
+    fclose(file);
+
+    for (int i = first; result && i < first + count; ++i)
+    {
+        atlas_entry_t* entry = &atlas->entries[i];
+        if (!atlas_decode(data + entry->offset - start, entry->length, tile))
+        {
+            // Rewritten with the next update
+            entry->stale = true;
+            continue;
+        }
+
+        done(arg, i, tile);
+    }
+
+    free(data);
+    return result;
+}
+
+bool odroid_atlas_current(odroid_atlas_t* atlas, odroid_atlas_name_func name, void* arg, int count)
+{
+    int index = 0;
+    for (int i = 0; i < count; ++i)
+    {
+        const char* n = atlas_name(name, arg, i);
+        if (!n) continue;
+
+        if (index >= atlas->count) return false;
+
+        const atlas_entry_t* entry = &atlas->entries[index++];
+        if (entry->stale || strcmp(atlas->names.data + entry->name, n) != 0) return false;
+    }
+
+    return index == atlas->count;
+}
+
+bool odroid_atlas_update(odroid_atlas_t* atlas, odroid_atlas_name_func name, odroid_atlas_tile_func tile, void* arg, int count, const volatile bool* stop)
+{
+    char* tmpName = path_join(atlas->path, ATLAS_TMP_FILE);
+    FILE* out = fopen(tmpName, "wb");
+    if (!out)
+    {
+        printf("%s: fopen failed.\n", __func__);
+        free(tmpName);
+        return false;
+    }
+
+    FILE* in = atlas->count ? fopen(atlas->filename, "rb") : NULL;
+
+    atlas_entry_t* entries = malloc((count ? count : 1) * sizeof(atlas_entry_t));
+    atlas_names_t names = { 0 };
+    uint8_t* buffer = malloc(ODROID_ATLAS_TILE_SIZE);
+    uint16_t* pixels = malloc(ODROID_ATLAS_TILE_SIZE);
+    if (!entries || !buffer || !pixels) abort();
+
+    atlas_header_t header = { 0 };
+    memcpy(header.magic, ATLAS_MAGIC, sizeof(header.magic));
+    header.tile_size = ODROID_ATLAS_TILE_SIZE;
+
+    bool ok = fwrite(&header, 1, sizeof(header), out) == sizeof(header);
+    uint32_t offset = sizeof(header);
+    int written = 0;
+    int copied = 0;
+    int skipped = 0;
+
+    // Tiles in list order
+    for (int i = 0; ok && i < count; ++i)
+    {
+        if (stop && *stop)
+        {
+            ok = false;
+            break;
+        }
+
+        const char* n = atlas_name(name, arg, i);
+        if (!n)
+        {
+            // Too long: read from its .fw every time
+            if (name(arg, i)) ++skipped;
+            continue;
+        }
+
+        atlas_entry_t* entry = &entries[written];
+        entry->hash = name_hash(n);
+        entry->name = names_add(&names, n);
+        entry->stale = false;
+
+        const int old = in ? atlas_lookup(atlas, n) : -1;
+        const atlas_entry_t* previous = old >= 0 ? &atlas->entries[old] : NULL;
+        if (previous && !previous->stale &&
+            (previous->length == 0 ||
+                (fseek(in, previous->offset, SEEK_SET) == 0 && fread(buffer, 1, previous->length, in) == previous->length)))
+        {
+            entry->size = previous->size;
+            entry->mtime = previous->mtime;
+            entry->length = previous->length;
+            ++copied;
+        }
+        else if (!tile(arg, n, &entry->size, &entry->mtime, pixels))
+        {
+            // Recorded, so the file is not tried again until it changes
+            entry->length = 0;
+        }
+        else
+        {
+            entry->length = atlas_encode(pixels, buffer);
+            if (entry->length == 0)
+            {
+                memcpy(buffer, pixels, ODROID_ATLAS_TILE_SIZE);
+                entry->length = ODROID_ATLAS_TILE_SIZE;
+            }
+        }
+
+        entry->offset = offset;
+        if (entry->length) ok = fwrite(buffer, 1, entry->length, out) == entry->length;
+        offset += entry->length;
+        ++written;
+    }
+
+    // Records, then the header with their position
+    header.count = written;
+    header.index_offset = offset;
+    for (int k = 0; ok && k < written; ++k)
+    {
+        const atlas_entry_t* entry = &entries[k];
+        atlas_record_t record = { 0 };
+        strcpy(record.name, names.data + entry->name);
+        record.size = entry->size;
+        record.mtime = entry->mtime;
+        record.offset = entry->offset;
+        record.length = entry->length;
+        ok = fwrite(&record, 1, sizeof(record), out) == sizeof(record);
+    }
+
+    ok = ok && fseek(out, 0, SEEK_SET) == 0 && fwrite(&header, 1, sizeof(header), out) == sizeof(header);
+    ok = (fclose(out) == 0) && ok;
+    if (in) fclose(in);
+
+    free(pixels);
+    free(buffer);
+
+    if (ok)
+    {
+        unlink(atlas->filename);
+        ok = rename(tmpName, atlas->filename) == 0;
+    }
+
+    if (ok)
+    {
+        atlas_set_entries(atlas, entries, &names, written);
+        printf("%s: %d tiles, %d copied, %d names too long.\n", __func__, written, copied, skipped);
+    }
+    else
+    {
+        unlink(tmpName);
+        free(entries);
+        free(names.data);
+    }
+
+    free(tmpName);
+    return ok;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Thumbnail atlas: the tiles of a firmware directory packed into one file,
+// .atlas, in list order, so the tiles of a page come from one contiguous
+// read instead of one read per .fw file. Each tile is stored raw or run
+// length encoded, whichever is shorter, and counts only while its .fw still
+// has the recorded size and mtime. Names of 64 characters or more are left
+// out, so those files always read their tile from the .fw (the update logs
+// how many). Written by the menu and by tools/mkatlas, so this file uses
+// nothing but the C library.
+#define ODROID_ATLAS_FILE ".atlas"
+#define ODROID_ATLAS_TILE_SIZE (86 * 48 * 2)
+
+typedef struct odroid_atlas odroid_atlas_t;
+
+// Never NULL: a missing or invalid file gives an empty atlas
+odroid_atlas_t* odroid_atlas_open(const char* path);
+void odroid_atlas_close(odroid_atlas_t* atlas);
+int odroid_atlas_count(odroid_atlas_t* atlas);
+
+// Record of name's tile, -1 if there is none or the .fw changed since (then
+// the record is marked stale and the next update replaces it)
+int odroid_atlas_find(odroid_atlas_t* atlas, const char* name, uint32_t size, uint32_t mtime);
+
+// True if a find came across a changed file
+bool odroid_atlas_stale(odroid_atlas_t* atlas);
+
+// Reads records first .. first + count - 1 with one read and decodes each
+// into tile, calling done after each one. False if the read failed.
+typedef void (*odroid_atlas_done_func)(void* arg, int index, const uint16_t* tile);
+bool odroid_atlas_read(odroid_atlas_t* atlas, int first, int count, uint16_t* tile, odroid_atlas_done_func done, void* arg);
+
+// The files of the directory in list order, NULL for entries without a tile
+// (directories)
+typedef const char* (*odroid_atlas_name_func)(void* arg, int index);
+// Loads the tile of a file that is new or changed and gives its size and
+// mtime. False if it has no tile; that is recorded too, until it changes.
+typedef bool (*odroid_atlas_tile_func)(void* arg, const char* name, uint32_t* size, uint32_t* mtime, uint16_t* tile);
+
+// True if the atlas holds name(arg, 0) .. name(arg, count - 1) in that order
+// and none of its records is stale
+bool odroid_atlas_current(odroid_atlas_t* atlas, odroid_atlas_name_func name, void* arg, int count);
+
+// Rewrites the atlas for the files, copying the tiles of unchanged ones
+// from the old file. Stops early, keeping the old atlas, once *stop is set.
+bool odroid_atlas_update(odroid_atlas_t* atlas, odroid_atlas_name_func name, odroid_atlas_tile_func tile, void* arg, int count, const volatile bool* stop);
@@ -0,0 +1,669 @@
+#include "odroid_catalog.h"
+#include "odroid_sdcard.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+
+#define CATALOG_FILE ".catalog"
+#define CATALOG_MAGIC "ODROIDGO_CAT_V01"
+#define CATALOG_NAME_SIZE (64)
+#define CATALOG_DESCRIPTION_SIZE (40)
+#define CATALOG_STATUS_FREE (0xff)
+
+// Layout of a .fw file (see tools/mkfw)
+#define FIRMWARE_HEADER "ODROIDGO_FIRMWARE_V00_01"
+#define FIRMWARE_DESCRIPTION_SIZE (40)
+#define FIRMWARE_TILE_SIZE (86 * 48 * 2)
+#define FIRMWARE_HEAD_SIZE (sizeof(FIRMWARE_HEADER) - 1 + FIRMWARE_DESCRIPTION_SIZE)
+#define FIRMWARE_MIN_SIZE (FIRMWARE_HEAD_SIZE + FIRMWARE_TILE_SIZE + sizeof(uint32_t))
+
+typedef struct
+{
+    char magic[16];
+    uint32_t record_size;
+    uint32_t count;
+} catalog_header_t;
+
+// On card record, updated in place
+typedef struct
+{
+    char name[CATALOG_NAME_SIZE];
+    uint32_t size;
+    uint32_t mtime;
+    uint32_t tile_offset;
+    uint32_t payload_size;
+    uint32_t checksum;
+    uint8_t status;
+    uint8_t _reserved[3];
+    char description[CATALOG_DESCRIPTION_SIZE];
+} catalog_record_t;
+
+_Static_assert(sizeof(catalog_record_t) == 128, "catalog_record_t");
+
+#define ENTRY_VERIFIED (1 << 0)
+
+// In memory index entry, the description stays on the card
+typedef struct
+{
+    uint32_t hash;
+    uint32_t name;          // offset in names
+    uint32_t size;
+    uint32_t mtime;
+    uint32_t tile_offset;
+    uint32_t payload_size;
+    uint32_t checksum;
+    uint16_t slot;
+    uint8_t status;
+    uint8_t flags;
+} catalog_entry_t;
+
+// The names of the entries, packed. Removed entries leave their name
+// behind until the catalog is opened again.
+typedef struct
+{
+    char* data;
+    size_t size;
+    size_t used;
+} catalog_names_t;
+
+struct odroid_catalog
+{
+    char* path;
+    char* filename;
+    bool valid;
+
+    // Open between the writes of one call
+    FILE* file;
+    uint32_t header_count;  // slot count in the header on the card
+
+    catalog_names_t names;
+
+    // Sorted by hash
+    catalog_entry_t* entries;
+    int count;
+    int capacity;
+
+    int slot_count;
+    uint16_t* free_slots;
+    int free_count;
+};
+
+
+
+static uint32_t name_hash(const char* name)
+{
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    while (*name)
+    {
+        hash ^= (uint8_t)*name++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static uint32_t names_add(catalog_names_t* names, const char* name)
+{
+    const size_t length = strlen(name) + 1;
+    if (names->used + length > names->size)
+    {
+        size_t size = names->size ? names->size * 2 : 1024;
+        while (size < names->used + length) size *= 2;
+
+        char* data = realloc(names->data, size);
+        if (!data) abort();
+
+        names->data = data;
+        names->size = size;
+    }
+
+    const uint32_t result = names->used;
+    memcpy(names->data + names->used, name, length);
+    names->used += length;
+    return result;
+}
+
+static int entry_compare(const void* a, const void* b)
+{
+    const uint32_t x = ((const catalog_entry_t*)a)->hash;
+    const uint32_t y = ((const catalog_entry_t*)b)->hash;
+    return (x > y) - (x < y);
+}
+
+// Index of the first entry with hash >= 'hash'
+static int entry_lower_bound(odroid_catalog_t* catalog, uint32_t hash)
+{
+    int low = 0;
+    int high = catalog->count;
+    while (low < high)
+    {
+        int mid = (low + high) / 2;
+        if (catalog->entries[mid].hash < hash)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+static catalog_entry_t* entry_find(odroid_catalog_t* catalog, uint32_t hash, const char* name)
+{
+    for (int i = entry_lower_bound(catalog, hash); i < catalog->count && catalog->entries[i].hash == hash; ++i)
+    {
+        if (strcmp(catalog->names.data + catalog->entries[i].name, name) == 0) return &catalog->entries[i];
+    }
+    return NULL;
+}
+
+static catalog_entry_t* entry_insert(odroid_catalog_t* catalog, uint32_t hash, const char* name)
+{
+    if (catalog->count >= catalog->capacity)
+    {
+        int capacity = catalog->capacity ? catalog->capacity * 2 : 32;
+        catalog_entry_t* entries = realloc(catalog->entries, capacity * sizeof(catalog_entry_t));
+        if (!entries) abort();
+
+        catalog->entries = entries;
+        catalog->capacity = capacity;
+    }
+
+    int index = entry_lower_bound(catalog, hash);
+    memmove(&catalog->entries[index + 1], &catalog->entries[index], (catalog->count - index) * sizeof(catalog_entry_t));
+    ++catalog->count;
+
+    memset(&catalog->entries[index], 0, sizeof(catalog_entry_t));
+    catalog->entries[index].hash = hash;
+    catalog->entries[index].name = names_add(&catalog->names, name);
+    return &catalog->entries[index];
+}
+
+static void slot_release(odroid_catalog_t* catalog, uint16_t slot)
+{
+    uint16_t* slots = realloc(catalog->free_slots, (catalog->free_count + 1) * sizeof(uint16_t));
+    if (!slots) abort();
+
+    catalog->free_slots = slots;
+    catalog->free_slots[catalog->free_count++] = slot;
+}
+
+static uint16_t slot_allocate(odroid_catalog_t* catalog)
+{
+    if (catalog->free_count > 0) return catalog->free_slots[--catalog->free_count];
+    return catalog->slot_count++;
+}
+
+static char* path_join(const char* path, const char* name)
+{
+    char* result = malloc(strlen(path) + 1 + strlen(name) + 1);
+    if (!result) abort();
+
+    strcpy(result, path);
+    strcat(result, "/");
+    strcat(result, name);
+    return result;
+}
+
+
+static bool catalog_load(odroid_catalog_t* catalog)
+{
+    FILE* file = fopen(catalog->filename, "rb");
+    if (!file) return false;
+
+    bool result = false;
+    catalog_header_t header;
+    if (fread(&header, 1, sizeof(header), file) != sizeof(header) ||
+        memcmp(header.magic, CATALOG_MAGIC, sizeof(header.magic)) != 0 ||
+        header.record_size != sizeof(catalog_record_t))
+    {
+        printf("%s: invalid catalog.\n", __func__);
+        goto catalog_load_exit;
+    }
+
+    // One sequential pass over the records
+    catalog_record_t record;
+    for (uint32_t slot = 0; slot < header.count; ++slot)
+    {
+        if (fread(&record, 1, sizeof(record), file) != sizeof(record)) break;
+
+        catalog->slot_count = slot + 1;
+
+        if (record.status == CATALOG_STATUS_FREE)
+        {
+            slot_release(catalog, slot);
+            continue;
+        }
+
+        record.name[CATALOG_NAME_SIZE - 1] = 0;
+
+        if (catalog->count >= catalog->capacity)
+        {
+            int capacity = catalog->capacity ? catalog->capacity * 2 : 32;
+            catalog_entry_t* entries = realloc(catalog->entries, capacity * sizeof(catalog_entry_t));
+            if (!entries) abort();
+
+            catalog->entries = entries;
+            catalog->capacity = capacity;
+        }
+
+        catalog_entry_t* entry = &catalog->entries[catalog->count++];
+        entry->hash = name_hash(record.name);
+        entry->name = names_add(&catalog->names, record.name);
+        entry->size = record.size;
+        entry->mtime = record.mtime;
+        entry->tile_offset = record.tile_offset;
+        entry->payload_size = record.payload_size;
+        entry->checksum = record.checksum;
+        entry->slot = slot;
+        entry->status = record.status;
+        entry->flags = 0;
+    }
+
+    qsort(catalog->entries, catalog->count, sizeof(catalog_entry_t), entry_compare);
+    catalog->header_count = header.count;
+    result = true;
+
+catalog_load_exit:
+    fclose(file);
+    return result;
+}
+
+static void catalog_write(odroid_catalog_t* catalog, uint16_t slot, const catalog_record_t* record)
+{
+    if (!catalog->file)
+    {
+        if (catalog->valid) catalog->file = fopen(catalog->filename, "r+b");
+        if (!catalog->file)
+        {
+            // Missing or unusable: start over
+            catalog->file = fopen(catalog->filename, "w+b");
+            if (!catalog->file)
+            {
+                printf("%s: fopen failed.\n", __func__);
+                return;
+            }
+            catalog->valid = true;
+            catalog->header_count = UINT32_MAX;
+        }
+    }
+
+    if (fseek(catalog->file, sizeof(catalog_header_t) + slot * sizeof(catalog_record_t), SEEK_SET) != 0 ||
+        fwrite(record, 1, sizeof(*record), catalog->file) != sizeof(*record))
+    {
+        printf("%s: write failed.\n", __func__);
+    }
+}
+
+// Ends the writes of a call: the header once, then the file is closed
+static void catalog_write_end(odroid_catalog_t* catalog)
+{
+    if (!catalog->file) return;
+
+    if (catalog->header_count != (uint32_t)catalog->slot_count)
+    {
+        catalog_header_t header;
+        memcpy(header.magic, CATALOG_MAGIC, sizeof(header.magic));
+        header.record_size = sizeof(catalog_record_t);
+        header.count = catalog->slot_count;
+
+        if (fseek(catalog->file, 0, SEEK_SET) != 0 ||
+            fwrite(&header, 1, sizeof(header), catalog->file) != sizeof(header))
+        {
+            printf("%s: write failed.\n", __func__);
+        }
+        else
+        {
+            catalog->header_count = header.count;
+        }
+    }
+
+    fclose(catalog->file);
+    catalog->file = NULL;
+}
+
+// Fills in the header information of a .fw file from the start of the file
+// (headCount bytes of it read) and the trailing checksum
+static void firmware_parse(const struct stat* st, const char* head, size_t headCount, bool checksumRead, uint32_t checksum, catalog_record_t* record)
+{
+    const size_t headerLength = strlen(FIRMWARE_HEADER);
+
+    record->status = ODROID_CATALOG_READ_ERROR;
+    if (headCount < headerLength) return;
+
+    if (strncmp(head, FIRMWARE_HEADER, headerLength) != 0 || st->st_size < FIRMWARE_MIN_SIZE)
+    {
+        record->status = ODROID_CATALOG_BAD_HEADER;
+        return;
+    }
+
+    if (headCount < FIRMWARE_HEAD_SIZE || !checksumRead) return;
+
+    memcpy(record->description, head + headerLength, FIRMWARE_DESCRIPTION_SIZE);
+    record->description[CATALOG_DESCRIPTION_SIZE - 1] = 0;
+
+    record->checksum = checksum;
+    record->tile_offset = FIRMWARE_HEAD_SIZE;
+    record->payload_size = st->st_size - record->tile_offset - FIRMWARE_TILE_SIZE - sizeof(uint32_t);
+    record->status = ODROID_CATALOG_OK;
+}
+
+// Reads the header information of a .fw file
+static void firmware_probe(const char* fullPath, const struct stat* st, catalog_record_t* record)
+{
+    char head[FIRMWARE_HEAD_SIZE];
+    size_t headCount = 0;
+    uint32_t checksum = 0;
+    bool checksumRead = false;
+
+    // Kept open for the tile read that usually follows
+    FILE* file = odroid_sdcard_acquire(fullPath);
+    if (file)
+    {
+        headCount = fread(head, 1, FIRMWARE_HEAD_SIZE, file);
+        checksumRead = headCount == FIRMWARE_HEAD_SIZE &&
+            fseek(file, st->st_size - sizeof(uint32_t), SEEK_SET) == 0 &&
+            fread(&checksum, 1, sizeof(uint32_t), file) == sizeof(uint32_t);
+
+        odroid_sdcard_release(file);
+    }
+
+    firmware_parse(st, head, headCount, checksumRead, checksum, record);
+}
+
+// Stores a probe result, adding the entry if there is none
+static catalog_entry_t* entry_update(odroid_catalog_t* catalog, catalog_entry_t* entry, uint32_t hash, const catalog_record_t* record)
+{
+    if (!entry)
+    {
+        entry = entry_insert(catalog, hash, record->name);
+        entry->slot = slot_allocate(catalog);
+    }
+
+    entry->size = record->size;
+    entry->mtime = record->mtime;
+    entry->tile_offset = record->tile_offset;
+    entry->payload_size = record->payload_size;
+    entry->checksum = record->checksum;
+    entry->status = record->status;
+
+    catalog_write(catalog, entry->slot, record);
+    return entry;
+}
+
+// The file is gone
+static void entry_remove(odroid_catalog_t* catalog, catalog_entry_t* entry)
+{
+    catalog_record_t record = { 0 };
+    record.status = CATALOG_STATUS_FREE;
+    catalog_write(catalog, entry->slot, &record);
+    slot_release(catalog, entry->slot);
+
+    int index = entry - catalog->entries;
+    memmove(entry, entry + 1, (catalog->count - index - 1) * sizeof(catalog_entry_t));
+    --catalog->count;
+}
+
+
+odroid_catalog_t* odroid_catalog_open(const char* path)
+{
+    odroid_catalog_t* catalog = calloc(1, sizeof(odroid_catalog_t));
+    if (!catalog) abort();
+
+    catalog->path = strdup(path);
+    if (!catalog->path) abort();
+
+    catalog->filename = path_join(path, CATALOG_FILE);
+    catalog->valid = catalog_load(catalog);
+
+    printf("%s: %d entries, %d free.\n", __func__, catalog->count, catalog->free_count);
+    return catalog;
+}
+
+void odroid_catalog_close(odroid_catalog_t* catalog)
+{
+    free(catalog->entries);
+    free(catalog->names.data);
+    free(catalog->free_slots);
+    free(catalog->filename);
+    free(catalog->path);
+    free(catalog);
+}
+
+bool odroid_catalog_lookup(odroid_catalog_t* catalog, const char* name, odroid_catalog_info_t* out)
+{
+    if (strlen(name) >= CATALOG_NAME_SIZE) return false;
+
+    const uint32_t hash = name_hash(name);
+    catalog_entry_t* entry = entry_find(catalog, hash, name);
+
+    // Known and already checked in this session: no card access
+    if (!entry || !(entry->flags & ENTRY_VERIFIED))
+    {
+        char* fullPath = path_join(catalog->path, name);
+
+        struct stat st;
+        if (!odroid_sdcard_stat(fullPath, &st))
+        {
+            if (entry) entry_remove(catalog, entry);
+            catalog_write_end(catalog);
+
+            free(fullPath);
+            return false;
+        }
+
+        if (!entry || entry->size != (uint32_t)st.st_size || entry->mtime != (uint32_t)st.st_mtime)
+        {
+            catalog_record_t record = { 0 };
+            strcpy(record.name, name);
+            record.size = st.st_size;
+            record.mtime = st.st_mtime;
+            firmware_probe(fullPath, &st, &record);
+
+            entry = entry_update(catalog, entry, hash, &record);
+            catalog_write_end(catalog);
+        }
+
+        entry->flags |= ENTRY_VERIFIED;
+        free(fullPath);
+    }
+
+    out->status = entry->status;
+    out->size = entry->size;
+    out->mtime = entry->mtime;
+    out->tile_offset = entry->tile_offset;
+    out->payload_size = entry->payload_size;
+    out->checksum = entry->checksum;
+    return true;
+}
+
+typedef struct
+{
+    const char* name;
+    uint32_t hash;
+    char* fullPath;
+    struct stat st;
+    int head_read;
+    int checksum_read;      // -1 if the file is too short
+    char head[FIRMWARE_HEAD_SIZE];
+    uint32_t checksum;
+} catalog_probe_t;
+
+void odroid_catalog_verify(odroid_catalog_t* catalog, const char* const* names, int count)
+{
+    catalog_probe_t* probes = malloc((count ? count : 1) * sizeof(catalog_probe_t));
+    odroid_sdcard_read_t* reads = calloc((count ? count : 1) * 2, sizeof(odroid_sdcard_read_t));
+    if (!probes || !reads) abort();
+
+    int probeCount = 0;
+    int readCount = 0;
+
+    // Files that are new or changed since the catalog was written
+    for (int i = 0; i < count; ++i)
+    {
+        if (strlen(names[i]) >= CATALOG_NAME_SIZE) continue;
+
+        catalog_probe_t* probe = &probes[probeCount];
+        probe->name = names[i];
+        probe->hash = name_hash(probe->name);
+
+        catalog_entry_t* entry = entry_find(catalog, probe->hash, probe->name);
+        if (entry && (entry->flags & ENTRY_VERIFIED)) continue;
+
+        probe->fullPath = path_join(catalog->path, probe->name);
+        if (!odroid_sdcard_stat(probe->fullPath, &probe->st))
+        {
+            if (entry) entry_remove(catalog, entry);
+            free(probe->fullPath);
+            continue;
+        }
+
+        if (entry && entry->size == (uint32_t)probe->st.st_size && entry->mtime == (uint32_t)probe->st.st_mtime)
+        {
+            entry->flags |= ENTRY_VERIFIED;
+            free(probe->fullPath);
+            continue;
+        }
+
+        odroid_sdcard_read_t* read = &reads[readCount];
+        read->path = probe->fullPath;
+        read->offset = 0;
+        read->length = FIRMWARE_HEAD_SIZE;
+        read->buffer = probe->head;
+        probe->head_read = readCount++;
+
+        probe->checksum_read = -1;
+        if (probe->st.st_size >= FIRMWARE_MIN_SIZE)
+        {
+            read = &reads[readCount];
+            read->path = probe->fullPath;
+            read->offset = probe->st.st_size - sizeof(uint32_t);
+            read->length = sizeof(uint32_t);
+            read->buffer = &probe->checksum;
+            probe->checksum_read = readCount++;
+        }
+
+        ++probeCount;
+    }
+
+    // All of their headers in card order
+    odroid_sdcard_read_batch(reads, readCount, NULL, NULL);
+
+    for (int i = 0; i < probeCount; ++i)
+    {
+        catalog_probe_t* probe = &probes[i];
+        const odroid_sdcard_read_t* head = &reads[probe->head_read];
+        const odroid_sdcard_read_t* checksum = probe->checksum_read >= 0 ? &reads[probe->checksum_read] : NULL;
+
+        catalog_record_t record = { 0 };
+        strcpy(record.name, probe->name);
+        record.size = probe->st.st_size;
+        record.mtime = probe->st.st_mtime;
+        firmware_parse(&probe->st, probe->head, head->ok ? head->count : 0,
+            checksum && checksum->ok && checksum->count == sizeof(uint32_t), probe->checksum, &record);
+
+        // Earlier updates may have moved the entries
+        catalog_entry_t* entry = entry_update(catalog, entry_find(catalog, probe->hash, probe->name), probe->hash, &record);
+        entry->flags |= ENTRY_VERIFIED;
+
+        free(probe->fullPath);
+    }
+    catalog_write_end(catalog);
+
+    free(reads);
+    free(probes);
+}
+
+bool odroid_catalog_description(odroid_catalog_t* catalog, const char* name, char* out, size_t size)
+{
+    odroid_catalog_info_t info;
+    if (!odroid_catalog_lookup(catalog, name, &info) || info.status != ODROID_CATALOG_OK) return false;
+
+    const catalog_entry_t* entry = entry_find(catalog, name_hash(name), name);
+
+    FILE* file = fopen(catalog->filename, "rb");
+    if (!file) return false;
+
+    char description[CATALOG_DESCRIPTION_SIZE];
+    bool result = fseek(file, sizeof(catalog_header_t) + entry->slot * sizeof(catalog_record_t) + offsetof(catalog_record_t, description), SEEK_SET) == 0 &&
+        fread(description, 1, sizeof(description), file) == sizeof(description);
+    fclose(file);
+
+    if (result && size > 0)
+    {
+        description[CATALOG_DESCRIPTION_SIZE - 1] = 0;
+        strncpy(out, description, size - 1);
+        out[size - 1] = 0;
+    }
+
+    return result;
+}
+
+typedef struct
+{
+    uint32_t hash;
+    int index;
+} catalog_present_t;
+
+static int present_compare(const void* a, const void* b)
+{
+    const uint32_t x = ((const catalog_present_t*)a)->hash;
+    const uint32_t y = ((const catalog_present_t*)b)->hash;
+    return (x > y) - (x < y);
+}
+
+void odroid_catalog_prune(odroid_catalog_t* catalog, odroid_catalog_name_func name, void* arg, int count)
+{
+    // Hashes of the names that exist, sorted
+    catalog_present_t* present = malloc((count ? count : 1) * sizeof(catalog_present_t));
+    if (!present) abort();
+
+    for (int i = 0; i < count; ++i)
+    {
+        present[i].hash = name_hash(name(arg, i));
+        present[i].index = i;
+    }
+    qsort(present, count, sizeof(catalog_present_t), present_compare);
+
+    const catalog_record_t record = { .status = CATALOG_STATUS_FREE };
+    int kept = 0;
+    for (int i = 0; i < catalog->count; ++i)
+    {
+        catalog_entry_t* entry = &catalog->entries[i];
+        const char* entryName = catalog->names.data + entry->name;
+
+        bool found = false;
+        catalog_present_t key = { .hash = entry->hash };
+        catalog_present_t* match = bsearch(&key, present, count, sizeof(catalog_present_t), present_compare);
+        if (match)
+        {
+            // bsearch may land on any of several equal hashes
+            while (match > present && (match - 1)->hash == entry->hash) --match;
+            for (; !found && match < present + count && match->hash == entry->hash; ++match)
+            {
+                found = strcmp(name(arg, match->index), entryName) == 0;
+            }
+        }
+
+        if (found)
+        {
+            catalog->entries[kept++] = *entry;
+        }
+        else
+        {
+            catalog_write(catalog, entry->slot, &record);
+            slot_release(catalog, entry->slot);
+        }
+    }
+    catalog_write_end(catalog);
+
+    if (kept != catalog->count) printf("%s: removed %d entries.\n", __func__, catalog->count - kept);
+    catalog->count = kept;
+
+    free(present);
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Per directory cache of the .fw header information, stored as .catalog in
+// the firmware directory. Entries are checked against the file's size and
+// mtime the first time they are looked up and re-read only if they changed.
+typedef struct odroid_catalog odroid_catalog_t;
+
+enum
+{
+    ODROID_CATALOG_OK = 0,
+    ODROID_CATALOG_BAD_HEADER,
+    ODROID_CATALOG_READ_ERROR,
+};
+
+typedef struct
+{
+    uint8_t status;
+    uint32_t size;
+    uint32_t mtime;
+    uint32_t tile_offset;
+    uint32_t payload_size;  // partition data between the tile and the checksum
+    uint32_t checksum;      // as stored at the end of the file
+} odroid_catalog_info_t;
+
+odroid_catalog_t* odroid_catalog_open(const char* path);
+void odroid_catalog_close(odroid_catalog_t* catalog);
+
+// Returns false if the file does not exist or can not be cataloged
+bool odroid_catalog_lookup(odroid_catalog_t* catalog, const char* name, odroid_catalog_info_t* out);
+// Brings the entries of several files up to date at once, as the lookups
+// would one by one. The headers of new and changed files are read in one
+// batch in card order (see odroid_sdcard_read_batch).
+void odroid_catalog_verify(odroid_catalog_t* catalog, const char* const* names, int count);
+bool odroid_catalog_description(odroid_catalog_t* catalog, const char* name, char* out, size_t size);
+
+// Drops entries for files that are not among name(arg, 0) .. name(arg, count - 1)
+typedef const char* (*odroid_catalog_name_func)(void* arg, int index);
+void odroid_catalog_prune(odroid_catalog_t* catalog, odroid_catalog_name_func name, void* arg, int count);
@@ -7,6 +7,8 @@
 #include <string.h>
 
 #include "odroid_display.h"
+#include "odroid_spibus.h"
+#include "odroid_latency.h"
 
 
 const gpio_num_t SPI_PIN_NUM_MISO = GPIO_NUM_19;
@@ -34,6 +36,11 @@ static spi_device_handle_t spi;
 static TaskHandle_t xTaskToNotify = NULL;
 //static bool useCallbacks = false;
 
+// Bytes sent since the bus was last handed over
+static size_t burst_bytes;
+// Line transactions queued and not collected yet
+static int trans_pending;
+
 
 #define LINE_COUNT (6)
 //uint16_t* line[2]; //[320 * LINE_COUNT]; // Must be at least 320
@@ -182,6 +189,10 @@ static void send_reset_drawing(int left, int top, int width, int height)
   trans[3].tx_data[3]=(top + height - 1)&0xff;  //end page low
   trans[4].tx_data[0]=0x2C;           //memory write
 
+  // Held until send_end_drawing, the SD card gets it between bursts
+  odroid_spibus_acquire(ODROID_SPIBUS_LCD);
+  burst_bytes = 0;
+
   // Queue all transactions.
   for (int x = 0; x < 5; x++) {
       ret=spi_device_queue_trans(spi, &trans[x], 1000 / portTICK_PERIOD_MS);
@@ -196,10 +207,34 @@ static void send_reset_drawing(int left, int top, int width, int height)
   }
 }
 
+// Collects the queued line, its buffer may be reused after this
+static void send_continue_wait()
+{
+  spi_transaction_t *rtrans;
+  for (; trans_pending > 0; --trans_pending) {
+      esp_err_t ret=spi_device_get_trans_result(spi, &rtrans, portMAX_DELAY);
+      assert(ret==ESP_OK);
+  }
+}
+
+// Queues the line and returns while it is sent: the caller fills the other
+// line buffer meanwhile
 static void send_continue_line(uint16_t *line, int width, int lineCount)
 {
   esp_err_t ret;
 
+  // trans[6..7] are reused, and the bus is only handed over idle
+  send_continue_wait();
+
+  const size_t bytes = width * lineCount * 2;
+  if (burst_bytes > 0 && burst_bytes + bytes > odroid_spibus_burst(ODROID_SPIBUS_LCD))
+  {
+      // Memory write continue resumes where the last line ended
+      odroid_spibus_yield(ODROID_SPIBUS_LCD);
+      burst_bytes = 0;
+  }
+  burst_bytes += bytes;
+
   trans[6].tx_data[0] = 0x3C;           //memory write continue
   trans[6].length = 8;            //Data length, in bits
   trans[6].flags = SPI_TRANS_USE_TXDATA;
@@ -214,14 +249,17 @@ static void send_continue_line(uint16_t *line, int width, int lineCount)
   for (int x = 6; x < 8; x++) {
       ret=spi_device_queue_trans(spi, &trans[x], 1000 / portTICK_PERIOD_MS);
       assert(ret==ESP_OK);
+      ++trans_pending;
   }
+}
 
-  // Wait for all transactions
-  spi_transaction_t *rtrans;
-  for (int x = 0; x < 2; x++) {
-      ret=spi_device_get_trans_result(spi, &rtrans, portMAX_DELAY);
-      assert(ret==ESP_OK);
-  }
+static void send_end_drawing()
+{
+  send_continue_wait();
+  odroid_spibus_release(ODROID_SPIBUS_LCD);
+
+  // The last line is on the panel
+  odroid_latency_present();
 }
 
 static void backlight_init()
@@ -260,6 +298,8 @@ void ili9341_write_frame(uint16_t* buffer)
             send_continue_line(buffer + y * displayWidth, displayWidth, 4);
         }
     }
+
+    send_end_drawing();
 }
 
 void ili9341_write_frame_rectangle(short left, short top, short width, short height, uint16_t* buffer)
@@ -294,6 +334,8 @@ void ili9341_write_frame_rectangle(short left, short top, short width, short hei
             if (alt > 1) alt = 0;
         }
     }
+
+    send_end_drawing();
 }
 
 void ili9341_clear(uint16_t color)
@@ -311,6 +353,8 @@ void ili9341_clear(uint16_t color)
     {
         send_continue_line(line[0], 320, 1);
     }
+
+    send_end_drawing();
 }
 
 void ili9341_write_frame_rectangleLE(short left, short top, short width, short height, uint16_t* buffer)
@@ -351,6 +395,8 @@ void ili9341_write_frame_rectangleLE(short left, short top, short width, short h
             if (alt > 1) alt = 0;
         }
     }
+
+    send_end_drawing();
 }
 
 void ili9341_init()
@@ -0,0 +1,676 @@
+#include "odroid_filelist.h"
+#include "odroid_filename.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <dirent.h>
+#include <string.h>
+#include <ctype.h>
+#include <sys/stat.h>
+
+
+#define FILELIST_INITIAL_CAPACITY (64)
+#define FILELIST_EXTENSION_MAX (16)
+
+// Names are packed into chunks that never move, so pointers returned by
+// odroid_filelist_name stay valid while the list grows. Chunks double in
+// size up to a limit that is still easy to find on a fragmented heap.
+#define FILELIST_CHUNK_MIN (4096)
+#define FILELIST_CHUNK_MAX (16384)
+#define FILELIST_CHUNKS (32)
+#define FILELIST_NAME_MAX (255)
+#define FILELIST_PATH_MAX (512)
+
+#define FILELIST_DIRECTORY (0x01)
+#define FILELIST_NO_NUMBER (0xffffffffu)
+
+// Runs of names with the same first letter, everything that is not a letter
+// counts as one letter: at most 28 runs for directories and 28 for files
+#define FILELIST_GROUPS (56)
+
+typedef struct
+{
+    uint32_t offset;    // in the chunk
+    uint32_t key;       // first four characters, case folded, big endian
+    uint32_t number;    // value of the first number, see sort_number
+    uint16_t length;
+    uint8_t chunk;
+    uint8_t flags;
+} filelist_entry_t;
+
+struct odroid_filelist
+{
+    SemaphoreHandle_t lock;
+    SemaphoreHandle_t exited;
+    SemaphoreHandle_t found;    // given once wanted entries are known, or when done
+
+    char* path;
+    char extension[FILELIST_EXTENSION_MAX];
+
+    // Protected by lock: the index moves when it grows
+    filelist_entry_t* entries;
+    int capacity;
+
+    char* chunks[FILELIST_CHUNKS];
+    int chunk_count;
+    uint32_t chunk_size;    // of the last chunk
+    uint32_t chunk_used;
+
+    // Protected by lock, set once the list is sorted
+    int groups[FILELIST_GROUPS];
+    int group_count;
+
+    volatile int count;
+    volatile int wanted;
+    volatile int dropped;   // names too long or past the last chunk
+    volatile uint32_t generation;
+    volatile bool done;
+    volatile bool cancel;
+};
+
+
+
+// Case folded characters before the first digit, big endian. A digit is
+// stored as '0' and ends the key, so keys order like odroid_filename_compare
+// and equal keys need the full comparison.
+static uint32_t sort_key(const char* name)
+{
+    uint32_t key = 0;
+    bool digit = false;
+    for (int i = 0; i < 4; ++i)
+    {
+        key <<= 8;
+        if (digit || !*name) continue;
+
+        if (odroid_filename_is_digit(*name))
+        {
+            key |= '0';
+            digit = true;
+        }
+        else
+        {
+            key |= odroid_filename_fold(*name++);
+        }
+    }
+    return key;
+}
+
+// Value of the first number, FILELIST_NO_NUMBER when there is none or it
+// has more than nine digits
+static uint32_t sort_number(const char* name)
+{
+    while (*name && !odroid_filename_is_digit(*name)) ++name;
+    if (!*name) return FILELIST_NO_NUMBER;
+
+    while (*name == '0') ++name;
+
+    uint32_t value = 0;
+    for (int digits = 0; odroid_filename_is_digit(*name); ++digits)
+    {
+        if (digits == 9) return FILELIST_NO_NUMBER;
+        value = value * 10 + (*name++ - '0');
+    }
+    return value;
+}
+
+// Text before the first number that the names sorting between lower and
+// upper all share, when both have a number right after it: the names in
+// between have theirs there too. -1 if not known.
+static int sort_shared(const char* lower, const char* upper)
+{
+    if (!lower || !upper) return -1;
+
+    int i = 0;
+    while (lower[i] && !odroid_filename_is_digit(lower[i]) && odroid_filename_fold(lower[i]) == odroid_filename_fold(upper[i])) ++i;
+
+    return (odroid_filename_is_digit(lower[i]) && odroid_filename_is_digit(upper[i])) ? i : -1;
+}
+
+static inline const char* entry_name(const odroid_filelist_t* list, const filelist_entry_t* entry)
+{
+    return list->chunks[entry->chunk] + entry->offset;
+}
+
+static inline int entry_compare(const odroid_filelist_t* list, const filelist_entry_t* a, const filelist_entry_t* b)
+{
+    // Directories first
+    if (a->flags != b->flags) return (a->flags & FILELIST_DIRECTORY) ? -1 : 1;
+
+    // Most names differ in the first characters
+    if (a->key != b->key) return (a->key < b->key) ? -1 : 1;
+
+    const char* nameA = entry_name(list, a);
+    const char* nameB = entry_name(list, b);
+    int d = odroid_filename_compare(nameA, nameB);
+    return d ? d : strcmp(nameA, nameB);
+}
+
+// Within a range whose names share the text before their first number, that
+// number orders them without reading the names
+static inline int range_compare(const odroid_filelist_t* list, const filelist_entry_t* a, const filelist_entry_t* b, int shared)
+{
+    if (shared >= 0 && a->number != b->number && a->number != FILELIST_NO_NUMBER && b->number != FILELIST_NO_NUMBER)
+    {
+        return (a->number < b->number) ? -1 : 1;
+    }
+
+    return entry_compare(list, a, b);
+}
+
+inline static void swap(filelist_entry_t* a, filelist_entry_t* b)
+{
+    filelist_entry_t t = *a;
+    *a = *b;
+    *b = t;
+}
+
+
+#define SORT_INSERTION_MAX (16)
+#define SORT_STACK_SIZE (40)
+
+static void insertion_sort(const odroid_filelist_t* list, filelist_entry_t arr[], int low, int high, int shared)
+{
+    for (int i = low + 1; i <= high; ++i)
+    {
+        filelist_entry_t item = arr[i];
+        int j = i - 1;
+        while (j >= low && range_compare(list, &arr[j], &item, shared) > 0)
+        {
+            arr[j + 1] = arr[j];
+            --j;
+        }
+        arr[j + 1] = item;
+    }
+}
+
+static void sift_down(const odroid_filelist_t* list, filelist_entry_t arr[], int root, int count, int shared)
+{
+    while (root * 2 + 1 < count)
+    {
+        int child = root * 2 + 1;
+        if (child + 1 < count && range_compare(list, &arr[child], &arr[child + 1], shared) < 0) ++child;
+        if (range_compare(list, &arr[root], &arr[child], shared) >= 0) return;
+
+        swap(&arr[root], &arr[child]);
+        root = child;
+    }
+}
+
+static void heap_sort(const odroid_filelist_t* list, filelist_entry_t arr[], int count, int shared)
+{
+    for (int i = count / 2 - 1; i >= 0; --i)
+    {
+        sift_down(list, arr, i, count, shared);
+    }
+
+    for (int i = count - 1; i > 0; --i)
+    {
+        swap(&arr[0], &arr[i]);
+        sift_down(list, arr, 0, i, shared);
+    }
+}
+
+// Quicksort with a median of three pivot on an explicit stack. Ranges that
+// partition badly too often are heap sorted instead, small ones are left
+// to insertion sort. Each range keeps the pivots around it, for sort_shared.
+// Directories and files must not be mixed.
+static void intro_sort(const odroid_filelist_t* list, filelist_entry_t arr[], int count)
+{
+    struct
+    {
+        int low;
+        int high;
+        int depth;
+        const char* lower;  // NULL at the ends
+        const char* upper;
+    } stack[SORT_STACK_SIZE];
+    int top = 0;
+
+    int depth = 0;
+    for (int n = count; n > 1; n >>= 1)
+    {
+        depth += 2;
+    }
+
+    stack[top].low = 0;
+    stack[top].high = count - 1;
+    stack[top].depth = depth;
+    stack[top].lower = NULL;
+    stack[top].upper = NULL;
+    ++top;
+
+    while (top > 0)
+    {
+        --top;
+        int low = stack[top].low;
+        int high = stack[top].high;
+        depth = stack[top].depth;
+        const char* lower = stack[top].lower;
+        const char* upper = stack[top].upper;
+        int shared = sort_shared(lower, upper);
+
+        while (high - low > SORT_INSERTION_MAX)
+        {
+            if (depth == 0)
+            {
+                heap_sort(list, arr + low, high - low + 1, shared);
+                low = high;
+                break;
+            }
+            --depth;
+
+            // Ordering the three also gives both scans a sentinel
+            const int mid = low + (high - low) / 2;
+            if (range_compare(list, &arr[mid], &arr[low], shared) < 0) swap(&arr[mid], &arr[low]);
+            if (range_compare(list, &arr[high], &arr[low], shared) < 0) swap(&arr[high], &arr[low]);
+            if (range_compare(list, &arr[high], &arr[mid], shared) < 0) swap(&arr[high], &arr[mid]);
+            const filelist_entry_t pivot = arr[mid];
+            const char* pivotName = entry_name(list, &pivot);
+
+            int i = low;
+            int j = high;
+            while (i <= j)
+            {
+                while (range_compare(list, &arr[i], &pivot, shared) < 0) ++i;
+                while (range_compare(list, &arr[j], &pivot, shared) > 0) --j;
+                if (i <= j)
+                {
+                    swap(&arr[i], &arr[j]);
+                    ++i;
+                    --j;
+                }
+            }
+
+            // Continue with the smaller side, so the stack stays below log2(count)
+            if (j - low < high - i)
+            {
+                stack[top].low = i;
+                stack[top].high = high;
+                stack[top].depth = depth;
+                stack[top].lower = pivotName;
+                stack[top].upper = upper;
+                high = j;
+                upper = pivotName;
+            }
+            else
+            {
+                stack[top].low = low;
+                stack[top].high = j;
+                stack[top].depth = depth;
+                stack[top].lower = lower;
+                stack[top].upper = pivotName;
+                low = i;
+                lower = pivotName;
+            }
+            ++top;
+
+            // Once known it holds for every range inside
+            if (shared < 0) shared = sort_shared(lower, upper);
+        }
+
+        insertion_sort(list, arr, low, high, shared);
+    }
+}
+
+
+static bool scan_is_directory(const odroid_filelist_t* list, const struct dirent* entry)
+{
+    if (entry->d_type != DT_UNKNOWN) return entry->d_type == DT_DIR;
+
+    char fullPath[FILELIST_PATH_MAX];
+    if (snprintf(fullPath, sizeof(fullPath), "%s/%s", list->path, entry->d_name) >= sizeof(fullPath)) return false;
+
+    struct stat st;
+    return stat(fullPath, &st) == 0 && S_ISDIR(st.st_mode);
+}
+
+// Returns the next matching file or subdirectory or NULL at the end
+static const char* scan_next(const odroid_filelist_t* list, DIR* dir, bool* directory)
+{
+    struct dirent *entry;
+    while((entry=readdir(dir)) != NULL)
+    {
+        const char* name = entry->d_name;
+        if (odroid_filename_hidden(name)) continue;
+
+        // Only listed here, read when opened
+        *directory = scan_is_directory(list, entry);
+        if (*directory) return name;
+
+        if (odroid_filename_matches(name, list->extension)) return name;
+    }
+
+    return NULL;
+}
+
+static void list_append(odroid_filelist_t* list, const char* name, uint8_t flags)
+{
+    const size_t length = strlen(name);
+    if (length > FILELIST_NAME_MAX)
+    {
+        ++list->dropped;
+        return;
+    }
+
+    xSemaphoreTake(list->lock, portMAX_DELAY);
+
+    if (list->count >= list->capacity)
+    {
+        int capacity = list->capacity ? list->capacity * 2 : FILELIST_INITIAL_CAPACITY;
+        filelist_entry_t* entries = realloc(list->entries, capacity * sizeof(filelist_entry_t));
+        if (!entries) abort();
+
+        list->entries = entries;
+        list->capacity = capacity;
+    }
+
+    if (list->chunk_count == 0 || list->chunk_used + length + 1 > list->chunk_size)
+    {
+        if (list->chunk_count >= FILELIST_CHUNKS)
+        {
+            ++list->dropped;
+            xSemaphoreGive(list->lock);
+            return;
+        }
+
+        uint32_t size = list->chunk_size ? list->chunk_size * 2 : FILELIST_CHUNK_MIN;
+        if (size > FILELIST_CHUNK_MAX) size = FILELIST_CHUNK_MAX;
+
+        list->chunks[list->chunk_count] = malloc(size);
+        if (!list->chunks[list->chunk_count]) abort();
+
+        ++list->chunk_count;
+        list->chunk_size = size;
+        list->chunk_used = 0;
+    }
+
+    const int chunk = list->chunk_count - 1;
+    memcpy(list->chunks[chunk] + list->chunk_used, name, length + 1);
+
+    filelist_entry_t* entry = &list->entries[list->count];
+    entry->offset = list->chunk_used;
+    entry->key = sort_key(name);
+    entry->number = sort_number(name);
+    entry->length = length;
+    entry->chunk = chunk;
+    entry->flags = flags;
+
+    list->chunk_used += length + 1;
+    ++list->count;
+
+    xSemaphoreGive(list->lock);
+
+    if (list->count == list->wanted) xSemaphoreGive(list->found);
+}
+
+static void list_sort(odroid_filelist_t* list)
+{
+    const int count = list->count;
+    if (count < 2) return;
+
+    // Sort a copy of the index so readers are not blocked meanwhile. Nothing
+    // else modifies the list once the directory has been read.
+    filelist_entry_t* sorted = malloc(count * sizeof(filelist_entry_t));
+    if (!sorted) abort();
+
+    xSemaphoreTake(list->lock, portMAX_DELAY);
+    memcpy(sorted, list->entries, count * sizeof(filelist_entry_t));
+    xSemaphoreGive(list->lock);
+
+    // Directories first, each part sorted on its own
+    int directories = 0;
+    for (int i = 0; i < count; ++i)
+    {
+        if (sorted[i].flags & FILELIST_DIRECTORY) swap(&sorted[i], &sorted[directories++]);
+    }
+    intro_sort(list, sorted, directories);
+    intro_sort(list, sorted + directories, count - directories);
+
+    xSemaphoreTake(list->lock, portMAX_DELAY);
+    memcpy(list->entries, sorted, count * sizeof(filelist_entry_t));
+    ++list->generation;
+    xSemaphoreGive(list->lock);
+
+    free(sorted);
+}
+
+static int entry_group(const filelist_entry_t* entry)
+{
+    const int c = entry->key >> 24;
+    const int letter = (c >= 'a' && c <= 'z') ? c - 'a' + 1 : 0;
+    return (entry->flags & FILELIST_DIRECTORY) ? letter + 27 : letter;
+}
+
+// Records where each first letter starts in the sorted list
+static void list_index(odroid_filelist_t* list)
+{
+    int groups[FILELIST_GROUPS];
+    int groupCount = 0;
+
+    // Nothing else modifies the entries once the directory has been read
+    int previous = -1;
+    for (int i = 0; i < list->count && groupCount < FILELIST_GROUPS; ++i)
+    {
+        const int group = entry_group(&list->entries[i]);
+        if (group != previous) groups[groupCount++] = i;
+        previous = group;
+    }
+
+    xSemaphoreTake(list->lock, portMAX_DELAY);
+    memcpy(list->groups, groups, groupCount * sizeof(int));
+    list->group_count = groupCount;
+    xSemaphoreGive(list->lock);
+}
+
+static void scan_task(void* arg)
+{
+    odroid_filelist_t* list = (odroid_filelist_t*)arg;
+
+    DIR *dir = opendir(list->path);
+    if (dir == NULL)
+    {
+        printf("%s: opendir failed.\n", __func__);
+    }
+    else
+    {
+        const char* name;
+        bool directory;
+        while (!list->cancel && (name = scan_next(list, dir, &directory)) != NULL)
+        {
+            list_append(list, name, directory ? FILELIST_DIRECTORY : 0);
+        }
+
+        closedir(dir);
+
+        if (!list->cancel)
+        {
+            list_sort(list);
+            list_index(list);
+        }
+    }
+
+    printf("%s: %d entries, %d dropped.\n", __func__, list->count, list->dropped);
+
+    list->done = true;
+    xSemaphoreGive(list->found);
+    xSemaphoreGive(list->exited);
+
+    vTaskDelete(NULL);
+}
+
+
+odroid_filelist_t* odroid_filelist_scan(const char* path, const char* extension)
+{
+    if (strlen(extension) < 1 || strlen(extension) >= FILELIST_EXTENSION_MAX) abort();
+
+    odroid_filelist_t* list = calloc(1, sizeof(odroid_filelist_t));
+    if (!list) abort();
+
+    list->path = strdup(path);
+    if (!list->path) abort();
+
+    for (int i = 0; extension[i]; ++i)
+    {
+        list->extension[i] = tolower((int)extension[i]);
+    }
+
+    list->lock = xSemaphoreCreateMutex();
+    list->exited = xSemaphoreCreateBinary();
+    list->found = xSemaphoreCreateBinary();
+    if (!list->lock || !list->exited || !list->found) abort();
+
+    list->wanted = -1;
+
+    if (xTaskCreatePinnedToCore(&scan_task, "scan_task", 1024 * 3, list, 4, NULL, 1) != pdPASS) abort();
+
+    return list;
+}
+
+void odroid_filelist_free(odroid_filelist_t* list)
+{
+    list->cancel = true;
+    xSemaphoreTake(list->exited, portMAX_DELAY);
+
+    for (int i = 0; i < list->chunk_count; ++i)
+    {
+        free(list->chunks[i]);
+    }
+
+    free(list->entries);
+    free(list->path);
+
+    vSemaphoreDelete(list->lock);
+    vSemaphoreDelete(list->exited);
+    vSemaphoreDelete(list->found);
+
+    free(list);
+}
+
+int odroid_filelist_count(odroid_filelist_t* list)
+{
+    return list->count;
+}
+
+int odroid_filelist_wait(odroid_filelist_t* list, int count)
+{
+    // A give left from an earlier wait only costs one more pass
+    list->wanted = count;
+    while (list->count < count && !list->done)
+    {
+        xSemaphoreTake(list->found, portMAX_DELAY);
+    }
+    list->wanted = -1;
+
+    return list->count;
+}
+
+int odroid_filelist_dropped(odroid_filelist_t* list)
+{
+    return list->dropped;
+}
+
+bool odroid_filelist_done(odroid_filelist_t* list)
+{
+    return list->done;
+}
+
+uint32_t odroid_filelist_generation(odroid_filelist_t* list)
+{
+    return list->generation;
+}
+
+const char* odroid_filelist_name(odroid_filelist_t* list, int index)
+{
+    const char* result = NULL;
+
+    xSemaphoreTake(list->lock, portMAX_DELAY);
+    if (index >= 0 && index < list->count)
+    {
+        result = entry_name(list, &list->entries[index]);
+    }
+    xSemaphoreGive(list->lock);
+
+    return result;
+}
+
+int odroid_filelist_next_group(odroid_filelist_t* list, int index)
+{
+    int result = index;
+
+    xSemaphoreTake(list->lock, portMAX_DELAY);
+    if (list->group_count > 0)
+    {
+        result = list->groups[0];
+        for (int i = 0; i < list->group_count; ++i)
+        {
+            if (list->groups[i] > index)
+            {
+                result = list->groups[i];
+                break;
+            }
+        }
+    }
+    xSemaphoreGive(list->lock);
+
+    return result;
+}
+
+int odroid_filelist_previous_group(odroid_filelist_t* list, int index)
+{
+    int result = index;
+
+    xSemaphoreTake(list->lock, portMAX_DELAY);
+    if (list->group_count > 0)
+    {
+        result = list->groups[list->group_count - 1];
+        for (int i = list->group_count - 1; i >= 0; --i)
+        {
+            if (list->groups[i] < index)
+            {
+                result = list->groups[i];
+                break;
+            }
+        }
+    }
+    xSemaphoreGive(list->lock);
+
+    return result;
+}
+
+bool odroid_filelist_is_directory(odroid_filelist_t* list, int index)
+{
+    bool result = false;
+
+    xSemaphoreTake(list->lock, portMAX_DELAY);
+    if (index >= 0 && index < list->count)
+    {
+        result = (list->entries[index].flags & FILELIST_DIRECTORY) != 0;
+    }
+    xSemaphoreGive(list->lock);
+
+    return result;
+}
+
+int odroid_filelist_find(odroid_filelist_t* list, const char* name)
+{
+    int result = -1;
+
+    const size_t length = strlen(name);
+
+    xSemaphoreTake(list->lock, portMAX_DELAY);
+    for (int i = 0; i < list->count; ++i)
+    {
+        if (list->entries[i].length == length && strcmp(entry_name(list, &list->entries[i]), name) == 0)
+        {
+            result = i;
+            break;
+        }
+    }
+    xSemaphoreGive(list->lock);
+
+    return result;
+}
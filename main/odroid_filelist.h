@@ -0,0 +1,37 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Directory listing that is filled by a background task. Entries can be
+// read while the scan is running; they are in directory order until the
+// scan is done, then the list is sorted once (generation changes).
+// Names are packed into a few large blocks rather than one per file.
+// Subdirectories are listed (sorted before the files) but not read.
+typedef struct odroid_filelist odroid_filelist_t;
+
+odroid_filelist_t* odroid_filelist_scan(const char* path, const char* extension);
+void odroid_filelist_free(odroid_filelist_t* list);
+
+// Number of entries found so far
+int odroid_filelist_count(odroid_filelist_t* list);
+// Blocks until at least 'count' entries are known or the scan is done
+int odroid_filelist_wait(odroid_filelist_t* list, int count);
+// Entries left out: names longer than 255 characters, or past the 32 name
+// blocks (about 490 KB of names)
+int odroid_filelist_dropped(odroid_filelist_t* list);
+// True when scanning and sorting have finished
+bool odroid_filelist_done(odroid_filelist_t* list);
+// Incremented whenever the order of existing entries changes
+uint32_t odroid_filelist_generation(odroid_filelist_t* list);
+
+// Names stay valid until odroid_filelist_free
+const char* odroid_filelist_name(odroid_filelist_t* list, int index);
+bool odroid_filelist_is_directory(odroid_filelist_t* list, int index);
+
+// Start of the next / previous group of names with the same first letter
+// (digits and symbols form one group), wrapping around. Returns index until
+// the list is sorted.
+int odroid_filelist_next_group(odroid_filelist_t* list, int index);
+int odroid_filelist_previous_group(odroid_filelist_t* list, int index);
+int odroid_filelist_find(odroid_filelist_t* list, const char* name);
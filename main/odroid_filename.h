@@ -0,0 +1,89 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+// Which names a firmware listing shows and in which order. Shared by the
+// file list and tools/mkatlas, which builds the .atlas in the same order on
+// the host. ASCII only, as the names on the card: no locale tables.
+
+static inline bool odroid_filename_is_digit(char c)
+{
+    return (unsigned)(c - '0') < 10;
+}
+
+static inline int odroid_filename_fold(char c)
+{
+    return (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : (uint8_t)c;
+}
+
+// Case insensitive, runs of digits compare by value: "game2" < "game10"
+static inline int odroid_filename_compare(const char* a, const char* b)
+{
+    while (1)
+    {
+        const char ca = *a;
+        const char cb = *b;
+
+        if (odroid_filename_is_digit(ca) && odroid_filename_is_digit(cb))
+        {
+            while (*a == '0') ++a;
+            while (*b == '0') ++b;
+
+            // Longer number (without leading zeros) is larger, else the
+            // first different digit decides
+            int d = 0;
+            while (1)
+            {
+                const bool digitA = odroid_filename_is_digit(*a);
+                const bool digitB = odroid_filename_is_digit(*b);
+                if (!digitA || !digitB)
+                {
+                    if (digitA != digitB) return digitA ? 1 : -1;
+                    break;
+                }
+
+                if (!d) d = *a - *b;
+                ++a;
+                ++b;
+            }
+            if (d) return d;
+
+            continue;
+        }
+
+        if (ca != cb)
+        {
+            const int d = odroid_filename_fold(ca) - odroid_filename_fold(cb);
+            if (d) return d;
+        }
+        else if (!ca)
+        {
+            return 0;
+        }
+
+        ++a;
+        ++b;
+    }
+}
+
+// Not listed at all, files or directories: "._*" are macOS metadata
+static inline bool odroid_filename_hidden(const char* name)
+{
+    return name[0] == '.';
+}
+
+// The extension is given in lower case, with the dot
+static inline bool odroid_filename_matches(const char* name, const char* extension)
+{
+    const size_t length = strlen(name);
+    const size_t extensionLength = strlen(extension);
+    if (length <= extensionLength) return false;
+
+    for (size_t i = 0; i < extensionLength; ++i)
+    {
+        if (odroid_filename_fold(name[length - extensionLength + i]) != extension[i]) return false;
+    }
+    return true;
+}
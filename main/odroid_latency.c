@@ -0,0 +1,84 @@
+#include "odroid_latency.h"
+
+#include "esp_timer.h"
+
+#include <stdio.h>
+#include <string.h>
+
+
+static odroid_latency_histogram_t histogram;
+static int64_t pending;     // input being answered, 0 = none
+
+
+void odroid_latency_begin(int64_t input_time)
+{
+    if (!pending || input_time < pending) pending = input_time;
+}
+
+void odroid_latency_cancel()
+{
+    pending = 0;
+}
+
+void odroid_latency_present()
+{
+    if (!pending) return;
+
+    const int64_t latency = esp_timer_get_time() - pending;
+    pending = 0;
+    if (latency < 0) return;
+
+    int bucket = latency / ODROID_LATENCY_BUCKET_US;
+    if (bucket >= ODROID_LATENCY_BUCKETS) bucket = ODROID_LATENCY_BUCKETS - 1;
+
+    ++histogram.buckets[bucket];
+    ++histogram.count;
+    if (latency > histogram.max_us) histogram.max_us = latency;
+}
+
+void odroid_latency_get(odroid_latency_histogram_t* out)
+{
+    *out = histogram;
+}
+
+void odroid_latency_reset()
+{
+    memset(&histogram, 0, sizeof(histogram));
+    pending = 0;
+}
+
+uint32_t odroid_latency_percentile(const odroid_latency_histogram_t* histogram, int percent)
+{
+    if (!histogram->count) return 0;
+
+    // Rank of the sample, rounded up
+    const uint32_t rank = ((uint64_t)histogram->count * percent + 99) / 100;
+
+    uint32_t seen = 0;
+    for (int i = 0; i < ODROID_LATENCY_BUCKETS; ++i)
+    {
+        seen += histogram->buckets[i];
+        if (seen >= rank && seen > 0)
+        {
+            const uint32_t end = (i + 1) * ODROID_LATENCY_BUCKET_US;
+            return end < histogram->max_us ? end : histogram->max_us;
+        }
+    }
+
+    return histogram->max_us;
+}
+
+void odroid_latency_dump()
+{
+    printf("latency count=%u p50_us=%u p95_us=%u max_us=%u\n", (unsigned)histogram.count,
+        (unsigned)odroid_latency_percentile(&histogram, 50), (unsigned)odroid_latency_percentile(&histogram, 95),
+        (unsigned)histogram.max_us);
+
+    for (int i = 0; i < ODROID_LATENCY_BUCKETS; ++i)
+    {
+        if (histogram.buckets[i])
+        {
+            printf("latency_bucket ms=%d count=%u\n", i * ODROID_LATENCY_BUCKET_US / 1000, (unsigned)histogram.buckets[i]);
+        }
+    }
+}
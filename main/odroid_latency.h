@@ -0,0 +1,37 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Input to photon latency: from the first edge of a button press
+// (esp_timer_get_time, as stamped by input.c) to the end of the LCD transfer
+// that shows what the press did. The menu marks the input it is answering,
+// the display reports each finished transfer. Called only from the task that
+// draws.
+#define ODROID_LATENCY_BUCKET_US (1000)
+#define ODROID_LATENCY_BUCKETS (128)    // the last one also counts longer ones
+
+typedef struct
+{
+    uint32_t count;
+    uint32_t max_us;
+    uint32_t buckets[ODROID_LATENCY_BUCKETS];
+} odroid_latency_histogram_t;
+
+// An input whose result is being drawn. Until the next transfer the earliest
+// one counts, so a burst of inputs drawn once is measured from its start.
+void odroid_latency_begin(int64_t input_time);
+// The inputs since begin changed nothing on screen
+void odroid_latency_cancel();
+// End of a transfer to the LCD
+void odroid_latency_present();
+
+void odroid_latency_get(odroid_latency_histogram_t* out);
+void odroid_latency_reset();
+// Upper end of the bucket that holds the given percentile, in us
+uint32_t odroid_latency_percentile(const odroid_latency_histogram_t* histogram, int percent);
+// To the serial console:
+//   latency count=<n> p50_us=<n> p95_us=<n> max_us=<n>
+//   latency_bucket ms=<n> count=<n>     (one line per bucket in use)
+void odroid_latency_dump();
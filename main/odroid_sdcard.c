@@ -1,4 +1,5 @@
 #include "odroid_sdcard.h"
+#include "odroid_spibus.h"
 
 //#include "esp_err.h"
 #include "esp_log.h"
@@ -6,13 +7,21 @@
 // #include "driver/sdmmc_host.h"
 // #include "driver/SDMMC_host.h"
 #include "sdmmc_cmd.h"
+#include "diskio_impl.h"
+#include "diskio_sdmmc.h"
+#include "ff.h"
 #include "esp_heap_caps.h"
 #include "esp_spiffs.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
 
 #include <dirent.h>
 #include <string.h>
 #include <unistd.h>
 #include <ctype.h>
+#include <fcntl.h>
+#include <sys/stat.h>
 
 
 
@@ -25,155 +34,773 @@ static const char *TAG = "odroid-go";
 
 static bool isOpen = false;
 
+#ifdef __XTENSA__
+#define SDCARD_MEMW() __asm__("memw")
+#else
+#define SDCARD_MEMW()
+#endif
+
 
+// Sector cache, installed as the disk driver of the mounted volume in place
+// of the plain SD one. FATFS serializes the calls for a volume, the lock is
+// for resizing and the counters.
+#define SDCARD_SECTOR_SIZE (512)
+#define SDCARD_CACHE_RUN_MAX (8)        // sectors read from the card per miss
+#define SDCARD_CACHE_READAHEAD (4)
+#define SDCARD_CACHE_BYPASS (8)         // reads this long are file data
 
-inline static void swap(char** a, char** b)
+typedef struct
 {
-    char* t = *a;
-    *a = *b;
-    *b = t;
+    uint32_t sector;
+    uint32_t used;      // LRU stamp, 0 = unused
+    bool ahead;         // read ahead, not requested yet
+} cache_slot_t;
+
+static SemaphoreHandle_t cache_lock;
+static sdmmc_card_t* cache_card;
+static cache_slot_t* cache_slots;
+static uint8_t* cache_data;
+static uint8_t* cache_run;
+static size_t cache_count;
+static size_t cache_size = ODROID_SDCARD_CACHE_SECTORS;
+static uint32_t cache_clock;
+static uint32_t cache_next;     // sector after the last miss
+static odroid_sdcard_cache_stats_t cache_stats;
+
+
+static int cache_find(uint32_t sector)
+{
+    for (int i = 0; i < cache_count; ++i)
+    {
+        if (cache_slots[i].used && cache_slots[i].sector == sector) return i;
+    }
+    return -1;
 }
 
-static int strcicmp(char const *a, char const *b)
+static void cache_store(uint32_t sector, const uint8_t* data, bool ahead)
 {
-    for (;; a++, b++)
+    int slot = cache_find(sector);
+    if (slot < 0)
     {
-        int d = tolower((int)*a) - tolower((int)*b);
-        if (d != 0 || !*a) return d;
+        // Unused slots have the lowest stamp
+        slot = 0;
+        for (int i = 1; i < cache_count && cache_slots[slot].used; ++i)
+        {
+            if (cache_slots[i].used < cache_slots[slot].used) slot = i;
+        }
     }
+
+    cache_slots[slot].sector = sector;
+    cache_slots[slot].used = ++cache_clock;
+    cache_slots[slot].ahead = ahead;
+    memcpy(cache_data + slot * SDCARD_SECTOR_SIZE, data, SDCARD_SECTOR_SIZE);
 }
 
-static int partition (char* arr[], int low, int high)
+// Every card access holds the shared bus, one burst at a time, so the LCD
+// can draw in between even while a long file is read
+static DRESULT cache_card_read(BYTE* buff, DWORD sector, UINT count)
 {
-    char* pivot = arr[high];
-    int i = (low - 1);
+    DRESULT result = RES_OK;
+    while (count > 0 && result == RES_OK)
+    {
+        UINT run = odroid_spibus_burst(ODROID_SPIBUS_SD) / SDCARD_SECTOR_SIZE;
+        if (run > count) run = count;
 
-    for (int j = low; j <= high- 1; j++)
+        odroid_spibus_acquire(ODROID_SPIBUS_SD);
+        result = (sdmmc_read_sectors(cache_card, buff, sector, run) == ESP_OK) ? RES_OK : RES_ERROR;
+        odroid_spibus_release(ODROID_SPIBUS_SD);
+
+        buff += run * SDCARD_SECTOR_SIZE;
+        sector += run;
+        count -= run;
+    }
+    return result;
+}
+
+static DRESULT cache_card_write(const BYTE* buff, DWORD sector, UINT count)
+{
+    DRESULT result = RES_OK;
+    while (count > 0 && result == RES_OK)
     {
-        if (strcicmp(arr[j], pivot) < 0)
+        UINT run = odroid_spibus_burst(ODROID_SPIBUS_SD) / SDCARD_SECTOR_SIZE;
+        if (run > count) run = count;
+
+        odroid_spibus_acquire(ODROID_SPIBUS_SD);
+        result = (sdmmc_write_sectors(cache_card, buff, sector, run) == ESP_OK) ? RES_OK : RES_ERROR;
+        odroid_spibus_release(ODROID_SPIBUS_SD);
+
+        buff += run * SDCARD_SECTOR_SIZE;
+        sector += run;
+        count -= run;
+    }
+    return result;
+}
+
+static DSTATUS cache_disk_initialize(BYTE pdrv)
+{
+    return 0;
+}
+
+static DSTATUS cache_disk_status(BYTE pdrv)
+{
+    return 0;
+}
+
+static DRESULT cache_disk_read(BYTE pdrv, BYTE* buff, DWORD sector, UINT count)
+{
+    xSemaphoreTake(cache_lock, portMAX_DELAY);
+
+    if (cache_count == 0 || count >= SDCARD_CACHE_BYPASS)
+    {
+        ++cache_stats.bypassed;
+        DRESULT result = cache_card_read(buff, sector, count);
+
+        xSemaphoreGive(cache_lock);
+        return result;
+    }
+
+    DRESULT result = RES_OK;
+    for (UINT i = 0; i < count && result == RES_OK; )
+    {
+        const int slot = cache_find(sector + i);
+        if (slot >= 0)
+        {
+            ++cache_stats.hits;
+            if (cache_slots[slot].ahead)
+            {
+                ++cache_stats.readahead_hits;
+                cache_slots[slot].ahead = false;
+            }
+
+            cache_slots[slot].used = ++cache_clock;
+            memcpy(buff + i * SDCARD_SECTOR_SIZE, cache_data + slot * SDCARD_SECTOR_SIZE, SDCARD_SECTOR_SIZE);
+            ++i;
+            continue;
+        }
+
+        // The missing run, one card read
+        UINT run = 1;
+        while (i + run < count && run < SDCARD_CACHE_RUN_MAX && cache_find(sector + i + run) < 0) ++run;
+
+        // Continues the last miss: likely to go on
+        UINT ahead = 0;
+        if (i + run == count && sector + i == cache_next)
+        {
+            ahead = SDCARD_CACHE_READAHEAD;
+            if (run + ahead > SDCARD_CACHE_RUN_MAX) ahead = SDCARD_CACHE_RUN_MAX - run;
+            if (sector + i + run + ahead > cache_card->csd.capacity) ahead = cache_card->csd.capacity - (sector + i + run);
+        }
+
+        result = cache_card_read(cache_run, sector + i, run + ahead);
+        if (result == RES_OK)
         {
-            i++;
-            swap(&arr[i], &arr[j]);
+            for (UINT j = 0; j < run + ahead; ++j)
+            {
+                cache_store(sector + i + j, cache_run + j * SDCARD_SECTOR_SIZE, j >= run);
+            }
+            memcpy(buff + i * SDCARD_SECTOR_SIZE, cache_run, run * SDCARD_SECTOR_SIZE);
+
+            cache_stats.misses += run;
+            cache_stats.readahead += ahead;
+            cache_next = sector + i + run + ahead;
         }
+
+        i += run;
     }
-    swap(&arr[i + 1], &arr[high]);
-    return (i + 1);
+
+    xSemaphoreGive(cache_lock);
+    return result;
 }
 
-static void quick_sort(char* arr[], int low, int high)
+static DRESULT cache_disk_write(BYTE pdrv, const BYTE* buff, DWORD sector, UINT count)
 {
-    if (low < high)
+    xSemaphoreTake(cache_lock, portMAX_DELAY);
+
+    // Write through, cached copies are updated
+    DRESULT result = cache_card_write(buff, sector, count);
+    for (UINT i = 0; i < count; ++i)
     {
-        int pi = partition(arr, low, high);
+        const int slot = cache_find(sector + i);
+        if (slot < 0) continue;
 
-        quick_sort(arr, low, pi - 1);
-        quick_sort(arr, pi + 1, high);
+        if (result == RES_OK)
+            memcpy(cache_data + slot * SDCARD_SECTOR_SIZE, buff + i * SDCARD_SECTOR_SIZE, SDCARD_SECTOR_SIZE);
+        else
+            cache_slots[slot].used = 0;
     }
+
+    xSemaphoreGive(cache_lock);
+    return result;
 }
 
-static void sort_files(char** files, int count)
+static DRESULT cache_disk_ioctl(BYTE pdrv, BYTE cmd, void* buff)
 {
-    int n = count;
-    bool swapped = true;
-
-    if (count > 1)
+    switch (cmd)
     {
-        quick_sort(files, 0, count - 1);
+        case CTRL_SYNC:
+            return RES_OK;
+
+        case GET_SECTOR_COUNT:
+            *((DWORD*)buff) = cache_card->csd.capacity;
+            return RES_OK;
+
+        case GET_SECTOR_SIZE:
+            *((WORD*)buff) = cache_card->csd.sector_size;
+            return RES_OK;
+
+        default:
+            return RES_ERROR;
     }
 }
 
+static void cache_free()
+{
+    free(cache_slots);
+    heap_caps_free(cache_data);
+    heap_caps_free(cache_run);
+
+    cache_slots = NULL;
+    cache_data = NULL;
+    cache_run = NULL;
+    cache_count = 0;
+}
+
+static void cache_alloc()
+{
+    if (cache_size == 0) return;
 
+    cache_slots = calloc(cache_size, sizeof(cache_slot_t));
+    cache_data = heap_caps_malloc(cache_size * SDCARD_SECTOR_SIZE, MALLOC_CAP_DMA);
+    cache_run = heap_caps_malloc(SDCARD_CACHE_RUN_MAX * SDCARD_SECTOR_SIZE, MALLOC_CAP_DMA);
 
-int odroid_sdcard_files_get(const char* path, const char* extension, char*** filesOut)
+    if (!cache_slots || !cache_data || !cache_run)
+    {
+        // Works without, only slower
+        printf("odroid_sdcard: cache allocation failed.\n");
+        cache_free();
+        return;
+    }
+
+    cache_count = cache_size;
+}
+
+static void cache_install(sdmmc_card_t* card)
 {
-    const int MAX_FILES = 1024;
-    const uint32_t MALLOC_CAPS = MALLOC_CAP_DEFAULT; //MALLOC_CAP_SPIRAM
+    static const ff_diskio_impl_t impl = {
+        .init = &cache_disk_initialize,
+        .status = &cache_disk_status,
+        .read = &cache_disk_read,
+        .write = &cache_disk_write,
+        .ioctl = &cache_disk_ioctl,
+    };
 
+    if (!cache_lock)
+    {
+        cache_lock = xSemaphoreCreateMutex();
+        if (!cache_lock) abort();
+    }
 
-    int count = 0;
-    char** result = (char**)malloc(MAX_FILES * sizeof(void*));
-    if (!result) abort();
+    if (card->csd.sector_size != SDCARD_SECTOR_SIZE) return;
+
+    cache_card = card;
+    cache_alloc();
+
+    ff_diskio_register(ff_diskio_get_pdrv_card(card), &impl);
+}
+
+void odroid_sdcard_cache_resize(size_t sectors)
+{
+    if (!cache_lock)
+    {
+        // Not mounted yet
+        cache_size = sectors;
+        return;
+    }
 
+    xSemaphoreTake(cache_lock, portMAX_DELAY);
+    cache_free();
+    cache_size = sectors;
+    if (cache_card) cache_alloc();
+    xSemaphoreGive(cache_lock);
+}
 
-    DIR *dir = opendir(path);
-    if( dir == NULL )
+void odroid_sdcard_cache_stats(odroid_sdcard_cache_stats_t* out)
+{
+    if (!cache_lock)
     {
-        printf("opendir failed.\n");
-        //abort();
-        return 0;
+        memset(out, 0, sizeof(*out));
+        return;
     }
 
-    int extensionLength = strlen(extension);
-    if (extensionLength < 1) abort();
+    xSemaphoreTake(cache_lock, portMAX_DELAY);
+    *out = cache_stats;
+    xSemaphoreGive(cache_lock);
+}
+
 
+// Read-only handles kept open for reuse and cached stat results. Files are
+// not expected to change while the card is mounted, except by this code.
+#define SDCARD_STAT_SLOTS (256)     // direct mapped by path hash
 
-    char* temp = (char*)malloc(extensionLength + 1);
-    if (!temp) abort();
+typedef struct
+{
+    FILE* file;     // NULL = unused
+    char* path;
+    uint32_t used;  // LRU stamp
+    bool busy;
+} handle_slot_t;
+
+typedef struct
+{
+    uint32_t hash;
+    char* path;         // NULL = unused
+    uint32_t size;
+    uint32_t mtime;
+    uint32_t mode;
+} stat_slot_t;
 
-    memset(temp, 0, extensionLength + 1);
+static SemaphoreHandle_t handle_lock;
+static handle_slot_t handle_slots[ODROID_SDCARD_HANDLES];
+static uint32_t handle_clock;
+static stat_slot_t* stat_slots;
+static odroid_sdcard_handle_stats_t handle_stats;
 
 
-    struct dirent *entry;
-    while((entry=readdir(dir)) != NULL)
+static void handles_init()
+{
+    if (handle_lock) return;
+
+    handle_lock = xSemaphoreCreateMutex();
+    if (!handle_lock) abort();
+
+    // Works without, only slower
+    stat_slots = calloc(SDCARD_STAT_SLOTS, sizeof(stat_slot_t));
+}
+
+// FNV-1a
+static uint32_t path_hash(const char* path)
+{
+    uint32_t hash = 2166136261u;
+    for (; *path; ++path)
     {
-        size_t len = strlen(entry->d_name);
+        hash ^= (uint8_t)*path;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+FILE* odroid_sdcard_acquire(const char* path)
+{
+    if (!handle_lock) return fopen(path, "rb");
+
+    xSemaphoreTake(handle_lock, portMAX_DELAY);
+
+    handle_slot_t* slot = NULL;
+    for (int i = 0; i < ODROID_SDCARD_HANDLES; ++i)
+    {
+        handle_slot_t* candidate = &handle_slots[i];
+        if (candidate->file && !candidate->busy && strcmp(candidate->path, path) == 0)
+        {
+            slot = candidate;
+            break;
+        }
+    }
+
+    if (slot)
+    {
+        ++handle_stats.handle_hits;
+        rewind(slot->file);
+    }
+    else
+    {
+        ++handle_stats.handle_opens;
+
+        FILE* file = fopen(path, "rb");
+        if (!file)
+        {
+            xSemaphoreGive(handle_lock);
+            return NULL;
+        }
+
+        // Close the least recently used idle handle to make room
+        for (int i = 0; i < ODROID_SDCARD_HANDLES; ++i)
+        {
+            handle_slot_t* candidate = &handle_slots[i];
+            if (candidate->busy) continue;
+            if (!slot || !candidate->file || (slot->file && candidate->used < slot->used)) slot = candidate;
+        }
+
+        if (!slot)
+        {
+            // All in use: this one is closed on release
+            xSemaphoreGive(handle_lock);
+            return file;
+        }
+
+        if (slot->file)
+        {
+            fclose(slot->file);
+            free(slot->path);
+        }
+
+        slot->file = file;
+        slot->path = strdup(path);
+        if (!slot->path) abort();
+    }
 
+    slot->busy = true;
+    slot->used = ++handle_clock;
+    FILE* result = slot->file;
 
-        // ignore 'hidden' files (MAC)
-        bool skip = false;
-        if (entry->d_name[0] == '.') skip = true;
+    xSemaphoreGive(handle_lock);
+    return result;
+}
 
+void odroid_sdcard_release(FILE* file)
+{
+    if (!file) return;
 
-        memset(temp, 0, extensionLength + 1);
-        if (!skip)
+    if (handle_lock)
+    {
+        xSemaphoreTake(handle_lock, portMAX_DELAY);
+        for (int i = 0; i < ODROID_SDCARD_HANDLES; ++i)
         {
-            for (int i = 0; i < extensionLength; ++i)
+            if (handle_slots[i].file == file)
             {
-                temp[i] = tolower((int)entry->d_name[len - extensionLength + i]);
+                handle_slots[i].busy = false;
+                xSemaphoreGive(handle_lock);
+                return;
             }
+        }
+        xSemaphoreGive(handle_lock);
+    }
+
+    fclose(file);
+}
+
+bool odroid_sdcard_stat(const char* path, struct stat* out)
+{
+    if (!handle_lock || !stat_slots) return stat(path, out) == 0;
+
+    const uint32_t hash = path_hash(path);
+
+    xSemaphoreTake(handle_lock, portMAX_DELAY);
+
+    stat_slot_t* slot = &stat_slots[hash % SDCARD_STAT_SLOTS];
+    if (slot->path && slot->hash == hash && strcmp(slot->path, path) == 0)
+    {
+        ++handle_stats.stat_hits;
+
+        memset(out, 0, sizeof(*out));
+        out->st_size = slot->size;
+        out->st_mtime = slot->mtime;
+        out->st_mode = slot->mode;
+
+        xSemaphoreGive(handle_lock);
+        return true;
+    }
+
+    xSemaphoreGive(handle_lock);
+
+    // Missing files are not cached, they may be created
+    if (stat(path, out) != 0) return false;
+
+    char* copy = strdup(path);
+
+    xSemaphoreTake(handle_lock, portMAX_DELAY);
+    ++handle_stats.stat_lookups;
+    if (copy)
+    {
+        free(slot->path);
+        slot->hash = hash;
+        slot->path = copy;
+        slot->size = out->st_size;
+        slot->mtime = out->st_mtime;
+        slot->mode = out->st_mode;
+    }
+    xSemaphoreGive(handle_lock);
+
+    return true;
+}
+
+void odroid_sdcard_flush_handles()
+{
+    if (!handle_lock) return;
+
+    xSemaphoreTake(handle_lock, portMAX_DELAY);
+
+    for (int i = 0; i < ODROID_SDCARD_HANDLES; ++i)
+    {
+        handle_slot_t* slot = &handle_slots[i];
+        if (!slot->file || slot->busy) continue;
+
+        fclose(slot->file);
+        free(slot->path);
+        slot->file = NULL;
+        slot->path = NULL;
+    }
 
-            if (len > extensionLength)
+    for (int i = 0; stat_slots && i < SDCARD_STAT_SLOTS; ++i)
+    {
+        free(stat_slots[i].path);
+        stat_slots[i].path = NULL;
+    }
+
+    xSemaphoreGive(handle_lock);
+}
+
+void odroid_sdcard_handle_stats(odroid_sdcard_handle_stats_t* out)
+{
+    if (!handle_lock)
+    {
+        memset(out, 0, sizeof(*out));
+        return;
+    }
+
+    xSemaphoreTake(handle_lock, portMAX_DELAY);
+    *out = handle_stats;
+    xSemaphoreGive(handle_lock);
+}
+
+
+// Batched reads. FATFS resolves each request to its clusters; the card reads
+// go through the sector cache driver, so short runs stay cached for the
+// file system reads that may follow.
+typedef struct
+{
+    uint32_t sector;
+    uint16_t sectors;
+    uint16_t skip;      // bytes into the first sector
+    uint32_t index;     // request
+} batch_span_t;
+
+static char* batch_base;        // mount point
+static char batch_drive[3];     // its FATFS drive, "0:"
+static odroid_sdcard_batch_stats_t batch_stats;
+
+
+static int batch_span_compare(const void* a, const void* b)
+{
+    const batch_span_t* x = (const batch_span_t*)a;
+    const batch_span_t* y = (const batch_span_t*)b;
+    if (x->sector != y->sector) return (x->sector > y->sector) - (x->sector < y->sector);
+    return (x->index > y->index) - (x->index < y->index);
+}
+
+// FATFS path of a file on the mounted volume, NULL for other files
+static char* batch_fatfs_path(const char* path)
+{
+    if (!batch_base) return NULL;
+
+    const size_t length = strlen(batch_base);
+    if (strncmp(path, batch_base, length) != 0 || path[length] != '/') return NULL;
+
+    char* result = malloc(strlen(batch_drive) + strlen(path + length) + 1);
+    if (!result) abort();
+
+    strcpy(result, batch_drive);
+    strcat(result, path + length);
+    return result;
+}
+
+// Finds the first sector of the request's data, if the data is one
+// contiguous run on the card
+static bool batch_resolve(FIL* fil, uint32_t offset, uint32_t length, uint32_t* sector)
+{
+    FATFS* fs = fil->obj.fs;
+    const uint32_t clusterSize = fs->csize * SDCARD_SECTOR_SIZE;
+    const uint32_t first = offset / clusterSize;
+    const uint32_t last = (offset + length - 1) / clusterSize;
+
+    DWORD start = 0;
+    for (uint32_t i = first; i <= last; ++i)
+    {
+        // f_lseek leaves clust at the cluster of the byte before the position
+        const uint32_t position = (i == first ? offset : i * clusterSize) + 1;
+        if (f_lseek(fil, position) != FR_OK || fil->clust < 2) return false;
+
+        if (i == first)
+            start = fil->clust;
+        else if (fil->clust != start + (i - first))
+            return false;
+    }
+
+    *sector = fs->database + (start - 2) * fs->csize + (offset % clusterSize) / SDCARD_SECTOR_SIZE;
+    return true;
+}
+
+static void batch_read_file(odroid_sdcard_read_t* request, FIL* fil)
+{
+    char* fatPath = batch_fatfs_path(request->path);
+    if (fatPath)
+    {
+        UINT count = 0;
+        if (f_open(fil, fatPath, FA_READ) == FR_OK)
+        {
+            request->ok = f_lseek(fil, request->offset) == FR_OK &&
+                f_read(fil, request->buffer, request->length, &count) == FR_OK;
+            f_close(fil);
+        }
+        request->count = count;
+        free(fatPath);
+        return;
+    }
+
+    FILE* file = fopen(request->path, "rb");
+    if (!file) return;
+
+    if (fseek(file, request->offset, SEEK_SET) == 0)
+    {
+        request->count = fread(request->buffer, 1, request->length, file);
+        request->ok = !ferror(file);
+    }
+    fclose(file);
+}
+
+size_t odroid_sdcard_read_batch(odroid_sdcard_read_t* requests, size_t count, odroid_sdcard_read_func done, void* arg)
+{
+    batch_span_t* spans = malloc((count ? count : 1) * sizeof(batch_span_t));
+    uint32_t* fallbacks = malloc((count ? count : 1) * sizeof(uint32_t));
+    FIL* fil = malloc(sizeof(FIL));
+    uint8_t* run = heap_caps_malloc(ODROID_SDCARD_BATCH_RUN * SDCARD_SECTOR_SIZE, MALLOC_CAP_DMA);
+    if (!spans || !fallbacks || !fil || !run) abort();
+
+    size_t spanCount = 0;
+    size_t fallbackCount = 0;
+    size_t result = 0;
+    odroid_sdcard_batch_stats_t stats = { .requests = count };
+
+    // Where the data is: no card data is read yet, only the FAT
+    for (size_t i = 0; i < count; ++i)
+    {
+        odroid_sdcard_read_t* request = &requests[i];
+        request->count = 0;
+        request->ok = false;
+
+        char* fatPath = cache_card ? batch_fatfs_path(request->path) : NULL;
+        if (!fatPath || f_open(fil, fatPath, FA_READ) != FR_OK)
+        {
+            fallbacks[fallbackCount++] = i;
+            free(fatPath);
+            continue;
+        }
+        free(fatPath);
+
+        const uint32_t size = f_size(fil);
+        uint32_t length = request->length;
+        if (request->offset >= size) length = 0;
+        else if (length > size - request->offset) length = size - request->offset;
+
+        batch_span_t* span = &spans[spanCount];
+        span->skip = request->offset % SDCARD_SECTOR_SIZE;
+        span->sectors = (span->skip + length + SDCARD_SECTOR_SIZE - 1) / SDCARD_SECTOR_SIZE;
+        span->index = i;
+
+        if (length == 0)
+        {
+            // Nothing to read at or after the end of the file
+            request->ok = request->offset <= size;
+            if (request->ok) ++result;
+            if (done) done(request, arg);
+        }
+        else if (span->sectors <= ODROID_SDCARD_BATCH_RUN && batch_resolve(fil, request->offset, length, &span->sector))
+        {
+            request->count = length;
+            ++spanCount;
+        }
+        else
+        {
+            fallbacks[fallbackCount++] = i;
+        }
+
+        f_close(fil);
+    }
+
+    qsort(spans, spanCount, sizeof(batch_span_t), batch_span_compare);
+
+    // In card order, one read per run of spans that touch
+    for (size_t i = 0; i < spanCount; )
+    {
+        const uint32_t first = spans[i].sector;
+        uint32_t end = first + spans[i].sectors;
+
+        size_t next = i + 1;
+        for (; next < spanCount && spans[next].sector <= end; ++next)
+        {
+            const uint32_t spanEnd = spans[next].sector + spans[next].sectors;
+            if (spanEnd > end)
             {
-                if (strcmp(temp, extension) == 0)
-                {
-                    result[count] = (char*)malloc(len + 1);
-                    //printf("%s: allocated %p\n", __func__, result[count]);
+                if (spanEnd - first > ODROID_SDCARD_BATCH_RUN) break;
+                end = spanEnd;
+            }
+        }
 
-                    if (!result[count])
-                    {
-                        abort();
-                    }
+        SDCARD_MEMW();
+        const bool ok = cache_disk_read(0, run, first, end - first) == RES_OK;
+        SDCARD_MEMW();
 
-                    strcpy(result[count], entry->d_name);
-                    ++count;
+        ++stats.card_reads;
+        stats.sectors += end - first;
 
-                    if (count >= MAX_FILES) break;
-                }
+        for (; i < next; ++i)
+        {
+            odroid_sdcard_read_t* request = &requests[spans[i].index];
+            if (ok)
+            {
+                memcpy(request->buffer, run + (spans[i].sector - first) * SDCARD_SECTOR_SIZE + spans[i].skip, request->count);
+                request->ok = true;
+                ++result;
             }
+            else
+            {
+                request->count = 0;
+            }
+
+            if (done) done(request, arg);
         }
     }
 
-    closedir(dir);
-    free(temp);
+    stats.fallbacks = fallbackCount;
+    for (size_t i = 0; i < fallbackCount; ++i)
+    {
+        odroid_sdcard_read_t* request = &requests[fallbacks[i]];
+        batch_read_file(request, fil);
+        if (request->ok) ++result;
+        if (done) done(request, arg);
+    }
+
+    if (cache_lock)
+    {
+        xSemaphoreTake(cache_lock, portMAX_DELAY);
+        batch_stats.requests += stats.requests;
+        batch_stats.card_reads += stats.card_reads;
+        batch_stats.sectors += stats.sectors;
+        batch_stats.fallbacks += stats.fallbacks;
+        xSemaphoreGive(cache_lock);
+    }
 
-    sort_files(result, count);
+    heap_caps_free(run);
+    free(fil);
+    free(fallbacks);
+    free(spans);
 
-    *filesOut = result;
-    return count;
+    return result;
 }
 
-void odroid_sdcard_files_free(char** files, int count)
+void odroid_sdcard_batch_stats(odroid_sdcard_batch_stats_t* out)
 {
-    for (int i = 0; i < count; ++i)
+    if (!cache_lock)
     {
-        //printf("%s: freeing item %p\n", __func__, files[i]);
-        free(files[i]);
+        memset(out, 0, sizeof(*out));
+        return;
     }
 
-    //printf("%s: freeing array %p\n", __func__, files);
-    free(files);
+    xSemaphoreTake(cache_lock, portMAX_DELAY);
+    *out = batch_stats;
+    xSemaphoreGive(cache_lock);
 }
 
+
 esp_err_t odroid_sdcard_open(const char* base_path)
 {
     esp_err_t ret;
@@ -259,19 +886,7 @@ esp_err_t odroid_sdcard_open(const char* base_path)
     // Example: for fixed frequency of 10MHz, use host.max_freq_khz = 10000;
     sdmmc_host_t host = SDSPI_HOST_DEFAULT();
     host.slot = VSPI_HOST;
-    spi_bus_config_t bus_cfg = {
-        .mosi_io_num = (gpio_num_t)SD_PIN_NUM_MOSI,
-        .miso_io_num = (gpio_num_t)SD_PIN_NUM_MISO,
-        .sclk_io_num = (gpio_num_t)SD_PIN_NUM_CLK,
-        .quadwp_io_num = -1,
-        .quadhd_io_num = -1,
-        .max_transfer_sz = 4000,
-    };
-    // ret = spi_bus_initialize(host.slot, &bus_cfg, SPI_DMA_CH_AUTO);
-    // if (ret != ESP_OK) {
-    //     ESP_LOGE(TAG, "Failed to initialize bus.");
-    //     return ret;
-    // }
+    // The bus is shared with the LCD, odroid_display initializes it
 
     // This initializes the slot without card detect (CD) and write protect (WP) signals.
     // Modify slot_config.gpio_cd and slot_config.gpio_wp if your board has these signals.
@@ -296,6 +911,16 @@ esp_err_t odroid_sdcard_open(const char* base_path)
 
     // Card has been initialized, print its properties
     sdmmc_card_print_info(stdout, card);
+
+    cache_install(card);
+    handles_init();
+
+    // Drive of the volume for batched reads, as esp_vfs_fat names it
+    batch_base = strdup(base_path);
+    batch_drive[0] = '0' + ff_diskio_get_pdrv_card(card);
+    batch_drive[1] = ':';
+    batch_drive[2] = 0;
+    isOpen = true;
     }
 #endif
 	return ret;
@@ -313,12 +938,26 @@ esp_err_t odroid_sdcard_close()
     }
     else
     {
+        odroid_sdcard_flush_handles();
+
         ret = esp_vfs_fat_sdmmc_unmount();
 
         if (ret != ESP_OK)
         {
             printf("odroid_sdcard_close: esp_vfs_fat_sdmmc_unmount failed (%d)\n", ret);
     	}
+
+        // The volume's disk driver is gone with it
+        if (cache_lock)
+        {
+            xSemaphoreTake(cache_lock, portMAX_DELAY);
+            cache_free();
+            cache_card = NULL;
+            xSemaphoreGive(cache_lock);
+        }
+
+        free(batch_base);
+        batch_base = NULL;
     }
 
     return ret;
@@ -335,17 +974,14 @@ size_t odroid_sdcard_get_filesize(const char* path)
     }
     else
     {
-        FILE* f = fopen(path, "rb");
-        if (f == NULL)
+        struct stat st;
+        if (!odroid_sdcard_stat(path, &st))
         {
-            printf("odroid_sdcard_get_filesize: fopen failed.\n");
+            printf("odroid_sdcard_get_filesize: stat failed.\n");
         }
         else
         {
-            // get the file size
-            fseek(f, 0, SEEK_END);
-            ret = ftell(f);
-            fseek(f, 0, SEEK_SET);
+            ret = st.st_size;
         }
     }
 
@@ -375,21 +1011,182 @@ size_t odroid_sdcard_copy_file_to_memory(const char* path, void* ptr)
             }
             else
             {
-                // copy
-                const size_t BLOCK_SIZE = 512;
+                // copy: large reads go straight from the card into ptr
+                const size_t BLOCK_SIZE = ODROID_SDCARD_STREAM_CHUNK;
+                setvbuf(f, NULL, _IONBF, 0);
                 while(true)
                 {
-                    __asm__("memw");
+                    SDCARD_MEMW();
                     size_t count = fread((uint8_t*)ptr + ret, 1, BLOCK_SIZE, f);
-                    __asm__("memw");
+                    SDCARD_MEMW();
 
                     ret += count;
 
                     if (count < BLOCK_SIZE) break;
                 }
+
+                fclose(f);
             }
         }
     }
 
     return ret;
 }
+
+
+struct odroid_sdcard_stream
+{
+    int fd;
+    size_t position;
+    size_t remaining;
+    size_t chunk_size;
+
+    uint8_t* buffers[2];
+    size_t counts[2];
+    bool owned;
+
+    SemaphoreHandle_t empty[2];
+    SemaphoreHandle_t full[2];
+    SemaphoreHandle_t exited;
+    int next;
+    bool holding;
+    bool end;
+
+    volatile bool cancel;
+    volatile bool failed;
+};
+
+static void stream_task(void* arg)
+{
+    odroid_sdcard_stream_t* stream = (odroid_sdcard_stream_t*)arg;
+
+    for (int i = 0; ; i ^= 1)
+    {
+        xSemaphoreTake(stream->empty[i], portMAX_DELAY);
+        if (stream->cancel) break;
+
+        // Up to the next chunk boundary, so later reads are whole clusters
+        size_t length = stream->chunk_size - (stream->position % stream->chunk_size);
+        if (length > stream->remaining) length = stream->remaining;
+
+        // The card driver hands the bus to the LCD between bursts
+        size_t count = 0;
+        while (count < length)
+        {
+            ssize_t result = read(stream->fd, stream->buffers[i] + count, length - count);
+            if (result <= 0)
+            {
+                stream->failed = true;
+                break;
+            }
+            count += result;
+        }
+
+        stream->position += count;
+        stream->remaining = stream->failed ? 0 : stream->remaining - count;
+        stream->counts[i] = count;
+        xSemaphoreGive(stream->full[i]);
+
+        if (count == 0) break;
+    }
+
+    xSemaphoreGive(stream->exited);
+    vTaskDelete(NULL);
+}
+
+odroid_sdcard_stream_t* odroid_sdcard_stream_open(const char* path, size_t offset, size_t length, size_t chunk_size, void* buffer)
+{
+    odroid_sdcard_stream_t* stream = calloc(1, sizeof(odroid_sdcard_stream_t));
+    if (!stream) abort();
+
+    stream->fd = open(path, O_RDONLY);
+    if (stream->fd < 0 || lseek(stream->fd, offset, SEEK_SET) != offset)
+    {
+        printf("odroid_sdcard_stream_open: open failed.\n");
+        if (stream->fd >= 0) close(stream->fd);
+        free(stream);
+        return NULL;
+    }
+
+    stream->position = offset;
+    stream->remaining = length;
+    stream->chunk_size = chunk_size;
+
+    if (!buffer)
+    {
+        buffer = heap_caps_malloc(chunk_size * 2, MALLOC_CAP_DMA);
+        if (!buffer) abort();
+        stream->owned = true;
+    }
+    stream->buffers[0] = (uint8_t*)buffer;
+    stream->buffers[1] = (uint8_t*)buffer + chunk_size;
+
+    for (int i = 0; i < 2; ++i)
+    {
+        stream->empty[i] = xSemaphoreCreateBinary();
+        stream->full[i] = xSemaphoreCreateBinary();
+        if (!stream->empty[i] || !stream->full[i]) abort();
+
+        xSemaphoreGive(stream->empty[i]);
+    }
+
+    stream->exited = xSemaphoreCreateBinary();
+    if (!stream->exited) abort();
+
+    // The caller usually writes flash on core 0
+    if (xTaskCreatePinnedToCore(&stream_task, "sd_stream", 1024 * 3, stream, 4, NULL, 1) != pdPASS) abort();
+
+    return stream;
+}
+
+const void* odroid_sdcard_stream_next(odroid_sdcard_stream_t* stream, size_t* count)
+{
+    *count = 0;
+
+    // The previous chunk can be refilled now
+    if (stream->holding)
+    {
+        xSemaphoreGive(stream->empty[stream->next ^ 1]);
+        stream->holding = false;
+    }
+
+    if (stream->end) return NULL;
+
+    const int i = stream->next;
+    xSemaphoreTake(stream->full[i], portMAX_DELAY);
+    if (stream->counts[i] == 0)
+    {
+        stream->end = true;
+        return NULL;
+    }
+
+    *count = stream->counts[i];
+    stream->holding = true;
+    stream->next = i ^ 1;
+    return stream->buffers[i];
+}
+
+bool odroid_sdcard_stream_ok(odroid_sdcard_stream_t* stream)
+{
+    return !stream->failed;
+}
+
+void odroid_sdcard_stream_close(odroid_sdcard_stream_t* stream)
+{
+    stream->cancel = true;
+    xSemaphoreGive(stream->empty[0]);
+    xSemaphoreGive(stream->empty[1]);
+    xSemaphoreTake(stream->exited, portMAX_DELAY);
+
+    close(stream->fd);
+
+    for (int i = 0; i < 2; ++i)
+    {
+        vSemaphoreDelete(stream->empty[i]);
+        vSemaphoreDelete(stream->full[i]);
+    }
+    vSemaphoreDelete(stream->exited);
+
+    if (stream->owned) heap_caps_free(stream->buffers[0]);
+    free(stream);
+}
@@ -2,9 +2,106 @@
 
 #include "esp_err.h"
 
-int odroid_sdcard_files_get(const char* path, const char* extension, char*** filesOut);
-void odroid_sdcard_files_free(char** files, int count);
-esp_err_t odroid_sdcard_open();
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <sys/stat.h>
+
+esp_err_t odroid_sdcard_open(const char* base_path);
 esp_err_t odroid_sdcard_close();
 size_t odroid_sdcard_get_filesize(const char* path);
 size_t odroid_sdcard_copy_file_to_memory(const char* path, void* ptr);
+
+// Sector cache below the FAT file system for the many small reads of the
+// menu (FAT and directory sectors, headers). A miss that continues the
+// previous one also reads a few sectors ahead. Large reads bypass the cache
+// and writes go through to the card.
+#define ODROID_SDCARD_CACHE_SECTORS (32)
+
+typedef struct
+{
+    uint32_t hits;          // sectors
+    uint32_t misses;
+    uint32_t readahead;     // sectors read before they were requested
+    uint32_t readahead_hits;
+    uint32_t bypassed;      // reads
+} odroid_sdcard_cache_stats_t;
+
+// Drops the contents. 0 disables the cache, applies from the next open if
+// the card is not mounted yet.
+void odroid_sdcard_cache_resize(size_t sectors);
+void odroid_sdcard_cache_stats(odroid_sdcard_cache_stats_t* out);
+
+// Read-only handles kept open for reuse, keyed by path. The least recently
+// used idle one is closed to make room; FATFS allows only a few open files.
+// Handles are given back with odroid_sdcard_release, not fclose.
+#define ODROID_SDCARD_HANDLES (2)
+
+FILE* odroid_sdcard_acquire(const char* path);
+void odroid_sdcard_release(FILE* file);
+// Size, mtime and mode; only the first lookup of a path reads the card
+bool odroid_sdcard_stat(const char* path, struct stat* out);
+// Closes idle handles and forgets stat results
+void odroid_sdcard_flush_handles();
+
+typedef struct
+{
+    uint32_t handle_hits;
+    uint32_t handle_opens;
+    uint32_t stat_hits;
+    uint32_t stat_lookups;  // went to the card
+} odroid_sdcard_handle_stats_t;
+
+void odroid_sdcard_handle_stats(odroid_sdcard_handle_stats_t* out);
+
+// Batched small reads from many files, such as the headers for a page or an
+// index. The requests are resolved to their sectors on the card and read in
+// ascending sector order, merging ranges that touch, instead of in list
+// order. Requests that are not one contiguous run of at most
+// ODROID_SDCARD_BATCH_RUN sectors (fragmented files) are read through the
+// file system afterwards. The files must not be open for writing.
+#define ODROID_SDCARD_BATCH_RUN (16)    // sectors per card read
+
+typedef struct
+{
+    const char* path;
+    uint32_t offset;
+    uint32_t length;
+    void* buffer;
+
+    // Set when the request completes
+    uint32_t count;     // bytes read, less than length at the end of the file
+    bool ok;
+} odroid_sdcard_read_t;
+
+// Called once per request as it completes, in card order
+typedef void (*odroid_sdcard_read_func)(odroid_sdcard_read_t* request, void* arg);
+
+// done may be NULL. Returns the number of requests that succeeded.
+size_t odroid_sdcard_read_batch(odroid_sdcard_read_t* requests, size_t count, odroid_sdcard_read_func done, void* arg);
+
+typedef struct
+{
+    uint32_t requests;
+    uint32_t card_reads;    // merged runs
+    uint32_t sectors;
+    uint32_t fallbacks;     // read through the file system
+} odroid_sdcard_batch_stats_t;
+
+void odroid_sdcard_batch_stats(odroid_sdcard_batch_stats_t* out);
+
+// Sequential reader for large files. A task reads the next chunk into the
+// second buffer while the caller consumes the first one. Reads are whole
+// chunks at chunk aligned file offsets (after the first), bypassing stdio.
+#define ODROID_SDCARD_STREAM_CHUNK (16 * 1024)
+
+typedef struct odroid_sdcard_stream odroid_sdcard_stream_t;
+
+// buffer: 2 * chunk_size DMA capable bytes, or NULL to allocate them
+odroid_sdcard_stream_t* odroid_sdcard_stream_open(const char* path, size_t offset, size_t length, size_t chunk_size, void* buffer);
+// Returns the next chunk, valid until the next call, or NULL at the end
+const void* odroid_sdcard_stream_next(odroid_sdcard_stream_t* stream, size_t* count);
+// False if a read failed or the file was shorter than requested
+bool odroid_sdcard_stream_ok(odroid_sdcard_stream_t* stream);
+void odroid_sdcard_stream_close(odroid_sdcard_stream_t* stream);
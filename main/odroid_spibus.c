@@ -0,0 +1,145 @@
+#include "odroid_spibus.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+
+#include <string.h>
+
+
+#define SPIBUS_NONE (-1)
+#define SPIBUS_TASKS_MAX (8)    // per client
+
+static SemaphoreHandle_t spibus_lock;
+static SemaphoreHandle_t spibus_wake[ODROID_SPIBUS_CLIENTS];   // one give per handover
+static int spibus_owner = SPIBUS_NONE;
+static int spibus_waiting[ODROID_SPIBUS_CLIENTS];               // tasks blocked in acquire
+static odroid_spibus_client_t spibus_priority = ODROID_SPIBUS_LCD;
+static odroid_spibus_stats_t spibus_stats[ODROID_SPIBUS_CLIENTS];
+
+
+void odroid_spibus_init()
+{
+    if (spibus_lock) return;
+
+    spibus_lock = xSemaphoreCreateMutex();
+    if (!spibus_lock) abort();
+
+    for (int i = 0; i < ODROID_SPIBUS_CLIENTS; ++i)
+    {
+        spibus_wake[i] = xSemaphoreCreateCounting(SPIBUS_TASKS_MAX, 0);
+        if (!spibus_wake[i]) abort();
+    }
+}
+
+void odroid_spibus_set_priority(odroid_spibus_client_t client)
+{
+    spibus_priority = client;
+}
+
+size_t odroid_spibus_burst(odroid_spibus_client_t client)
+{
+    const bool first = (client == spibus_priority);
+
+    if (client == ODROID_SPIBUS_LCD)
+        return first ? ODROID_SPIBUS_LCD_BURST_LONG : ODROID_SPIBUS_LCD_BURST_SHORT;
+    else
+        return first ? ODROID_SPIBUS_SD_BURST_LONG : ODROID_SPIBUS_SD_BURST_SHORT;
+}
+
+void odroid_spibus_acquire(odroid_spibus_client_t client)
+{
+    if (!spibus_lock) return;
+
+    xSemaphoreTake(spibus_lock, portMAX_DELAY);
+
+    if (spibus_owner == SPIBUS_NONE)
+    {
+        spibus_owner = client;
+        ++spibus_stats[client].grants;
+        xSemaphoreGive(spibus_lock);
+        return;
+    }
+
+    ++spibus_waiting[client];
+    xSemaphoreGive(spibus_lock);
+
+    // The owner passes the bus to us directly when its burst ends
+    int64_t start = esp_timer_get_time();
+    xSemaphoreTake(spibus_wake[client], portMAX_DELAY);
+    uint32_t wait = (uint32_t)(esp_timer_get_time() - start);
+
+    xSemaphoreTake(spibus_lock, portMAX_DELAY);
+    odroid_spibus_stats_t* stats = &spibus_stats[client];
+    stats->total_wait_us += wait;
+    if (wait > stats->max_wait_us) stats->max_wait_us = wait;
+    xSemaphoreGive(spibus_lock);
+}
+
+void odroid_spibus_release(odroid_spibus_client_t client)
+{
+    if (!spibus_lock) return;
+
+    const odroid_spibus_client_t other = (client == ODROID_SPIBUS_LCD) ? ODROID_SPIBUS_SD : ODROID_SPIBUS_LCD;
+
+    xSemaphoreTake(spibus_lock, portMAX_DELAY);
+
+    if (spibus_owner != client) abort();
+
+    // The other client first, then another task of this one
+    const int next = spibus_waiting[other] ? (int)other : spibus_waiting[client] ? (int)client : SPIBUS_NONE;
+    if (next != SPIBUS_NONE)
+    {
+        --spibus_waiting[next];
+        spibus_owner = next;
+        ++spibus_stats[client].handovers;
+        ++spibus_stats[next].grants;
+        xSemaphoreGive(spibus_wake[next]);
+    }
+    else
+    {
+        spibus_owner = SPIBUS_NONE;
+    }
+
+    xSemaphoreGive(spibus_lock);
+}
+
+void odroid_spibus_yield(odroid_spibus_client_t client)
+{
+    if (!spibus_lock) return;
+
+    const odroid_spibus_client_t other = (client == ODROID_SPIBUS_LCD) ? ODROID_SPIBUS_SD : ODROID_SPIBUS_LCD;
+
+    xSemaphoreTake(spibus_lock, portMAX_DELAY);
+    bool waiting = spibus_waiting[other] || spibus_waiting[client];
+    xSemaphoreGive(spibus_lock);
+
+    if (waiting)
+    {
+        odroid_spibus_release(client);
+        odroid_spibus_acquire(client);
+    }
+}
+
+void odroid_spibus_get_stats(odroid_spibus_client_t client, odroid_spibus_stats_t* out)
+{
+    if (!spibus_lock)
+    {
+        memset(out, 0, sizeof(*out));
+        return;
+    }
+
+    xSemaphoreTake(spibus_lock, portMAX_DELAY);
+    *out = spibus_stats[client];
+    xSemaphoreGive(spibus_lock);
+}
+
+void odroid_spibus_reset_stats()
+{
+    if (!spibus_lock) return;
+
+    xSemaphoreTake(spibus_lock, portMAX_DELAY);
+    memset(spibus_stats, 0, sizeof(spibus_stats));
+    xSemaphoreGive(spibus_lock);
+}
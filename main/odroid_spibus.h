@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Scheduler for the VSPI bus shared by the LCD and the SD card. Each client
+// holds the bus for one burst at a time and hands it over at the end of the
+// burst if the other client is waiting, so neither stalls for a whole frame
+// or file. The priority client gets long bursts and the other short ones,
+// which bounds the wait of each to one burst of the other. Several tasks
+// may use one client: the bus goes to one of them at a time. The SD card
+// driver takes the bus for every card access, the LCD for every update.
+typedef enum
+{
+    ODROID_SPIBUS_LCD = 0,
+    ODROID_SPIBUS_SD,
+    ODROID_SPIBUS_CLIENTS,
+} odroid_spibus_client_t;
+
+// Burst sizes in bytes
+#define ODROID_SPIBUS_LCD_BURST_LONG (320 * 2 * 48)
+#define ODROID_SPIBUS_LCD_BURST_SHORT (320 * 2 * 8)
+#define ODROID_SPIBUS_SD_BURST_LONG (16 * 1024)
+#define ODROID_SPIBUS_SD_BURST_SHORT (4 * 1024)
+
+typedef struct
+{
+    uint32_t grants;
+    uint32_t handovers;     // bursts that ended by passing the bus on
+    uint32_t max_wait_us;
+    uint64_t total_wait_us;
+} odroid_spibus_stats_t;
+
+// Until this is called acquire, yield and release do nothing
+void odroid_spibus_init();
+
+// SD first while installing, LCD first in the menu
+void odroid_spibus_set_priority(odroid_spibus_client_t client);
+size_t odroid_spibus_burst(odroid_spibus_client_t client);
+
+// Not recursive
+void odroid_spibus_acquire(odroid_spibus_client_t client);
+// Ends the current burst: passes the bus on if another task is waiting and
+// takes it back afterwards. The caller's transfers must have completed.
+void odroid_spibus_yield(odroid_spibus_client_t client);
+void odroid_spibus_release(odroid_spibus_client_t client);
+
+void odroid_spibus_get_stats(odroid_spibus_client_t client, odroid_spibus_stats_t* out);
+void odroid_spibus_reset_stats();
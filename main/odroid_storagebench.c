@@ -0,0 +1,218 @@
+#include "odroid_storagebench.h"
+#include "odroid_sdcard.h"
+
+#include "esp_flash.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+
+
+static const uint32_t sd_blocks[] = { 512, 4096, 16 * 1024, 32 * 1024 };
+#define SD_BLOCK_COUNT (sizeof(sd_blocks) / sizeof(sd_blocks[0]))
+
+
+uint32_t odroid_storagebench_kb_per_sec(const odroid_storagebench_result_t* result)
+{
+    if (result->us == 0) return 0;
+    return (uint32_t)((uint64_t)result->bytes * 1000000 / 1024 / result->us);
+}
+
+static void result_report(const char* test, uint32_t block, uint32_t bytes, int64_t us, bool ok, odroid_storagebench_func done, void* arg)
+{
+    odroid_storagebench_result_t result;
+    result.test = test;
+    result.block = block;
+    result.bytes = bytes;
+    result.us = us > 0 ? (uint32_t)us : 1;
+    result.ok = ok;
+
+    printf("storage %s block=%u bytes=%u us=%u kb_per_sec=%u ok=%d\n", test,
+        (unsigned)block, (unsigned)bytes, (unsigned)result.us,
+        (unsigned)odroid_storagebench_kb_per_sec(&result), ok ? 1 : 0);
+
+    if (done) done(&result, arg);
+}
+
+static uint8_t pattern_byte(uint32_t offset)
+{
+    return (uint8_t)(offset * 7 + (offset >> 9));
+}
+
+static void pattern_fill(uint8_t* buffer, uint32_t offset, uint32_t length)
+{
+    for (uint32_t i = 0; i < length; ++i) buffer[i] = pattern_byte(offset + i);
+}
+
+static bool pattern_check(const uint8_t* buffer, uint32_t offset, uint32_t length)
+{
+    for (uint32_t i = 0; i < length; ++i)
+    {
+        if (buffer[i] != pattern_byte(offset + i)) return false;
+    }
+    return true;
+}
+
+// Same offsets on every run, so runs can be compared
+static uint32_t random_next(uint32_t* state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+
+static bool sd_file_create(const char* path, uint8_t* buffer)
+{
+    struct stat st;
+    if (stat(path, &st) == 0 && st.st_size == ODROID_STORAGEBENCH_FILE_SIZE) return true;
+
+    printf("odroid_storagebench_sd: writing '%s'.\n", path);
+
+    FILE* file = fopen(path, "wb");
+    if (!file) return false;
+
+    bool ok = true;
+    for (uint32_t offset = 0; ok && offset < ODROID_STORAGEBENCH_FILE_SIZE; offset += ODROID_STORAGEBENCH_MAX_BLOCK)
+    {
+        pattern_fill(buffer, offset, ODROID_STORAGEBENCH_MAX_BLOCK);
+        ok = fwrite(buffer, 1, ODROID_STORAGEBENCH_MAX_BLOCK, file) == ODROID_STORAGEBENCH_MAX_BLOCK;
+    }
+
+    if (fclose(file) != 0) ok = false;
+    if (!ok) unlink(path);
+
+    return ok;
+}
+
+// Reads through the file descriptor, as the install stream does, so stdio
+// buffering does not hide the block size
+static bool sd_read(int fd, uint8_t* buffer, uint32_t offset, uint32_t block)
+{
+    return lseek(fd, offset, SEEK_SET) == offset &&
+        read(fd, buffer, block) == block;
+}
+
+bool odroid_storagebench_sd(const char* dir, odroid_storagebench_func done, void* arg)
+{
+    uint8_t* buffer = heap_caps_malloc(ODROID_STORAGEBENCH_MAX_BLOCK, MALLOC_CAP_DMA);
+    if (!buffer) abort();
+
+    const size_t pathLength = strlen(dir) + 1 + strlen(ODROID_STORAGEBENCH_FILE) + 1;
+    char* path = malloc(pathLength);
+    if (!path) abort();
+    snprintf(path, pathLength, "%s/%s", dir, ODROID_STORAGEBENCH_FILE);
+
+    bool result = sd_file_create(path, buffer);
+    int fd = result ? open(path, O_RDONLY) : -1;
+    if (fd < 0) result = false;
+
+    // The card, not the cache
+    if (result) odroid_sdcard_cache_resize(0);
+
+    for (size_t i = 0; result && i < SD_BLOCK_COUNT; ++i)
+    {
+        const uint32_t block = sd_blocks[i];
+
+        bool ok = true;
+        int64_t start = esp_timer_get_time();
+        for (uint32_t offset = 0; ok && offset < ODROID_STORAGEBENCH_FILE_SIZE; offset += block)
+        {
+            ok = sd_read(fd, buffer, offset, block);
+        }
+        int64_t time = esp_timer_get_time() - start;
+
+        // Only the last block, checking all would be timed too
+        ok = ok && pattern_check(buffer, ODROID_STORAGEBENCH_FILE_SIZE - block, block);
+        result_report("sd_seq_read", block, ODROID_STORAGEBENCH_FILE_SIZE, time, ok, done, arg);
+        if (!ok) result = false;
+
+        uint32_t state = 0x2545f491;
+        const uint32_t blocks = ODROID_STORAGEBENCH_FILE_SIZE / block;
+        uint32_t offset = 0;
+
+        ok = true;
+        start = esp_timer_get_time();
+        for (int n = 0; ok && n < ODROID_STORAGEBENCH_RANDOM_READS; ++n)
+        {
+            offset = (random_next(&state) % blocks) * block;
+            ok = sd_read(fd, buffer, offset, block);
+        }
+        time = esp_timer_get_time() - start;
+
+        ok = ok && pattern_check(buffer, offset, block);
+        result_report("sd_rand_read", block, ODROID_STORAGEBENCH_RANDOM_READS * block, time, ok, done, arg);
+        if (!ok) result = false;
+    }
+
+    if (fd >= 0)
+    {
+        close(fd);
+        odroid_sdcard_cache_resize(ODROID_SDCARD_CACHE_SECTORS);
+    }
+
+    free(path);
+    heap_caps_free(buffer);
+
+    return result;
+}
+
+
+bool odroid_storagebench_flash(uint32_t address, uint32_t length, odroid_storagebench_func done, void* arg)
+{
+    const uint32_t block = ODROID_STORAGEBENCH_FLASH_BLOCK;
+    length -= length % block;
+
+    uint8_t* buffer = heap_caps_malloc(block, MALLOC_CAP_DMA);
+    if (!buffer) abort();
+
+    int64_t start = esp_timer_get_time();
+    bool ok = esp_flash_erase_region(NULL, address, length) == ESP_OK;
+    int64_t time = esp_timer_get_time() - start;
+    result_report("flash_erase", length, length, time, ok, done, arg);
+
+    bool result = ok;
+
+    if (result)
+    {
+        // The pattern is made outside the timed calls
+        time = 0;
+        for (uint32_t offset = 0; ok && offset < length; offset += block)
+        {
+            pattern_fill(buffer, offset, block);
+
+            start = esp_timer_get_time();
+            ok = esp_flash_write(NULL, buffer, address + offset, block) == ESP_OK;
+            time += esp_timer_get_time() - start;
+        }
+        result_report("flash_write", block, length, time, ok, done, arg);
+        if (!ok) result = false;
+    }
+
+    if (result)
+    {
+        time = 0;
+        for (uint32_t offset = 0; ok && offset < length; offset += block)
+        {
+            start = esp_timer_get_time();
+            ok = esp_flash_read(NULL, buffer, address + offset, block) == ESP_OK;
+            time += esp_timer_get_time() - start;
+
+            ok = ok && pattern_check(buffer, offset, block);
+        }
+        result_report("flash_read", block, length, time, ok, done, arg);
+        if (!ok) result = false;
+    }
+
+    heap_caps_free(buffer);
+
+    return result;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Storage throughput, to tell whether a slow install is the card or the
+// flash. Every result is also printed as one line
+//   storage <test> block=<n> bytes=<n> us=<n> kb_per_sec=<n> ok=<0|1>
+// with test one of sd_seq_read, sd_rand_read, flash_erase, flash_write and
+// flash_read.
+#define ODROID_STORAGEBENCH_FILE ".storagebench"
+#define ODROID_STORAGEBENCH_FILE_SIZE (1024 * 1024)
+#define ODROID_STORAGEBENCH_RANDOM_READS (64)
+#define ODROID_STORAGEBENCH_MAX_BLOCK (32 * 1024)
+#define ODROID_STORAGEBENCH_FLASH_SIZE (256 * 1024)
+#define ODROID_STORAGEBENCH_FLASH_BLOCK (4096)
+
+typedef struct
+{
+    const char* test;
+    uint32_t block;     // bytes per call
+    uint32_t bytes;
+    uint32_t us;
+    bool ok;
+} odroid_storagebench_result_t;
+
+typedef void (*odroid_storagebench_func)(const odroid_storagebench_result_t* result, void* arg);
+
+uint32_t odroid_storagebench_kb_per_sec(const odroid_storagebench_result_t* result);
+
+// Sequential and random reads of a test file in dir at each block size. The
+// file is written on the first run and kept. The sector cache is disabled
+// while measuring. False if the file could not be made or a read failed.
+bool odroid_storagebench_sd(const char* dir, odroid_storagebench_func done, void* arg);
+
+// Erases, writes and reads back length bytes of flash at address, which
+// must be unused and 64 KB aligned. Whatever was there is lost.
+bool odroid_storagebench_flash(uint32_t address, uint32_t length, odroid_storagebench_func done, void* arg);
@@ -0,0 +1,135 @@
+#include "odroid_tilecache.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+
+typedef struct
+{
+    char* name;     // NULL = unused
+    uint32_t used;  // LRU stamp
+    bool prefetched;
+    uint16_t* data;
+} tilecache_slot_t;
+
+struct odroid_tilecache
+{
+    tilecache_slot_t* slots;
+    int count;
+    uint32_t clock;
+
+    odroid_tilecache_stats_t stats;
+};
+
+
+
+static tilecache_slot_t* slot_find(odroid_tilecache_t* cache, const char* name)
+{
+    for (int i = 0; i < cache->count; ++i)
+    {
+        tilecache_slot_t* slot = &cache->slots[i];
+        if (slot->name && strcmp(slot->name, name) == 0) return slot;
+    }
+    return NULL;
+}
+
+
+odroid_tilecache_t* odroid_tilecache_create(int count, size_t tile_size)
+{
+    odroid_tilecache_t* cache = calloc(1, sizeof(odroid_tilecache_t));
+    if (!cache) abort();
+
+    cache->slots = calloc(count, sizeof(tilecache_slot_t));
+    if (!cache->slots) abort();
+
+    for (int i = 0; i < count; ++i)
+    {
+        cache->slots[i].data = malloc(tile_size);
+        if (!cache->slots[i].data) abort();
+    }
+
+    cache->count = count;
+    return cache;
+}
+
+void odroid_tilecache_free(odroid_tilecache_t* cache)
+{
+    for (int i = 0; i < cache->count; ++i)
+    {
+        free(cache->slots[i].name);
+        free(cache->slots[i].data);
+    }
+
+    free(cache->slots);
+    free(cache);
+}
+
+const uint16_t* odroid_tilecache_get(odroid_tilecache_t* cache, const char* name)
+{
+    tilecache_slot_t* slot = slot_find(cache, name);
+    if (!slot)
+    {
+        ++cache->stats.misses;
+        return NULL;
+    }
+
+    ++cache->stats.hits;
+    if (slot->prefetched)
+    {
+        ++cache->stats.prefetch_hits;
+        slot->prefetched = false;
+    }
+
+    slot->used = ++cache->clock;
+    return slot->data;
+}
+
+bool odroid_tilecache_contains(odroid_tilecache_t* cache, const char* name)
+{
+    return slot_find(cache, name) != NULL;
+}
+
+uint16_t* odroid_tilecache_put(odroid_tilecache_t* cache, const char* name, bool prefetch)
+{
+    tilecache_slot_t* slot = slot_find(cache, name);
+    if (!slot)
+    {
+        // Unused slots have the lowest stamp
+        slot = &cache->slots[0];
+        for (int i = 1; i < cache->count; ++i)
+        {
+            if (!slot->name) break;
+            if (!cache->slots[i].name || cache->slots[i].used < slot->used) slot = &cache->slots[i];
+        }
+
+        if (slot->name)
+        {
+            ++cache->stats.evictions;
+            free(slot->name);
+        }
+
+        slot->name = strdup(name);
+        if (!slot->name) abort();
+    }
+
+    slot->prefetched = prefetch;
+    if (prefetch) ++cache->stats.prefetches;
+
+    slot->used = ++cache->clock;
+    return slot->data;
+}
+
+void odroid_tilecache_clear(odroid_tilecache_t* cache)
+{
+    for (int i = 0; i < cache->count; ++i)
+    {
+        free(cache->slots[i].name);
+        cache->slots[i].name = NULL;
+        cache->slots[i].prefetched = false;
+    }
+}
+
+void odroid_tilecache_stats(odroid_tilecache_t* cache, odroid_tilecache_stats_t* out)
+{
+    *out = cache->stats;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Fixed budget LRU cache of decoded menu tiles, keyed by file name. The
+// cache lives for one menu session. All tile buffers are allocated up front.
+// Not thread safe: callers share it under their own lock.
+typedef struct odroid_tilecache odroid_tilecache_t;
+
+typedef struct
+{
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+    uint32_t prefetches;     // tiles stored ahead of being shown
+    uint32_t prefetch_hits;  // prefetched tiles that were shown later
+} odroid_tilecache_stats_t;
+
+odroid_tilecache_t* odroid_tilecache_create(int count, size_t tile_size);
+void odroid_tilecache_free(odroid_tilecache_t* cache);
+
+// Returns the cached tile or NULL. Marks it as most recently used.
+const uint16_t* odroid_tilecache_get(odroid_tilecache_t* cache, const char* name);
+// Same without touching the counters or the LRU order
+bool odroid_tilecache_contains(odroid_tilecache_t* cache, const char* name);
+// Returns the buffer to load the tile into, reusing the least recently used one
+uint16_t* odroid_tilecache_put(odroid_tilecache_t* cache, const char* name, bool prefetch);
+// Drops all tiles (names are only unique within a directory), keeps the counters
+void odroid_tilecache_clear(odroid_tilecache_t* cache);
+
+void odroid_tilecache_stats(odroid_tilecache_t* cache, odroid_tilecache_stats_t* out);
@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+# Converts 1bpp uGUI fonts from ugui.c into the row-span format (FONT_TYPE_SPAN).
+#
+# usage: fontspan.py ../../components/ugui/ugui.c ../../components/ugui/ugui_fontspan.c
+#
+# Layout of the data a span font points to:
+#   UG_U16 offset[end_char - start_char + 1]    little endian, from the start of the data
+#   per glyph:
+#     top                                       first row with pixels set, 0xFF = empty glyph
+#     rows                                      number of encoded rows from top
+#     row ops, one of
+#       0x00..0x7F  n                           n spans follow: (x, length) byte pairs
+#       0x80..0xFF  0x80 | count                previous row is repeated count times
+#   Rows outside of top..top+rows-1 are background.
+
+import re
+import sys
+
+FONTS = [
+    ("font_22x36", 22, 36),
+    ("font_24x40", 24, 40),
+    ("font_32x53", 32, 53),
+]
+
+
+def load(source, name, width, height):
+    m = re.search(r"unsigned char %s\[256\]\[(\d+)\]=\{(.*?)\n\};" % name, source, re.S)
+    if not m:
+        sys.exit("%s: not found" % name)
+
+    stride = (width + 7) // 8
+    glyphs = []
+    for cell in re.findall(r"\{([^}]*)\}", m.group(2)):
+        data = [int(x, 16) for x in re.findall(r"0x[0-9A-Fa-f]+", cell)]
+        if len(data) != stride * height:
+            sys.exit("%s: glyph %d has %d bytes" % (name, len(glyphs), len(data)))
+
+        rows = []
+        for y in range(height):
+            bits = []
+            for b in data[y * stride:(y + 1) * stride]:
+                bits.extend((b >> k) & 1 for k in range(8))
+            rows.append(tuple(bits[:width]))
+        glyphs.append(rows)
+
+    if len(glyphs) != 256:
+        sys.exit("%s: %d glyphs" % (name, len(glyphs)))
+    return glyphs
+
+
+def spans(row):
+    result = []
+    x = 0
+    while x < len(row):
+        if row[x]:
+            start = x
+            while x < len(row) and row[x]:
+                x += 1
+            result.append((start, x - start))
+        else:
+            x += 1
+    return result
+
+
+def encode(rows):
+    used = [i for i, r in enumerate(rows) if any(r)]
+    if not used:
+        return bytes([0xFF])
+
+    top = used[0]
+    rows = rows[top:used[-1] + 1]
+    out = bytearray([top, len(rows)])
+
+    i = 0
+    previous = None
+    while i < len(rows):
+        if rows[i] == previous:
+            count = 0
+            while i < len(rows) and rows[i] == previous and count < 0x7F:
+                i += 1
+                count += 1
+            out.append(0x80 | count)
+            continue
+
+        s = spans(rows[i])
+        out.append(len(s))
+        for x, length in s:
+            out.extend((x, length))
+        previous = rows[i]
+        i += 1
+    return bytes(out)
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit("usage: %s ugui.c output.c" % sys.argv[0])
+
+    source = open(sys.argv[1], encoding="utf-8").read()
+
+    out = []
+    out.append("/* Generated by tools/fontspan/fontspan.py from the 1bpp fonts in ugui.c. Do not edit. */")
+    out.append('#include "ugui.h"')
+    out.append("")
+
+    for name, width, height in FONTS:
+        glyphs = [encode(g) for g in load(source, name, width, height)]
+
+        data = bytearray()
+        offset = 2 * len(glyphs)
+        for g in glyphs:
+            if offset > 0xFFFF:
+                sys.exit("%s: too large for 16 bit offsets" % name)
+            data.extend((offset & 0xFF, offset >> 8))
+            offset += len(g)
+        for g in glyphs:
+            data.extend(g)
+
+        raw = 256 * height * ((width + 7) // 8)
+        print("%s: %d -> %d bytes" % (name, raw, len(data)))
+
+        define = "USE_FONT_SPAN_%s" % name[5:].upper()
+        out.append("#ifdef %s" % define)
+        out.append("/* %d bytes, %d as 1bpp bitmap */" % (len(data), raw))
+        out.append("__UG_FONT_DATA unsigned char %s_span[%d]={" % (name, len(data)))
+        for i in range(0, len(data), 16):
+            out.append(",".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+        out.append("};")
+        out.append("#endif")
+        out.append("")
+
+    open(sys.argv[2], "w", newline="\n").write("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
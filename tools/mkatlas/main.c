@@ -0,0 +1,116 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include "../../main/odroid_atlas.h"
+#include "../../main/odroid_filename.h"
+
+
+// Builds or updates the .atlas of a firmware directory, the same file the
+// menu maintains, so the first visit of the directory on the device does
+// not have to read the tile of every .fw.
+const char* HEADER = "ODROIDGO_FIRMWARE_V00_01";
+
+#define FIRMWARE_DESCRIPTION_SIZE (40)
+
+const char* directory;
+char** names;
+int count;
+
+
+static int name_compare(const void* a, const void* b)
+{
+    const char* x = *(const char* const*)a;
+    const char* y = *(const char* const*)b;
+
+    // Same order as the menu
+    int d = odroid_filename_compare(x, y);
+    return d ? d : strcmp(x, y);
+}
+
+static const char* name_get(void* arg, int index)
+{
+    return names[index];
+}
+
+static bool tile_get(void* arg, const char* name, uint32_t* size, uint32_t* mtime, uint16_t* tile)
+{
+    char path[1024];
+    snprintf(path, sizeof(path), "%s/%s", directory, name);
+
+    struct stat st;
+    if (stat(path, &st) != 0) return false;
+
+    *size = st.st_size;
+    *mtime = st.st_mtime;
+
+    FILE* file = fopen(path, "rb");
+    if (!file) return false;
+
+    char header[64];
+    const size_t headerLength = strlen(HEADER);
+    bool result = fread(header, 1, headerLength + FIRMWARE_DESCRIPTION_SIZE, file) == headerLength + FIRMWARE_DESCRIPTION_SIZE &&
+        strncmp(header, HEADER, headerLength) == 0 &&
+        fread(tile, 1, ODROID_ATLAS_TILE_SIZE, file) == ODROID_ATLAS_TILE_SIZE;
+
+    fclose(file);
+
+    if (!result) printf("%s: no tile.\n", name);
+    return result;
+}
+
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        printf("usage: %s firmware_directory\n", argv[0]);
+        return 1;
+    }
+
+    directory = argv[1];
+
+    DIR* dir = opendir(directory);
+    if (!dir)
+    {
+        printf("%s: opendir failed.\n", directory);
+        return 1;
+    }
+
+    // The files the menu lists: no hidden ones, no directories
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != NULL)
+    {
+        if (odroid_filename_hidden(entry->d_name) || !odroid_filename_matches(entry->d_name, ".fw")) continue;
+
+        char path[1024];
+        snprintf(path, sizeof(path), "%s/%s", directory, entry->d_name);
+
+        struct stat st;
+        if (stat(path, &st) != 0 || S_ISDIR(st.st_mode)) continue;
+
+        names = realloc(names, (count + 1) * sizeof(char*));
+        if (!names) abort();
+
+        names[count] = strdup(entry->d_name);
+        if (!names[count]) abort();
+        ++count;
+    }
+    closedir(dir);
+
+    qsort(names, count, sizeof(char*), name_compare);
+
+    // Tiles of unchanged files are copied from the existing atlas
+    odroid_atlas_t* atlas = odroid_atlas_open(directory);
+    bool result = odroid_atlas_update(atlas, name_get, tile_get, NULL, count, NULL);
+    odroid_atlas_close(atlas);
+
+    for (int i = 0; i < count; ++i) free(names[i]);
+    free(names);
+
+    return result ? 0 : 1;
+}
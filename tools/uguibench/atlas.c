@@ -0,0 +1,185 @@
+// Tile atlas over the mock firmware directory. Included from main.c.
+
+// The atlas is built by the tile loader once the listing is complete. A cold
+// page then takes one atlas read and no .fw reads. Adding a file rewrites
+// the atlas with only the new tile read.
+#define ATLAS_NEW_FILE "Firmware 99.fw"
+
+static int atlas_tile_reads;
+static bool atlas_read_ok;
+
+static bool atlas_check_tile(int file, const uint16_t* tile)
+{
+    for (int p = 0; p < TILE_WIDTH * TILE_HEIGHT; ++p)
+    {
+        const uint16_t expected = file < MOCK_FILE_COUNT ?
+            (uint16_t)((p % TILE_WIDTH) * 0x0801 + (p / TILE_WIDTH) * 0x20 + file * 0x1111) :
+            (uint16_t)((p / (TILE_WIDTH * 8)) * 0x1234);
+        if (tile[p] != expected) return false;
+    }
+    return true;
+}
+
+static void atlas_bench_check(void* arg, int index, const uint16_t* tile)
+{
+    ++atlas_tile_reads;
+    // Records are in list order, which is the order of the mock files
+    if (!atlas_check_tile(index, tile)) atlas_read_ok = false;
+}
+
+static const char* atlas_bench_name(void* arg, int index)
+{
+    return index < MOCK_FILE_COUNT ? mock_files[index] : ATLAS_NEW_FILE;
+}
+
+static bool atlas_bench_tile(void* arg, const char* name, uint32_t* size, uint32_t* mtime, uint16_t* tile)
+{
+    ++atlas_tile_reads;
+    return ui_atlas_tile(arg, name, size, mtime, tile);
+}
+
+static void atlas_bench()
+{
+    bool ok = true;
+
+    ui_tile_cancel();
+    atlas = odroid_atlas_open(mock_dir);
+
+    files = mock_list;
+    ui_tile_prune_request();
+    tile_wait();
+    if (odroid_atlas_count(atlas) != MOCK_FILE_COUNT || !odroid_atlas_current(atlas, ui_atlas_name, mock_list, MOCK_FILE_COUNT)) ok = false;
+
+    char atlasPath[128];
+    sprintf(atlasPath, "%s/%s", mock_dir, ODROID_ATLAS_FILE);
+    struct stat st;
+    if (stat(atlasPath, &st) != 0) ok = false;
+
+    // Cold page, no tiles cached
+    odroid_tilecache_t* saved = tileCache;
+    tileCache = odroid_tilecache_create(TILE_CACHE_COUNT, TILE_LENGTH);
+
+    odroid_sdcard_handle_stats_t before;
+    odroid_sdcard_handle_stats(&before);
+    const size_t opens = host_fopens;
+
+    double start = now_ns();
+    ui_draw_page(mock_list, MOCK_FILE_COUNT, ITEM_COUNT);
+    tile_wait();
+    double complete = now_ns() - start;
+
+    odroid_sdcard_handle_stats_t after;
+    odroid_sdcard_handle_stats(&after);
+    const size_t pageReads = host_fopens - opens;
+    const uint32_t fwReads = (after.handle_hits + after.handle_opens) - (before.handle_hits + before.handle_opens);
+
+    for (int i = ITEM_COUNT; i < ITEM_COUNT * 2; ++i)
+    {
+        const uint16_t* tile = odroid_tilecache_get(tileCache, mock_files[i]);
+        if (!tile || !atlas_check_tile(i, tile)) ok = false;
+    }
+
+    odroid_tilecache_free(tileCache);
+    tileCache = saved;
+
+    // A new file with a flat tile, stored run length encoded
+    char fullPath[128];
+    sprintf(fullPath, "%s/%s", mock_dir, ATLAS_NEW_FILE);
+    FILE* f = fopen(fullPath, "wb");
+    if (!f) abort();
+
+    uint16_t* tile = malloc(TILE_LENGTH);
+    if (!tile) abort();
+    for (int p = 0; p < TILE_WIDTH * TILE_HEIGHT; ++p) tile[p] = (uint16_t)((p / (TILE_WIDTH * 8)) * 0x1234);
+
+    char description[FIRMWARE_DESCRIPTION_SIZE] = "New firmware";
+    uint32_t checksum = 0;
+    fwrite(HEADER_V00_01, 1, strlen(HEADER_V00_01), f);
+    fwrite(description, 1, FIRMWARE_DESCRIPTION_SIZE, f);
+    fwrite(tile, 1, TILE_LENGTH, f);
+    fwrite(&checksum, 1, sizeof(checksum), f);
+    fclose(f);
+
+    atlas_tile_reads = 0;
+    if (!odroid_atlas_update(atlas, atlas_bench_name, atlas_bench_tile, NULL, MOCK_FILE_COUNT + 1, NULL) ||
+        atlas_tile_reads != 1 ||
+        !odroid_atlas_current(atlas, atlas_bench_name, NULL, MOCK_FILE_COUNT + 1))
+    {
+        ok = false;
+    }
+
+    struct stat grown;
+    if (stat(atlasPath, &grown) != 0 || grown.st_size - st.st_size >= TILE_LENGTH) ok = false;
+
+    // Both tiles of the last two records decoded from one read
+    memset(tile, 0, TILE_LENGTH);
+    atlas_tile_reads = 0;
+    atlas_read_ok = true;
+    if (!odroid_atlas_read(atlas, MOCK_FILE_COUNT - 1, 2, tile, &atlas_bench_check, NULL) || atlas_tile_reads != 2 || !atlas_read_ok) ok = false;
+
+    unlink(fullPath);
+    free(tile);
+
+    fprintf(stdout, "atlas_%d                bytes=%ld raw_bytes=%d page_reads=%zu fw_tile_reads=%u complete_us=%.0f new_tile_bytes=%ld%s\n",
+        MOCK_FILE_COUNT, (long)st.st_size, MOCK_FILE_COUNT * TILE_LENGTH, pageReads, (unsigned)fwReads, complete / 1e3,
+        (long)(grown.st_size - st.st_size), ok ? "" : " WRONG");
+    if (!ok) golden_mismatch++;
+}
+
+// Same length, same FNV-1a hash
+static const char* atlas_collision_names[] =
+{
+    "Game 0335786.fw",
+    "A firmware whose name is far too long to fit in an atlas record.fw",
+    "Game 1074240.fw",
+};
+
+static const char* atlas_collision_name(void* arg, int index)
+{
+    return atlas_collision_names[index];
+}
+
+static bool atlas_collision_tile(void* arg, const char* name, uint32_t* size, uint32_t* mtime, uint16_t* tile)
+{
+    ++atlas_tile_reads;
+    *size = 1;
+    *mtime = 2;
+    memset(tile, 0x5a, ODROID_ATLAS_TILE_SIZE);
+    return true;
+}
+
+// A file missing from the atlas must not get the tile of one whose name has
+// the same hash, before and after reloading. The long name is left out.
+static void atlas_collision_bench()
+{
+    char dir[64];
+    strcpy(dir, "/tmp/uguibench.atlas.XXXXXX");
+    if (!mkdtemp(dir)) abort();
+
+    odroid_atlas_t* a = odroid_atlas_open(dir);
+    atlas_tile_reads = 0;
+    bool ok = odroid_atlas_update(a, atlas_collision_name, atlas_collision_tile, NULL, 2, NULL) &&
+        atlas_tile_reads == 1 && odroid_atlas_count(a) == 1;
+
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        if (odroid_atlas_find(a, atlas_collision_names[0], 1, 2) != 0 ||
+            odroid_atlas_find(a, atlas_collision_names[2], 1, 2) != -1 ||
+            odroid_atlas_current(a, atlas_collision_name, NULL, 3) ||
+            !odroid_atlas_current(a, atlas_collision_name, NULL, 2))
+        {
+            ok = false;
+        }
+
+        odroid_atlas_close(a);
+        if (pass == 0) a = odroid_atlas_open(dir);
+    }
+
+    fprintf(stdout, "atlas_collision         records=1%s\n", ok ? "" : " WRONG");
+    if (!ok) golden_mismatch++;
+
+    char fullPath[128];
+    snprintf(fullPath, sizeof(fullPath), "%s/%s", dir, ODROID_ATLAS_FILE);
+    unlink(fullPath);
+    rmdir(dir);
+}
@@ -0,0 +1,356 @@
+// Menu screens over a directory of mock firmware: the catalog, the tile
+// loader and the install screens. Included from main.c.
+
+// ---- firmware screens
+#define MOCK_FILE_COUNT (12)
+static char mock_dir[64];
+static char* mock_files[MOCK_FILE_COUNT];
+static odroid_filelist_t* mock_list;
+
+static void mock_create()
+{
+    strcpy(mock_dir, "/tmp/uguibench.XXXXXX");
+    if (!mkdtemp(mock_dir)) abort();
+
+    uint16_t* tile = malloc(TILE_LENGTH);
+    if (!tile) abort();
+
+    for (int i = 0; i < MOCK_FILE_COUNT; ++i)
+    {
+        char name[32];
+        sprintf(name, "Firmware %02d.fw", i);
+        mock_files[i] = strdup(name);
+
+        char fullPath[128];
+        sprintf(fullPath, "%s/%s", mock_dir, name);
+
+        FILE* f = fopen(fullPath, "wb");
+        if (!f) abort();
+
+        char description[FIRMWARE_DESCRIPTION_SIZE] = {0};
+        sprintf(description, "Mock firmware %d", i);
+
+        for (int p = 0; p < TILE_WIDTH * TILE_HEIGHT; ++p)
+        {
+            tile[p] = (uint16_t)((p % TILE_WIDTH) * 0x0801 + (p / TILE_WIDTH) * 0x20 + i * 0x1111);
+        }
+
+        fwrite(HEADER_V00_01, 1, strlen(HEADER_V00_01), f);
+        fwrite(description, 1, FIRMWARE_DESCRIPTION_SIZE, f);
+        fwrite(tile, 1, TILE_LENGTH, f);
+
+        // No partitions, only the trailing checksum
+        uint32_t checksum = 0x12345678 + i;
+        fwrite(&checksum, 1, sizeof(checksum), f);
+        fclose(f);
+    }
+
+    free(tile);
+
+    ui_path = mock_dir;
+    odroid_sdcard_open(SD_CARD);
+    tileCache = odroid_tilecache_create(TILE_CACHE_COUNT, TILE_LENGTH);
+    if (!ui_tile_lock) ui_tile_init();
+
+    mock_list = odroid_filelist_scan(mock_dir, ".fw");
+    odroid_filelist_wait(mock_list, MOCK_FILE_COUNT);
+    while (!odroid_filelist_done(mock_list)) usleep(100);
+}
+
+// Until the tile loader has nothing left to do
+static void tile_wait()
+{
+    while (ui_tile_busy || ui_tile_queue_depth() > 0) usleep(20);
+}
+
+// Tiles of the first page, so menu scenes draw the same frame every time
+static void mock_warm()
+{
+    ui_draw_page(mock_list, MOCK_FILE_COUNT, 0);
+    tile_wait();
+}
+
+static void mock_destroy()
+{
+    ui_tile_cancel();
+    odroid_sdcard_flush_handles();
+    odroid_filelist_free(mock_list);
+    odroid_catalog_close(catalog);
+    catalog = NULL;
+    if (atlas) odroid_atlas_close(atlas);
+    atlas = NULL;
+    odroid_tilecache_free(tileCache);
+    tileCache = NULL;
+
+    char catalogPath[128];
+    sprintf(catalogPath, "%s/.catalog", mock_dir);
+    unlink(catalogPath);
+    sprintf(catalogPath, "%s/%s", mock_dir, ODROID_ATLAS_FILE);
+    unlink(catalogPath);
+
+    for (int i = 0; i < MOCK_FILE_COUNT; ++i)
+    {
+        char fullPath[128];
+        sprintf(fullPath, "%s/%s", mock_dir, mock_files[i]);
+        unlink(fullPath);
+        free(mock_files[i]);
+    }
+
+    rmdir(mock_dir);
+}
+
+// Cold: every entry is read from the .fw and written to .catalog.
+// Warm: a new session only stats the files.
+static void catalog_bench()
+{
+    double cold = 0;
+    double warm = 0;
+    bool ok = true;
+    odroid_sdcard_handle_stats_t before;
+
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        if (catalog) odroid_catalog_close(catalog);
+        catalog = odroid_catalog_open(mock_dir);
+        odroid_sdcard_handle_stats(&before);
+
+        double start = now_ns();
+        for (int i = 0; i < MOCK_FILE_COUNT; ++i)
+        {
+            odroid_catalog_info_t info;
+            if (!odroid_catalog_lookup(catalog, mock_files[i], &info) ||
+                info.status != ODROID_CATALOG_OK ||
+                info.tile_offset != strlen(HEADER_V00_01) + FIRMWARE_DESCRIPTION_SIZE ||
+                info.payload_size != 0 ||
+                info.checksum != 0x12345678 + i)
+            {
+                ok = false;
+            }
+        }
+        *(pass ? &warm : &cold) = now_ns() - start;
+    }
+
+    // The new session's checks are answered by the stat cache
+    odroid_sdcard_handle_stats_t after;
+    odroid_sdcard_handle_stats(&after);
+    const uint32_t warmStats = after.stat_lookups - before.stat_lookups;
+    if (warmStats != 0 || after.stat_hits - before.stat_hits != MOCK_FILE_COUNT) ok = false;
+
+    char description[FIRMWARE_DESCRIPTION_SIZE];
+    if (!odroid_catalog_description(catalog, mock_files[3], description, sizeof(description)) ||
+        strcmp(description, "Mock firmware 3") != 0)
+    {
+        ok = false;
+    }
+
+    fprintf(stdout, "catalog_%d             cold_us=%.0f warm_us=%.0f warm_card_stats=%u%s\n",
+        MOCK_FILE_COUNT, cold / 1e3, warm / 1e3, (unsigned)warmStats, ok ? "" : " WRONG");
+    if (!ok) golden_mismatch++;
+}
+
+// Same FNV-1a hash and length, as in atlas_collision
+static const char* catalog_collision_names[] =
+{
+    "Game 0335786.fw",
+    "Game 1074240.fw",
+};
+
+static const char* catalog_collision_name(void* arg, int index)
+{
+    return catalog_collision_names[index];
+}
+
+static void catalog_collision_write(const char* dir, int index, uint32_t checksum)
+{
+    char fullPath[128];
+    snprintf(fullPath, sizeof(fullPath), "%s/%s", dir, catalog_collision_names[index]);
+
+    FILE* f = fopen(fullPath, "wb");
+    if (!f) abort();
+
+    char head[FIRMWARE_DESCRIPTION_SIZE + TILE_LENGTH] = {0};
+    fwrite(HEADER_V00_01, 1, strlen(HEADER_V00_01), f);
+    fwrite(head, 1, sizeof(head), f);
+    fwrite(&checksum, 1, sizeof(checksum), f);
+    fclose(f);
+
+    // Same size and mtime every time
+    struct utimbuf times = { 1000000000, 1000000000 };
+    utime(fullPath, &times);
+}
+
+static bool catalog_collision_check(odroid_catalog_t* c, int index, uint32_t checksum)
+{
+    odroid_catalog_info_t info;
+    return odroid_catalog_lookup(c, catalog_collision_names[index], &info) &&
+        info.status == ODROID_CATALOG_OK && info.checksum == checksum;
+}
+
+// Two files whose names hash the same each get their own entry. A deleted
+// one is pruned even though the other remains: recreated with the same size
+// and mtime, it is read again.
+static void catalog_collision_bench()
+{
+    char dir[64];
+    strcpy(dir, "/tmp/uguibench.catalog.XXXXXX");
+    if (!mkdtemp(dir)) abort();
+
+    catalog_collision_write(dir, 0, 100);
+    catalog_collision_write(dir, 1, 101);
+
+    odroid_catalog_t* c = odroid_catalog_open(dir);
+    const size_t opens = host_fopens;
+    odroid_catalog_verify(c, catalog_collision_names, 2);
+    const size_t verifyOpens = host_fopens - opens;
+    bool ok = catalog_collision_check(c, 0, 100) && catalog_collision_check(c, 1, 101);
+    odroid_catalog_close(c);
+
+    char fullPath[128];
+    snprintf(fullPath, sizeof(fullPath), "%s/%s", dir, catalog_collision_names[1]);
+    unlink(fullPath);
+    odroid_sdcard_flush_handles();
+
+    c = odroid_catalog_open(dir);
+    odroid_catalog_prune(c, catalog_collision_name, NULL, 1);
+    odroid_catalog_close(c);
+
+    catalog_collision_write(dir, 1, 102);
+    odroid_sdcard_flush_handles();
+
+    c = odroid_catalog_open(dir);
+    ok = ok && catalog_collision_check(c, 1, 102) && catalog_collision_check(c, 0, 100);
+    odroid_catalog_close(c);
+    odroid_sdcard_flush_handles();
+
+    fprintf(stdout, "catalog_collision       verify_fopens=%zu%s\n", verifyOpens, ok ? "" : " WRONG");
+    if (!ok) golden_mismatch++;
+
+    for (int i = 0; i < 2; ++i)
+    {
+        snprintf(fullPath, sizeof(fullPath), "%s/%s", dir, catalog_collision_names[i]);
+        unlink(fullPath);
+    }
+    snprintf(fullPath, sizeof(fullPath), "%s/.catalog", dir);
+    unlink(fullPath);
+    rmdir(dir);
+}
+
+static void scene_menu_page(int i)
+{
+    ui_draw_page(mock_list, MOCK_FILE_COUNT, 1);
+}
+
+static void scene_menu_move(int i)
+{
+    // Highlight moving down one row inside a page
+    ui_draw_page(mock_list, MOCK_FILE_COUNT, i % ITEM_COUNT);
+}
+
+static void scene_menu_cold(int i)
+{
+    // Nothing cached: the page is drawn with placeholders
+    ui_tile_cancel();
+    odroid_tilecache_free(tileCache);
+    tileCache = odroid_tilecache_create(ITEM_COUNT, TILE_LENGTH);
+
+    ui_draw_page(mock_list, MOCK_FILE_COUNT, (i % 2) * ITEM_COUNT * 2);
+}
+
+static void tilecache_bench()
+{
+    odroid_tilecache_stats_t before;
+    odroid_tilecache_stats_t after;
+
+    odroid_tilecache_stats(tileCache, &before);
+    run("menu_move", scene_menu_move);
+    odroid_tilecache_stats(tileCache, &after);
+
+    fprintf(stdout, "menu_move_tiles          hits=%u misses=%u evictions=%u\n",
+        after.hits - before.hits, after.misses - before.misses, after.evictions - before.evictions);
+    if (after.misses != before.misses) golden_mismatch++;
+
+    odroid_tilecache_t* saved = tileCache;
+    tileCache = odroid_tilecache_create(ITEM_COUNT, TILE_LENGTH);
+    run("menu_page_cold", scene_menu_cold);
+    ui_tile_cancel();
+    odroid_tilecache_free(tileCache);
+
+    // First paint of an uncached page against the time until all of its tiles are shown
+    tileCache = odroid_tilecache_create(TILE_CACHE_COUNT, TILE_LENGTH);
+    double start = now_ns();
+    ui_draw_page(mock_list, MOCK_FILE_COUNT, ITEM_COUNT);
+    double paint = now_ns() - start;
+    bool pending = true;
+    while (pending)
+    {
+        ui_draw_pending_tiles(mock_list, ITEM_COUNT);
+        pending = false;
+        for (int line = 0; line < ITEM_COUNT; ++line)
+        {
+            if (ui_tile_pending[line]) pending = true;
+        }
+    }
+    double complete = now_ns() - start;
+
+    // Idle on that page, then RIGHT and LEFT
+    ui_tile_prefetch(mock_list, MOCK_FILE_COUNT, ITEM_COUNT);
+    tile_wait();
+    ui_draw_page(mock_list, MOCK_FILE_COUNT, ITEM_COUNT * 2);
+    ui_draw_page(mock_list, MOCK_FILE_COUNT, 0);
+
+    odroid_tilecache_stats_t stats;
+    odroid_tilecache_stats(tileCache, &stats);
+    fprintf(stdout, "tile_loader              first_paint_us=%.0f complete_us=%.0f queue_max=%d prefetch_hits=%u/%u\n",
+        paint / 1e3, complete / 1e3, ui_tile_queue_max, stats.prefetch_hits, stats.prefetches);
+    if (stats.prefetch_hits != 2 * ITEM_COUNT) golden_mismatch++;
+
+    odroid_tilecache_free(tileCache);
+    tileCache = saved;
+}
+
+static void scene_flash(int i)
+{
+    ui_draw_title();
+    DisplayHeader("Mock firmware");
+
+    uint16_t* tile = malloc(TILE_LENGTH);
+    if (!tile) abort();
+
+    char fullPath[128];
+    sprintf(fullPath, "%s/%s", mock_dir, mock_files[0]);
+    ui_firmware_image_get(fullPath, tile);
+
+    const uint16_t tileLeft = (320 / 2) - (TILE_WIDTH / 2);
+    const uint16_t tileTop = (16 + 16 + 16);
+    ui_draw_image(tileLeft, tileTop, TILE_WIDTH, TILE_HEIGHT, tile);
+    UG_DrawFrame(tileLeft - 1, tileTop - 1, tileLeft + TILE_WIDTH, tileTop + TILE_HEIGHT, C_BLACK);
+    free(tile);
+
+    ui_log_begin();
+    for (int offset = 0; offset < 64 * 4096; offset += 4096)
+    {
+        sprintf(tempstring, "Writing app (%d%%)", offset * 100 / (64 * 4096));
+        ui_install_progress(tempstring, offset, 64 * 4096);
+    }
+}
+
+static void scene_error(int i)
+{
+    if (i == 0) scene_menu_page(0);
+    DisplayError("HEADER MATCH ERROR");
+}
+
+static void scene_log(int i)
+{
+    // The install log alone, one line per 4 KB block
+    if (i == 0)
+    {
+        ui_draw_title();
+        ui_log_begin();
+    }
+
+    for (int n = 0; n < 64; ++n)
+    {
+        ui_log("Writing app (%d%%) - %#08x", n, n * 4096);
+    }
+}
@@ -0,0 +1,324 @@
+// Directory scan and file list sort. Included from main.c.
+
+// ---- directory scan
+#define SCAN_FILE_COUNT (10000)
+
+static void scan_bench()
+{
+    char dir[64];
+    strcpy(dir, "/tmp/uguibench.scan.XXXXXX");
+    if (!mkdtemp(dir)) abort();
+
+    // Names in scrambled order, plus some files that do not match
+    char fullPath[128];
+    for (int i = 0; i < SCAN_FILE_COUNT; ++i)
+    {
+        sprintf(fullPath, "%s/Game %05u.%s", dir, (unsigned)(i * 7919u % SCAN_FILE_COUNT), (i % 10) ? "fw" : "txt");
+        FILE* f = fopen(fullPath, "wb");
+        if (!f) abort();
+        fclose(f);
+    }
+
+    const size_t allocations = host_allocations;
+    double start = now_ns();
+    odroid_filelist_t* list = odroid_filelist_scan(dir, ".fw");
+    odroid_filelist_wait(list, ITEM_COUNT);
+    double first = now_ns() - start;
+
+    while (!odroid_filelist_done(list)) usleep(10);
+    double total = now_ns() - start;
+    const size_t scanAllocations = host_allocations - allocations;
+
+    int count = odroid_filelist_count(list);
+    bool sorted = true;
+    for (int i = 1; i < count; ++i)
+    {
+        if (odroid_filename_compare(odroid_filelist_name(list, i - 1), odroid_filelist_name(list, i)) > 0) sorted = false;
+    }
+
+    fprintf(stdout, "scan_%d                entries=%d first_page_us=%.0f total_us=%.0f allocations=%zu%s\n",
+        SCAN_FILE_COUNT, count, first / 1e3, total / 1e3, scanAllocations, sorted ? "" : " NOT SORTED");
+    if (!sorted || count != SCAN_FILE_COUNT - SCAN_FILE_COUNT / 10) golden_mismatch++;
+
+    odroid_filelist_free(list);
+
+    for (int i = 0; i < SCAN_FILE_COUNT; ++i)
+    {
+        sprintf(fullPath, "%s/Game %05u.%s", dir, (unsigned)(i * 7919u % SCAN_FILE_COUNT), (i % 10) ? "fw" : "txt");
+        unlink(fullPath);
+    }
+    rmdir(dir);
+}
+
+// The same library split into subdirectories: the top level lists only the
+// directories and opening one scans just its files
+#define SUBDIR_COUNT (10)
+
+static void subdir_bench()
+{
+    char dir[64];
+    strcpy(dir, "/tmp/uguibench.subdir.XXXXXX");
+    if (!mkdtemp(dir)) abort();
+
+    char fullPath[128];
+    for (int d = 0; d < SUBDIR_COUNT; ++d)
+    {
+        sprintf(fullPath, "%s/Set %d", dir, d);
+        if (mkdir(fullPath, 0700) != 0) abort();
+    }
+
+    for (int i = 0; i < SCAN_FILE_COUNT; ++i)
+    {
+        sprintf(fullPath, "%s/Set %d/Game %05d.fw", dir, i % SUBDIR_COUNT, i);
+        FILE* f = fopen(fullPath, "wb");
+        if (!f) abort();
+        fclose(f);
+    }
+
+    // A file at the top, listed after the directories
+    sprintf(fullPath, "%s/Another.fw", dir);
+    fclose(fopen(fullPath, "wb"));
+
+    double start = now_ns();
+    odroid_filelist_t* top = odroid_filelist_scan(dir, ".fw");
+    while (!odroid_filelist_done(top)) usleep(10);
+    double topTime = now_ns() - start;
+
+    bool ok = odroid_filelist_count(top) == SUBDIR_COUNT + 1;
+    for (int i = 0; i < odroid_filelist_count(top); ++i)
+    {
+        if (odroid_filelist_is_directory(top, i) != (i < SUBDIR_COUNT)) ok = false;
+    }
+    if (strcmp(odroid_filelist_name(top, 2), "Set 2") != 0) ok = false;
+
+    // Opened from the menu
+    char* subdir = ui_path_join(dir, odroid_filelist_name(top, 3));
+    start = now_ns();
+    odroid_filelist_t* files = odroid_filelist_scan(subdir, ".fw");
+    while (!odroid_filelist_done(files)) usleep(10);
+    double subdirTime = now_ns() - start;
+
+    const int count = odroid_filelist_count(files);
+    if (count != SCAN_FILE_COUNT / SUBDIR_COUNT || odroid_filelist_is_directory(files, 0)) ok = false;
+
+    fprintf(stdout, "scan_%d_subdirs        top_entries=%d top_us=%.0f dir_entries=%d dir_us=%.0f%s\n",
+        SCAN_FILE_COUNT, odroid_filelist_count(top), topTime / 1e3, count, subdirTime / 1e3, ok ? "" : " WRONG");
+    if (!ok) golden_mismatch++;
+
+    odroid_filelist_free(files);
+    odroid_filelist_free(top);
+    free(subdir);
+
+    for (int i = 0; i < SCAN_FILE_COUNT; ++i)
+    {
+        sprintf(fullPath, "%s/Set %d/Game %05d.fw", dir, i % SUBDIR_COUNT, i);
+        unlink(fullPath);
+    }
+    for (int d = 0; d < SUBDIR_COUNT; ++d)
+    {
+        sprintf(fullPath, "%s/Set %d", dir, d);
+        rmdir(fullPath);
+    }
+    sprintf(fullPath, "%s/Another.fw", dir);
+    unlink(fullPath);
+    rmdir(dir);
+}
+
+
+// ---- file list sort
+// The recursive Lomuto quicksort that was used before, for comparison
+static int lomuto_partition(char* arr[], int low, int high)
+{
+    char* pivot = arr[high];
+    int i = low - 1;
+    for (int j = low; j < high; j++)
+    {
+        if (strcasecmp(arr[j], pivot) < 0)
+        {
+            char* t = arr[++i];
+            arr[i] = arr[j];
+            arr[j] = t;
+        }
+    }
+    char* t = arr[i + 1];
+    arr[i + 1] = arr[high];
+    arr[high] = t;
+    return i + 1;
+}
+
+static void lomuto_sort(char* arr[], int low, int high)
+{
+    if (low < high)
+    {
+        int pi = lomuto_partition(arr, low, high);
+        lomuto_sort(arr, low, pi - 1);
+        lomuto_sort(arr, pi + 1, high);
+    }
+}
+
+static odroid_filelist_t* sort_list_create(char** names, int count)
+{
+    odroid_filelist_t* list = calloc(1, sizeof(odroid_filelist_t));
+    if (!list) abort();
+
+    list->lock = xSemaphoreCreateMutex();
+    for (int i = 0; i < count; ++i)
+    {
+        list_append(list, names[i], 0);
+    }
+    return list;
+}
+
+static void sort_list_free(odroid_filelist_t* list)
+{
+    for (int i = 0; i < list->chunk_count; ++i)
+    {
+        free(list->chunks[i]);
+    }
+    free(list->entries);
+    vSemaphoreDelete(list->lock);
+    free(list);
+}
+
+static void sort_bench()
+{
+    static const char* titles[] = {
+        "Super Mario Bros", "The Legend of Zelda", "tetris", "Donkey Kong", "Mega Man",
+        "Castlevania", "Metroid", "Final Fantasy", "Contra", "Kirby's Adventure",
+        "Game", "Track", "Pac-Man", "Dr. Mario", "Bomberman", "Ninja Gaiden",
+    };
+    static const char* tags[] = { "", " (USA)", " (Europe)", " (Japan) [!]", " v1.1", " (Rev 2)" };
+    static const char* orders[] = { "random", "sorted", "reverse" };
+    const int titleCount = sizeof(titles) / sizeof(titles[0]);
+    const int tagCount = sizeof(tags) / sizeof(tags[0]);
+
+    for (int count = 1000; count <= 10000; count *= 10)
+    {
+        // Unpadded numbers, so natural and plain ordering differ
+        char** names = malloc(count * sizeof(char*));
+        if (!names) abort();
+        for (int i = 0; i < count; ++i)
+        {
+            const int n = (int)((i * 7919u) % count);
+            char name[96];
+            sprintf(name, "%s %d%s.fw", titles[n % titleCount], n / titleCount + 1, tags[n % tagCount]);
+            names[i] = strdup(name);
+        }
+
+        free(names[0]);
+        free(names[1]);
+        names[0] = strdup("Game 10.fw");
+        names[1] = strdup("Game 2.fw");
+
+        odroid_filelist_t* reference = sort_list_create(names, count);
+        intro_sort(reference, reference->entries, count);
+
+        char** ordered = malloc(count * sizeof(char*));
+        if (!ordered) abort();
+
+        for (int order = 0; order < 3; ++order)
+        {
+            for (int i = 0; i < count; ++i)
+            {
+                if (order == 0) ordered[i] = names[i];
+                else if (order == 1) ordered[i] = (char*)entry_name(reference, &reference->entries[i]);
+                else ordered[i] = (char*)entry_name(reference, &reference->entries[count - 1 - i]);
+            }
+
+            odroid_filelist_t* list = sort_list_create(ordered, count);
+            double start = now_ns();
+            list_sort(list);
+            double sorted = now_ns() - start;
+
+            bool ok = true;
+            for (int i = 1; i < count; ++i)
+            {
+                if (entry_compare(list, &list->entries[i - 1], &list->entries[i]) > 0) ok = false;
+            }
+            sort_list_free(list);
+
+            start = now_ns();
+            lomuto_sort(ordered, 0, count - 1);
+            double old = now_ns() - start;
+
+            char label[32];
+            sprintf(label, "sort_%d_%s", count, orders[order]);
+            fprintf(stdout, "%-24s introsort_us=%.0f lomuto_us=%.0f%s\n",
+                label, sorted / 1e3, old / 1e3, ok ? "" : " NOT SORTED");
+            if (!ok) golden_mismatch++;
+        }
+
+        // Natural order
+        const int a = odroid_filelist_find(reference, "Game 2.fw");
+        const int b = odroid_filelist_find(reference, "Game 10.fw");
+        if (a < 0 || b < 0 || a > b)
+        {
+            fprintf(stdout, "sort_%d: \"Game 2.fw\" is not before \"Game 10.fw\"\n", count);
+            golden_mismatch++;
+        }
+
+        sort_list_free(reference);
+        free(ordered);
+        for (int i = 0; i < count; ++i)
+        {
+            free(names[i]);
+        }
+        free(names);
+    }
+}
+
+// Reaching the last letter group: page steps (one redraw each) against
+// jumps through the letter index
+static void jump_bench()
+{
+    static const char* titles[] = {
+        "Super Mario Bros", "The Legend of Zelda", "tetris", "Donkey Kong", "Mega Man",
+        "Castlevania", "Metroid", "Final Fantasy", "Contra", "Kirby's Adventure",
+        "1942", "Track", "Pac-Man", "Dr. Mario", "Bomberman", "Ninja Gaiden",
+    };
+    const int titleCount = sizeof(titles) / sizeof(titles[0]);
+    const int count = 10000;
+
+    char** names = malloc(count * sizeof(char*));
+    if (!names) abort();
+    for (int i = 0; i < count; ++i)
+    {
+        char name[96];
+        sprintf(name, "%s %d.fw", titles[i % titleCount], i / titleCount + 1);
+        names[i] = strdup(name);
+    }
+
+    odroid_filelist_t* list = sort_list_create(names, count);
+    list_sort(list);
+    list_index(list);
+
+    // Every jump must land on a new first letter
+    bool ok = true;
+    int groups = 0;
+    int item = 0;
+    do
+    {
+        const int next = odroid_filelist_next_group(list, item);
+        if (next != 0 && entry_group(&list->entries[next - 1]) == entry_group(&list->entries[next])) ok = false;
+        if (next != 0 && next <= item) ok = false;
+        item = next;
+        ++groups;
+    } while (item != 0 && groups <= FILELIST_GROUPS);
+
+    // "1942", b, c, d, f, k, m, n, p, s, t
+    if (groups != 11) ok = false;
+
+    const int last = odroid_filelist_previous_group(list, 0);
+    if (odroid_filelist_previous_group(list, last + 1) != last) ok = false;
+
+    int jumps = 0;
+    for (item = 0; item != last; ++jumps) item = odroid_filelist_next_group(list, item);
+
+    fprintf(stdout, "jump_%d                groups=%d page_redraws_to_last=%d jump_redraws_to_last=%d%s\n",
+        count, groups, last / ITEM_COUNT, jumps, ok ? "" : " WRONG");
+    if (!ok) golden_mismatch++;
+
+    sort_list_free(list);
+    for (int i = 0; i < count; ++i) free(names[i]);
+    free(names);
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include "host.h"
+
+typedef uint8_t BYTE;
+typedef uint16_t WORD;
+typedef uint32_t DWORD;
+typedef unsigned int UINT;
+
+typedef BYTE DSTATUS;
+typedef enum { RES_OK = 0, RES_ERROR, RES_WRPRT, RES_NOTRDY, RES_PARERR } DRESULT;
+
+#define CTRL_SYNC 0
+#define GET_SECTOR_COUNT 1
+#define GET_SECTOR_SIZE 2
+#define GET_BLOCK_SIZE 3
+#define CTRL_TRIM 4
+
+typedef struct
+{
+    DSTATUS (*init)(BYTE pdrv);
+    DSTATUS (*status)(BYTE pdrv);
+    DRESULT (*read)(BYTE pdrv, BYTE* buff, DWORD sector, UINT count);
+    DRESULT (*write)(BYTE pdrv, const BYTE* buff, DWORD sector, UINT count);
+    DRESULT (*ioctl)(BYTE pdrv, BYTE cmd, void* buff);
+} ff_diskio_impl_t;
+
+void ff_diskio_register(BYTE pdrv, const ff_diskio_impl_t* discio_impl);
+
+// The driver registered last, FATFS reads through it (see ff.h)
+extern ff_diskio_impl_t host_diskio;
@@ -0,0 +1,4 @@
+#pragma once
+#include "diskio_impl.h"
+
+BYTE ff_diskio_get_pdrv_card(const sdmmc_card_t* card);
@@ -0,0 +1,52 @@
+#pragma once
+#include "diskio_impl.h"
+
+// The part of FATFS used for batched reads. The volume is a table of files
+// and their cluster extents on host_card_image; reads go through host_diskio.
+typedef DWORD LBA_t;
+typedef DWORD FSIZE_t;
+
+typedef enum { FR_OK = 0, FR_DISK_ERR, FR_INT_ERR, FR_NOT_READY, FR_NO_FILE } FRESULT;
+#define FA_READ 0x01
+
+typedef struct
+{
+    WORD csize;         // sectors per cluster
+    LBA_t database;     // first sector of cluster 2
+} FATFS;
+
+typedef struct
+{
+    FATFS* fs;
+    DWORD sclust;
+    FSIZE_t objsize;
+} FFOBJID;
+
+#define HOST_FAT_EXTENTS (2)
+
+typedef struct
+{
+    const char* path;   // "0:/..."
+    uint32_t size;
+    DWORD clusters[HOST_FAT_EXTENTS];   // first cluster of each extent
+    DWORD lengths[HOST_FAT_EXTENTS];    // in clusters, 0 = unused
+} host_fat_file_t;
+
+typedef struct
+{
+    FFOBJID obj;
+    FSIZE_t fptr;
+    DWORD clust;
+    const host_fat_file_t* file;
+} FIL;
+
+#define f_size(fp) ((fp)->obj.objsize)
+
+FRESULT f_open(FIL* fp, const char* path, BYTE mode);
+FRESULT f_close(FIL* fp);
+FRESULT f_lseek(FIL* fp, FSIZE_t ofs);
+FRESULT f_read(FIL* fp, void* buff, UINT btr, UINT* br);
+
+extern FATFS host_fatfs;
+extern host_fat_file_t* host_fat_files;
+extern size_t host_fat_count;
@@ -0,0 +1,203 @@
+// Minimal stand-ins for the ESP-IDF / FreeRTOS APIs used by main/main.c so the
+// UI code can be built and measured on a Linux host.
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+#define portTICK_PERIOD_MS 1
+#define portMAX_DELAY 0xffffffff
+#define pdTRUE 1
+#define pdFALSE 0
+
+#define pdPASS pdTRUE
+
+void vTaskDelay(TickType_t ticks);
+
+// tasks run as threads, semaphores are POSIX semaphores
+typedef void* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+void vTaskDelete(TaskHandle_t task);
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t func, const char* name, uint32_t stack, void* arg, UBaseType_t priority, TaskHandle_t* handle, BaseType_t core);
+
+typedef struct host_semaphore* SemaphoreHandle_t;
+SemaphoreHandle_t xSemaphoreCreateBinary(void);
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max, UBaseType_t initial);
+SemaphoreHandle_t xSemaphoreCreateMutex(void);
+void vSemaphoreDelete(SemaphoreHandle_t sem);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem);
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t sem, BaseType_t* woken);
+
+typedef struct host_queue* QueueHandle_t;
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size);
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticks);
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t ticks);
+BaseType_t xQueueReset(QueueHandle_t queue);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue);
+
+// Interrupt handlers run on the thread that changes the pin
+#define IRAM_ATTR
+#define portYIELD_FROM_ISR()
+#include <pthread.h>
+typedef pthread_mutex_t portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED PTHREAD_MUTEX_INITIALIZER
+#define portENTER_CRITICAL(mux) pthread_mutex_lock(mux)
+#define portEXIT_CRITICAL(mux) pthread_mutex_unlock(mux)
+#define portENTER_CRITICAL_ISR(mux) pthread_mutex_lock(mux)
+#define portEXIT_CRITICAL_ISR(mux) pthread_mutex_unlock(mux)
+
+uint32_t esp_get_free_heap_size(void);
+void esp_restart(void);
+esp_err_t nvs_flash_init(void);
+
+#define MALLOC_CAP_DEFAULT (1<<12)
+#define MALLOC_CAP_8BIT (1<<2)
+#define MALLOC_CAP_DMA (1<<3)
+size_t heap_caps_get_largest_free_block(uint32_t caps);
+#define heap_caps_malloc(size, caps) malloc(size)
+#define heap_caps_free(ptr) free(ptr)
+
+int64_t esp_timer_get_time(void);
+
+// Each timer has a thread that runs the callback
+typedef struct host_timer* esp_timer_handle_t;
+typedef struct
+{
+    void (*callback)(void* arg);
+    void* arg;
+    int dispatch_method;
+    const char* name;
+    bool skip_unhandled_events;
+} esp_timer_create_args_t;
+esp_err_t esp_timer_create(const esp_timer_create_args_t* args, esp_timer_handle_t* out_handle);
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us);
+esp_err_t esp_timer_stop(esp_timer_handle_t timer);
+
+#define ESP_LOGI(tag, format, ...) ((void)(tag))
+#define ESP_LOGE(tag, format, ...) ((void)(tag))
+const char* esp_err_to_name(esp_err_t err);
+
+// SD card mount, the card is the host file system
+typedef int gpio_num_t;
+#define GPIO_NUM_4 4
+#define GPIO_NUM_13 13
+#define GPIO_NUM_14 14
+#define GPIO_NUM_21 21
+#define GPIO_NUM_25 25
+#define GPIO_NUM_27 27
+#define GPIO_NUM_32 32
+#define GPIO_NUM_33 33
+#define GPIO_NUM_34 34
+#define GPIO_NUM_35 35
+#define GPIO_MODE_INPUT 1
+#define GPIO_PULLUP_ONLY 0
+#define GPIO_INTR_ANYEDGE 3
+typedef void (*gpio_isr_t)(void* arg);
+esp_err_t gpio_set_direction(gpio_num_t pin, int mode);
+esp_err_t gpio_set_pull_mode(gpio_num_t pin, int pull);
+esp_err_t gpio_set_intr_type(gpio_num_t pin, int type);
+esp_err_t gpio_install_isr_service(int flags);
+esp_err_t gpio_isr_handler_add(gpio_num_t pin, gpio_isr_t handler, void* arg);
+int gpio_get_level(gpio_num_t pin);
+// Pins idle high (pull up), a pressed button pulls its pin low. Runs the
+// pin's interrupt handler if the level changes.
+void host_gpio_set(gpio_num_t pin, int level);
+#define VSPI_HOST 2
+typedef struct { int slot; int max_freq_khz; } sdmmc_host_t;
+#define SDSPI_HOST_DEFAULT() ((sdmmc_host_t){ 1, 20000 })
+typedef struct { int gpio_cs; int host_id; } sdspi_device_config_t;
+#define SDSPI_DEVICE_CONFIG_DEFAULT() ((sdspi_device_config_t){ -1, 1 })
+typedef struct { int mosi_io_num; int miso_io_num; int sclk_io_num; int quadwp_io_num; int quadhd_io_num; int max_transfer_sz; } spi_bus_config_t;
+typedef struct { bool format_if_mount_failed; int max_files; size_t allocation_unit_size; } esp_vfs_fat_sdmmc_mount_config_t;
+typedef struct { struct { uint32_t capacity; uint32_t sector_size; } csd; } sdmmc_card_t;
+esp_err_t esp_vfs_fat_sdspi_mount(const char* base_path, const sdmmc_host_t* host, const sdspi_device_config_t* slot, const esp_vfs_fat_sdmmc_mount_config_t* config, sdmmc_card_t** card);
+esp_err_t esp_vfs_fat_sdmmc_unmount(void);
+void sdmmc_card_print_info(FILE* stream, const sdmmc_card_t* card);
+esp_err_t sdmmc_read_sectors(sdmmc_card_t* card, void* dst, size_t start_block, size_t block_count);
+esp_err_t sdmmc_write_sectors(sdmmc_card_t* card, const void* src, size_t start_block, size_t block_count);
+
+// The card behind the mount: sectors in memory, card reads are counted
+extern sdmmc_card_t host_card;
+extern uint8_t* host_card_image;
+extern size_t host_card_reads;
+extern size_t host_card_seek;       // sectors between the end of a read and the next
+
+// LCD transfer time to model, 0 by default
+extern int host_lcd_ns_per_pixel;
+
+// heap calls made so far (malloc, calloc and realloc are wrapped)
+extern size_t host_allocations;
+// files opened so far (fopen is wrapped)
+extern size_t host_fopens;
+// printf of the firmware goes to stderr when set, else nowhere (printf is
+// wrapped): stdout only holds the report
+extern int host_verbose;
+
+// partitions
+typedef enum
+{
+    ESP_PARTITION_TYPE_APP = 0x00,
+    ESP_PARTITION_TYPE_DATA = 0x01,
+} esp_partition_type_t;
+
+typedef enum
+{
+    ESP_PARTITION_SUBTYPE_APP_FACTORY = 0x00,
+    ESP_PARTITION_SUBTYPE_APP_OTA_0 = 0x10,
+} esp_partition_subtype_t;
+
+typedef struct
+{
+    esp_partition_type_t type;
+    esp_partition_subtype_t subtype;
+    uint32_t address;
+    uint32_t size;
+    char label[17];
+} esp_partition_t;
+
+const esp_partition_t* esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype, const char* label);
+void esp_partition_unload_all(void);
+esp_err_t esp_ota_set_boot_partition(const esp_partition_t* partition);
+
+#define CONFIG_PARTITION_TABLE_OFFSET 0x8000
+#define ESP_PARTITION_MAGIC 0x50AA
+#define PART_SUBTYPE_TEST 0x20
+
+typedef struct
+{
+    uint32_t offset;
+    uint32_t size;
+} esp_partition_pos_t;
+
+typedef struct
+{
+    uint16_t magic;
+    uint8_t type;
+    uint8_t subtype;
+    esp_partition_pos_t pos;
+    uint8_t label[16];
+    uint32_t flags;
+} esp_partition_info_t;
+
+// flash, backed by a temporary file
+#define HOST_FLASH_SIZE (16 * 1024 * 1024)
+#define HOST_FLASH_ERASE_SIZE (4096)
+typedef struct esp_flash_t esp_flash_t;
+esp_err_t esp_flash_init(esp_flash_t* chip);
+esp_err_t esp_flash_get_size(esp_flash_t* chip, uint32_t* out_size);
+esp_err_t esp_flash_read(esp_flash_t* chip, void* buffer, uint32_t address, uint32_t length);
+esp_err_t esp_flash_write(esp_flash_t* chip, const void* buffer, uint32_t address, uint32_t length);
+esp_err_t esp_flash_erase_region(esp_flash_t* chip, uint32_t start, uint32_t len);
+
+uint32_t crc32_le(uint32_t crc, const uint8_t* buf, uint32_t len);
@@ -0,0 +1,478 @@
+// Buttons: debounce, repeat, latency to the panel and replayed sessions.
+// Included from main.c.
+
+// ---- input
+// Presses with contact bounce go through the edge interrupt, the debounce
+// timer and the event queue to a waiting reader. The same presses are also
+// run against a model of the 10 ms polling it replaced: a task sampling
+// twice per change and a menu loop polling the result.
+#define INPUT_PRESSES (20)
+#define INPUT_BOUNCES (3)
+#define INPUT_HOLD_US (20000)
+#define INPUT_POLL_MS (10)
+
+static const gpio_num_t input_bench_pins[ODROID_INPUT_MAX] =
+{
+    ODROID_GAMEPAD_IO_UP, ODROID_GAMEPAD_IO_RIGHT, ODROID_GAMEPAD_IO_DOWN, ODROID_GAMEPAD_IO_LEFT,
+    ODROID_GAMEPAD_IO_SELECT, ODROID_GAMEPAD_IO_START, ODROID_GAMEPAD_IO_A, ODROID_GAMEPAD_IO_B,
+    ODROID_GAMEPAD_IO_MENU, ODROID_GAMEPAD_IO_VOLUME,
+};
+
+static volatile int64_t input_press_time;
+static volatile bool input_driver_done;
+
+static void input_bounce(gpio_num_t pin, int level)
+{
+    for (int i = 0; i < INPUT_BOUNCES; ++i)
+    {
+        host_gpio_set(pin, level);
+        usleep(100);
+        host_gpio_set(pin, !level);
+        usleep(100);
+    }
+    host_gpio_set(pin, level);
+}
+
+static void input_driver(void* arg)
+{
+    for (int i = 0; i < INPUT_PRESSES; ++i)
+    {
+        const gpio_num_t pin = input_bench_pins[i % ODROID_INPUT_MAX];
+
+        input_press_time = esp_timer_get_time();
+        input_bounce(pin, 0);
+        usleep(INPUT_HOLD_US);
+        input_bounce(pin, 1);
+        usleep(INPUT_HOLD_US);
+    }
+
+    input_driver_done = true;
+    vTaskDelete(NULL);
+}
+
+static void input_driver_start()
+{
+    input_driver_done = false;
+    xTaskCreatePinnedToCore(&input_driver, "input_driver", 4096, NULL, 5, NULL, 0);
+}
+
+static volatile odroid_gamepad_state poll_state;
+static volatile uint32_t poll_wakeups;
+
+static void input_poll_task(void* arg)
+{
+    uint8_t debounce[ODROID_INPUT_MAX];
+    memset(debounce, 0xff, sizeof(debounce));
+
+    while (true)
+    {
+        odroid_gamepad_state state = input_read_raw();
+        for (int i = 0; i < ODROID_INPUT_MAX; ++i)
+        {
+            debounce[i] = (debounce[i] << 1) | (state.values[i] ? 1 : 0);
+            if ((debounce[i] & 0x03) == 0x00) poll_state.values[i] = 0;
+            if ((debounce[i] & 0x03) == 0x03) poll_state.values[i] = 1;
+        }
+
+        ++poll_wakeups;
+        vTaskDelay(INPUT_POLL_MS / portTICK_PERIOD_MS);
+    }
+}
+
+static void input_bench()
+{
+    input_init();
+    input_flush_events();
+
+    odroid_input_stats before;
+    input_get_stats(&before);
+    const uint32_t snapshotBefore = input_snapshot();
+
+    // Interrupts and events
+    bool ok = true;
+    int events = 0;
+    input_driver_start();
+    while (!input_driver_done || events < INPUT_PRESSES * 2)
+    {
+        odroid_input_event event;
+        if (!input_wait_event(&event, 1000)) break;
+
+        const int press = events / 2;
+        if (event.button != press % ODROID_INPUT_MAX || event.pressed != !(events & 1)) ok = false;
+        ++events;
+    }
+    if (events != INPUT_PRESSES * 2) ok = false;
+
+    odroid_input_stats after;
+    input_get_stats(&after);
+    const uint32_t eventAvg = (uint32_t)((after.latency_total_us - before.latency_total_us) / (after.received - before.received));
+
+    // All released again: every change was one the buttons do not show
+    odroid_gamepad_state snapshot;
+    input_read(&snapshot);
+    for (int i = 0; i < ODROID_INPUT_MAX; ++i)
+    {
+        if (snapshot.values[i]) ok = false;
+    }
+    const int missed = input_snapshot_missed(snapshotBefore, input_snapshot());
+    if (missed != INPUT_PRESSES * 2) ok = false;
+
+    const int reads = 1000000;
+    double start = now_ns();
+    for (int i = 0; i < reads; ++i) input_read(&snapshot);
+    const double readNs = (now_ns() - start) / reads;
+
+    usleep(100000);
+    input_get_stats(&before);
+    usleep(200000);
+    input_get_stats(&after);
+    const uint32_t idleWakeups = (after.wakeups - before.wakeups) * 5;
+
+    // Polling model, press latency only
+    xTaskCreatePinnedToCore(&input_poll_task, "input_poll", 4096, NULL, 5, NULL, 1);
+
+    int64_t pollTotal = 0;
+    int64_t pollMax = 0;
+    int pollPresses = 0;
+    odroid_gamepad_state previous = {0};
+    input_driver_start();
+    while (!input_driver_done)
+    {
+        for (int i = 0; i < ODROID_INPUT_MAX; ++i)
+        {
+            if (!previous.values[i] && poll_state.values[i])
+            {
+                const int64_t latency = esp_timer_get_time() - input_press_time;
+                pollTotal += latency;
+                if (latency > pollMax) pollMax = latency;
+                ++pollPresses;
+            }
+            previous.values[i] = poll_state.values[i];
+        }
+
+        ++poll_wakeups;
+        vTaskDelay(INPUT_POLL_MS / portTICK_PERIOD_MS);
+    }
+
+    poll_wakeups = 0;
+    usleep(200000);
+    const uint32_t pollIdleWakeups = poll_wakeups * 5 * 2;
+
+    fprintf(stdout, "input_%d_presses        latency_us_avg=%u max=%u idle_wakeups_per_sec=%u read_ns=%.1f missed=%d poll_latency_us_avg=%u max=%u poll_idle_wakeups_per_sec=%u%s\n",
+        INPUT_PRESSES, (unsigned)eventAvg, (unsigned)after.latency_max_us, (unsigned)idleWakeups, readNs, missed,
+        (unsigned)(pollPresses ? pollTotal / pollPresses : 0), (unsigned)pollMax, (unsigned)pollIdleWakeups,
+        ok ? "" : " WRONG");
+    if (!ok) golden_mismatch++;
+}
+
+
+// Presses answered with a full frame sent at the LCD's 16 bits per pixel at
+// 40 MHz, measured from the first edge to the end of the transfer
+#define LATENCY_LCD_NS_PER_PIXEL (400)
+
+static void latency_bench()
+{
+    odroid_latency_reset();
+    input_flush_events();
+    host_lcd_ns_per_pixel = LATENCY_LCD_NS_PER_PIXEL;
+
+    bool ok = true;
+    int presses = 0;
+    input_driver_start();
+    while (presses < INPUT_PRESSES)
+    {
+        odroid_input_event event;
+        if (!input_wait_event(&event, 1000))
+        {
+            ok = false;
+            break;
+        }
+
+        if (!event.pressed) continue;
+        ++presses;
+
+        odroid_latency_begin(event.time);
+        UG_FillScreen(event.button * 0x1111);
+        ui_update_display();
+    }
+
+    host_lcd_ns_per_pixel = 0;
+    while (!input_driver_done) usleep(1000);
+    usleep(INPUT_DEBOUNCE_US * 2);
+    input_flush_events();
+
+    odroid_latency_histogram_t histogram;
+    odroid_latency_get(&histogram);
+    const uint32_t p50 = odroid_latency_percentile(&histogram, 50);
+    const uint32_t p95 = odroid_latency_percentile(&histogram, 95);
+
+    // At least debounce and transfer, in order
+    const uint32_t least = INPUT_DEBOUNCE_US + 320 * 240 * LATENCY_LCD_NS_PER_PIXEL / 1000;
+    if (histogram.count != INPUT_PRESSES || p50 < least || p50 > p95 || p95 > histogram.max_us) ok = false;
+
+    fprintf(stdout, "latency_%d_presses      p50_us=%u p95_us=%u max_us=%u count=%u%s\n",
+        INPUT_PRESSES, (unsigned)p50, (unsigned)p95, (unsigned)histogram.max_us, (unsigned)histogram.count,
+        ok ? "" : " WRONG");
+    if (!ok) golden_mismatch++;
+}
+
+// DOWN held with the menu's repeat settings, taken by a loop whose page
+// draw takes REPEAT_DRAW_US. Coalesced, it draws once per burst of queued
+// repeats; otherwise once per repeat, falling behind once repeats come
+// faster than it draws.
+#define REPEAT_HOLD_US (2000000)
+#define REPEAT_DRAW_US (50000)
+
+static void repeat_hold(void* arg)
+{
+    input_bounce(ODROID_GAMEPAD_IO_DOWN, 0);
+    usleep(REPEAT_HOLD_US);
+    input_press_time = esp_timer_get_time();
+    input_bounce(ODROID_GAMEPAD_IO_DOWN, 1);
+
+    input_driver_done = true;
+    vTaskDelete(NULL);
+}
+
+static void repeat_run(bool coalesce, int* moves, int* draws, int* settleMs, bool* ok)
+{
+    input_flush_events();
+    input_driver_done = false;
+    xTaskCreatePinnedToCore(&repeat_hold, "repeat_hold", 4096, NULL, 5, NULL, 0);
+
+    *moves = 0;
+    *draws = 0;
+    bool redraw = false;
+    bool released = false;
+    int64_t lastDraw = 0;
+
+    while (!released || redraw)
+    {
+        odroid_input_event event;
+        if (!input_wait_event(&event, 1000))
+        {
+            *ok = false;
+            break;
+        }
+
+        if (event.button != ODROID_INPUT_DOWN) *ok = false;
+        if (event.pressed) ++*moves;
+        else released = true;
+        redraw = redraw || event.pressed;
+
+        if (redraw && (!coalesce || input_pending_events() == 0))
+        {
+            usleep(REPEAT_DRAW_US);
+            lastDraw = esp_timer_get_time();
+            redraw = false;
+            ++*draws;
+        }
+    }
+
+    *settleMs = (int)((lastDraw - input_press_time) / 1000);
+}
+
+static void repeat_bench()
+{
+    const odroid_input_repeat repeat = {
+        .buttons = 1 << ODROID_INPUT_DOWN,
+        .delay_us = UI_REPEAT_DELAY_MS * 1000,
+        .interval_us = UI_REPEAT_INTERVAL_MS * 1000,
+        .min_interval_us = UI_REPEAT_MIN_INTERVAL_MS * 1000,
+        .accel_percent = UI_REPEAT_ACCEL_PERCENT,
+    };
+    input_set_repeat(&repeat);
+
+    bool ok = true;
+    int moves, draws, settle;
+    int plainMoves, plainDraws, plainSettle;
+    repeat_run(true, &moves, &draws, &settle, &ok);
+    repeat_run(false, &plainMoves, &plainDraws, &plainSettle, &ok);
+
+    const odroid_input_repeat noRepeat = {0};
+    input_set_repeat(&noRepeat);
+
+    // Accelerating: more moves than the first interval alone gives
+    const int slowest = (REPEAT_HOLD_US - UI_REPEAT_DELAY_MS * 1000) / (UI_REPEAT_INTERVAL_MS * 1000) + 1;
+    if (moves <= slowest || plainMoves <= slowest) ok = false;
+
+    fprintf(stdout, "repeat_hold_%dms      moves=%d draws=%d settle_ms=%d plain_draws=%d plain_settle_ms=%d%s\n",
+        REPEAT_HOLD_US / 1000, moves, draws, settle, plainDraws, plainSettle, ok ? "" : " WRONG");
+    if (!ok) golden_mismatch++;
+}
+
+
+// ---- replayed menu session
+// The menu opened on 500 files with a recorded session on the card: RIGHT
+// tapped to the last page, DOWN to the last file, then A. The session is
+// recorded again while it is replayed, which must give the same events.
+#define REPLAY_FILE_COUNT (500)
+#define REPLAY_START_US (100000)
+// A tap each, held for half of it
+#define REPLAY_TAP_US (20000)
+
+static int replay_script_write(const char* path, uint32_t* endUs)
+{
+    FILE* f = fopen(path, "w");
+    if (!f) abort();
+
+    // To the last page, to its last file, open it
+    const int pages = REPLAY_FILE_COUNT / ITEM_COUNT - 1;
+    const int taps = pages + ITEM_COUNT - 1 + 1;
+
+    uint32_t time = REPLAY_START_US;
+    int count = 0;
+    for (int i = 0; i < taps; ++i)
+    {
+        const int button = i < pages ? ODROID_INPUT_RIGHT : i < taps - 1 ? ODROID_INPUT_DOWN : ODROID_INPUT_A;
+
+        fprintf(f, "input_event us=%u button=%d pressed=1\n", (unsigned)time, button);
+        fprintf(f, "input_event us=%u button=%d pressed=0\n", (unsigned)(time + REPLAY_TAP_US / 2), button);
+        time += REPLAY_TAP_US;
+        count += 2;
+    }
+    fclose(f);
+
+    *endUs = time;
+    return count;
+}
+
+// Events of the recording that match the script, up to the first
+// difference, and how much later than the script the last one was
+static int replay_compare(const char* scriptPath, const char* recordPath, int* driftUs)
+{
+    FILE* script = fopen(scriptPath, "r");
+    FILE* record = fopen(recordPath, "r");
+    if (!script || !record) abort();
+
+    int matched = 0;
+    *driftUs = 0;
+    char scriptLine[80];
+    char recordLine[80];
+    while (fgets(scriptLine, sizeof(scriptLine), script) && fgets(recordLine, sizeof(recordLine), record))
+    {
+        unsigned scriptTime, scriptButton, scriptPressed;
+        unsigned recordTime, recordButton, recordPressed;
+        if (sscanf(scriptLine, "input_event us=%u button=%u pressed=%u", &scriptTime, &scriptButton, &scriptPressed) != 3 ||
+            sscanf(recordLine, "input_event us=%u button=%u pressed=%u", &recordTime, &recordButton, &recordPressed) != 3 ||
+            scriptButton != recordButton || scriptPressed != recordPressed)
+        {
+            break;
+        }
+
+        *driftUs = (int)recordTime - (int)scriptTime;
+        ++matched;
+    }
+
+    fclose(script);
+    fclose(record);
+    return matched;
+}
+
+static volatile bool replay_chooser_done;
+
+// The user confirming the install the replay asks for
+static void replay_confirm_driver(void* arg)
+{
+    while (!replay_chooser_done)
+    {
+        if (input_replay_done())
+        {
+            input_bounce(input_bench_pins[ODROID_INPUT_A], 0);
+            usleep(INPUT_HOLD_US);
+            input_bounce(input_bench_pins[ODROID_INPUT_A], 1);
+        }
+        usleep(INPUT_HOLD_US * 5);
+    }
+
+    vTaskDelete(NULL);
+}
+
+static void replay_bench()
+{
+    char dir[64];
+    strcpy(dir, "/tmp/uguibench.replay.XXXXXX");
+    if (!mkdtemp(dir)) abort();
+
+    uint16_t* tile = malloc(TILE_LENGTH);
+    if (!tile) abort();
+    for (int i = 0; i < REPLAY_FILE_COUNT; ++i)
+    {
+        char fullPath[128];
+        sprintf(fullPath, "%s/Game %03d.fw", dir, i);
+        FILE* f = fopen(fullPath, "wb");
+        if (!f) abort();
+
+        char description[FIRMWARE_DESCRIPTION_SIZE] = {0};
+        sprintf(description, "Game %d", i);
+        for (int p = 0; p < TILE_WIDTH * TILE_HEIGHT; ++p) tile[p] = (uint16_t)(p * 0x0801 + i * 0x1111);
+
+        fwrite(HEADER_V00_01, 1, strlen(HEADER_V00_01), f);
+        fwrite(description, 1, FIRMWARE_DESCRIPTION_SIZE, f);
+        fwrite(tile, 1, TILE_LENGTH, f);
+        const uint32_t checksum = i;
+        fwrite(&checksum, 1, sizeof(checksum), f);
+        fclose(f);
+    }
+    free(tile);
+
+    char scriptPath[128];
+    char recordPath[128];
+    sprintf(scriptPath, "%s/input_replay.txt", dir);
+    sprintf(recordPath, "%s/input_record.txt", dir);
+    uint32_t scriptUs;
+    const int scriptEvents = replay_script_write(scriptPath, &scriptUs);
+
+    INPUT_REPLAY_PATH = scriptPath;
+    INPUT_RECORD_PATH = recordPath;
+    ui_replayed = false;
+
+    replay_chooser_done = false;
+    xTaskCreatePinnedToCore(&replay_confirm_driver, "replay_confirm", 4096, NULL, 5, NULL, 0);
+
+    odroid_latency_reset();
+    const size_t transfers = lcd_transfers;
+    const double start = now_ns();
+    const char* result = ui_choose_file(dir);
+    const double time = now_ns() - start;
+    replay_chooser_done = true;
+    usleep(INPUT_HOLD_US * 7);
+    const size_t frames = lcd_transfers - transfers;
+
+    odroid_latency_histogram_t histogram;
+    odroid_latency_get(&histogram);
+
+    // The replayed A release is the last event both have
+    int drift;
+    const int matched = replay_compare(scriptPath, recordPath, &drift);
+    const char* opened = result ? strrchr(result, '/') + 1 : "";
+    const bool ok = strcmp(opened, "Game 499.fw") == 0 && matched >= scriptEvents - 1;
+
+    fprintf(stdout, "replay_%d_files        ms=%.0f script_ms=%u drift_us=%d frames=%zu p50_us=%u p95_us=%u events=%d/%d opened='%s'%s\n",
+        REPLAY_FILE_COUNT, time / 1e6, (unsigned)(scriptUs / 1000), drift, frames,
+        (unsigned)odroid_latency_percentile(&histogram, 50), (unsigned)odroid_latency_percentile(&histogram, 95),
+        matched, scriptEvents, opened, ok ? "" : " WRONG");
+    if (!ok) golden_mismatch++;
+
+    free((char*)result);
+    odroid_catalog_close(catalog);
+    catalog = NULL;
+    if (atlas) odroid_atlas_close(atlas);
+    atlas = NULL;
+    input_flush_events();
+
+    // Firmware, catalog, atlas and the two sessions
+    DIR* d = opendir(dir);
+    if (!d) abort();
+    struct dirent* entry;
+    while ((entry = readdir(d)))
+    {
+        if (entry->d_name[0] == '.' && (!entry->d_name[1] || (entry->d_name[1] == '.' && !entry->d_name[2]))) continue;
+
+        char fullPath[512];
+        snprintf(fullPath, sizeof(fullPath), "%s/%s", dir, entry->d_name);
+        unlink(fullPath);
+    }
+    closedir(d);
+    rmdir(dir);
+}
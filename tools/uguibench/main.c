@@ -0,0 +1,308 @@
+// Host microbenchmarks and scene checksums for uGUI and the firmware menu.
+//
+// usage: uguibench [-v] [-c previous_output.txt] [-o image_dir] [-s storage_dir]
+//
+// Every line of output has the form
+//   <name> ops=<n> pixels=<n> ns_per_pixel=<x> mpixels_per_sec=<y> crc=<crc>
+// The crc is computed over the framebuffer after the scene was rendered once
+// from a cleared screen. Passing a previous output with -c compares the
+// checksums and reports scenes that render differently. With -o every scene
+// is also written to <image_dir>/<name>.ppm. -s only runs the menu's storage
+// benchmark, with its test file in storage_dir and a file as the flash. -v
+// shows the firmware's own log on stderr.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <utime.h>
+
+static const char* image_dir = NULL;
+
+#define UI_INPUT_SESSIONS
+#include "../../main/main.c"
+// Included for the sort benchmark, which needs its internals
+#include "../../main/odroid_filelist.c"
+
+// The disk driver odroid_sdcard installs at mount
+#include "diskio_impl.h"
+#include "ff.h"
+
+
+extern unsigned long crc32(unsigned long crc, const unsigned char* buf, unsigned int len);
+extern size_t lcd_pixels;
+extern size_t lcd_transfers;
+
+static size_t pixel_count;
+// Pixels written per op by scenes that bypass pset (image blits)
+static size_t scene_area;
+// Time per op of the last run
+static double last_ns_per_op;
+
+static void bench_pset(UG_S16 x, UG_S16 y, UG_COLOR color)
+{
+    fb[y * 320 + x] = color;
+    ++pixel_count;
+}
+
+static double now_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+
+// ---- golden checksums
+#define MAX_GOLDEN (64)
+static struct
+{
+    char name[64];
+    unsigned long crc;
+} golden[MAX_GOLDEN];
+static int golden_count = 0;
+static int golden_mismatch = 0;
+
+static void golden_load(const char* filename)
+{
+    FILE* f = fopen(filename, "r");
+    if (!f)
+    {
+        fprintf(stderr, "%s: could not open '%s'\n", __func__, filename);
+        exit(1);
+    }
+
+    char line[256];
+    while (fgets(line, sizeof(line), f) && golden_count < MAX_GOLDEN)
+    {
+        char* crc = strstr(line, "crc=");
+        if (!crc) continue;
+
+        sscanf(line, "%63s", golden[golden_count].name);
+        golden[golden_count].crc = strtoul(crc + 4, NULL, 16);
+        ++golden_count;
+    }
+
+    fclose(f);
+}
+
+static void golden_check(const char* name, unsigned long crc)
+{
+    for (int i = 0; i < golden_count; ++i)
+    {
+        if (strcmp(golden[i].name, name) == 0)
+        {
+            if (golden[i].crc != crc)
+            {
+                fprintf(stderr, "MISMATCH %s: expected=%08lx actual=%08lx\n", name, golden[i].crc, crc);
+                ++golden_mismatch;
+            }
+            return;
+        }
+    }
+}
+
+
+static void image_write(const char* name)
+{
+    char filename[256];
+    snprintf(filename, sizeof(filename), "%s/%s.ppm", image_dir, name);
+
+    FILE* f = fopen(filename, "wb");
+    if (!f)
+    {
+        fprintf(stderr, "%s: could not create '%s'\n", __func__, filename);
+        return;
+    }
+
+    fprintf(f, "P6\n320 240\n255\n");
+    for (int i = 0; i < 320 * 240; ++i)
+    {
+        uint16_t pixel = fb[i];
+        uint8_t rgb[3] = { (pixel >> 11) << 3, ((pixel >> 5) & 0x3f) << 2, (pixel & 0x1f) << 3 };
+        fwrite(rgb, 1, sizeof(rgb), f);
+    }
+
+    fclose(f);
+}
+
+
+// ---- benchmark runner
+typedef void (*scene_func)(int iteration);
+
+static unsigned long run(const char* name, scene_func func)
+{
+    // Reference render from a cleared framebuffer
+    memset(fb, 0, sizeof(fb));
+    pixel_count = 0;
+    scene_area = 0;
+    func(0);
+    unsigned long crc = crc32(0, (const unsigned char*)fb, sizeof(fb));
+    size_t pixels_per_op = pixel_count;
+    if (image_dir) image_write(name);
+
+    // Timed renders, at least 100ms
+    int ops = 0;
+    pixel_count = 0;
+    double start = now_ns();
+    double elapsed;
+    do
+    {
+        func(++ops);
+        elapsed = now_ns() - start;
+    } while (elapsed < 100e6 || ops < 4);
+
+    // Primitives that write the framebuffer directly do not go through
+    // pset; count their area instead.
+    size_t pixels = pixel_count ? pixel_count : pixels_per_op * ops;
+    if (!pixels) pixels = scene_area * ops;
+    if (!pixels) pixels = ops;
+
+    fprintf(stdout, "%-24s ops=%d pixels=%zu ns_per_op=%.0f ns_per_pixel=%.3f mpixels_per_sec=%.2f crc=%08lx\n",
+        name, ops, pixels, elapsed / ops, elapsed / pixels, pixels / elapsed * 1e3, crc);
+
+    golden_check(name, crc);
+    last_ns_per_op = elapsed / ops;
+    return crc;
+}
+
+
+// Checks by subsystem, sharing the runner above
+#include "ugui.c"
+#include "catalog.c"
+#include "atlas.c"
+#include "filelist.c"
+#include "storage.c"
+#include "input.c"
+
+
+int main(int argc, char* argv[])
+{
+    int opt;
+    const char* storage_dir = NULL;
+    while ((opt = getopt(argc, argv, "vc:o:s:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'v':
+                host_verbose = 1;
+                break;
+
+            case 'c':
+                golden_load(optarg);
+                break;
+
+            case 'o':
+                image_dir = optarg;
+                break;
+
+            case 's':
+                storage_dir = optarg;
+                break;
+
+            default:
+                fprintf(stderr, "usage: %s [-v] [-c previous_output.txt] [-o image_dir] [-s storage_dir]\n", argv[0]);
+                return 1;
+        }
+    }
+
+    VERSION = "Ver: uguibench";
+
+    for (int i = 0; i < 64 * 64; ++i)
+    {
+        bmp_data[i] = (uint16_t)(i * 33);
+
+        // Radial falloff
+        int dx = (i % 64) - 32;
+        int dy = (i / 64) - 32;
+        int d = dx * dx + dy * dy;
+        alpha_data[i] = d >= 1024 ? 0 : 255 - (d * 255 / 1024);
+    }
+
+    for (int i = 0; i < 320 * 240; ++i)
+    {
+        screen_copy[i] = (uint16_t)(i * 2654435761u >> 16);
+    }
+
+    UG_Init(&gui, bench_pset, 320, 240);
+    UG_SetFramebuffer(fb);
+
+    if (storage_dir)
+    {
+        storage_run(storage_dir);
+        return golden_mismatch ? 1 : 0;
+    }
+
+    run("fill_screen", scene_fill);
+    run("fill_8x8", scene_fill_small);
+    run("line", scene_line);
+    run("frame", scene_frame);
+    run("circle", scene_circle);
+    run("fill_circle", scene_fill_circle);
+    run("glyph_8x12", scene_glyph_8x12);
+    run("glyph_22x36", scene_glyph_22x36);
+    run("glyph_32x53", scene_glyph_32x53);
+    run("string_8x12", scene_string);
+    run("bmp_64x64", scene_bmp);
+    run("image_64x64", scene_image);
+    run("window_update", scene_window);
+    font_compare("font_22x36", &FONT_22X36, scene_glyph_22x36);
+    font_compare("font_32x53", &FONT_32X53, scene_glyph_32x53);
+    run("memcpy_screen", scene_memcpy);
+    run("dim_screen", scene_dim);
+    run("blend_screen", scene_blend);
+    run("blend_odd", scene_blend_odd);
+    run("image_alpha_64x64", scene_image_alpha);
+
+    mock_create();
+    catalog_bench();
+    catalog_collision_bench();
+    stat_collision_bench();
+    mock_warm();
+
+    lcd_pixels = 0;
+    lcd_transfers = 0;
+    unsigned long menu_crc = run("menu_page", scene_menu_page);
+    tilecache_bench();
+    run("flash_screen", scene_flash);
+    run("install_log", scene_log);
+    run("error_overlay", scene_error);
+    fprintf(stdout, "lcd pixels=%zu transfers=%zu\n", lcd_pixels, lcd_transfers);
+
+    // Same page recorded once and replayed in two bands by two threads
+    ui_banded_init();
+    if (run("menu_page_banded", scene_menu_page) != menu_crc)
+    {
+        fprintf(stdout, "menu_page_banded: output differs from menu_page\n");
+        golden_mismatch++;
+    }
+
+    atlas_bench();
+    atlas_collision_bench();
+    mock_destroy();
+
+    scan_bench();
+    subdir_bench();
+    sort_bench();
+    jump_bench();
+    stream_bench();
+    sdcache_bench();
+    batch_bench();
+    spibus_bench();
+    storage_bench();
+    input_bench();
+    repeat_bench();
+    latency_bench();
+    replay_bench();
+
+    if (golden_mismatch)
+    {
+        fprintf(stderr, "%d scene(s) differ.\n", golden_mismatch);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,649 @@
+// Card access: stat cache, streaming, the sector cache, batched reads, the
+// SPI bus arbiter and the storage benchmark. Included from main.c.
+
+// ---- stat cache
+// Same FNV-1a as odroid_sdcard, to find two paths it cannot tell apart
+static uint32_t stat_path_hash(const char* path)
+{
+    uint32_t hash = 2166136261u;
+    for (; *path; ++path)
+    {
+        hash ^= (uint8_t)*path;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Two files whose paths hash the same and have the same length: each must
+// get its own size
+static void stat_collision_bench()
+{
+    const int tableSize = 1 << 22;
+    uint32_t* hashes = calloc(tableSize, sizeof(uint32_t));
+    uint32_t* indexes = calloc(tableSize, sizeof(uint32_t));
+    if (!hashes || !indexes) abort();
+
+    char paths[2][128];
+    int tried = 0;
+    bool found = false;
+    for (uint32_t i = 1; !found && i < (uint32_t)tableSize / 2; ++i)
+    {
+        snprintf(paths[0], sizeof(paths[0]), "%s/stat %07u.fw", mock_dir, (unsigned)i);
+        const uint32_t hash = stat_path_hash(paths[0]);
+
+        uint32_t at = hash & (tableSize - 1);
+        while (indexes[at] && hashes[at] != hash) at = (at + 1) & (tableSize - 1);
+        if (indexes[at])
+        {
+            snprintf(paths[1], sizeof(paths[1]), "%s/stat %07u.fw", mock_dir, (unsigned)indexes[at]);
+            found = true;
+        }
+        hashes[at] = hash;
+        indexes[at] = i;
+        ++tried;
+    }
+    free(hashes);
+    free(indexes);
+    if (!found) abort();
+
+    for (int i = 0; i < 2; ++i)
+    {
+        FILE* f = fopen(paths[i], "wb");
+        if (!f) abort();
+        for (int j = 0; j <= i; ++j) fputc('x', f);
+        fclose(f);
+    }
+
+    struct stat st[2];
+    const bool ok = odroid_sdcard_stat(paths[0], &st[0]) && odroid_sdcard_stat(paths[1], &st[1]) &&
+        st[0].st_size == 1 && st[1].st_size == 2 &&
+        odroid_sdcard_stat(paths[0], &st[0]) && st[0].st_size == 1;
+
+    fprintf(stdout, "stat_collision          tried=%d%s\n", tried, ok ? "" : " WRONG");
+    if (!ok) golden_mismatch++;
+
+    unlink(paths[0]);
+    unlink(paths[1]);
+}
+
+
+// ---- streaming reads
+#define STREAM_FILE_SIZE (8 * 1024 * 1024)
+
+static void stream_bench()
+{
+    char fileName[64];
+    strcpy(fileName, "/tmp/uguibench.stream.XXXXXX");
+    int fd = mkstemp(fileName);
+    if (fd < 0) abort();
+
+    uint8_t* block = malloc(4096);
+    if (!block) abort();
+    for (int i = 0; i < STREAM_FILE_SIZE / 4096; ++i)
+    {
+        for (int j = 0; j < 4096; ++j) block[j] = (uint8_t)(i * 31 + j * 7);
+        if (write(fd, block, 4096) != 4096) abort();
+    }
+    close(fd);
+
+    // An unaligned range, as for a partition inside a .fw
+    const size_t offset = 1000;
+    const size_t length = STREAM_FILE_SIZE - offset - 3;
+
+    // Previous path: 4 KB freads through stdio
+    double start = now_ns();
+    FILE* f = fopen(fileName, "rb");
+    fseek(f, offset, SEEK_SET);
+    unsigned long freadCrc = 0;
+    size_t remaining = length;
+    while (remaining > 0)
+    {
+        size_t count = fread(block, 1, remaining < 4096 ? remaining : 4096, f);
+        if (count == 0) break;
+        freadCrc = crc32(freadCrc, block, count);
+        remaining -= count;
+    }
+    fclose(f);
+    double freadTime = now_ns() - start;
+
+    start = now_ns();
+    odroid_sdcard_stream_t* stream = odroid_sdcard_stream_open(fileName, offset, length, ODROID_SDCARD_STREAM_CHUNK, NULL);
+    unsigned long streamCrc = 0;
+    size_t streamBytes = 0;
+    size_t count;
+    const void* chunk;
+    while ((chunk = odroid_sdcard_stream_next(stream, &count)) != NULL)
+    {
+        streamCrc = crc32(streamCrc, chunk, count);
+        streamBytes += count;
+    }
+    bool ok = odroid_sdcard_stream_ok(stream) && streamBytes == length && streamCrc == freadCrc;
+    odroid_sdcard_stream_close(stream);
+    double streamTime = now_ns() - start;
+
+    // Past the end of the file must fail
+    stream = odroid_sdcard_stream_open(fileName, STREAM_FILE_SIZE - 100, 200, ODROID_SDCARD_STREAM_CHUNK, NULL);
+    while (odroid_sdcard_stream_next(stream, &count) != NULL);
+    if (odroid_sdcard_stream_ok(stream)) ok = false;
+    odroid_sdcard_stream_close(stream);
+
+    fprintf(stdout, "stream_%dmb              fread_4k_mb_per_sec=%.0f stream_mb_per_sec=%.0f%s\n",
+        STREAM_FILE_SIZE / (1024 * 1024), length / (freadTime / 1e3), length / (streamTime / 1e3), ok ? "" : " WRONG");
+    if (!ok) golden_mismatch++;
+
+    free(block);
+    unlink(fileName);
+}
+
+
+// ---- sector cache below FATFS
+// The disk reads FATFS makes while browsing pages of a directory: directory
+// sectors while opening each file, then the tile at the catalog offset (a
+// partial first sector, whole sectors read directly, a partial last one).
+// Then a file read in small pieces, as stdio does.
+#define SDCACHE_CARD_SECTORS (16384)
+#define SDCACHE_FILES (40)
+#define SDCACHE_DIR_SECTOR (200)
+#define SDCACHE_DATA_SECTOR (1024)
+
+static int sdcache_requests;
+static bool sdcache_ok;
+
+static void sdcache_read(uint32_t sector, uint32_t count)
+{
+    static uint8_t buffer[32 * 512];
+
+    ++sdcache_requests;
+    if (host_diskio.read(0, buffer, sector, count) != RES_OK ||
+        memcmp(buffer, host_card_image + sector * 512, count * 512) != 0)
+    {
+        sdcache_ok = false;
+    }
+}
+
+static void sdcache_trace()
+{
+    for (int round = 0; round < 3; ++round)
+    {
+        for (int step = 0; step < 2 * SDCACHE_FILES / ITEM_COUNT; ++step)
+        {
+            // Forward through the pages, then back
+            const int page = (step < SDCACHE_FILES / ITEM_COUNT) ? step : 2 * SDCACHE_FILES / ITEM_COUNT - 1 - step;
+            for (int file = page * ITEM_COUNT; file < (page + 1) * ITEM_COUNT; ++file)
+            {
+                for (int dir = 0; dir <= file / 16; ++dir) sdcache_read(SDCACHE_DIR_SECTOR + dir, 1);
+
+                const uint32_t data = SDCACHE_DATA_SECTOR + ((file * 7919) % 200) * 32;
+                sdcache_read(data, 1);
+                sdcache_read(data + 1, 16);
+                sdcache_read(data + 17, 1);
+            }
+        }
+    }
+
+    // 32 KB in small pieces
+    for (int i = 0; i < 64; ++i) sdcache_read(SDCACHE_DATA_SECTOR + 8000 + i, 1);
+}
+
+static void sdcache_bench()
+{
+    host_card.csd.capacity = SDCACHE_CARD_SECTORS;
+    host_card_image = malloc(SDCACHE_CARD_SECTORS * 512);
+    if (!host_card_image) abort();
+    for (size_t i = 0; i < SDCACHE_CARD_SECTORS * 512; ++i) host_card_image[i] = (uint8_t)(i * 2654435761u >> 24);
+
+    // Mounted by mock_create
+    odroid_sdcard_cache_resize(0);
+    sdcache_ok = true;
+
+    // No cache: every request goes to the card
+    host_card_reads = 0;
+    sdcache_requests = 0;
+    sdcache_trace();
+    const size_t uncached = host_card_reads;
+
+    odroid_sdcard_cache_resize(ODROID_SDCARD_CACHE_SECTORS);
+    odroid_sdcard_cache_stats_t before;
+    odroid_sdcard_cache_stats(&before);
+
+    host_card_reads = 0;
+    sdcache_requests = 0;
+    sdcache_trace();
+    const size_t cached = host_card_reads;
+
+    odroid_sdcard_cache_stats_t stats;
+    odroid_sdcard_cache_stats(&stats);
+    const uint32_t hits = stats.hits - before.hits;
+    const uint32_t misses = stats.misses - before.misses;
+
+    // Written sectors read back as written
+    uint8_t sector[512];
+    memset(sector, 0x5a, sizeof(sector));
+    if (host_diskio.write(0, sector, SDCACHE_DIR_SECTOR, 1) != RES_OK) sdcache_ok = false;
+    sdcache_read(SDCACHE_DIR_SECTOR, 1);
+
+    fprintf(stdout, "sdcache_%d_sectors      requests=%d uncached_card_reads=%zu card_reads=%zu hit_rate=%.0f%% readahead_hits=%u/%u%s\n",
+        ODROID_SDCARD_CACHE_SECTORS, sdcache_requests - 1, uncached, cached, hits * 100.0 / (hits + misses),
+        (unsigned)(stats.readahead_hits - before.readahead_hits), (unsigned)(stats.readahead - before.readahead),
+        sdcache_ok ? "" : " WRONG");
+    if (!sdcache_ok) golden_mismatch++;
+
+    odroid_sdcard_cache_resize(0);
+    free(host_card_image);
+    host_card_image = NULL;
+}
+
+
+// ---- Batched reads
+// Files were copied to the card in some other order than their names, so
+// the headers and checksums of a directory in list order are scattered.
+// Every tenth file is in two pieces; a read across the gap is not one run.
+#define BATCH_FILES (200)
+#define BATCH_FILE_CLUSTERS (6)
+#define BATCH_FILE_SIZE (BATCH_FILE_CLUSTERS * 4096 - 300)
+#define BATCH_HEAD (64)
+
+static host_fat_file_t batch_files[BATCH_FILES];
+static odroid_sdcard_read_t batch_requests[BATCH_FILES * 3];
+static uint8_t batch_data[BATCH_FILES * 3][1024];
+static int batch_request_count;
+static int batch_done_count;
+
+static uint8_t batch_byte(int file, uint32_t offset)
+{
+    return (uint8_t)((file * 131 + offset) * 2654435761u >> 24);
+}
+
+static void batch_done(odroid_sdcard_read_t* request, void* arg)
+{
+    ++batch_done_count;
+}
+
+static void batch_add(const char* path, uint32_t offset, uint32_t length)
+{
+    odroid_sdcard_read_t* request = &batch_requests[batch_request_count];
+    request->path = path;
+    request->offset = offset;
+    request->length = length;
+    request->buffer = batch_data[batch_request_count];
+    ++batch_request_count;
+}
+
+static bool batch_check()
+{
+    for (int i = 0; i < batch_request_count; ++i)
+    {
+        const odroid_sdcard_read_t* request = &batch_requests[i];
+        const int file = i / 3;
+        if (!request->ok || request->count != request->length) return false;
+
+        for (uint32_t j = 0; j < request->count; ++j)
+        {
+            if (((uint8_t*)request->buffer)[j] != batch_byte(file, request->offset + j)) return false;
+        }
+    }
+    return true;
+}
+
+static void batch_bench()
+{
+    const size_t clusters = BATCH_FILES * (BATCH_FILE_CLUSTERS + 1);
+    host_card.csd.capacity = host_fatfs.database + clusters * host_fatfs.csize;
+    host_card_image = calloc(host_card.csd.capacity, 512);
+    if (!host_card_image) abort();
+
+    // Copy order: a permutation of the names
+    DWORD next = 2;
+    for (int n = 0; n < BATCH_FILES; ++n)
+    {
+        const int i = (n * 73) % BATCH_FILES;
+        host_fat_file_t* file = &batch_files[i];
+
+        char path[64];
+        sprintf(path, "0:/batch/Game %03d.fw", i);
+        file->path = strdup(path);
+        file->size = BATCH_FILE_SIZE;
+
+        if (i % 10 == 0)
+        {
+            // Two pieces with a free cluster between
+            file->clusters[0] = next;
+            file->lengths[0] = BATCH_FILE_CLUSTERS / 2;
+            file->clusters[1] = next + BATCH_FILE_CLUSTERS / 2 + 1;
+            file->lengths[1] = BATCH_FILE_CLUSTERS - BATCH_FILE_CLUSTERS / 2;
+            next += BATCH_FILE_CLUSTERS + 1;
+        }
+        else
+        {
+            file->clusters[0] = next;
+            file->lengths[0] = BATCH_FILE_CLUSTERS;
+            next += BATCH_FILE_CLUSTERS;
+        }
+
+        for (uint32_t offset = 0; offset < file->size; ++offset)
+        {
+            const DWORD cluster = offset / 4096 < file->lengths[0] ? file->clusters[0] + offset / 4096 : file->clusters[1] + offset / 4096 - file->lengths[0];
+            host_card_image[(host_fatfs.database + (cluster - 2) * host_fatfs.csize) * 512 + offset % 4096] = batch_byte(i, offset);
+        }
+    }
+    host_fat_files = batch_files;
+    host_fat_count = BATCH_FILES;
+
+    // Head, checksum and a piece in the middle of each file, in name order
+    char* paths[BATCH_FILES];
+    batch_request_count = 0;
+    for (int i = 0; i < BATCH_FILES; ++i)
+    {
+        char path[64];
+        sprintf(path, "%s/batch/Game %03d.fw", SD_CARD, i);
+        paths[i] = strdup(path);
+
+        batch_add(paths[i], 0, BATCH_HEAD);
+        batch_add(paths[i], BATCH_FILE_SIZE - 4, 4);
+        batch_add(paths[i], BATCH_FILE_CLUSTERS / 2 * 4096 - 512, 1024);
+    }
+
+    // The card as it is read, no sector cache
+    odroid_sdcard_cache_resize(0);
+
+    // One request at a time, in list order
+    host_card_reads = 0;
+    host_card_seek = 0;
+    for (int i = 0; i < batch_request_count; ++i) odroid_sdcard_read_batch(&batch_requests[i], 1, NULL, NULL);
+    const size_t listReads = host_card_reads;
+    const size_t listSeek = host_card_seek;
+    bool ok = batch_check();
+
+    memset(batch_data, 0, sizeof(batch_data));
+
+    odroid_sdcard_batch_stats_t before;
+    odroid_sdcard_batch_stats(&before);
+
+    host_card_reads = 0;
+    host_card_seek = 0;
+    batch_done_count = 0;
+    size_t succeeded = odroid_sdcard_read_batch(batch_requests, batch_request_count, &batch_done, NULL);
+    const size_t batchReads = host_card_reads;
+    const size_t batchSeek = host_card_seek;
+    if (!batch_check() || succeeded != batch_request_count || batch_done_count != batch_request_count) ok = false;
+
+    odroid_sdcard_batch_stats_t stats;
+    odroid_sdcard_batch_stats(&stats);
+
+    fprintf(stdout, "batch_%d_requests      list_card_reads=%zu list_seek_sectors=%zu card_reads=%zu seek_sectors=%zu runs=%u fallbacks=%u%s\n",
+        batch_request_count, listReads, listSeek, batchReads, batchSeek,
+        (unsigned)(stats.card_reads - before.card_reads), (unsigned)(stats.fallbacks - before.fallbacks),
+        ok ? "" : " WRONG");
+    if (!ok) golden_mismatch++;
+
+    for (int i = 0; i < BATCH_FILES; ++i)
+    {
+        free(paths[i]);
+        free((char*)batch_files[i].path);
+    }
+    host_fat_files = NULL;
+    host_fat_count = 0;
+    free(host_card_image);
+    host_card_image = NULL;
+}
+
+
+// ---- SPI bus arbiter model
+// The LCD (40 MHz) and the SD card (20 MHz) share VSPI. Transfers are modelled
+// by holding the bus for as long as the bytes take on the wire, the scheduling
+// is done by the real odroid_spibus. An install reads a file through the
+// stream while the progress area of the screen is redrawn periodically. The
+// card driver takes the bus for each burst it reads.
+#define SPIBUS_SD_NS_PER_BYTE (400)
+#define SPIBUS_SD_COMMAND_NS (150000)   // command and card latency per read
+#define SPIBUS_LCD_NS_PER_BYTE (200)
+#define SPIBUS_SD_BYTES (512 * 1024)
+#define SPIBUS_LCD_UPDATE_BYTES (320 * 48 * 2)
+#define SPIBUS_LCD_PERIOD_NS (33000000)
+
+static bool spibus_whole;           // hold the bus for whole jobs, as before
+static volatile bool spibus_sd_done;
+static volatile uint32_t spibus_sd_reads;
+static double spibus_sd_time;
+static SemaphoreHandle_t spibus_sd_exited;
+
+static void spibus_transfer(double ns)
+{
+    struct timespec ts = { 0, (long)ns };
+    nanosleep(&ts, NULL);
+}
+
+static void spibus_sd_task(void* arg)
+{
+    double start = now_ns();
+
+    for (size_t done = 0; done < SPIBUS_SD_BYTES; done += ODROID_SDCARD_STREAM_CHUNK)
+    {
+        size_t count = 0;
+        while (count < ODROID_SDCARD_STREAM_CHUNK)
+        {
+            size_t burst = spibus_whole ? ODROID_SDCARD_STREAM_CHUNK : odroid_spibus_burst(ODROID_SPIBUS_SD);
+            if (burst > ODROID_SDCARD_STREAM_CHUNK - count) burst = ODROID_SDCARD_STREAM_CHUNK - count;
+
+            odroid_spibus_acquire(ODROID_SPIBUS_SD);
+            spibus_transfer(SPIBUS_SD_COMMAND_NS + (double)burst * SPIBUS_SD_NS_PER_BYTE);
+            odroid_spibus_release(ODROID_SPIBUS_SD);
+
+            __atomic_add_fetch(&spibus_sd_reads, 1, __ATOMIC_RELAXED);
+            count += burst;
+        }
+    }
+
+    spibus_sd_time = now_ns() - start;
+    spibus_sd_done = true;
+    xSemaphoreGive(spibus_sd_exited);
+    vTaskDelete(NULL);
+}
+
+static void spibus_model(const char* name, bool whole, odroid_spibus_client_t priority)
+{
+    spibus_whole = whole;
+    spibus_sd_done = false;
+    odroid_spibus_set_priority(priority);
+    odroid_spibus_reset_stats();
+
+    if (xTaskCreatePinnedToCore(&spibus_sd_task, "sd", 4096, NULL, 4, NULL, 1) != pdPASS) abort();
+
+    int updates = 0;
+    int interleaved = 0;
+    double maxLatency = 0;
+    while (!spibus_sd_done)
+    {
+        double start = now_ns();
+        uint32_t reads = spibus_sd_reads;
+
+        odroid_spibus_acquire(ODROID_SPIBUS_LCD);
+        size_t sent = 0;
+        while (sent < SPIBUS_LCD_UPDATE_BYTES)
+        {
+            if (sent > 0) odroid_spibus_yield(ODROID_SPIBUS_LCD);
+
+            size_t burst = whole ? SPIBUS_LCD_UPDATE_BYTES : odroid_spibus_burst(ODROID_SPIBUS_LCD);
+            if (burst > SPIBUS_LCD_UPDATE_BYTES - sent) burst = SPIBUS_LCD_UPDATE_BYTES - sent;
+
+            spibus_transfer((double)burst * SPIBUS_LCD_NS_PER_BYTE);
+            sent += burst;
+        }
+        odroid_spibus_release(ODROID_SPIBUS_LCD);
+
+        double latency = now_ns() - start;
+        if (latency > maxLatency) maxLatency = latency;
+        if (spibus_sd_reads - reads > 1) ++interleaved;   // the card read during the update
+        ++updates;
+
+        double idle = SPIBUS_LCD_PERIOD_NS - (now_ns() - start);
+        if (idle > 0) spibus_transfer(idle);
+    }
+    xSemaphoreTake(spibus_sd_exited, portMAX_DELAY);
+
+    odroid_spibus_stats_t sd;
+    odroid_spibus_stats_t lcd;
+    odroid_spibus_get_stats(ODROID_SPIBUS_SD, &sd);
+    odroid_spibus_get_stats(ODROID_SPIBUS_LCD, &lcd);
+
+    // Bus time the work needs if nothing else used it
+    double sdBus = (double)SPIBUS_SD_BYTES * SPIBUS_SD_NS_PER_BYTE +
+        (double)(whole ? SPIBUS_SD_BYTES / ODROID_SDCARD_STREAM_CHUNK : sd.grants) * SPIBUS_SD_COMMAND_NS;
+
+    fprintf(stdout, "%-24s sd_kb_per_sec=%.0f sd_alone=%.0f%% sd_max_wait_us=%u lcd_max_latency_us=%.0f lcd_max_wait_us=%u interleaved=%d/%d\n",
+        name, SPIBUS_SD_BYTES / 1024 / (spibus_sd_time / 1e9), sdBus * 100 / spibus_sd_time,
+        (unsigned)sd.max_wait_us, maxLatency / 1e3, (unsigned)lcd.max_wait_us, interleaved, updates);
+}
+
+// Two card tasks (stream and tiles) and the LCD: every acquire must return
+#define SPIBUS_SHARED_TASKS (3)
+#define SPIBUS_SHARED_BURSTS (300)
+
+static SemaphoreHandle_t spibus_shared_exited;
+
+static void spibus_shared_task(void* arg)
+{
+    const odroid_spibus_client_t client = (odroid_spibus_client_t)(intptr_t)arg;
+
+    for (int i = 0; i < SPIBUS_SHARED_BURSTS; ++i)
+    {
+        odroid_spibus_acquire(client);
+        spibus_transfer(20000);
+        if (i % 2) odroid_spibus_yield(client);
+        spibus_transfer(20000);
+        odroid_spibus_release(client);
+    }
+
+    xSemaphoreGive(spibus_shared_exited);
+    vTaskDelete(NULL);
+}
+
+static void spibus_shared_bench()
+{
+    spibus_shared_exited = xSemaphoreCreateCounting(SPIBUS_SHARED_TASKS, 0);
+    odroid_spibus_reset_stats();
+
+    for (int i = 0; i < SPIBUS_SHARED_TASKS; ++i)
+    {
+        const odroid_spibus_client_t client = i ? ODROID_SPIBUS_SD : ODROID_SPIBUS_LCD;
+        if (xTaskCreatePinnedToCore(&spibus_shared_task, "shared", 4096, (void*)(intptr_t)client, 4, NULL, 1) != pdPASS) abort();
+    }
+
+    // A lost wakeup leaves a task blocked for good; it is left behind
+    int exited = 0;
+    while (exited < SPIBUS_SHARED_TASKS && xSemaphoreTake(spibus_shared_exited, 5000 / portTICK_PERIOD_MS) == pdTRUE) ++exited;
+
+    odroid_spibus_stats_t sd;
+    odroid_spibus_get_stats(ODROID_SPIBUS_SD, &sd);
+    const bool ok = exited == SPIBUS_SHARED_TASKS;
+
+    fprintf(stdout, "spibus_two_sd_tasks      exited=%d/%d sd_grants=%u sd_handovers=%u%s\n",
+        exited, SPIBUS_SHARED_TASKS, (unsigned)sd.grants, (unsigned)sd.handovers, ok ? "" : " WRONG");
+    if (!ok) golden_mismatch++;
+
+    if (ok) vSemaphoreDelete(spibus_shared_exited);
+}
+
+static void spibus_bench()
+{
+    odroid_spibus_init();
+    spibus_sd_exited = xSemaphoreCreateBinary();
+
+    spibus_model("spibus_whole_jobs", true, ODROID_SPIBUS_SD);
+    spibus_model("spibus_install", false, ODROID_SPIBUS_SD);
+    spibus_model("spibus_menu", false, ODROID_SPIBUS_LCD);
+
+    vSemaphoreDelete(spibus_sd_exited);
+
+    spibus_shared_bench();
+}
+
+
+// ---- storage benchmark
+// The menu's storage benchmark against a directory of the host and the file
+// backed flash, with a partition table that has one installed app after the
+// factory partition. The flash test must stay past that app.
+#define STORAGE_FACTORY_END (0x110000)
+#define STORAGE_APP_END (0x158000)
+
+static int storage_results;
+static int storage_failed;
+
+// Same line the firmware logs, which only reaches stderr with -v
+static void storage_result(const odroid_storagebench_result_t* result, void* arg)
+{
+    fprintf(stdout, "storage %s block=%u bytes=%u us=%u kb_per_sec=%u ok=%d\n", result->test,
+        (unsigned)result->block, (unsigned)result->bytes, (unsigned)result->us,
+        (unsigned)odroid_storagebench_kb_per_sec(result), result->ok ? 1 : 0);
+
+    ++storage_results;
+    if (!result->ok) ++storage_failed;
+}
+
+static void storage_table_write()
+{
+    esp_partition_info_t table[3];
+    memset(table, 0xff, sizeof(table));
+
+    table[0].magic = ESP_PARTITION_MAGIC;
+    table[0].type = PART_TYPE_APP;
+    table[0].subtype = PART_SUBTYPE_FACTORY;
+    table[0].pos.offset = 0x10000;
+    table[0].pos.size = STORAGE_FACTORY_END - 0x10000;
+
+    table[1].magic = ESP_PARTITION_MAGIC;
+    table[1].type = PART_TYPE_APP;
+    table[1].subtype = ESP_PARTITION_SUBTYPE_APP_OTA_0;
+    table[1].pos.offset = STORAGE_FACTORY_END;
+    table[1].pos.size = STORAGE_APP_END - STORAGE_FACTORY_END;
+
+    esp_flash_erase_region(NULL, ESP_PARTITION_TABLE_OFFSET, 4096);
+    esp_flash_write(NULL, table, ESP_PARTITION_TABLE_OFFSET, sizeof(table));
+}
+
+static void storage_run(const char* dir)
+{
+    storage_table_write();
+    odroid_sdcard_open(SD_CARD);
+
+    // The app's last sector, which the test must not touch
+    uint8_t sector[4096];
+    memset(sector, 0x5a, sizeof(sector));
+    esp_flash_erase_region(NULL, STORAGE_APP_END - sizeof(sector), sizeof(sector));
+    esp_flash_write(NULL, sector, STORAGE_APP_END - sizeof(sector), sizeof(sector));
+
+    const uint32_t address = flash_free_address();
+
+    storage_results = 0;
+    storage_failed = 0;
+    bool ok = odroid_storagebench_sd(dir, &storage_result, NULL);
+    ok = odroid_storagebench_flash(address, ODROID_STORAGEBENCH_FLASH_SIZE, &storage_result, NULL) && ok;
+
+    // Same again through the screen
+    ui_storagebench(dir);
+
+    uint8_t check[4096];
+    esp_flash_read(NULL, check, STORAGE_APP_END - sizeof(check), sizeof(check));
+    const bool intact = memcmp(check, sector, sizeof(check)) == 0;
+
+    ok = ok && intact && storage_failed == 0 && storage_results == 11 &&
+        address == ((STORAGE_APP_END + 0xffff) & 0xffff0000);
+
+    fprintf(stdout, "storage_bench            results=%d failed=%d free_flash=%#08x app_intact=%d%s\n",
+        storage_results, storage_failed, (unsigned)address, intact ? 1 : 0, ok ? "" : " WRONG");
+    if (!ok) golden_mismatch++;
+}
+
+static void storage_bench()
+{
+    char dir[64];
+    strcpy(dir, "/tmp/uguibench.storage.XXXXXX");
+    if (!mkdtemp(dir)) abort();
+
+    storage_run(dir);
+
+    char fileName[128];
+    sprintf(fileName, "%s/%s", dir, ODROID_STORAGEBENCH_FILE);
+    unlink(fileName);
+    rmdir(dir);
+}
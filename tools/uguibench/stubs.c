@@ -0,0 +1,717 @@
+#include "host.h"
+
+#include <string.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <unistd.h>
+#include <time.h>
+#include <errno.h>
+#include <stdarg.h>
+
+#include "../../main/odroid_display.h"
+#include "../../main/odroid_sdcard.h"
+#include "../../main/odroid_latency.h"
+#include "../../main/input.h"
+#include "diskio_impl.h"
+#include "ff.h"
+
+
+// Number of pixels sent to the (virtual) LCD
+size_t lcd_pixels = 0;
+size_t lcd_transfers = 0;
+
+
+void vTaskDelay(TickType_t ticks)
+{
+    usleep(ticks * portTICK_PERIOD_MS * 1000);
+}
+
+struct host_semaphore
+{
+    sem_t sem;
+};
+
+typedef struct
+{
+    TaskFunction_t func;
+    void* arg;
+} host_task_t;
+
+static void* host_task_entry(void* arg)
+{
+    host_task_t task = *(host_task_t*)arg;
+    free(arg);
+
+    task.func(task.arg);
+    return NULL;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t func, const char* name, uint32_t stack, void* arg, UBaseType_t priority, TaskHandle_t* handle, BaseType_t core)
+{
+    host_task_t* task = malloc(sizeof(host_task_t));
+    if (!task) return pdFALSE;
+
+    task->func = func;
+    task->arg = arg;
+
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, host_task_entry, task) != 0)
+    {
+        free(task);
+        return pdFALSE;
+    }
+
+    pthread_detach(thread);
+    if (handle) *handle = (TaskHandle_t)thread;
+
+    return pdPASS;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    SemaphoreHandle_t result = malloc(sizeof(struct host_semaphore));
+    if (result) sem_init(&result->sem, 0, 0);
+    return result;
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max, UBaseType_t initial)
+{
+    SemaphoreHandle_t result = malloc(sizeof(struct host_semaphore));
+    if (result) sem_init(&result->sem, 0, initial);
+    return result;
+}
+
+static struct timespec host_deadline(TickType_t ticks)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+
+    const uint64_t ns = (uint64_t)ticks * portTICK_PERIOD_MS * 1000000 + ts.tv_nsec;
+    ts.tv_sec += ns / 1000000000;
+    ts.tv_nsec = ns % 1000000000;
+    return ts;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks)
+{
+    if (ticks == portMAX_DELAY)
+    {
+        while (sem_wait(&sem->sem) != 0)
+        {
+        }
+        return pdTRUE;
+    }
+
+    const struct timespec deadline = host_deadline(ticks);
+    while (sem_timedwait(&sem->sem, &deadline) != 0)
+    {
+        if (errno == ETIMEDOUT) return pdFALSE;
+    }
+
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem)
+{
+    sem_post(&sem->sem);
+    return pdTRUE;
+}
+
+// Binary: a give while nobody took the last one does nothing
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t sem, BaseType_t* woken)
+{
+    int value;
+    sem_getvalue(&sem->sem, &value);
+    if (value == 0) sem_post(&sem->sem);
+
+    if (woken) *woken = pdFALSE;
+    return pdTRUE;
+}
+
+struct host_queue
+{
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+    uint8_t* items;
+    size_t item_size;
+    size_t length;
+    size_t head;
+    size_t count;
+};
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size)
+{
+    QueueHandle_t queue = calloc(1, sizeof(struct host_queue));
+    if (!queue) return NULL;
+
+    queue->items = malloc(length * item_size);
+    if (!queue->items) abort();
+
+    queue->item_size = item_size;
+    queue->length = length;
+    pthread_mutex_init(&queue->lock, NULL);
+    pthread_cond_init(&queue->changed, NULL);
+    return queue;
+}
+
+// Never waits for room
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticks)
+{
+    pthread_mutex_lock(&queue->lock);
+
+    const bool room = queue->count < queue->length;
+    if (room)
+    {
+        const size_t tail = (queue->head + queue->count) % queue->length;
+        memcpy(queue->items + tail * queue->item_size, item, queue->item_size);
+        ++queue->count;
+        pthread_cond_broadcast(&queue->changed);
+    }
+
+    pthread_mutex_unlock(&queue->lock);
+    return room ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t ticks)
+{
+    const struct timespec deadline = host_deadline(ticks == portMAX_DELAY ? 0 : ticks);
+
+    pthread_mutex_lock(&queue->lock);
+
+    while (queue->count == 0)
+    {
+        if (ticks == portMAX_DELAY)
+        {
+            pthread_cond_wait(&queue->changed, &queue->lock);
+        }
+        else if (pthread_cond_timedwait(&queue->changed, &queue->lock, &deadline) == ETIMEDOUT)
+        {
+            break;
+        }
+    }
+
+    const bool received = queue->count > 0;
+    if (received)
+    {
+        memcpy(item, queue->items + queue->head * queue->item_size, queue->item_size);
+        queue->head = (queue->head + 1) % queue->length;
+        --queue->count;
+    }
+
+    pthread_mutex_unlock(&queue->lock);
+    return received ? pdTRUE : pdFALSE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue)
+{
+    pthread_mutex_lock(&queue->lock);
+    const size_t count = queue->count;
+    pthread_mutex_unlock(&queue->lock);
+    return count;
+}
+
+BaseType_t xQueueReset(QueueHandle_t queue)
+{
+    pthread_mutex_lock(&queue->lock);
+    queue->head = 0;
+    queue->count = 0;
+    pthread_mutex_unlock(&queue->lock);
+    return pdPASS;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    SemaphoreHandle_t result = xSemaphoreCreateBinary();
+    if (result) sem_post(&result->sem);
+    return result;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem)
+{
+    sem_destroy(&sem->sem);
+    free(sem);
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+    if (task == NULL) pthread_exit(NULL);
+}
+
+uint32_t esp_get_free_heap_size(void)
+{
+    return 0;
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps)
+{
+    return 0;
+}
+
+size_t host_allocations;
+
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+
+void* __wrap_malloc(size_t size)
+{
+    __atomic_add_fetch(&host_allocations, 1, __ATOMIC_RELAXED);
+    return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t count, size_t size)
+{
+    __atomic_add_fetch(&host_allocations, 1, __ATOMIC_RELAXED);
+    return __real_calloc(count, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size)
+{
+    __atomic_add_fetch(&host_allocations, 1, __ATOMIC_RELAXED);
+    return __real_realloc(ptr, size);
+}
+
+size_t host_fopens;
+
+FILE* __real_fopen(const char* path, const char* mode);
+
+FILE* __wrap_fopen(const char* path, const char* mode)
+{
+    __atomic_add_fetch(&host_fopens, 1, __ATOMIC_RELAXED);
+    return __real_fopen(path, mode);
+}
+
+int host_verbose;
+
+int __wrap_printf(const char* format, ...)
+{
+    int ret = 0;
+    if (host_verbose)
+    {
+        va_list args;
+        va_start(args, format);
+        ret = vfprintf(stderr, format, args);
+        va_end(args);
+    }
+    return ret;
+}
+
+void esp_restart(void)
+{
+    printf("esp_restart called.\n");
+    abort();
+}
+
+esp_err_t nvs_flash_init(void)
+{
+    return ESP_OK;
+}
+
+const esp_partition_t* esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype, const char* label)
+{
+    return NULL;
+}
+
+void esp_partition_unload_all(void)
+{
+}
+
+esp_err_t esp_ota_set_boot_partition(const esp_partition_t* partition)
+{
+    return ESP_FAIL;
+}
+
+esp_err_t esp_flash_init(esp_flash_t* chip)
+{
+    return ESP_OK;
+}
+
+// The flash is a file. Erased bytes read 0xff and writes only clear bits.
+static FILE* host_flash;
+
+static FILE* host_flash_file()
+{
+    if (!host_flash)
+    {
+        host_flash = tmpfile();
+        if (!host_flash) abort();
+
+        uint8_t* erased = malloc(HOST_FLASH_ERASE_SIZE);
+        if (!erased) abort();
+        memset(erased, 0xff, HOST_FLASH_ERASE_SIZE);
+
+        for (uint32_t i = 0; i < HOST_FLASH_SIZE / HOST_FLASH_ERASE_SIZE; ++i)
+        {
+            if (fwrite(erased, 1, HOST_FLASH_ERASE_SIZE, host_flash) != HOST_FLASH_ERASE_SIZE) abort();
+        }
+
+        free(erased);
+    }
+
+    return host_flash;
+}
+
+esp_err_t esp_flash_get_size(esp_flash_t* chip, uint32_t* out_size)
+{
+    *out_size = HOST_FLASH_SIZE;
+    return ESP_OK;
+}
+
+esp_err_t esp_flash_read(esp_flash_t* chip, void* buffer, uint32_t address, uint32_t length)
+{
+    if (address > HOST_FLASH_SIZE || length > HOST_FLASH_SIZE - address) return ESP_FAIL;
+
+    FILE* file = host_flash_file();
+    if (fseek(file, address, SEEK_SET) != 0 || fread(buffer, 1, length, file) != length) return ESP_FAIL;
+
+    return ESP_OK;
+}
+
+esp_err_t esp_flash_write(esp_flash_t* chip, const void* buffer, uint32_t address, uint32_t length)
+{
+    uint8_t* data = malloc(length);
+    if (!data) abort();
+
+    esp_err_t result = esp_flash_read(chip, data, address, length);
+    if (result == ESP_OK)
+    {
+        for (uint32_t i = 0; i < length; ++i) data[i] &= ((const uint8_t*)buffer)[i];
+
+        FILE* file = host_flash_file();
+        if (fseek(file, address, SEEK_SET) != 0 || fwrite(data, 1, length, file) != length) result = ESP_FAIL;
+    }
+
+    free(data);
+    return result;
+}
+
+esp_err_t esp_flash_erase_region(esp_flash_t* chip, uint32_t start, uint32_t len)
+{
+    if (start % HOST_FLASH_ERASE_SIZE || len % HOST_FLASH_ERASE_SIZE) return ESP_FAIL;
+    if (start > HOST_FLASH_SIZE || len > HOST_FLASH_SIZE - start) return ESP_FAIL;
+
+    uint8_t erased[HOST_FLASH_ERASE_SIZE];
+    memset(erased, 0xff, sizeof(erased));
+
+    FILE* file = host_flash_file();
+    if (fseek(file, start, SEEK_SET) != 0) return ESP_FAIL;
+
+    for (uint32_t i = 0; i < len / HOST_FLASH_ERASE_SIZE; ++i)
+    {
+        if (fwrite(erased, 1, sizeof(erased), file) != sizeof(erased)) return ESP_FAIL;
+    }
+
+    return ESP_OK;
+}
+
+uint32_t crc32_le(uint32_t crc, const uint8_t* buf, uint32_t len)
+{
+    extern unsigned long crc32(unsigned long crc, const unsigned char* buf, unsigned int len);
+    return (uint32_t)crc32(crc, buf, len);
+}
+
+
+// display
+// Time per pixel sent, 0 = transfers take no time
+int host_lcd_ns_per_pixel = 0;
+
+static void host_lcd_transfer(size_t pixels)
+{
+    lcd_pixels += pixels;
+    ++lcd_transfers;
+
+    if (host_lcd_ns_per_pixel) usleep(pixels * host_lcd_ns_per_pixel / 1000);
+    odroid_latency_present();
+}
+
+void ili9341_init()
+{
+}
+
+void ili9341_write_frame(uint16_t* buffer)
+{
+    host_lcd_transfer(320 * 240);
+}
+
+void ili9341_write_frame_rectangle(short left, short top, short width, short height, uint16_t* buffer)
+{
+    host_lcd_transfer(width * height);
+}
+
+void ili9341_write_frame_rectangleLE(short left, short top, short width, short height, uint16_t* buffer)
+{
+    host_lcd_transfer(width * height);
+}
+
+void ili9341_clear(uint16_t color)
+{
+    host_lcd_transfer(320 * 240);
+}
+
+
+// gpio, for input.c
+#define HOST_GPIO_COUNT (40)
+static int host_gpio_levels[HOST_GPIO_COUNT];
+static gpio_isr_t host_gpio_handlers[HOST_GPIO_COUNT];
+static void* host_gpio_args[HOST_GPIO_COUNT];
+static pthread_mutex_t host_gpio_lock = PTHREAD_MUTEX_INITIALIZER;
+
+esp_err_t gpio_set_direction(gpio_num_t pin, int mode)
+{
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_pull_mode(gpio_num_t pin, int pull)
+{
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_intr_type(gpio_num_t pin, int type)
+{
+    return ESP_OK;
+}
+
+esp_err_t gpio_install_isr_service(int flags)
+{
+    return ESP_OK;
+}
+
+esp_err_t gpio_isr_handler_add(gpio_num_t pin, gpio_isr_t handler, void* arg)
+{
+    host_gpio_args[pin] = arg;
+    host_gpio_handlers[pin] = handler;
+    return ESP_OK;
+}
+
+int gpio_get_level(gpio_num_t pin)
+{
+    return !__atomic_load_n(&host_gpio_levels[pin], __ATOMIC_ACQUIRE);
+}
+
+void host_gpio_set(gpio_num_t pin, int level)
+{
+    // Stored inverted, so pins start high
+    pthread_mutex_lock(&host_gpio_lock);
+    const bool changed = gpio_get_level(pin) != level;
+    __atomic_store_n(&host_gpio_levels[pin], !level, __ATOMIC_RELEASE);
+    if (changed && host_gpio_handlers[pin]) host_gpio_handlers[pin](host_gpio_args[pin]);
+    pthread_mutex_unlock(&host_gpio_lock);
+}
+
+
+// sdcard
+sdmmc_card_t host_card = { { 0, 512 } };
+uint8_t* host_card_image;
+size_t host_card_reads;
+size_t host_card_seek;
+static size_t host_card_next;
+ff_diskio_impl_t host_diskio;
+
+esp_err_t esp_vfs_fat_sdspi_mount(const char* base_path, const sdmmc_host_t* host, const sdspi_device_config_t* slot, const esp_vfs_fat_sdmmc_mount_config_t* config, sdmmc_card_t** card)
+{
+    *card = &host_card;
+    return ESP_OK;
+}
+
+esp_err_t sdmmc_read_sectors(sdmmc_card_t* card, void* dst, size_t start_block, size_t block_count)
+{
+    if (start_block + block_count > card->csd.capacity) return ESP_FAIL;
+
+    memcpy(dst, host_card_image + start_block * card->csd.sector_size, block_count * card->csd.sector_size);
+    ++host_card_reads;
+    host_card_seek += start_block > host_card_next ? start_block - host_card_next : host_card_next - start_block;
+    host_card_next = start_block + block_count;
+    return ESP_OK;
+}
+
+esp_err_t sdmmc_write_sectors(sdmmc_card_t* card, const void* src, size_t start_block, size_t block_count)
+{
+    if (start_block + block_count > card->csd.capacity) return ESP_FAIL;
+
+    memcpy(host_card_image + start_block * card->csd.sector_size, src, block_count * card->csd.sector_size);
+    return ESP_OK;
+}
+
+void ff_diskio_register(BYTE pdrv, const ff_diskio_impl_t* discio_impl)
+{
+    host_diskio = *discio_impl;
+}
+
+BYTE ff_diskio_get_pdrv_card(const sdmmc_card_t* card)
+{
+    return 0;
+}
+
+esp_err_t esp_vfs_fat_sdmmc_unmount(void)
+{
+    return ESP_OK;
+}
+
+// FATFS
+FATFS host_fatfs = { 8, 64 };
+host_fat_file_t* host_fat_files;
+size_t host_fat_count;
+
+// Cluster of the byte at offset, 0 past the extents
+static DWORD host_fat_cluster(const host_fat_file_t* file, FSIZE_t offset)
+{
+    DWORD index = offset / (host_fatfs.csize * 512);
+    for (int i = 0; i < HOST_FAT_EXTENTS; ++i)
+    {
+        if (index < file->lengths[i]) return file->clusters[i] + index;
+        index -= file->lengths[i];
+    }
+    return 0;
+}
+
+FRESULT f_open(FIL* fp, const char* path, BYTE mode)
+{
+    for (size_t i = 0; i < host_fat_count; ++i)
+    {
+        if (strcmp(host_fat_files[i].path, path) != 0) continue;
+
+        fp->file = &host_fat_files[i];
+        fp->obj.fs = &host_fatfs;
+        fp->obj.sclust = fp->file->clusters[0];
+        fp->obj.objsize = fp->file->size;
+        fp->fptr = 0;
+        fp->clust = 0;
+        return FR_OK;
+    }
+    return FR_NO_FILE;
+}
+
+FRESULT f_close(FIL* fp)
+{
+    fp->file = NULL;
+    return FR_OK;
+}
+
+// As FATFS: clust is the cluster of the byte before the position
+FRESULT f_lseek(FIL* fp, FSIZE_t ofs)
+{
+    if (ofs > fp->obj.objsize) ofs = fp->obj.objsize;
+    fp->fptr = ofs;
+    fp->clust = ofs > 0 ? host_fat_cluster(fp->file, ofs - 1) : fp->obj.sclust;
+    return FR_OK;
+}
+
+FRESULT f_read(FIL* fp, void* buff, UINT btr, UINT* br)
+{
+    uint8_t sector[512];
+
+    *br = 0;
+    while (btr > 0 && fp->fptr < fp->obj.objsize)
+    {
+        const DWORD cluster = host_fat_cluster(fp->file, fp->fptr);
+        const DWORD lba = host_fatfs.database + (cluster - 2) * host_fatfs.csize + (fp->fptr / 512) % host_fatfs.csize;
+        if (host_diskio.read(0, sector, lba, 1) != RES_OK) return FR_DISK_ERR;
+
+        UINT count = 512 - fp->fptr % 512;
+        if (count > btr) count = btr;
+        if (count > fp->obj.objsize - fp->fptr) count = fp->obj.objsize - fp->fptr;
+
+        memcpy((uint8_t*)buff + *br, sector + fp->fptr % 512, count);
+        fp->fptr += count;
+        *br += count;
+        btr -= count;
+    }
+    return FR_OK;
+}
+
+void sdmmc_card_print_info(FILE* stream, const sdmmc_card_t* card)
+{
+}
+
+const char* esp_err_to_name(esp_err_t err)
+{
+    return "ESP_ERR";
+}
+
+int64_t esp_timer_get_time(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+struct host_timer
+{
+    esp_timer_create_args_t args;
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+    int64_t deadline;   // 0 = stopped
+};
+
+static void* host_timer_thread(void* arg)
+{
+    esp_timer_handle_t timer = arg;
+
+    pthread_mutex_lock(&timer->lock);
+    while (true)
+    {
+        if (!timer->deadline)
+        {
+            pthread_cond_wait(&timer->changed, &timer->lock);
+            continue;
+        }
+
+        const int64_t wait = timer->deadline - esp_timer_get_time();
+        if (wait > 0)
+        {
+            struct timespec until = host_deadline(0);
+            const uint64_t ns = (uint64_t)wait * 1000 + until.tv_nsec;
+            until.tv_sec += ns / 1000000000;
+            until.tv_nsec = ns % 1000000000;
+            pthread_cond_timedwait(&timer->changed, &timer->lock, &until);
+            continue;
+        }
+
+        timer->deadline = 0;
+        pthread_mutex_unlock(&timer->lock);
+        timer->args.callback(timer->args.arg);
+        pthread_mutex_lock(&timer->lock);
+    }
+
+    return NULL;
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t* args, esp_timer_handle_t* out_handle)
+{
+    esp_timer_handle_t timer = calloc(1, sizeof(struct host_timer));
+    if (!timer) return ESP_FAIL;
+
+    timer->args = *args;
+    pthread_mutex_init(&timer->lock, NULL);
+    pthread_cond_init(&timer->changed, NULL);
+
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, host_timer_thread, timer) != 0) abort();
+    pthread_detach(thread);
+
+    *out_handle = timer;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us)
+{
+    pthread_mutex_lock(&timer->lock);
+    const bool running = timer->deadline != 0;
+    if (!running)
+    {
+        timer->deadline = esp_timer_get_time() + (timeout_us ? timeout_us : 1);
+        pthread_cond_signal(&timer->changed);
+    }
+    pthread_mutex_unlock(&timer->lock);
+    return running ? ESP_FAIL : ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer)
+{
+    pthread_mutex_lock(&timer->lock);
+    const bool running = timer->deadline != 0;
+    timer->deadline = 0;
+    pthread_cond_signal(&timer->changed);
+    pthread_mutex_unlock(&timer->lock);
+    return running ? ESP_OK : ESP_FAIL;
+}
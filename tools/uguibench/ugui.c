@@ -0,0 +1,280 @@
+// uGUI primitives, blending and windows. Included from main.c.
+
+// ---- primitives
+static void scene_fill(int i)
+{
+    UG_FillFrame(0, 0, 319, 239, (UG_COLOR)(C_MIDNIGHT_BLUE + (i & 1)));
+}
+
+static void scene_fill_small(int i)
+{
+    for (int y = 0; y < 240; y += 16)
+    {
+        for (int x = 0; x < 320; x += 16)
+        {
+            UG_FillFrame(x, y, x + 7, y + 7, (UG_COLOR)(x * y + i));
+        }
+    }
+}
+
+static void scene_line(int i)
+{
+    for (int n = 0; n < 64; ++n)
+    {
+        UG_DrawLine(0, n * 3, 319, 239 - n * 3, (UG_COLOR)(n + i));
+        UG_DrawLine(n * 5, 0, 319 - n * 5, 239, (UG_COLOR)(n * 7 + i));
+    }
+}
+
+static void scene_frame(int i)
+{
+    for (int n = 0; n < 100; n += 4)
+    {
+        UG_DrawFrame(n, n, 319 - n, 239 - n, (UG_COLOR)(n + i));
+    }
+}
+
+static void scene_circle(int i)
+{
+    for (int r = 4; r < 119; r += 6)
+    {
+        UG_DrawCircle(160, 120, r, (UG_COLOR)(r + i));
+    }
+}
+
+static void scene_fill_circle(int i)
+{
+    UG_FillCircle(160, 120, 100, (UG_COLOR)(C_ORANGE + (i & 1)));
+}
+
+#define GLYPHS_PER_OP (0x7f - 0x21)
+
+static void scene_glyph(const UG_FONT* font, int i)
+{
+    // Span fonts write the framebuffer directly
+    scene_area = GLYPHS_PER_OP * font->char_width * font->char_height;
+
+    UG_FontSelect(font);
+    short x = 0;
+    short y = 0;
+    for (int c = 0x21; c < 0x7f; ++c)
+    {
+        if (x + font->char_width > 320)
+        {
+            x = 0;
+            y += font->char_height;
+        }
+        if (y + font->char_height > 240) y = 0;
+
+        UG_PutChar((char)c, x, y, C_BLACK, (UG_COLOR)(C_WHITE - (i & 1)));
+        x += font->char_width;
+    }
+}
+
+static void scene_glyph_8x12(int i) { scene_glyph(&FONT_8X12, i); }
+static void scene_glyph_22x36(int i) { scene_glyph(&FONT_22X36, i); }
+static void scene_glyph_32x53(int i) { scene_glyph(&FONT_32X53, i); }
+
+// Span fonts are unpacked back into a 1bpp bitmap font so both renderers
+// can be compared on the same glyphs.
+static UG_FONT bitmap_font;
+
+static size_t font_unpack(const UG_FONT* font, UG_FONT* out)
+{
+    const int stride = (font->char_width + 7) / 8;
+    const int glyphs = font->end_char - font->start_char + 1;
+    const int cell = stride * font->char_height;
+    unsigned char* bits = calloc(glyphs, cell);
+    if (!bits) abort();
+
+    size_t size = glyphs * 2;
+    for (int g = 0; g < glyphs; ++g)
+    {
+        const unsigned char* start = font->p + (font->p[g * 2] | (font->p[g * 2 + 1] << 8));
+        const unsigned char* d = start;
+        if (*d == 0xff)
+        {
+            d++;
+        }
+        else
+        {
+            int y = d[0];
+            int n = d[1];
+            const unsigned char* row = NULL;
+            d += 2;
+            while (n > 0)
+            {
+                int count = 1;
+                if (*d & 0x80)
+                {
+                    count = *d++ & 0x7f;
+                }
+                else
+                {
+                    row = d;
+                    d += 1 + d[0] * 2;
+                }
+
+                for (int r = 0; r < count; ++r, ++y)
+                {
+                    for (int s = 0; s < row[0]; ++s)
+                    {
+                        for (int x = row[1 + s * 2]; x < row[1 + s * 2] + row[2 + s * 2]; ++x)
+                        {
+                            bits[g * cell + y * stride + x / 8] |= 1 << (x % 8);
+                        }
+                    }
+                }
+                n -= count;
+            }
+        }
+
+        size += d - start;
+    }
+
+    *out = *font;
+    out->p = bits;
+    out->font_type = FONT_TYPE_1BPP;
+    return size;
+}
+
+static void scene_glyph_bitmap(int i) { scene_glyph(&bitmap_font, i); }
+
+static void font_compare(const char* name, const UG_FONT* font, scene_func span_scene)
+{
+    char scene[64];
+    if (font->font_type != FONT_TYPE_SPAN) return;
+
+    size_t span_size = font_unpack(font, &bitmap_font);
+    size_t bitmap_size = (font->end_char - font->start_char + 1) * ((font->char_width + 7) / 8) * font->char_height;
+
+    sprintf(scene, "%s_span", name);
+    unsigned long span_crc = run(scene, span_scene);
+    double span_ns = last_ns_per_op;
+
+    sprintf(scene, "%s_bitmap", name);
+    unsigned long bitmap_crc = run(scene, scene_glyph_bitmap);
+    double bitmap_ns = last_ns_per_op;
+
+    fprintf(stdout, "%s: bitmap=%zu bytes span=%zu bytes saved=%zu glyphs_per_sec bitmap=%.0f span=%.0f%s\n",
+        name, bitmap_size, span_size, bitmap_size - span_size,
+        GLYPHS_PER_OP * 1e9 / bitmap_ns, GLYPHS_PER_OP * 1e9 / span_ns,
+        span_crc == bitmap_crc ? "" : " OUTPUT DIFFERS");
+    if (span_crc != bitmap_crc) golden_mismatch++;
+
+    free((void*)bitmap_font.p);
+}
+
+static void scene_string(int i)
+{
+    UG_FontSelect(&FONT_8X12);
+    UG_SetForecolor(C_BLACK);
+    UG_SetBackcolor((UG_COLOR)(C_WHITE - (i & 1)));
+    for (int y = 0; y < 240 - 12; y += 13)
+    {
+        UG_PutString(0, y, "The quick brown fox jumps over the lazy dog");
+    }
+}
+
+static uint16_t bmp_data[64 * 64];
+static UG_BMP bmp = { bmp_data, 64, 64, BMP_BPP_16, BMP_RGB565 };
+
+static void scene_bmp(int i)
+{
+    for (int y = 0; y + 64 <= 240; y += 64)
+    {
+        for (int x = 0; x + 64 <= 320; x += 64)
+        {
+            UG_DrawBMP(x, y, &bmp);
+        }
+    }
+}
+
+static void scene_image(int i)
+{
+    scene_area = 320 * 192;
+    for (int y = 0; y + 64 <= 240; y += 64)
+    {
+        for (int x = 0; x + 64 <= 320; x += 64)
+        {
+            ui_draw_image(x, y, 64, 64, bmp_data);
+        }
+    }
+}
+
+// ---- blending
+static uint16_t screen_copy[320 * 240];
+static uint8_t alpha_data[64 * 64];
+
+static void scene_memcpy(int i)
+{
+    // Reference: the cost of touching every pixel once
+    scene_area = 320 * 240;
+    memcpy(fb, screen_copy, sizeof(fb));
+}
+
+static void scene_dim(int i)
+{
+    scene_area = 320 * 240;
+    if (i == 0) memcpy(fb, screen_copy, sizeof(fb));
+    UG_DimFrame(0, 0, 319, 239, 16);
+}
+
+static void scene_blend(int i)
+{
+    scene_area = 320 * 240;
+    if (i == 0) memcpy(fb, screen_copy, sizeof(fb));
+    UG_BlendFrame(0, 0, 319, 239, C_WHITE, 100);
+}
+
+static void scene_blend_odd(int i)
+{
+    // Odd start and width: exercises the single pixel edges
+    scene_area = 317 * 240;
+    if (i == 0) memcpy(fb, screen_copy, sizeof(fb));
+    UG_BlendFrame(1, 0, 317, 239, C_RED, 100);
+}
+
+static void scene_image_alpha(int i)
+{
+    scene_area = 320 * 192;
+    if (i == 0) memcpy(fb, screen_copy, sizeof(fb));
+    for (int y = 0; y + 64 <= 240; y += 64)
+    {
+        for (int x = 0; x + 64 <= 320; x += 64)
+        {
+            UG_DrawImageAlpha(x, y, 64, 64, bmp_data, alpha_data);
+        }
+    }
+}
+
+#define WINDOW_OBJECTS (4)
+static UG_WINDOW window;
+static UG_OBJECT window_objects[WINDOW_OBJECTS];
+static UG_BUTTON window_button;
+static UG_TEXTBOX window_textbox;
+
+static void window_callback(UG_MESSAGE* msg)
+{
+}
+
+static void scene_window(int i)
+{
+    UG_WindowCreate(&window, window_objects, WINDOW_OBJECTS, window_callback);
+    UG_WindowSetTitleText(&window, "Window");
+    UG_WindowSetTitleTextFont(&window, &FONT_8X12);
+    UG_WindowResize(&window, 20, 20, 299, 219);
+
+    UG_ButtonCreate(&window, &window_button, BTN_ID_0, 10, 10, 110, 60);
+    UG_ButtonSetFont(&window, BTN_ID_0, &FONT_8X12);
+    UG_ButtonSetText(&window, BTN_ID_0, "Button");
+
+    UG_TextboxCreate(&window, &window_textbox, TXB_ID_0, 10, 80, 250, 150);
+    UG_TextboxSetFont(&window, TXB_ID_0, &FONT_8X12);
+    UG_TextboxSetText(&window, TXB_ID_0, "Textbox");
+    UG_TextboxSetBackColor(&window, TXB_ID_0, (UG_COLOR)(C_WHITE - (i & 1)));
+
+    UG_WindowShow(&window);
+    UG_Update();
+    UG_WindowDelete(&window);
+}